@@ -1,7 +1,79 @@
 #include "LogManager.h"
+#include "../EclipseWalker/Profiler.h"
+#include "../EclipseWalker/CharacterBenchmark.h"
+#include "../EclipseWalker/NavigationBenchmark.h"
+#include "../EclipseWalker/CrowdBenchmark.h"
+#include "../EclipseWalker/SceneBVHBenchmark.h"
+#include "../EclipseWalker/TransformHierarchyBenchmark.h"
+#include "../EclipseWalker/TransformStorageBenchmark.h"
+#include "../EclipseWalker/MeshLoadBenchmark.h"
+#include "../EclipseWalker/VertexCompressionBenchmark.h"
+#include "../EclipseWalker/LodBenchmark.h"
+#include "../EclipseWalker/RenderQueueBenchmark.h"
+#include "../EclipseWalker/CommandStreamBenchmark.h"
+#include "../EclipseWalker/RenderGraphBenchmark.h"
+#include "../EclipseWalker/ShaderCacheBenchmark.h"
+#include "../EclipseWalker/FrustumCullingBenchmark.h"
+#include "../EclipseWalker/OcclusionBenchmark.h"
+#include "../EclipseWalker/CameraCollisionBenchmark.h"
+#include "../EclipseWalker/AnimationBenchmark.h"
+#include "../EclipseWalker/ParticleBenchmark.h"
+#include "../EclipseWalker/UploadRingBenchmark.h"
+#include "../EclipseWalker/UploadBatcherBenchmark.h"
+#include "../EclipseWalker/OffsetAllocatorBenchmark.h"
+#include <cstring>
+#include <string>
 
-int main()
+namespace
 {
+    //   +  ˻ (Ŭ̾Ʈ  ڵ, D3D   ͵)
+    struct BenchSuite
+    {
+        const char* Flag;
+        std::string (*Run)(bool* allValid);
+    };
+
+    const BenchSuite BenchSuites[] =
+    {
+        { "--bench-movement",        CharacterBenchmark::RunDefaultSuite },          // ̵  (ĳ Ʈѷ)
+        { "--bench-navigation",      NavigationBenchmark::RunDefaultSuite },         // ׺޽  +   û
+        { "--bench-crowd",           CrowdBenchmark::RunDefaultSuite },              //   ȸ
+        { "--bench-bvh",             SceneBVHBenchmark::RunDefaultSuite },
+        { "--bench-hierarchy",       TransformHierarchyBenchmark::RunDefaultSuite },
+        { "--bench-transform",       TransformStorageBenchmark::RunDefaultSuite },
+        { "--bench-meshload",        MeshLoadBenchmark::RunDefaultSuite },           // ӽ   
+        { "--bench-vertex",          VertexCompressionBenchmark::RunDefaultSuite },
+        { "--bench-lod",             LodBenchmark::RunDefaultSuite },
+        { "--bench-renderqueue",     RenderQueueBenchmark::RunDefaultSuite },
+        { "--bench-commandstream",   CommandStreamBenchmark::RunDefaultSuite },
+        { "--bench-rendergraph",     RenderGraphBenchmark::RunDefaultSuite },
+        { "--bench-shadercache",     ShaderCacheBenchmark::RunDefaultSuite },        // ӽ   
+        { "--bench-frustum",         FrustumCullingBenchmark::RunDefaultSuite },
+        { "--bench-occlusion",       OcclusionBenchmark::RunDefaultSuite },
+        { "--bench-camera",          CameraCollisionBenchmark::RunDefaultSuite },
+        { "--bench-animation",       AnimationBenchmark::RunDefaultSuite },
+        { "--bench-particle",        ParticleBenchmark::RunDefaultSuite },
+        { "--bench-uploadring",      UploadRingBenchmark::RunDefaultSuite },
+        { "--bench-uploadbatch",     UploadBatcherBenchmark::RunDefaultSuite },
+        { "--bench-offsetallocator", OffsetAllocatorBenchmark::RunDefaultSuite },
+    };
+
+    //  ǥ α׷ , Ʋ   false
+    bool RunBenchSuite(const BenchSuite& suite)
+    {
+        bool valid = false;
+        const std::string report = suite.Run(&valid);
+        LOG_INFO("%s", report.c_str());
+        if (!valid)
+            LOG_ERROR("%s ˻ ", suite.Flag);
+        return valid;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    PROFILE_THREAD("Server Main");
+
     LogManager::GetInstance()->Initialize();
 
     LOG_INFO(" ʱȭ ...");
@@ -21,6 +93,30 @@ int main()
     char packet[5] = { 0x01, 0x02, 0xFF, 0xAA, 0xBB };
     LOG_HEX("̵ Ŷ", packet, 5);
 
+    //  : --bench-≮>  BenchSuites ϳ, --bench-all  
+    // ˻翡  ǥ ϳ   ڵ 1 (  ״  ó)
+    int exitCode = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool all = std::strcmp(argv[i], "--bench-all") == 0;
+        bool matched = all;
+        for (const BenchSuite& suite : BenchSuites)
+        {
+            if (!all && std::strcmp(argv[i], suite.Flag) != 0)
+                continue;
+
+            matched = true;
+            if (!RunBenchSuite(suite))
+                exitCode = 1;
+        }
+
+        if (!matched && std::strncmp(argv[i], "--bench-", 8) == 0)
+        {
+            LOG_ERROR("   ġũ: %s", argv[i]);
+            exitCode = 1;
+        }
+    }
+
     LogManager::GetInstance()->Finalize();
-    return 0;
+    return exitCode;
 }
\ No newline at end of file
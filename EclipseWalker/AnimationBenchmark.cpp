@@ -0,0 +1,450 @@
+#include "AnimationBenchmark.h"
+#include "BlendTree.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float Dt = 1.0f / 30.0f;
+    constexpr float Pi = 3.14159265f;
+    constexpr std::uint32_t ParallelGrain = 16;     // ĳ
+    constexpr std::uint32_t CheckedSamples = 256;
+
+    //   (Ŭ  ũⰡ ٸ)
+    enum class Part { Pelvis, Spine, Head, Face, Arm, Finger, Leg };
+
+    struct Rig
+    {
+        Skeleton Bones;
+        std::vector<Part> Parts;
+        std::vector<float> Axis;    //    (x, y, z)
+        std::vector<float> Offset;  //  
+    };
+
+    void AddJoint(Rig& rig, std::uint32_t parent, Part part, float x, float y, float z)
+    {
+        JointTransform bind;
+        bind.Translation[0] = x; bind.Translation[1] = y; bind.Translation[2] = z;
+        rig.Bones.AddJoint(parent, bind);
+        rig.Parts.push_back(part);
+    }
+
+    // 1 + 3 (ô) + 2 (, Ӹ) + 12 () + 2 x 19 () + 2 x 4 (ٸ) = 64 
+    void BuildRig(Rig& rig, std::mt19937& rng)
+    {
+        AddJoint(rig, Skeleton::NoParent, Part::Pelvis, 0.0f, 1.0f, 0.0f);
+        std::uint32_t spine = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            AddJoint(rig, spine, Part::Spine, 0.0f, 0.15f, 0.0f);
+            spine = rig.Bones.GetJointCount() - 1;
+        }
+        AddJoint(rig, spine, Part::Head, 0.0f, 0.12f, 0.0f);
+        AddJoint(rig, rig.Bones.GetJointCount() - 1, Part::Head, 0.0f, 0.12f, 0.0f);
+        const std::uint32_t head = rig.Bones.GetJointCount() - 1;
+        for (int i = 0; i < 12; ++i)
+            AddJoint(rig, head, Part::Face, 0.02f * (i % 4) - 0.03f, 0.05f + 0.02f * (i / 4), 0.08f);
+
+        for (float side : { -1.0f, 1.0f })
+        {
+            AddJoint(rig, spine, Part::Arm, side * 0.08f, 0.1f, 0.0f);
+            AddJoint(rig, rig.Bones.GetJointCount() - 1, Part::Arm, side * 0.15f, 0.0f, 0.0f);
+            AddJoint(rig, rig.Bones.GetJointCount() - 1, Part::Arm, side * 0.28f, 0.0f, 0.0f);
+            AddJoint(rig, rig.Bones.GetJointCount() - 1, Part::Arm, side * 0.25f, 0.0f, 0.0f);
+            const std::uint32_t hand = rig.Bones.GetJointCount() - 1;
+            for (int finger = 0; finger < 5; ++finger)
+            {
+                std::uint32_t parent = hand;
+                for (int bone = 0; bone < 3; ++bone)
+                {
+                    AddJoint(rig, parent, Part::Finger, side * (bone == 0 ? 0.08f : 0.03f), 0.0f, bone == 0 ? 0.02f * (finger - 2) : 0.0f);
+                    parent = rig.Bones.GetJointCount() - 1;
+                }
+            }
+        }
+
+        for (float side : { -1.0f, 1.0f })
+        {
+            AddJoint(rig, 0, Part::Leg, side * 0.1f, -0.05f, 0.0f);
+            AddJoint(rig, rig.Bones.GetJointCount() - 1, Part::Leg, 0.0f, -0.45f, 0.0f);
+            AddJoint(rig, rig.Bones.GetJointCount() - 1, Part::Leg, 0.0f, -0.42f, 0.0f);
+            AddJoint(rig, rig.Bones.GetJointCount() - 1, Part::Leg, 0.0f, -0.05f, 0.12f);
+        }
+        rig.Bones.Finalize();
+
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        for (std::uint32_t j = 0; j < rig.Bones.GetJointCount(); ++j)
+        {
+            float axis[3] = { 1.0f, 0.3f * unit(rng), 0.3f * unit(rng) };
+            const float len = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+            for (float a : axis)
+                rig.Axis.push_back(a / len);
+            rig.Offset.push_back(Pi * unit(rng));
+        }
+    }
+
+    // ֱ Ŭ (  = ù ). amplitude[part] =   ()
+    struct ClipShape
+    {
+        float Duration;
+        float Amplitude[7];     // Part 
+        float Bob;              //  Ʒ (m)
+        float Breath;           // ô 
+    };
+
+    RawAnimationClip MakeClip(const Rig& rig, const ClipShape& shape)
+    {
+        RawAnimationClip raw;
+        raw.JointCount = rig.Bones.GetJointCount();
+        raw.SampleRate = 30.0f;
+        const std::uint32_t frames = (std::uint32_t)std::lround(shape.Duration * raw.SampleRate) + 1;
+        raw.Frames.resize(frames * raw.JointCount);
+
+        for (std::uint32_t f = 0; f < frames; ++f)
+        {
+            const float phase = 2.0f * Pi * f / (frames - 1);
+            for (std::uint32_t j = 0; j < raw.JointCount; ++j)
+            {
+                JointTransform& t = raw.Frames[f * raw.JointCount + j];
+                t = rig.Bones.GetBindLocal(j);
+
+                // ⺻ ֱ +  (   īο κ)
+                const float amplitude = shape.Amplitude[(int)rig.Parts[j]];
+                const float angle = amplitude * (std::sin(phase + rig.Offset[j]) + 0.3f * std::sin(2.0f * phase + 2.0f * rig.Offset[j]));
+                const float s = std::sin(0.5f * angle), c = std::cos(0.5f * angle);
+                t.Rotation[0] = rig.Axis[j * 3 + 0] * s;
+                t.Rotation[1] = rig.Axis[j * 3 + 1] * s;
+                t.Rotation[2] = rig.Axis[j * 3 + 2] * s;
+                t.Rotation[3] = c;
+
+                if (rig.Parts[j] == Part::Pelvis)
+                    t.Translation[1] += shape.Bob * std::sin(2.0f * phase);
+                if (rig.Parts[j] == Part::Spine)
+                    t.Scale[0] = t.Scale[2] = 1.0f + shape.Breath * std::sin(phase);
+            }
+        }
+        return raw;
+    }
+
+    // ---------------------------------------------------------
+    // Į  (˻)
+    // ---------------------------------------------------------
+    void ToMatrix(const JointTransform& t, float m[16])
+    {
+        const float* q = t.Rotation;
+        const float* s = t.Scale;
+        const float r[16] =
+        {
+            s[0] * (1.0f - 2.0f * (q[1] * q[1] + q[2] * q[2])), s[0] * (2.0f * (q[0] * q[1] + q[3] * q[2])), s[0] * (2.0f * (q[0] * q[2] - q[3] * q[1])), 0.0f,
+            s[1] * (2.0f * (q[0] * q[1] - q[3] * q[2])), s[1] * (1.0f - 2.0f * (q[0] * q[0] + q[2] * q[2])), s[1] * (2.0f * (q[1] * q[2] + q[3] * q[0])), 0.0f,
+            s[2] * (2.0f * (q[0] * q[2] + q[3] * q[1])), s[2] * (2.0f * (q[1] * q[2] - q[3] * q[0])), s[2] * (1.0f - 2.0f * (q[0] * q[0] + q[1] * q[1])), 0.0f,
+            t.Translation[0], t.Translation[1], t.Translation[2], 1.0f,
+        };
+        std::memcpy(m, r, sizeof(r));
+    }
+
+    void Multiply(const float a[16], const float b[16], float out[16])
+    {
+        float r[16];
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+                r[i * 4 + j] = a[i * 4 + 0] * b[0 + j] + a[i * 4 + 1] * b[4 + j] + a[i * 4 + 2] * b[8 + j] + a[i * 4 + 3] * b[12 + j];
+        }
+        std::memcpy(out, r, sizeof(r));
+    }
+
+    //    (θ )
+    void ReferenceModel(const Skeleton& skeleton, const JointTransform* local, std::vector<Float4x4A>& out)
+    {
+        out.resize(skeleton.GetJointCount());
+        for (std::uint32_t j = 0; j < skeleton.GetJointCount(); ++j)
+        {
+            ToMatrix(local[j], out[j].M);
+            if (skeleton.GetParent(j) != Skeleton::NoParent)
+                Multiply(out[j].M, out[skeleton.GetParent(j)].M, out[j].M);
+        }
+    }
+
+    float RotationAngle(const float a[4], const float b[4])
+    {
+        const double dot = std::fabs((double)a[0] * b[0] + (double)a[1] * b[1] + (double)a[2] * b[2] + (double)a[3] * b[3]);
+        return (float)(2.0 * std::acos(std::min(1.0, dot)));
+    }
+
+    float MaxDifference(const float* a, const float* b, std::uint32_t count)
+    {
+        float worst = 0.0f;
+        for (std::uint32_t i = 0; i < count; ++i)
+            worst = std::max(worst, std::fabs(a[i] - b[i]));
+        return worst;
+    }
+
+    // ---------------------------------------------------------
+    // 1.   (  ð, θ  ĳ÷)
+    // ---------------------------------------------------------
+    void CheckCompression(const Skeleton& skeleton, const RawAnimationClip& raw, const AnimationClip& clip, AnimationBenchmarkResult& result)
+    {
+        const std::uint32_t joints = skeleton.GetJointCount();
+        AnimationSamplingCache cache;
+        std::vector<SoaTransform> pose(skeleton.GetSoaCount());
+        std::vector<JointTransform> sampled(joints);
+        std::vector<Float4x4A> rawModel, model;
+
+        for (std::uint32_t f = 0; f < raw.GetFrameCount(); ++f)
+        {
+            clip.Sample(f / raw.SampleRate, cache, pose.data());
+            const JointTransform* source = &raw.Frames[f * joints];
+            for (std::uint32_t j = 0; j < joints; ++j)
+            {
+                AnimationPose::GetJoint(pose.data(), j, sampled[j]);
+                for (int c = 0; c < 3; ++c)
+                    result.MaxTranslationError = std::max(result.MaxTranslationError, std::fabs(sampled[j].Translation[c] - source[j].Translation[c]));
+                result.MaxRotationError = std::max(result.MaxRotationError, RotationAngle(sampled[j].Rotation, source[j].Rotation));
+            }
+
+            ReferenceModel(skeleton, source, rawModel);
+            ReferenceModel(skeleton, sampled.data(), model);
+            for (std::uint32_t j = 0; j < joints; ++j)
+            {
+                const float dx = model[j].M[12] - rawModel[j].M[12];
+                const float dy = model[j].M[13] - rawModel[j].M[13];
+                const float dz = model[j].M[14] - rawModel[j].M[14];
+                result.MaxModelError = std::max(result.MaxModelError, std::sqrt(dx * dx + dy * dy + dz * dz));
+            }
+        }
+    }
+
+    // ---------------------------------------------------------
+    // 2. SIMD = Į (ø,  )
+    // ---------------------------------------------------------
+    void CheckSampling(const Skeleton& skeleton, const AnimationClip& clip, std::mt19937& rng, AnimationBenchmarkResult& result)
+    {
+        const std::uint32_t joints = skeleton.GetJointCount();
+        std::uniform_real_distribution<float> time(-0.1f, clip.GetDuration() + 0.1f);
+        AnimationSamplingCache cache;
+        std::vector<SoaTransform> pose(skeleton.GetSoaCount());
+        std::vector<JointTransform> sampled(joints);
+        std::vector<Float4x4A> model(joints), reference;
+
+        for (std::uint32_t n = 0; n < CheckedSamples; ++n)
+        {
+            const float t = time(rng);
+            clip.Sample(t, cache, pose.data());
+            for (std::uint32_t j = 0; j < joints; ++j)
+            {
+                JointTransform scalar;
+                clip.SampleJoint(j, t, scalar);
+                AnimationPose::GetJoint(pose.data(), j, sampled[j]);
+                const float diff = std::max({ MaxDifference(scalar.Translation, sampled[j].Translation, 3),
+                    MaxDifference(scalar.Rotation, sampled[j].Rotation, 4), MaxDifference(scalar.Scale, sampled[j].Scale, 3) });
+                if (diff > 1e-5f)
+                    ++result.SampleMismatches;
+            }
+
+            AnimationPose::LocalToModel(skeleton, pose.data(), model.data());
+            ReferenceModel(skeleton, sampled.data(), reference);
+            for (std::uint32_t j = 0; j < joints; ++j)
+            {
+                if (MaxDifference(model[j].M, reference[j].M, 16) > 1e-4f)
+                    ++result.ModelMismatches;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------
+    // 3. ε ȷƮ = ׵, ΰ  = Ŭ ϳ
+    // ---------------------------------------------------------
+    void CheckBlending(const Skeleton& skeleton, const BlendTree& tree, const std::vector<float>& thresholds,
+        const std::vector<AnimationClip>& clips, AnimationBenchmarkResult& result)
+    {
+        const std::uint32_t joints = skeleton.GetJointCount();
+        const Float4x4A identity = Float4x4A::Identity();
+        std::vector<Float4x4A> model(joints);
+        std::vector<SkinningMatrix> palette(joints);
+        AnimationPose::LocalToModel(skeleton, skeleton.GetBindPose(), model.data());
+        AnimationPose::BuildSkinningPalette(skeleton, model.data(), palette.data());
+        for (std::uint32_t j = 0; j < joints; ++j)
+        {
+            for (int r = 0; r < 3; ++r)
+            {
+                for (int c = 0; c < 4; ++c)
+                    result.BindPaletteError = std::max(result.BindPaletteError, std::fabs(palette[j].Rows[r * 4 + c] - identity.M[c * 4 + r]));
+            }
+        }
+
+        std::vector<SoaTransform> expected(skeleton.GetSoaCount());
+        for (std::size_t k = 0; k < clips.size(); ++k)
+        {
+            BlendTreeInstance instance(tree, skeleton);
+            instance.SetParameter(0, thresholds[k]);
+            instance.SetPhase(0.37f);
+            instance.Evaluate();
+
+            AnimationSamplingCache cache;
+            clips[k].Sample(0.37f * clips[k].GetDuration(), cache, expected.data());
+            for (std::uint32_t j = 0; j < joints; ++j)
+            {
+                JointTransform a, b;
+                AnimationPose::GetJoint(instance.GetLocalPose(), j, a);
+                AnimationPose::GetJoint(expected.data(), j, b);
+                const float diff = std::max({ MaxDifference(a.Translation, b.Translation, 3),
+                    MaxDifference(a.Rotation, b.Rotation, 4), MaxDifference(a.Scale, b.Scale, 3) });
+                if (diff > 1e-6f)
+                    ++result.BlendMismatches;
+            }
+        }
+    }
+}
+
+namespace AnimationBenchmark
+{
+    AnimationBenchmarkResult Run(std::uint32_t characters, std::uint32_t ticks, std::uint32_t seed)
+    {
+        AnimationBenchmarkResult result;
+        result.Characters = characters;
+        result.Ticks = ticks;
+
+        JobSystem* jobs = JobSystem::GetInstance();
+        jobs->Initialize();
+        result.Threads = jobs->GetThreadCount();
+
+        // 1. ̷ + Ŭ  ( 2 , ȱ 1 , ٱ 0.6 ) 
+        std::mt19937 rng(seed);
+        Rig rig;
+        BuildRig(rig, rng);
+        const Skeleton& skeleton = rig.Bones;
+        result.Joints = skeleton.GetJointCount();
+
+        //                    ô   Ӹ          հ ٸ
+        const ClipShape shapes[] =
+        {
+            { 2.0f, { 0.02f, 0.03f, 0.05f, 0.0f, 0.05f, 0.0f, 0.02f }, 0.005f, 0.01f },
+            { 1.0f, { 0.08f, 0.06f, 0.05f, 0.0f, 0.35f, 0.1f, 0.6f }, 0.03f, 0.0f },
+            { 0.6f, { 0.15f, 0.12f, 0.08f, 0.0f, 0.7f, 0.2f, 1.1f }, 0.06f, 0.0f },
+        };
+        const std::vector<float> thresholds = { 0.0f, 1.5f, 4.0f };   // m/s
+
+        std::vector<RawAnimationClip> raws;
+        std::vector<AnimationClip> clips;
+        std::uint32_t rawKeys = 0, keys = 0;
+        for (const ClipShape& shape : shapes)
+        {
+            AnimationCompressionStats stats;
+            raws.push_back(MakeClip(rig, shape));
+            clips.push_back(AnimationClip::Compress(raws.back(), AnimationCompressionSettings(), &stats));
+            result.RawKB += stats.RawBytes / 1024.0;
+            result.CompressedKB += stats.CompressedBytes / 1024.0;
+            rawKeys += stats.RawKeys;
+            keys += stats.Keys;
+        }
+        result.KeyRatio = (double)keys / std::max(rawKeys, 1u);
+
+        BlendTree tree;
+        std::vector<BlendTree::NodeIndex> leaves;
+        for (const AnimationClip& clip : clips)
+            leaves.push_back(tree.AddClip(clip));
+        tree.SetRoot(tree.AddBlend1D(0, leaves, thresholds));
+
+        // 2. ˻
+        for (std::size_t k = 0; k < clips.size(); ++k)
+        {
+            CheckCompression(skeleton, raws[k], clips[k], result);
+            CheckSampling(skeleton, clips[k], rng, result);
+        }
+        CheckBlending(skeleton, tree, thresholds, clips, result);
+
+        // 3. ĳ: ӵ õõ ٲ  ~ ٱ ̸ .   /  ý    
+        std::uniform_real_distribution<float> speed(0.0f, 5.0f), unit(0.0f, 1.0f), accel(-1.0f, 1.0f);
+        std::vector<std::unique_ptr<BlendTreeInstance>> serial, parallel;
+        std::vector<float> speeds(characters);
+        for (std::uint32_t i = 0; i < characters; ++i)
+        {
+            serial.push_back(std::make_unique<BlendTreeInstance>(tree, skeleton));
+            parallel.push_back(std::make_unique<BlendTreeInstance>(tree, skeleton));
+            const float phase = unit(rng);
+            serial.back()->SetPhase(phase);
+            parallel.back()->SetPhase(phase);
+            speeds[i] = speed(rng);
+        }
+
+        auto update = [](BlendTreeInstance& instance, float value)
+        {
+            instance.SetParameter(0, value);
+            instance.Advance(Dt);
+            instance.Evaluate();
+        };
+
+        double serialMs = 0.0, parallelMs = 0.0;
+        for (std::uint32_t tick = 0; tick < ticks; ++tick)
+        {
+            for (float& s : speeds)
+                s = std::clamp(s + accel(rng) * 4.0f * Dt, 0.0f, 5.0f);
+
+            auto t0 = Clock::now();
+            for (std::uint32_t i = 0; i < characters; ++i)
+                update(*serial[i], speeds[i]);
+            auto t1 = Clock::now();
+            jobs->ParallelFor(characters, ParallelGrain, [&](std::uint32_t begin, std::uint32_t end)
+            {
+                for (std::uint32_t i = begin; i < end; ++i)
+                    update(*parallel[i], speeds[i]);
+            });
+            auto t2 = Clock::now();
+            serialMs += ElapsedMs(t0, t1);
+            parallelMs += ElapsedMs(t1, t2);
+
+            for (std::uint32_t i = 0; i < characters; ++i)
+            {
+                if (std::memcmp(serial[i]->GetPalette().data(), parallel[i]->GetPalette().data(), result.Joints * sizeof(SkinningMatrix)) != 0)
+                    ++result.ParallelMismatches;
+            }
+        }
+
+        const double updates = (double)characters * std::max(ticks, 1u);
+        result.CharacterUs = serialMs * 1000.0 / updates;
+        result.CharactersPerMs = serialMs > 0.0 ? updates / serialMs : 0.0;
+        result.CharactersPerMsParallel = parallelMs > 0.0 ? updates / parallelMs : 0.0;
+
+        result.Valid = result.SampleMismatches == 0 && result.ModelMismatches == 0 && result.BlendMismatches == 0 &&
+            result.ParallelMismatches == 0 && result.BindPaletteError < 1e-4f && result.MaxModelError < 0.005f;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[AnimationBenchmark]\n";
+        report += "  chars joints  clipKB(raw->cmp)  keys(%)  char(us)  chars/ms  chars/ms(xN)  err(mm)  rot(deg)  valid\n";
+
+        bool valid = true;
+        for (std::uint32_t count : { 100u, 1000u, 4000u })
+        {
+            AnimationBenchmarkResult r = Run(count, 60);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%7u %6u %8.1f -> %5.1f %8.1f %9.2f %9.1f %13.1f %8.2f %9.3f  %s\n",
+                r.Characters, r.Joints, r.RawKB, r.CompressedKB, r.KeyRatio * 100.0, r.CharacterUs,
+                r.CharactersPerMs, r.CharactersPerMsParallel, r.MaxModelError * 1000.0f,
+                r.MaxRotationError * 57.2957795f, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ִϸ̼ Ÿ  (߿, 帮)
+//   ̷ (64 )  ڵ  ֱ Ŭ  (, ȱ, ٱ)  ؼ ư,
+// ӵ Ķͷ    Ʈ ĳ characters  30 Hz  ticks ƽ 
+// (  + ø +  +   + Ű ȷƮ)
+//  Ȯ:
+//   1.  :  Ӹ  ̵/ȸ,    ġ
+//   2. SIMD ø = Į ø (  ð ĳ ǰ), SIMD   = Į  
+//   3. ε  ȷƮ = ׵, ĶͰ ΰ̸   =  Ŭ ϳ
+//   4. ĳ   ýۿ  ȷƮ =   ȷƮ (Ʈ )
+// ==========================================================
+
+struct AnimationBenchmarkResult
+{
+    std::uint32_t Characters = 0;
+    std::uint32_t Joints = 0;
+    std::uint32_t Ticks = 0;
+    std::uint32_t Threads = 0;
+
+    double RawKB = 0.0;                 // Ŭ 
+    double CompressedKB = 0.0;
+    double KeyRatio = 0.0;              //  Ű /  Ű
+
+    double CharacterUs = 0.0;           //  , ĳ ϳ  ƽ
+    double CharactersPerMs = 0.0;       //  ھ
+    double CharactersPerMsParallel = 0.0;
+
+    float MaxTranslationError = 0.0f;   // m
+    float MaxRotationError = 0.0f;      // 
+    float MaxModelError = 0.0f;         // m (   ġ)
+
+    std::uint32_t SampleMismatches = 0;
+    std::uint32_t ModelMismatches = 0;
+    std::uint32_t BlendMismatches = 0;
+    std::uint32_t ParallelMismatches = 0;
+    float BindPaletteError = 0.0f;
+    bool Valid = false;
+};
+
+namespace AnimationBenchmark
+{
+    AnimationBenchmarkResult Run(std::uint32_t characters, std::uint32_t ticks, std::uint32_t seed = 49);
+
+    // 100 / 1000 / 4000  x 60 ƽ
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,437 @@
+#include "AnimationClip.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <initializer_list>
+#include <immintrin.h>
+
+namespace
+{
+    constexpr float RotationRange = 0.70710678f;                //  ū    [-1/sqrt2, 1/sqrt2]
+    constexpr float RotationStep = 2.0f * RotationRange / 32767.0f;
+
+    // ---------------------------------------------------------
+    // Ű ̱
+    // error(a, b, f) = Ű a, b   f    
+    // ---------------------------------------------------------
+    template <typename ErrorFn>
+    void ReduceKeys(std::uint32_t frameCount, float tolerance, ErrorFn error, std::vector<std::uint16_t>& outKeys)
+    {
+        outKeys.clear();
+        outKeys.push_back(0);
+
+        // 1. ù Ű ϳ    ̸ 
+        bool constant = true;
+        for (std::uint32_t f = 1; f < frameCount && constant; ++f)
+            constant = error(0, 0, f) <= tolerance;
+        if (constant)
+            return;
+
+        // 2.  [a, b]  ø    ø
+        std::uint32_t a = 0;
+        while (a + 1 < frameCount)
+        {
+            std::uint32_t b = a + 1;
+            for (std::uint32_t c = a + 2; c < frameCount; ++c)
+            {
+                bool fits = true;
+                for (std::uint32_t f = a + 1; f < c && fits; ++f)
+                    fits = error(a, c, f) <= tolerance;
+                if (!fits)
+                    break;
+                b = c;
+            }
+            outKeys.push_back((std::uint16_t)b);
+            a = b;
+        }
+    }
+
+    double Alpha(std::uint32_t a, std::uint32_t b, std::uint32_t f)
+    {
+        return b > a ? (double)(f - a) / (double)(b - a) : 0.0;
+    }
+
+    // 16 Ʈ x 3 ȸ ( ū  ȣ    ֻ Ʈ)
+    void QuantizeRotation(const float q[4], std::uint16_t out[3])
+    {
+        std::uint32_t largest = 0;
+        for (std::uint32_t c = 1; c < 4; ++c)
+        {
+            if (std::fabs(q[c]) > std::fabs(q[largest]))
+                largest = c;
+        }
+        const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+        std::uint32_t n = 0;
+        for (std::uint32_t c = 0; c < 4; ++c)
+        {
+            if (c == largest)
+                continue;
+            const float v = std::clamp(q[c] * sign, -RotationRange, RotationRange);
+            out[n++] = (std::uint16_t)std::lround((v + RotationRange) / RotationStep);
+        }
+        out[0] |= (std::uint16_t)((largest >> 1) << 15);
+        out[1] |= (std::uint16_t)((largest & 1) << 15);
+    }
+
+    void DequantizeRotation(const std::uint16_t in[3], float q[4])
+    {
+        const std::uint32_t largest = ((in[0] >> 15) << 1) | (in[1] >> 15);
+        float rest[3];
+        for (int c = 0; c < 3; ++c)
+            rest[c] = (in[c] & 0x7FFF) * RotationStep - RotationRange;
+        const float d = std::sqrt(std::max(0.0f, 1.0f - rest[0] * rest[0] - rest[1] * rest[1] - rest[2] * rest[2]));
+
+        std::uint32_t n = 0;
+        for (std::uint32_t c = 0; c < 4; ++c)
+            q[c] = c == largest ? d : rest[n++];
+    }
+
+    inline __m128 Select(__m128 mask, __m128 a, __m128 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    inline __m128 LoadLanes(const std::int32_t* lanes)
+    {
+        return _mm_cvtepi32_ps(_mm_load_si128((const __m128i*)lanes));
+    }
+
+    // ȭ ȸ 4  (θ) -> ʹϾ SoA
+    inline void DecodeRotations(const std::int32_t words[3][4], __m128& qx, __m128& qy, __m128& qz, __m128& qw)
+    {
+        const __m128i w0 = _mm_load_si128((const __m128i*)words[0]);
+        const __m128i w1 = _mm_load_si128((const __m128i*)words[1]);
+        const __m128i w2 = _mm_load_si128((const __m128i*)words[2]);
+        const __m128i low = _mm_set1_epi32(0x7FFF);
+        const __m128i largest = _mm_or_si128(_mm_slli_epi32(_mm_srli_epi32(w0, 15), 1), _mm_srli_epi32(w1, 15));
+
+        const __m128 step = _mm_set1_ps(RotationStep), range = _mm_set1_ps(RotationRange);
+        const __m128 a = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(w0, low)), step), range);
+        const __m128 b = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(w1, low)), step), range);
+        const __m128 c = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(w2, low)), step), range);
+        const __m128 len2 = _mm_add_ps(_mm_mul_ps(a, a), _mm_add_ps(_mm_mul_ps(b, b), _mm_mul_ps(c, c)));
+        const __m128 d = _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), len2)));
+
+        //   ڸ d,   a, b, c
+        const __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(0)));
+        const __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(1)));
+        const __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(2)));
+        const __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(3)));
+        qx = Select(is0, d, a);
+        qy = Select(is0, a, Select(is1, d, b));
+        qz = Select(is2, d, Select(is3, c, b));
+        qw = Select(is3, d, c);
+    }
+}
+
+// ---------------------------------------------------------
+// 
+// ---------------------------------------------------------
+AnimationClip AnimationClip::Compress(const RawAnimationClip& raw, const AnimationCompressionSettings& settings,
+    AnimationCompressionStats* outStats)
+{
+    const std::uint32_t frameCount = raw.GetFrameCount();
+    const std::uint32_t jointCount = raw.JointCount;
+    assert(frameCount >= 1 && frameCount <= 0xFFFF);
+
+    AnimationClip clip;
+    clip.mJointCount = jointCount;
+    clip.mFrameCount = frameCount;
+    clip.mSampleRate = raw.SampleRate;
+
+    const std::uint32_t lanes = clip.GetSoaCount() * 4;
+    for (int c = 0; c < 3; ++c)
+    {
+        clip.mMin[0][c].assign(lanes, 0.0f);
+        clip.mMin[1][c].assign(lanes, 1.0f);
+        clip.mStep[0][c].assign(lanes, 0.0f);
+        clip.mStep[1][c].assign(lanes, 0.0f);
+    }
+    for (Track& track : clip.mTracks)
+        track.Start.assign(1, 0);
+
+    std::vector<float> rotations(frameCount * 4);
+    std::vector<std::uint16_t> keys;
+    for (std::uint32_t j = 0; j < jointCount; ++j)
+    {
+        auto frame = [&raw, jointCount, j](std::uint32_t f) -> const JointTransform& { return raw.Frames[f * jointCount + j]; };
+
+        // 1. ̵ / : lerp  = Ÿ
+        for (Channel channel : { Translation, Scale })
+        {
+            auto value = [&frame, channel](std::uint32_t f) { return channel == Translation ? frame(f).Translation : frame(f).Scale; };
+            auto error = [&value](std::uint32_t a, std::uint32_t b, std::uint32_t f)
+            {
+                const double t = Alpha(a, b, f);
+                double d2 = 0.0;
+                for (int c = 0; c < 3; ++c)
+                {
+                    const double v = value(a)[c] + (value(b)[c] - (double)value(a)[c]) * t;
+                    d2 += (v - value(f)[c]) * (v - value(f)[c]);
+                }
+                return (float)std::sqrt(d2);
+            };
+            ReduceKeys(frameCount, channel == Translation ? settings.TranslationTolerance : settings.ScaleTolerance, error, keys);
+
+            //  Ű  ȭ
+            const int range = channel == Translation ? 0 : 1;
+            Track& track = clip.mTracks[channel];
+            for (int c = 0; c < 3; ++c)
+            {
+                float lo = value(keys[0])[c], hi = lo;
+                for (std::uint16_t k : keys)
+                {
+                    lo = std::min(lo, value(k)[c]);
+                    hi = std::max(hi, value(k)[c]);
+                }
+                const float step = (hi - lo) / 65535.0f;
+                clip.mMin[range][c][j] = lo;
+                clip.mStep[range][c][j] = step;
+            }
+            for (std::uint16_t k : keys)
+            {
+                track.Frames.push_back(k);
+                for (int c = 0; c < 3; ++c)
+                {
+                    const float step = clip.mStep[range][c][j];
+                    const float q = step > 0.0f ? (value(k)[c] - clip.mMin[range][c][j]) / step : 0.0f;
+                    track.Values.push_back((std::uint16_t)std::clamp(std::lround(q), 0L, 65535L));
+                }
+            }
+            track.Start.push_back((std::uint32_t)track.Frames.size());
+        }
+
+        // 2. ȸ:  Ӱ  ݱ  ΰ nlerp  =  ȸ  
+        for (std::uint32_t f = 0; f < frameCount; ++f)
+        {
+            const float* q = frame(f).Rotation;
+            float sign = 1.0f;
+            if (f > 0)
+            {
+                const float* prev = &rotations[(f - 1) * 4];
+                sign = q[0] * prev[0] + q[1] * prev[1] + q[2] * prev[2] + q[3] * prev[3] < 0.0f ? -1.0f : 1.0f;
+            }
+            for (int c = 0; c < 4; ++c)
+                rotations[f * 4 + c] = q[c] * sign;
+        }
+        auto rotationError = [&rotations](std::uint32_t a, std::uint32_t b, std::uint32_t f)
+        {
+            const double t = Alpha(a, b, f);
+            double v[4], len2 = 0.0, dot = 0.0;
+            for (int c = 0; c < 4; ++c)
+            {
+                v[c] = rotations[a * 4 + c] + (rotations[b * 4 + c] - (double)rotations[a * 4 + c]) * t;
+                len2 += v[c] * v[c];
+            }
+            for (int c = 0; c < 4; ++c)
+                dot += v[c] * rotations[f * 4 + c];
+            return (float)(2.0 * std::acos(std::min(1.0, std::fabs(dot) / std::sqrt(len2))));
+        };
+        ReduceKeys(frameCount, settings.RotationTolerance, rotationError, keys);
+
+        Track& track = clip.mTracks[Rotation];
+        for (std::uint16_t k : keys)
+        {
+            std::uint16_t words[3];
+            QuantizeRotation(&rotations[k * 4], words);
+            track.Frames.push_back(k);
+            track.Values.insert(track.Values.end(), words, words + 3);
+        }
+        track.Start.push_back((std::uint32_t)track.Frames.size());
+    }
+
+    if (outStats)
+    {
+        outStats->RawBytes = (std::uint32_t)(raw.Frames.size() * sizeof(JointTransform));
+        outStats->CompressedBytes = clip.GetSizeBytes();
+        outStats->RawKeys = frameCount * jointCount * ChannelCount;
+        outStats->Keys = clip.GetKeyCount();
+    }
+    return clip;
+}
+
+std::uint32_t AnimationClip::GetKeyCount()const
+{
+    std::uint32_t keys = 0;
+    for (const Track& track : mTracks)
+        keys += (std::uint32_t)track.Frames.size();
+    return keys;
+}
+
+std::uint32_t AnimationClip::GetSizeBytes()const
+{
+    std::size_t bytes = 0;
+    for (const Track& track : mTracks)
+        bytes += track.Start.size() * sizeof(std::uint32_t) + (track.Frames.size() + track.Values.size()) * sizeof(std::uint16_t);
+    for (int range = 0; range < 2; ++range)
+    {
+        for (int c = 0; c < 3; ++c)
+            bytes += (mMin[range][c].size() + mStep[range][c].size()) * sizeof(float);
+    }
+    return (std::uint32_t)bytes;
+}
+
+// ---------------------------------------------------------
+// ø
+// ---------------------------------------------------------
+float AnimationClip::ToFrame(float time)const
+{
+    return std::clamp(time * mSampleRate, 0.0f, (float)(mFrameCount - 1));
+}
+
+void AnimationClip::FindKeys(Channel channel, std::uint32_t joint, float frame, std::uint16_t& cursor,
+    std::uint32_t& outKey0, std::uint32_t& outKey1, float& outAlpha)const
+{
+    const Track& track = mTracks[channel];
+    const std::uint32_t first = track.Start[joint];
+    const std::uint32_t count = track.Start[joint + 1] - first;
+    const std::uint16_t* frames = &track.Frames[first];
+
+    // ð  θ Ƿ   ѱ (ڷ  Sample  0   )
+    std::uint32_t k = cursor;
+    while (k + 1 < count && frames[k + 1] <= frame)
+        ++k;
+    cursor = (std::uint16_t)k;
+
+    const std::uint32_t next = k + 1 < count ? k + 1 : k;
+    outKey0 = first + k;
+    outKey1 = first + next;
+    outAlpha = next != k ? (frame - frames[k]) / (float)(frames[next] - frames[k]) : 0.0f;
+}
+
+void AnimationClip::Sample(float time, AnimationSamplingCache& cache, SoaTransform* outPose)const
+{
+    const float frame = ToFrame(time);
+    if (cache.Cursors.size() != mJointCount * ChannelCount || frame < cache.LastFrame)
+        cache.Cursors.assign(mJointCount * ChannelCount, 0);
+    cache.LastFrame = frame;
+
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+
+    alignas(16) std::int32_t words0[3][4];
+    alignas(16) std::int32_t words1[3][4];
+    alignas(16) float alpha[4];
+
+    for (std::uint32_t g = 0; g < GetSoaCount(); ++g)
+    {
+        SoaTransform& out = outPose[g];
+
+        // 1. ̵ / : θ  Ű Ƽ ȭ + lerp
+        for (Channel channel : { Translation, Scale })
+        {
+            const Track& track = mTracks[channel];
+            for (std::uint32_t lane = 0; lane < 4; ++lane)
+            {
+                const std::uint32_t joint = g * 4 + lane;
+                std::uint32_t k0 = 0, k1 = 0;
+                alpha[lane] = 0.0f;
+                if (joint < mJointCount)
+                    FindKeys(channel, joint, frame, cache.Cursors[joint * ChannelCount + channel], k0, k1, alpha[lane]);
+                for (int c = 0; c < 3; ++c)
+                {
+                    words0[c][lane] = joint < mJointCount ? track.Values[k0 * 3 + c] : 0;
+                    words1[c][lane] = joint < mJointCount ? track.Values[k1 * 3 + c] : 0;
+                }
+            }
+
+            const int range = channel == Translation ? 0 : 1;
+            const __m128 t = _mm_load_ps(alpha);
+            float* rows[3] = { channel == Translation ? out.Tx : out.Sx, channel == Translation ? out.Ty : out.Sy, channel == Translation ? out.Tz : out.Sz };
+            for (int c = 0; c < 3; ++c)
+            {
+                const __m128 lo = _mm_loadu_ps(&mMin[range][c][g * 4]);
+                const __m128 step = _mm_loadu_ps(&mStep[range][c][g * 4]);
+                const __m128 v0 = _mm_add_ps(lo, _mm_mul_ps(LoadLanes(words0[c]), step));
+                const __m128 v1 = _mm_add_ps(lo, _mm_mul_ps(LoadLanes(words1[c]), step));
+                _mm_store_ps(rows[c], _mm_add_ps(v0, _mm_mul_ps(_mm_sub_ps(v1, v0), t)));
+            }
+        }
+
+        // 2. ȸ:  Ű Ǯ  ݱ ߰ nlerp (  ׵ = w   ŭ,  0)
+        const Track& track = mTracks[Rotation];
+        for (std::uint32_t lane = 0; lane < 4; ++lane)
+        {
+            const std::uint32_t joint = g * 4 + lane;
+            if (joint >= mJointCount)
+            {
+                alpha[lane] = 0.0f;
+                for (int c = 0; c < 3; ++c)
+                    words0[c][lane] = words1[c][lane] = c < 2 ? 0xBFFF : 0x3FFF;
+                continue;
+            }
+
+            std::uint32_t k0, k1;
+            FindKeys(Rotation, joint, frame, cache.Cursors[joint * ChannelCount + Rotation], k0, k1, alpha[lane]);
+            for (int c = 0; c < 3; ++c)
+            {
+                words0[c][lane] = track.Values[k0 * 3 + c];
+                words1[c][lane] = track.Values[k1 * 3 + c];
+            }
+        }
+
+        __m128 ax, ay, az, aw, bx, by, bz, bw;
+        DecodeRotations(words0, ax, ay, az, aw);
+        DecodeRotations(words1, bx, by, bz, bw);
+
+        const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+        const __m128 flip = _mm_and_ps(dot, signBit);
+        const __m128 t = _mm_load_ps(alpha);
+        const __m128 qx = _mm_add_ps(ax, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bx, flip), ax), t));
+        const __m128 qy = _mm_add_ps(ay, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(by, flip), ay), t));
+        const __m128 qz = _mm_add_ps(az, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bz, flip), az), t));
+        const __m128 qw = _mm_add_ps(aw, _mm_mul_ps(_mm_sub_ps(_mm_xor_ps(bw, flip), aw), t));
+        const __m128 len2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, qx), _mm_mul_ps(qy, qy)), _mm_add_ps(_mm_mul_ps(qz, qz), _mm_mul_ps(qw, qw)));
+        const __m128 invLen = _mm_div_ps(one, _mm_sqrt_ps(len2));
+        _mm_store_ps(out.Qx, _mm_mul_ps(qx, invLen));
+        _mm_store_ps(out.Qy, _mm_mul_ps(qy, invLen));
+        _mm_store_ps(out.Qz, _mm_mul_ps(qz, invLen));
+        _mm_store_ps(out.Qw, _mm_mul_ps(qw, invLen));
+    }
+}
+
+void AnimationClip::SampleJoint(std::uint32_t joint, float time, JointTransform& out)const
+{
+    assert(joint < mJointCount);
+    const float frame = ToFrame(time);
+
+    auto find = [this, joint, frame](Channel channel, std::uint32_t& k0, std::uint32_t& k1, float& alpha)
+    {
+        const Track& track = mTracks[channel];
+        const auto begin = track.Frames.begin() + track.Start[joint];
+        const auto end = track.Frames.begin() + track.Start[joint + 1];
+        std::uint16_t cursor = (std::uint16_t)(std::upper_bound(begin, end, frame, [](float f, std::uint16_t key) { return f < key; }) - begin - 1);
+        FindKeys(channel, joint, frame, cursor, k0, k1, alpha);
+    };
+
+    std::uint32_t k0, k1;
+    float alpha;
+    for (Channel channel : { Translation, Scale })
+    {
+        find(channel, k0, k1, alpha);
+        const int range = channel == Translation ? 0 : 1;
+        float* target = channel == Translation ? out.Translation : out.Scale;
+        for (int c = 0; c < 3; ++c)
+        {
+            const float v0 = mMin[range][c][joint] + mTracks[channel].Values[k0 * 3 + c] * mStep[range][c][joint];
+            const float v1 = mMin[range][c][joint] + mTracks[channel].Values[k1 * 3 + c] * mStep[range][c][joint];
+            target[c] = v0 + (v1 - v0) * alpha;
+        }
+    }
+
+    find(Rotation, k0, k1, alpha);
+    float a[4], b[4];
+    DequantizeRotation(&mTracks[Rotation].Values[k0 * 3], a);
+    DequantizeRotation(&mTracks[Rotation].Values[k1 * 3], b);
+    const float sign = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3] < 0.0f ? -1.0f : 1.0f;
+    float len2 = 0.0f;
+    for (int c = 0; c < 4; ++c)
+    {
+        out.Rotation[c] = a[c] + (b[c] * sign - a[c]) * alpha;
+        len2 += out.Rotation[c] * out.Rotation[c];
+    }
+    const float invLen = 1.0f / std::sqrt(len2);
+    for (int c = 0; c < 4; ++c)
+        out.Rotation[c] *= invLen;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "AnimationPose.h"
+#include <vector>
+
+// ==========================================================
+//  ִϸ̼ Ŭ
+// - :   (SampleRate)     TRS (RawAnimationClip)
+// -  (Compress):
+//   1. Ű ̱:  x (̵, ȸ, ) Ʈ տ  ִ ÷
+//         Ű  (̵/ lerp, ȸ nlerp)     ӿ   ̸  Ű 
+//        ù Ű ϳ   ̸ ( ʴ ) Ű ϳ
+//   2. ȭ: ̵/ Ʈ [ּ, ִ]  16 Ʈ x 3,
+//      ȸ  ū   ( 缭)   15 Ʈ +   ȣ 2 Ʈ = 48 Ʈ
+//   Ű ð  ȣ (16 Ʈ)
+// - ø (Sample):  4  Ʈ ð δ  Ű  (ĳÿ  ġ ؼ  O(1))
+//   SSE  ȭ + ؼ SoaTransform  ٷ 
+// ==========================================================
+
+struct RawAnimationClip
+{
+    std::uint32_t JointCount = 0;
+    float SampleRate = 30.0f;
+    std::vector<JointTransform> Frames;     //  , Ӹ JointCount 
+
+    std::uint32_t GetFrameCount()const { return JointCount == 0 ? 0 : (std::uint32_t)(Frames.size() / JointCount); }
+};
+
+struct AnimationCompressionSettings
+{
+    float TranslationTolerance = 0.0005f;   // m
+    float RotationTolerance = 0.001f;       //  ( ȸ  )
+    float ScaleTolerance = 0.0005f;
+};
+
+struct AnimationCompressionStats
+{
+    std::uint32_t RawBytes = 0;
+    std::uint32_t CompressedBytes = 0;
+    std::uint32_t RawKeys = 0;              //  x  x 3
+    std::uint32_t Keys = 0;                 //  Ű ( Ʈ )
+};
+
+// νϽ (Ŭ ϳ ϳ). Ʈ     Ű
+struct AnimationSamplingCache
+{
+    std::vector<std::uint16_t> Cursors;     //  x 3 (̵, ȸ, )
+    float LastFrame = 0.0f;
+};
+
+class AnimationClip
+{
+public:
+    static AnimationClip Compress(const RawAnimationClip& raw,
+        const AnimationCompressionSettings& settings = AnimationCompressionSettings(),
+        AnimationCompressionStats* outStats = nullptr);
+
+    float GetDuration()const { return mFrameCount > 1 ? (mFrameCount - 1) / mSampleRate : 0.0f; }
+    std::uint32_t GetJointCount()const { return mJointCount; }
+    std::uint32_t GetSoaCount()const { return AnimationPose::GetSoaCount(mJointCount); }
+    std::uint32_t GetKeyCount()const;
+    std::uint32_t GetSizeBytes()const;
+
+    // time  [0, GetDuration()]  ڸ. outPose  GetSoaCount() 
+    void Sample(float time, AnimationSamplingCache& cache, SoaTransform* outPose)const;
+
+    //  ϳ Į (ĳ  ̺ Ž). ˻
+    void SampleJoint(std::uint32_t joint, float time, JointTransform& out)const;
+
+private:
+    enum Channel { Translation, Rotation, Scale, ChannelCount };
+
+    struct Track
+    {
+        std::vector<std::uint32_t> Start;   //  + 1 ( j  Ű = [Start[j], Start[j + 1]))
+        std::vector<std::uint16_t> Frames;  // Ű ð ( ȣ)
+        std::vector<std::uint16_t> Values;  // Ű 3 
+    };
+
+    float ToFrame(float time)const;
+    void FindKeys(Channel channel, std::uint32_t joint, float frame, std::uint16_t& cursor,
+        std::uint32_t& outKey0, std::uint32_t& outKey1, float& outAlpha)const;
+
+private:
+    std::uint32_t mJointCount = 0;
+    std::uint32_t mFrameCount = 0;
+    float mSampleRate = 30.0f;
+
+    Track mTracks[ChannelCount];
+
+    // ̵/ ȭ:  = Min + q * Step.  4  SIMD  а GetSoaCount() * 4  ä
+    // (  ̵ 0,  1)
+    std::vector<float> mMin[2][3];
+    std::vector<float> mStep[2][3];
+};
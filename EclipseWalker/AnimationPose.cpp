@@ -0,0 +1,192 @@
+#include "AnimationPose.h"
+#include "Skeleton.h"
+#include <cassert>
+#include <initializer_list>
+#include <immintrin.h>
+
+namespace
+{
+    // out = local * parent (  Ծ̹Ƿ ڽ  )
+    inline void MultiplyAffine(const Float4x4A& local, const Float4x4A& parent, Float4x4A& out)
+    {
+        const __m128 p0 = _mm_load_ps(parent.M + 0);
+        const __m128 p1 = _mm_load_ps(parent.M + 4);
+        const __m128 p2 = _mm_load_ps(parent.M + 8);
+        const __m128 p3 = _mm_load_ps(parent.M + 12);
+
+        for (int r = 0; r < 4; ++r)
+        {
+            const float* row = local.M + r * 4;
+            __m128 v = _mm_mul_ps(_mm_set1_ps(row[0]), p0);
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(row[1]), p1));
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(row[2]), p2));
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(row[3]), p3));
+            _mm_store_ps(out.M + r * 4, v);
+        }
+    }
+
+    inline __m128 MulAdd(__m128 a, __m128 b, __m128 c)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+}
+
+namespace AnimationPose
+{
+    void GetJoint(const SoaTransform* pose, std::uint32_t joint, JointTransform& out)
+    {
+        const SoaTransform& soa = pose[joint / 4];
+        const std::uint32_t lane = joint % 4;
+        out.Translation[0] = soa.Tx[lane]; out.Translation[1] = soa.Ty[lane]; out.Translation[2] = soa.Tz[lane];
+        out.Rotation[0] = soa.Qx[lane]; out.Rotation[1] = soa.Qy[lane]; out.Rotation[2] = soa.Qz[lane]; out.Rotation[3] = soa.Qw[lane];
+        out.Scale[0] = soa.Sx[lane]; out.Scale[1] = soa.Sy[lane]; out.Scale[2] = soa.Sz[lane];
+    }
+
+    void SetJoint(SoaTransform* pose, std::uint32_t joint, const JointTransform& in)
+    {
+        SoaTransform& soa = pose[joint / 4];
+        const std::uint32_t lane = joint % 4;
+        soa.Tx[lane] = in.Translation[0]; soa.Ty[lane] = in.Translation[1]; soa.Tz[lane] = in.Translation[2];
+        soa.Qx[lane] = in.Rotation[0]; soa.Qy[lane] = in.Rotation[1]; soa.Qz[lane] = in.Rotation[2]; soa.Qw[lane] = in.Rotation[3];
+        soa.Sx[lane] = in.Scale[0]; soa.Sy[lane] = in.Scale[1]; soa.Sz[lane] = in.Scale[2];
+    }
+
+    void Accumulate(const SoaTransform* in, float weight, std::uint32_t soaCount, bool first, SoaTransform* out)
+    {
+        const __m128 w = _mm_set1_ps(weight);
+        const __m128 signBit = _mm_set1_ps(-0.0f);
+
+        for (std::uint32_t g = 0; g < soaCount; ++g)
+        {
+            const float* src = in[g].Tx;
+            float* dst = out[g].Tx;
+
+            if (first)
+            {
+                // SoaTransform = float 4  x 10 
+                for (int row = 0; row < 10; ++row)
+                    _mm_store_ps(dst + row * 4, _mm_mul_ps(_mm_load_ps(src + row * 4), w));
+                continue;
+            }
+
+            // ȸ:  ʰ    ȣ   (q  -q   ȸ)
+            const __m128 qx = _mm_load_ps(in[g].Qx), qy = _mm_load_ps(in[g].Qy);
+            const __m128 qz = _mm_load_ps(in[g].Qz), qw = _mm_load_ps(in[g].Qw);
+            const __m128 ax = _mm_load_ps(out[g].Qx), ay = _mm_load_ps(out[g].Qy);
+            const __m128 az = _mm_load_ps(out[g].Qz), aw = _mm_load_ps(out[g].Qw);
+            const __m128 dot = MulAdd(qx, ax, MulAdd(qy, ay, MulAdd(qz, az, _mm_mul_ps(qw, aw))));
+            const __m128 sw = _mm_xor_ps(w, _mm_and_ps(dot, signBit));
+
+            _mm_store_ps(out[g].Qx, MulAdd(qx, sw, ax));
+            _mm_store_ps(out[g].Qy, MulAdd(qy, sw, ay));
+            _mm_store_ps(out[g].Qz, MulAdd(qz, sw, az));
+            _mm_store_ps(out[g].Qw, MulAdd(qw, sw, aw));
+
+            // ̵ (0 ~ 2 ) +  (7 ~ 9 )
+            for (int row : { 0, 1, 2, 7, 8, 9 })
+                _mm_store_ps(dst + row * 4, MulAdd(_mm_load_ps(src + row * 4), w, _mm_load_ps(dst + row * 4)));
+        }
+    }
+
+    void Normalize(SoaTransform* pose, float totalWeight, std::uint32_t soaCount)
+    {
+        assert(totalWeight > 0.0f);
+        const __m128 inv = _mm_set1_ps(1.0f / totalWeight);
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        for (std::uint32_t g = 0; g < soaCount; ++g)
+        {
+            float* rows = pose[g].Tx;
+            for (int row : { 0, 1, 2, 7, 8, 9 })
+                _mm_store_ps(rows + row * 4, _mm_mul_ps(_mm_load_ps(rows + row * 4), inv));
+
+            const __m128 qx = _mm_load_ps(pose[g].Qx), qy = _mm_load_ps(pose[g].Qy);
+            const __m128 qz = _mm_load_ps(pose[g].Qz), qw = _mm_load_ps(pose[g].Qw);
+            const __m128 len2 = MulAdd(qx, qx, MulAdd(qy, qy, MulAdd(qz, qz, _mm_mul_ps(qw, qw))));
+            const __m128 invLen = _mm_div_ps(one, _mm_sqrt_ps(len2));
+            _mm_store_ps(pose[g].Qx, _mm_mul_ps(qx, invLen));
+            _mm_store_ps(pose[g].Qy, _mm_mul_ps(qy, invLen));
+            _mm_store_ps(pose[g].Qz, _mm_mul_ps(qz, invLen));
+            _mm_store_ps(pose[g].Qw, _mm_mul_ps(qw, invLen));
+        }
+    }
+
+    void LocalToModel(const Skeleton& skeleton, const SoaTransform* local, Float4x4A* outModel)
+    {
+        const std::uint32_t jointCount = skeleton.GetJointCount();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        const __m128 zero = _mm_setzero_ps();
+
+        Float4x4A lanes[4];
+        for (std::uint32_t g = 0; g * 4 < jointCount; ++g)
+        {
+            const SoaTransform& soa = local[g];
+
+            // 1.  4  Scale * Rotation  SoA  (TransformHierarchy::SetLocalTRS   )
+            const __m128 qx = _mm_load_ps(soa.Qx), qy = _mm_load_ps(soa.Qy);
+            const __m128 qz = _mm_load_ps(soa.Qz), qw = _mm_load_ps(soa.Qw);
+            const __m128 sx = _mm_load_ps(soa.Sx), sy = _mm_load_ps(soa.Sy), sz = _mm_load_ps(soa.Sz);
+
+            const __m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+            const __m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+            const __m128 wx = _mm_mul_ps(qw, qx), wy = _mm_mul_ps(qw, qy), wz = _mm_mul_ps(qw, qz);
+
+            __m128 r0x = _mm_mul_ps(sx, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))));
+            __m128 r0y = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_add_ps(xy, wz)));
+            __m128 r0z = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_sub_ps(xz, wy)));
+            __m128 r1x = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_sub_ps(xy, wz)));
+            __m128 r1y = _mm_mul_ps(sy, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))));
+            __m128 r1z = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_add_ps(yz, wx)));
+            __m128 r2x = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_add_ps(xz, wy)));
+            __m128 r2y = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_sub_ps(yz, wx)));
+            __m128 r2z = _mm_mul_ps(sz, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))));
+            __m128 tx = _mm_load_ps(soa.Tx), ty = _mm_load_ps(soa.Ty), tz = _mm_load_ps(soa.Tz);
+            __m128 r0w = zero, r1w = zero, r2w = zero, tw = one;
+
+            // 2. ġ -> θ  ϳ
+            _MM_TRANSPOSE4_PS(r0x, r0y, r0z, r0w);
+            _MM_TRANSPOSE4_PS(r1x, r1y, r1z, r1w);
+            _MM_TRANSPOSE4_PS(r2x, r2y, r2z, r2w);
+            _MM_TRANSPOSE4_PS(tx, ty, tz, tw);
+            const __m128 rows[4][4] =
+            {
+                { r0x, r1x, r2x, tx },
+                { r0y, r1y, r2y, ty },
+                { r0z, r1z, r2z, tz },
+                { r0w, r1w, r2w, tw },
+            };
+
+            // 3. θ    (     θ  ־  )
+            const std::uint32_t count = jointCount - g * 4 < 4 ? jointCount - g * 4 : 4;
+            for (std::uint32_t lane = 0; lane < count; ++lane)
+            {
+                const std::uint32_t joint = g * 4 + lane;
+                const std::uint16_t parent = skeleton.GetParent(joint);
+                Float4x4A& target = parent == Skeleton::NoParent ? outModel[joint] : lanes[lane];
+                for (int r = 0; r < 4; ++r)
+                    _mm_store_ps(target.M + r * 4, rows[lane][r]);
+
+                if (parent != Skeleton::NoParent)
+                    MultiplyAffine(lanes[lane], outModel[parent], outModel[joint]);
+            }
+        }
+    }
+
+    void BuildSkinningPalette(const Skeleton& skeleton, const Float4x4A* model, SkinningMatrix* outPalette)
+    {
+        for (std::uint32_t j = 0; j < skeleton.GetJointCount(); ++j)
+        {
+            Float4x4A skin;
+            MultiplyAffine(skeleton.GetInverseBind(j), model[j], skin);
+
+            //  ->  (   , °  ׻ 0, 0, 0, 1)
+            __m128 r0 = _mm_load_ps(skin.M + 0), r1 = _mm_load_ps(skin.M + 4);
+            __m128 r2 = _mm_load_ps(skin.M + 8), r3 = _mm_load_ps(skin.M + 12);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(outPalette[j].Rows + 0, r0);
+            _mm_storeu_ps(outPalette[j].Rows + 4, r1);
+            _mm_storeu_ps(outPalette[j].Rows + 8, r2);
+        }
+    }
+}
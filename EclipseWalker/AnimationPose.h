@@ -0,0 +1,59 @@
+#pragma once
+#include "TransformHierarchy.h"
+#include <cstdint>
+
+// ==========================================================
+// ִϸ̼  (  TRS)   
+// -   4   SoA (SoaTransform ϳ = SSE  4  =  4 )
+//     4   ƴϸ   ׵ ȯ ä  (ȭ /  꿡 NaN   )
+// - : Accumulate    װ Normalize   (ȸ  ʰ  ݱ    ȭ = nlerp)
+// - LocalToModel: 4  TRS ->  SoA  ؼ ġ, θ    (θ ׻ )
+// - BuildSkinningPalette: ε *   GPU  3x4 (SkinningMatrix) 
+//  TransformHierarchy    켱 /   Ծ (Scale * Rotation * Translation)
+// ==========================================================
+
+struct JointTransform
+{
+    float Translation[3] = { 0.0f, 0.0f, 0.0f };
+    float Rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };    // x, y, z, w
+    float Scale[3] = { 1.0f, 1.0f, 1.0f };
+};
+
+struct alignas(16) SoaTransform
+{
+    float Tx[4], Ty[4], Tz[4];
+    float Qx[4], Qy[4], Qz[4], Qw[4];
+    float Sx[4], Sy[4], Sz[4];
+
+    static SoaTransform Identity()
+    {
+        return SoaTransform{ {}, {}, {}, {}, {}, {}, { 1.0f, 1.0f, 1.0f, 1.0f },
+            { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f, 1.0f, 1.0f } };
+    }
+};
+
+// Ű ȷƮ  ׸ (48 Ʈ).      
+// = HLSL  float3x4  о mul(M, float4(p, 1)) ( / ȭ ۿ ״ )
+struct SkinningMatrix
+{
+    float Rows[12];
+};
+
+class Skeleton;
+
+namespace AnimationPose
+{
+    inline std::uint32_t GetSoaCount(std::uint32_t jointCount) { return (jointCount + 3) / 4; }
+
+    void GetJoint(const SoaTransform* pose, std::uint32_t joint, JointTransform& out);
+    void SetJoint(SoaTransform* pose, std::uint32_t joint, const JointTransform& in);
+
+    // first  out = weight * in, ƴϸ out += weight * in
+    void Accumulate(const SoaTransform* in, float weight, std::uint32_t soaCount, bool first, SoaTransform* out);
+
+    // ġ   ȸ ȭ
+    void Normalize(SoaTransform* pose, float totalWeight, std::uint32_t soaCount);
+
+    void LocalToModel(const Skeleton& skeleton, const SoaTransform* local, Float4x4A* outModel);
+    void BuildSkinningPalette(const Skeleton& skeleton, const Float4x4A* model, SkinningMatrix* outPalette);
+}
@@ -0,0 +1,146 @@
+#include "BlendTree.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// ---------------------------------------------------------
+// Ʈ 
+// ---------------------------------------------------------
+BlendTree::NodeIndex BlendTree::AddClip(const AnimationClip& clip)
+{
+    Node node;
+    node.IsClip = true;
+    node.Leaf = (std::uint32_t)mLeaves.size();
+    mLeaves.push_back(&clip);
+
+    mNodes.push_back(node);
+    return (NodeIndex)mNodes.size() - 1;
+}
+
+BlendTree::NodeIndex BlendTree::AddBlend1D(std::uint32_t parameter, const std::vector<NodeIndex>& children, const std::vector<float>& thresholds)
+{
+    assert(!children.empty() && children.size() == thresholds.size());
+    assert(std::is_sorted(thresholds.begin(), thresholds.end()));
+
+    Node node;
+    node.Parameter = parameter;
+    node.FirstChild = (std::uint32_t)mChildren.size();
+    node.ChildCount = (std::uint32_t)children.size();
+    mChildren.insert(mChildren.end(), children.begin(), children.end());
+    mThresholds.insert(mThresholds.end(), thresholds.begin(), thresholds.end());
+    mParameterCount = std::max(mParameterCount, parameter + 1);
+
+    mNodes.push_back(node);
+    return (NodeIndex)mNodes.size() - 1;
+}
+
+void BlendTree::ComputeLeafWeights(const float* parameters, float* outWeights)const
+{
+    std::fill(outWeights, outWeights + mLeaves.size(), 0.0f);
+    if (mNodes.empty())
+        return;
+
+    // (,  ġ) . ġ 0    
+    struct Entry
+    {
+        NodeIndex Node;
+        float Weight;
+    };
+    Entry stack[64];
+    std::uint32_t top = 0;
+    stack[top++] = { mRoot, 1.0f };
+
+    while (top > 0)
+    {
+        const Entry entry = stack[--top];
+        const Node& node = mNodes[entry.Node];
+        if (node.IsClip)
+        {
+            outWeights[node.Leaf] += entry.Weight;
+            continue;
+        }
+
+        // Ķ͸ δ  ڽ (  ̸  ڽ ϳ)
+        const float* thresholds = &mThresholds[node.FirstChild];
+        const float value = parameters[node.Parameter];
+        const std::uint32_t last = node.ChildCount - 1;
+        std::uint32_t upper = (std::uint32_t)(std::upper_bound(thresholds, thresholds + node.ChildCount, value) - thresholds);
+
+        assert(top + 2 <= 64);
+        if (upper == 0 || upper > last)
+        {
+            stack[top++] = { mChildren[node.FirstChild + (upper == 0 ? 0 : last)], entry.Weight };
+            continue;
+        }
+
+        const float t = (value - thresholds[upper - 1]) / (thresholds[upper] - thresholds[upper - 1]);
+        if (t < 1.0f)
+            stack[top++] = { mChildren[node.FirstChild + upper - 1], entry.Weight * (1.0f - t) };
+        if (t > 0.0f)
+            stack[top++] = { mChildren[node.FirstChild + upper], entry.Weight * t };
+    }
+}
+
+// ---------------------------------------------------------
+// νϽ
+// ---------------------------------------------------------
+BlendTreeInstance::BlendTreeInstance(const BlendTree& tree, const Skeleton& skeleton)
+    : mTree(&tree)
+    , mSkeleton(&skeleton)
+    , mParameters(tree.GetParameterCount(), 0.0f)
+    , mLeafWeights(tree.GetLeafCount(), 0.0f)
+    , mCaches(tree.GetLeafCount())
+    , mSampled(skeleton.GetSoaCount())
+    , mLocal(skeleton.GetSoaCount())
+    , mModel(skeleton.GetJointCount())
+    , mPalette(skeleton.GetJointCount())
+{
+    for (std::uint32_t leaf = 0; leaf < tree.GetLeafCount(); ++leaf)
+        assert(tree.GetLeafClip(leaf).GetJointCount() == skeleton.GetJointCount());
+}
+
+void BlendTreeInstance::Advance(float dt)
+{
+    mTree->ComputeLeafWeights(mParameters.data(), mLeafWeights.data());
+
+    float duration = 0.0f;
+    for (std::uint32_t leaf = 0; leaf < mTree->GetLeafCount(); ++leaf)
+        duration += mLeafWeights[leaf] * mTree->GetLeafClip(leaf).GetDuration();
+
+    if (duration > 0.0f)
+    {
+        mPhase += dt / duration;
+        mPhase -= std::floor(mPhase);
+    }
+}
+
+void BlendTreeInstance::Evaluate()
+{
+    const std::uint32_t soaCount = mSkeleton->GetSoaCount();
+
+    // 1.  ġ
+    mTree->ComputeLeafWeights(mParameters.data(), mLeafWeights.data());
+
+    // 2. ſ ٸ øؼ   (ϳ  ε )
+    float total = 0.0f;
+    for (std::uint32_t leaf = 0; leaf < mTree->GetLeafCount(); ++leaf)
+    {
+        const float weight = mLeafWeights[leaf];
+        if (weight < MinLeafWeight)
+            continue;
+
+        const AnimationClip& clip = mTree->GetLeafClip(leaf);
+        clip.Sample(mPhase * clip.GetDuration(), mCaches[leaf], mSampled.data());
+        AnimationPose::Accumulate(mSampled.data(), weight, soaCount, total == 0.0f, mLocal.data());
+        total += weight;
+    }
+
+    if (total > 0.0f)
+        AnimationPose::Normalize(mLocal.data(), total, soaCount);
+    else
+        std::copy(mSkeleton->GetBindPose(), mSkeleton->GetBindPose() + soaCount, mLocal.begin());
+
+    // 3.   -> ȷƮ
+    AnimationPose::LocalToModel(*mSkeleton, mLocal.data(), mModel.data());
+    AnimationPose::BuildSkinningPalette(*mSkeleton, mModel.data(), mPalette.data());
+}
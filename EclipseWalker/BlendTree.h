@@ -0,0 +1,89 @@
+#pragma once
+#include "AnimationClip.h"
+#include "Skeleton.h"
+#include <vector>
+
+// ==========================================================
+//  Ʈ + ĳ ϳ ִϸ̼ 
+// - : Ŭ () / 1D  (Ķ  δ ̿  ڽ ̸ )
+//   Ʈ  (BlendTree)  ĳͳ ϰ, Ķ/ð/ BlendTreeInstance 
+// - :
+//   1. ٸ  ġ = Ʈ   ġ  ( 常̶   )
+//   2. ġ ִ ٸ øؼ   (AnimationPose::Accumulate) -> ȭ
+//   3.  ->  -> Ű ȷƮ
+// - ð: νϽ  (0 ~ 1) ϳ.   x ڱ ̿  (ȱ/ٱó ̰ ٸ ֱ Ŭ   )
+//    ӵ = 1 / (ġ   )
+// νϽ б⸸ ϹǷ ĳ   ýۿ   
+// ==========================================================
+
+class BlendTree
+{
+public:
+    using NodeIndex = std::uint32_t;
+
+    NodeIndex AddClip(const AnimationClip& clip);
+    // thresholds  , children   
+    NodeIndex AddBlend1D(std::uint32_t parameter, const std::vector<NodeIndex>& children, const std::vector<float>& thresholds);
+    void SetRoot(NodeIndex root) { mRoot = root; }
+
+    std::uint32_t GetParameterCount()const { return mParameterCount; }
+    std::uint32_t GetLeafCount()const { return (std::uint32_t)mLeaves.size(); }
+    const AnimationClip& GetLeafClip(std::uint32_t leaf)const { return *mLeaves[leaf]; }
+
+    // outWeights   ŭ.  1
+    void ComputeLeafWeights(const float* parameters, float* outWeights)const;
+
+private:
+    struct Node
+    {
+        bool IsClip = false;
+        std::uint32_t Leaf = 0;             // IsClip
+        std::uint32_t Parameter = 0;        // 1D 
+        std::uint32_t FirstChild = 0;       // mChildren / mThresholds  
+        std::uint32_t ChildCount = 0;
+    };
+
+    std::vector<Node> mNodes;
+    std::vector<NodeIndex> mChildren;
+    std::vector<float> mThresholds;
+    std::vector<const AnimationClip*> mLeaves;
+    NodeIndex mRoot = 0;
+    std::uint32_t mParameterCount = 0;
+};
+
+class BlendTreeInstance
+{
+public:
+    //     ø 
+    static constexpr float MinLeafWeight = 1e-3f;
+
+    BlendTreeInstance(const BlendTree& tree, const Skeleton& skeleton);
+
+    void SetParameter(std::uint32_t parameter, float value) { mParameters[parameter] = value; }
+    void SetPhase(float phase) { mPhase = phase; }
+    float GetPhase()const { return mPhase; }
+
+    //  dt ŭ (   ٽ 0 )
+    void Advance(float dt);
+
+    // ø +  +   + ȷƮ
+    void Evaluate();
+
+    const SoaTransform* GetLocalPose()const { return mLocal.data(); }
+    const Float4x4A* GetModel()const { return mModel.data(); }
+    const std::vector<SkinningMatrix>& GetPalette()const { return mPalette; }
+
+private:
+    const BlendTree* mTree;
+    const Skeleton* mSkeleton;
+
+    std::vector<float> mParameters;
+    std::vector<float> mLeafWeights;
+    float mPhase = 0.0f;
+
+    std::vector<AnimationSamplingCache> mCaches;    // ٸ
+    std::vector<SoaTransform> mSampled;             //  ϳ  ( )
+    std::vector<SoaTransform> mLocal;
+    std::vector<Float4x4A> mModel;
+    std::vector<SkinningMatrix> mPalette;
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include <algorithm>
+#include <cfloat>
+
+//  ڷᱸ(BVH, ε )   ּ/ִ AABB  
+// D3D/DirectXMath  float 
+
+struct Aabb
+{
+    float MinX = FLT_MAX, MinY = FLT_MAX, MinZ = FLT_MAX;
+    float MaxX = -FLT_MAX, MaxY = -FLT_MAX, MaxZ = -FLT_MAX;
+
+    static Aabb FromCenterExtent(float cx, float cy, float cz, float ex, float ey, float ez)
+    {
+        Aabb b;
+        b.MinX = cx - ex; b.MinY = cy - ey; b.MinZ = cz - ez;
+        b.MaxX = cx + ex; b.MaxY = cy + ey; b.MaxZ = cz + ez;
+        return b;
+    }
+
+    bool IsValid()const { return MinX <= MaxX && MinY <= MaxY && MinZ <= MaxZ; }
+
+    void Grow(float x, float y, float z)
+    {
+        MinX = std::min(MinX, x); MinY = std::min(MinY, y); MinZ = std::min(MinZ, z);
+        MaxX = std::max(MaxX, x); MaxY = std::max(MaxY, y); MaxZ = std::max(MaxZ, z);
+    }
+
+    void Grow(const Aabb& b)
+    {
+        MinX = std::min(MinX, b.MinX); MinY = std::min(MinY, b.MinY); MinZ = std::min(MinZ, b.MinZ);
+        MaxX = std::max(MaxX, b.MaxX); MaxY = std::max(MaxY, b.MaxY); MaxZ = std::max(MaxZ, b.MaxZ);
+    }
+
+    //   r ŭ Ű (  )
+    Aabb Expanded(float r)const
+    {
+        Aabb b = *this;
+        b.MinX -= r; b.MinY -= r; b.MinZ -= r;
+        b.MaxX += r; b.MaxY += r; b.MaxZ += r;
+        return b;
+    }
+
+    float CenterX()const { return 0.5f * (MinX + MaxX); }
+    float CenterY()const { return 0.5f * (MinY + MaxY); }
+    float CenterZ()const { return 0.5f * (MinZ + MaxZ); }
+
+    float SurfaceArea()const
+    {
+        if (!IsValid())
+            return 0.0f;
+        float dx = MaxX - MinX, dy = MaxY - MinY, dz = MaxZ - MinZ;
+        return 2.0f * (dx * dy + dy * dz + dz * dx);
+    }
+
+    bool Overlaps(const Aabb& b)const
+    {
+        return MinX <= b.MaxX && MaxX >= b.MinX &&
+            MinY <= b.MaxY && MaxY >= b.MinY &&
+            MinZ <= b.MaxZ && MaxZ >= b.MinZ;
+    }
+
+    bool Contains(const Aabb& b)const
+    {
+        return MinX <= b.MinX && MinY <= b.MinY && MinZ <= b.MinZ &&
+            MaxX >= b.MaxX && MaxY >= b.MaxY && MaxZ >= b.MaxZ;
+    }
+};
+
+struct Ray
+{
+    float OriginX = 0.0f, OriginY = 0.0f, OriginZ = 0.0f;
+    float DirX = 0.0f, DirY = 0.0f, DirZ = 1.0f; // ȭ  ص  (t Dir  )
+};
@@ -0,0 +1,377 @@
+#include "Broadphase.h"
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+    constexpr int StackSize = 256; //  + 1 ̸  (ȸ ǥ ֶ    )
+
+    Aabb Union(const Aabb& a, const Aabb& b)
+    {
+        Aabb c = a;
+        c.Grow(b);
+        return c;
+    }
+}
+
+Broadphase::Broadphase(float margin, float predictionScale)
+    : mMargin(margin), mPredictionScale(predictionScale)
+{
+}
+
+Broadphase::ProxyId Broadphase::CreateProxy(const Aabb& bounds, std::uint32_t userData)
+{
+    const std::int32_t proxy = AllocateNode();
+    Node& node = mNodes[proxy];
+    node.Bounds = bounds.Expanded(mMargin);
+    node.UserData = userData;
+    node.Height = 0;
+    node.Moved = true;
+
+    InsertLeaf(proxy);
+    mMoveBuffer.push_back(proxy);
+    ++mProxyCount;
+    return proxy;
+}
+
+void Broadphase::DestroyProxy(ProxyId proxy)
+{
+    assert(proxy >= 0 && proxy < (std::int32_t)mNodes.size() && mNodes[proxy].IsLeaf());
+
+    //  Ͽ    (UpdatePairs   带  )
+    if (mNodes[proxy].Moved)
+        mMoveBuffer.erase(std::remove(mMoveBuffer.begin(), mMoveBuffer.end(), proxy), mMoveBuffer.end());
+
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    --mProxyCount;
+}
+
+bool Broadphase::MoveProxy(ProxyId proxy, const Aabb& bounds, float dx, float dy, float dz)
+{
+    assert(proxy >= 0 && proxy < (std::int32_t)mNodes.size() && mNodes[proxy].IsLeaf());
+
+    // 1.  AABB ̸ ״. ,   ʹ ũ ( ̴ ) ٽ ־ 
+    const Aabb& fat = mNodes[proxy].Bounds;
+    if (fat.Contains(bounds) && bounds.Expanded(4.0f * mMargin).Contains(fat))
+        return false;
+
+    // 2.  + ̵  
+    Aabb grown = bounds.Expanded(mMargin);
+    const float px = dx * mPredictionScale, py = dy * mPredictionScale, pz = dz * mPredictionScale;
+    if (px < 0.0f) grown.MinX += px; else grown.MaxX += px;
+    if (py < 0.0f) grown.MinY += py; else grown.MaxY += py;
+    if (pz < 0.0f) grown.MinZ += pz; else grown.MaxZ += pz;
+
+    RemoveLeaf(proxy);
+    mNodes[proxy].Bounds = grown;
+    InsertLeaf(proxy);
+
+    if (!mNodes[proxy].Moved)
+    {
+        mNodes[proxy].Moved = true;
+        mMoveBuffer.push_back(proxy);
+    }
+    return true;
+}
+
+void Broadphase::QueryOverlap(const Aabb& box, std::vector<std::uint32_t>& out)const
+{
+    if (mRoot == NullProxy)
+        return;
+
+    std::int32_t stack[StackSize];
+    int top = 0;
+    stack[top++] = mRoot;
+
+    while (top > 0)
+    {
+        const Node& node = mNodes[stack[--top]];
+        if (!node.Bounds.Overlaps(box))
+            continue;
+
+        if (node.IsLeaf())
+        {
+            out.push_back(node.UserData);
+        }
+        else if (top + 2 <= StackSize)
+        {
+            stack[top++] = node.Child1;
+            stack[top++] = node.Child2;
+        }
+    }
+}
+
+void Broadphase::UpdatePairs(std::vector<BroadphasePair>& outPairs)
+{
+    outPairs.clear();
+
+    std::int32_t stack[StackSize];
+    for (ProxyId query : mMoveBuffer)
+    {
+        const Node& queryNode = mNodes[query];
+        if (mRoot == NullProxy)
+            break;
+
+        int top = 0;
+        stack[top++] = mRoot;
+        while (top > 0)
+        {
+            const std::int32_t index = stack[--top];
+            const Node& node = mNodes[index];
+            if (!node.Bounds.Overlaps(queryNode.Bounds))
+                continue;
+
+            if (!node.IsLeaf())
+            {
+                if (top + 2 <= StackSize)
+                {
+                    stack[top++] = node.Child1;
+                    stack[top++] = node.Child2;
+                }
+                continue;
+            }
+
+            // ڱ ڽ /    ȣ  ʿ
+            if (index == query || (node.Moved && index < query))
+                continue;
+
+            BroadphasePair pair;
+            pair.A = std::min(queryNode.UserData, node.UserData);
+            pair.B = std::max(queryNode.UserData, node.UserData);
+            outPairs.push_back(pair);
+        }
+    }
+
+    for (ProxyId proxy : mMoveBuffer)
+        mNodes[proxy].Moved = false;
+    mMoveBuffer.clear();
+
+    std::sort(outPairs.begin(), outPairs.end());
+    outPairs.erase(std::unique(outPairs.begin(), outPairs.end()), outPairs.end());
+}
+
+// ---------------------------------------------------------
+//  Ҵ (  )
+// ---------------------------------------------------------
+std::int32_t Broadphase::AllocateNode()
+{
+    if (mFreeList == NullProxy)
+    {
+        mNodes.emplace_back();
+        return (std::int32_t)mNodes.size() - 1;
+    }
+
+    const std::int32_t node = mFreeList;
+    mFreeList = mNodes[node].Parent;
+    mNodes[node] = Node();
+    return node;
+}
+
+void Broadphase::FreeNode(std::int32_t node)
+{
+    mNodes[node].Parent = mFreeList;
+    mNodes[node].Height = -1;
+    mFreeList = node;
+}
+
+// ---------------------------------------------------------
+//  / 
+// ---------------------------------------------------------
+void Broadphase::InsertLeaf(std::int32_t leaf)
+{
+    if (mRoot == NullProxy)
+    {
+        mRoot = leaf;
+        mNodes[leaf].Parent = NullProxy;
+        return;
+    }
+
+    // 1.  ã: ⼭ ߸   vs ڽ    (ǥ)
+    const Aabb leafBounds = mNodes[leaf].Bounds;
+    std::int32_t index = mRoot;
+    while (!mNodes[index].IsLeaf())
+    {
+        const Node& node = mNodes[index];
+        const float area = node.Bounds.SurfaceArea();
+        const float combinedArea = Union(node.Bounds, leafBounds).SurfaceArea();
+
+        // ⿡  θ :  θ +   Ŀ ŭ
+        const float cost = 2.0f * combinedArea;
+        const float inheritance = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](std::int32_t child)
+        {
+            const Node& c = mNodes[child];
+            const float grown = Union(c.Bounds, leafBounds).SurfaceArea();
+            return c.IsLeaf() ? grown + inheritance : (grown - c.Bounds.SurfaceArea()) + inheritance;
+        };
+        const float cost1 = descendCost(node.Child1);
+        const float cost2 = descendCost(node.Child2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+        index = cost1 < cost2 ? node.Child1 : node.Child2;
+    }
+
+    // 2.      θ
+    const std::int32_t sibling = index;
+    const std::int32_t oldParent = mNodes[sibling].Parent;
+    const std::int32_t newParent = AllocateNode();
+    mNodes[newParent].Parent = oldParent;
+    mNodes[newParent].Bounds = Union(leafBounds, mNodes[sibling].Bounds);
+    mNodes[newParent].Height = mNodes[sibling].Height + 1;
+    mNodes[newParent].Child1 = sibling;
+    mNodes[newParent].Child2 = leaf;
+    mNodes[sibling].Parent = newParent;
+    mNodes[leaf].Parent = newParent;
+
+    if (oldParent == NullProxy)
+        mRoot = newParent;
+    else if (mNodes[oldParent].Child1 == sibling)
+        mNodes[oldParent].Child1 = newParent;
+    else
+        mNodes[oldParent].Child2 = newParent;
+
+    // 3. ö󰡸鼭 ٿ/  + ȸ
+    index = mNodes[leaf].Parent;
+    while (index != NullProxy)
+    {
+        Refresh(index);
+        Rotate(index);
+        index = mNodes[index].Parent;
+    }
+}
+
+void Broadphase::RemoveLeaf(std::int32_t leaf)
+{
+    if (leaf == mRoot)
+    {
+        mRoot = NullProxy;
+        return;
+    }
+
+    // θ ְ  θ ٷ 
+    const std::int32_t parent = mNodes[leaf].Parent;
+    const std::int32_t grandParent = mNodes[parent].Parent;
+    const std::int32_t sibling = mNodes[parent].Child1 == leaf ? mNodes[parent].Child2 : mNodes[parent].Child1;
+
+    FreeNode(parent);
+    mNodes[sibling].Parent = grandParent;
+    if (grandParent == NullProxy)
+    {
+        mRoot = sibling;
+        return;
+    }
+
+    if (mNodes[grandParent].Child1 == parent)
+        mNodes[grandParent].Child1 = sibling;
+    else
+        mNodes[grandParent].Child2 = sibling;
+
+    std::int32_t index = grandParent;
+    while (index != NullProxy)
+    {
+        Refresh(index);
+        Rotate(index);
+        index = mNodes[index].Parent;
+    }
+}
+
+void Broadphase::Refresh(std::int32_t index)
+{
+    Node& node = mNodes[index];
+    const Node& c1 = mNodes[node.Child1];
+    const Node& c2 = mNodes[node.Child2];
+    node.Height = 1 + std::max(c1.Height, c2.Height);
+    node.Bounds = Union(c1.Bounds, c2.Bounds);
+}
+
+// ---------------------------------------------------------
+// ȸ: ڽ ϳ ݴ ڸ ٲ㼭 ٲ   ǥ ٸ ٲ (A  Refresh  )
+// (̸  AVL ȸ ó ū ڸ     Ŀ)
+// ---------------------------------------------------------
+void Broadphase::Rotate(std::int32_t iA)
+{
+    Node& A = mNodes[iA];
+    if (A.Height < 2)
+        return;
+
+    const std::int32_t iB = A.Child1;
+    const std::int32_t iC = A.Child2;
+    const Node& B = mNodes[iB];
+    const Node& C = mNodes[iC];
+
+    // ĺ: B <-> C  ڽ (C  ٽ ), C <-> B  ڽ (B  ٽ )
+    // ǥ ȭ   ()  ϳ
+    float best = 0.0f;
+    std::int32_t swapChild = NullProxy, swapGrandChild = NullProxy;
+    auto consider = [&](std::int32_t iChild, const Node& other)
+    {
+        if (other.IsLeaf())
+            return;
+        const float area = other.Bounds.SurfaceArea();
+        const std::int32_t grand[2] = { other.Child1, other.Child2 };
+        for (int k = 0; k < 2; ++k)
+        {
+            // other  grand[k]  iChild  ٲٸ other = iChild + grand[1 - k]
+            const float delta = Union(mNodes[iChild].Bounds, mNodes[grand[1 - k]].Bounds).SurfaceArea() - area;
+            if (delta < best)
+            {
+                best = delta;
+                swapChild = iChild;
+                swapGrandChild = grand[k];
+            }
+        }
+    };
+    consider(iB, C);
+    consider(iC, B);
+    if (swapChild == NullProxy)
+        return;
+
+    // ڸ A  ø ڽ  ڸ
+    const std::int32_t iOther = swapChild == iB ? iC : iB;
+    Node& other = mNodes[iOther];
+    if (other.Child1 == swapGrandChild)
+        other.Child1 = swapChild;
+    else
+        other.Child2 = swapChild;
+    mNodes[swapChild].Parent = iOther;
+
+    if (A.Child1 == swapChild)
+        A.Child1 = swapGrandChild;
+    else
+        A.Child2 = swapGrandChild;
+    mNodes[swapGrandChild].Parent = iA;
+
+    Refresh(iOther);
+    Refresh(iA);
+}
+
+// ---------------------------------------------------------
+// ˻
+// ---------------------------------------------------------
+bool Broadphase::Validate()const
+{
+    if (mRoot == NullProxy)
+        return mProxyCount == 0;
+    return ValidateNode(mRoot, NullProxy);
+}
+
+bool Broadphase::ValidateNode(std::int32_t index, std::int32_t parent)const
+{
+    const Node& node = mNodes[index];
+    if (node.Parent != parent)
+        return false;
+    if (node.IsLeaf())
+        return node.Height == 0 && node.Child2 == NullProxy;
+
+    const Node& c1 = mNodes[node.Child1];
+    const Node& c2 = mNodes[node.Child2];
+    if (node.Height != 1 + std::max(c1.Height, c2.Height))
+        return false;
+    if (!node.Bounds.Contains(c1.Bounds) || !node.Bounds.Contains(c2.Bounds))
+        return false;
+
+    return ValidateNode(node.Child1, index) && ValidateNode(node.Child2, index);
+}
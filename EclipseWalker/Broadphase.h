@@ -0,0 +1,86 @@
+#pragma once
+#include "Bounds.h"
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+//  ε ( AABB Ʈ)
+// - Ͻø (fat) AABB   :  AABB +  + ̵  
+//    AABB   AABB ȿ ִ  Ʈ  ǵ帮Ƿ ̴ ٵ Ƶ 
+// -  ǥ      ã , ö鼭 ڽ/ڸ ٲ ǥ ٸ ȸ (Box2D v3 )
+// -  迭 +    (ȣ  ٲ = Ͻ ȣ)
+// - UpdatePairs:  ȣ ڷ ٽ  Ͻð  ħ ָ (    )
+// SceneBVH  / ,  ְ  ̴ ٵ.    (D3D )
+// ==========================================================
+
+struct BroadphasePair
+{
+    std::uint32_t A = 0; //   (A < B)
+    std::uint32_t B = 0;
+
+    bool operator<(const BroadphasePair& o)const { return A != o.A ? A < o.A : B < o.B; }
+    bool operator==(const BroadphasePair& o)const { return A == o.A && B == o.B; }
+};
+
+class Broadphase
+{
+public:
+    using ProxyId = std::int32_t;
+    static constexpr ProxyId NullProxy = -1;
+
+    // margin =  AABB   (m),    ̵ x PredictionScale
+    explicit Broadphase(float margin = 0.1f, float predictionScale = 2.0f);
+
+    ProxyId CreateProxy(const Aabb& bounds, std::uint32_t userData);
+    void DestroyProxy(ProxyId proxy);
+
+    //  AABB   AABB    ٽ  (ٽ ־ true)
+    bool MoveProxy(ProxyId proxy, const Aabb& bounds, float dx, float dy, float dz);
+
+    //  AABB  box  ġ Ͻ   (out ڿ )
+    void QueryOverlap(const Aabb& box, std::vector<std::uint32_t>& out)const;
+
+    //  ĥ  ְ   (, ߺ ). ȣϸ   
+    void UpdatePairs(std::vector<BroadphasePair>& outPairs);
+
+    std::uint32_t GetUserData(ProxyId proxy)const { return mNodes[proxy].UserData; }
+    const Aabb& GetFatBounds(ProxyId proxy)const { return mNodes[proxy].Bounds; }
+    std::uint32_t GetProxyCount()const { return mProxyCount; }
+    std::int32_t GetHeight()const { return mRoot == NullProxy ? 0 : mNodes[mRoot].Height; }
+
+    //  ˻ (θ/ڽ , , ٿ  ). ߿
+    bool Validate()const;
+
+private:
+    struct Node
+    {
+        Aabb Bounds;
+        std::int32_t Parent = NullProxy;    //     
+        std::int32_t Child1 = NullProxy;
+        std::int32_t Child2 = NullProxy;
+        std::int32_t Height = -1;           //  0,   -1
+        std::uint32_t UserData = 0;
+        bool Moved = false;
+
+        bool IsLeaf()const { return Child1 == NullProxy; }
+    };
+
+    std::int32_t AllocateNode();
+    void FreeNode(std::int32_t node);
+    void InsertLeaf(std::int32_t leaf);
+    void RemoveLeaf(std::int32_t leaf);
+    void Rotate(std::int32_t node);
+    void Refresh(std::int32_t node);
+    bool ValidateNode(std::int32_t node, std::int32_t parent)const;
+
+private:
+    std::vector<Node> mNodes;
+    std::int32_t mRoot = NullProxy;
+    std::int32_t mFreeList = NullProxy;
+    std::uint32_t mProxyCount = 0;
+
+    float mMargin;
+    float mPredictionScale;
+
+    std::vector<ProxyId> mMoveBuffer;
+};
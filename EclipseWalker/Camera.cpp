@@ -5,6 +5,7 @@ using namespace DirectX;
 Camera::Camera()
 {
     SetLens(0.25f * XM_PI, 1.0f, 1.0f, 1000.0f);
+    UpdateViewMatrix();
 }
 
 Camera::~Camera()
@@ -60,6 +61,14 @@ void Camera::SetLens(float fovY, float aspect, float zn, float zf)
 
     XMMATRIX P = XMMatrixPerspectiveFovLH(mFovY, mAspect, mNearZ, mFarZ);
     XMStoreFloat4x4(&mProj, P);
+
+    mProjDirty = true;
+}
+
+float Camera::GetFovX()const
+{
+    float halfWidth = 0.5f * GetNearWindowWidth();
+    return 2.0f * atanf(halfWidth / mNearZ);
 }
 
 void Camera::LookAt(FXMVECTOR pos, FXMVECTOR target, FXMVECTOR worldUp)
@@ -132,6 +141,8 @@ void Camera::RotateY(float angle)
 
 void Camera::UpdateViewMatrix()
 {
+    bool viewChanged = false;
+
     if (mViewDirty)
     {
         XMVECTOR R = XMLoadFloat3(&mRight);
@@ -153,13 +164,24 @@ void Camera::UpdateViewMatrix()
         XMStoreFloat3(&mUp, U);
         XMStoreFloat3(&mLook, L);
 
-        mView(0, 0) = mRight.x; mView(0, 1) = mUp.x; mView(0, 2) = mLook.x; mView(0, 3) = 0.0f;
-        mView(1, 0) = mRight.y; mView(1, 1) = mUp.y; mView(1, 2) = mLook.y; mView(1, 3) = 0.0f;
-        mView(2, 0) = mRight.z; mView(2, 1) = mUp.z; mView(2, 2) = mLook.z; mView(2, 3) = 0.0f;
-        mView(3, 0) = x;        mView(3, 1) = y;        mView(3, 2) = z;        mView(3, 3) = 1.0f;
+        XMFLOAT4X4 view;
+        view(0, 0) = mRight.x; view(0, 1) = mUp.x; view(0, 2) = mLook.x; view(0, 3) = 0.0f;
+        view(1, 0) = mRight.y; view(1, 1) = mUp.y; view(1, 2) = mLook.y; view(1, 3) = 0.0f;
+        view(2, 0) = mRight.z; view(2, 1) = mUp.z; view(2, 2) = mLook.z; view(2, 3) = 0.0f;
+        view(3, 0) = x;        view(3, 1) = y;        view(3, 2) = z;        view(3, 3) = 1.0f;
+
+        //   LookAt ٽ ҷ  ״θ  ø 
+        viewChanged = memcmp(&view, &mView, sizeof(XMFLOAT4X4)) != 0;
+        mView = view;
 
         mViewDirty = false;
     }
+
+    if (viewChanged || mProjDirty)
+    {
+        UpdateDerived();
+        mProjDirty = false;
+    }
 }
 
 XMMATRIX Camera::GetView()const
@@ -174,5 +196,37 @@ XMMATRIX Camera::GetProj()const
 
 XMMATRIX Camera::GetViewProj()const
 {
-    return XMMatrixMultiply(GetView(), GetProj());
+    return XMLoadFloat4x4A(&mDerived.ViewProj);
+}
+
+XMMATRIX Camera::GetInvView()const
+{
+    return XMLoadFloat4x4A(&mDerived.InvView);
+}
+
+XMMATRIX Camera::GetInvProj()const
+{
+    return XMLoadFloat4x4A(&mDerived.InvProj);
+}
+
+XMMATRIX Camera::GetInvViewProj()const
+{
+    return XMLoadFloat4x4A(&mDerived.InvViewProj);
+}
+
+void Camera::UpdateDerived()
+{
+    XMMATRIX view = XMLoadFloat4x4(&mView);
+    XMMATRIX proj = XMLoadFloat4x4(&mProj);
+    XMMATRIX viewProj = XMMatrixMultiply(view, proj);
+
+    XMStoreFloat4x4A(&mDerived.ViewProj, viewProj);
+    XMStoreFloat4x4A(&mDerived.InvView, XMMatrixInverse(nullptr, view));
+    XMStoreFloat4x4A(&mDerived.InvProj, XMMatrixInverse(nullptr, proj));
+    XMStoreFloat4x4A(&mDerived.InvViewProj, XMMatrixInverse(nullptr, viewProj));
+
+    // ViewProj Ŀ    ٷ ̾Ƴ
+    FrustumCulling::ExtractPlanes(&mDerived.ViewProj.m[0][0], mDerived.WorldFrustum);
+
+    ++mVersion;
 }
\ No newline at end of file
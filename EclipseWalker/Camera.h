@@ -1,5 +1,17 @@
 #pragma once
 #include "d3dUtil.h"
+#include "FrustumCulling.h"
+#include <cstdint>
+
+// / ĻǴ   (䳪  ٲ ӿ ٽ )
+struct alignas(16) CameraDerived
+{
+    DirectX::XMFLOAT4X4A ViewProj;
+    DirectX::XMFLOAT4X4A InvView;
+    DirectX::XMFLOAT4X4A InvProj;
+    DirectX::XMFLOAT4X4A InvViewProj;
+    Frustum WorldFrustum; //    6
+};
 
 class Camera
 {
@@ -21,6 +33,17 @@ public:
     // 2.   (ٰ, þ߰)
     void SetLens(float fovY, float aspect, float zn, float zf);
 
+    float GetNearZ()const { return mNearZ; }
+    float GetFarZ()const { return mFarZ; }
+    float GetAspect()const { return mAspect; }
+    float GetFovY()const { return mFovY; }
+    float GetFovX()const;
+
+    float GetNearWindowWidth()const { return mAspect * mNearWindowHeight; }
+    float GetNearWindowHeight()const { return mNearWindowHeight; }
+    float GetFarWindowWidth()const { return mAspect * mFarWindowHeight; }
+    float GetFarWindowHeight()const { return mFarWindowHeight; }
+
     // 3. ī޶ 
     void LookAt(DirectX::FXMVECTOR pos, DirectX::FXMVECTOR target, DirectX::FXMVECTOR worldUp);
     void LookAt(const DirectX::XMFLOAT3& pos, const DirectX::XMFLOAT3& target, const DirectX::XMFLOAT3& up);
@@ -34,10 +57,26 @@ public:
     void RotateY(float angle); //  
 
     // 4.  
+    // UpdateViewMatrix() /  ٲ    Ļ ͸ ٽ 
+    // (Ʒ Get Լ  UpdateViewMatrix()  )
     void UpdateViewMatrix(); 
     DirectX::XMMATRIX GetView()const;
     DirectX::XMMATRIX GetProj()const;
     DirectX::XMMATRIX GetViewProj()const;
+    DirectX::XMMATRIX GetInvView()const;
+    DirectX::XMMATRIX GetInvProj()const;
+    DirectX::XMMATRIX GetInvViewProj()const;
+
+    // 5. ü (   6)
+    const Frustum& GetFrustum()const { return mDerived.WorldFrustum; }
+    const CameraDerived& GetDerived()const { return mDerived; }
+
+    // 6. Ļ Ͱ ٽ   1 
+    // ø, ׸ ĳ̵, Ʈ      ۾ ǳʶٸ 
+    std::uint64_t GetVersion()const { return mVersion; }
+
+private:
+    void UpdateDerived();
 
 private:
     // ī޶ ġ  
@@ -55,6 +94,10 @@ private:
     float mFarWindowHeight = 0.0f;
 
     bool mViewDirty = true; 
+    bool mProjDirty = true;
+
+    std::uint64_t mVersion = 0;
+    CameraDerived mDerived = {};
 
     //  
     DirectX::XMFLOAT4X4 mView = {
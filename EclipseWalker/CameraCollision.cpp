@@ -0,0 +1,55 @@
+#include "CameraCollision.h"
+#include "SweepTests.h"
+#include <cmath>
+
+void CameraCollision::Update(const SceneBVH& world, const float focus[3], const float desired[3], float dt, float outPosition[3])
+{
+    Update(world, [&world, radius = mSettings.Radius](std::uint32_t prim, const Ray& ray, float limit) -> float
+        {
+            return SweepTests::SphereAabb(ray, radius, world.GetPrimitiveBounds(prim), limit);
+        }, focus, desired, dt, outPosition);
+}
+
+void CameraCollision::Update(const SceneBVH& world, const SceneBVH::RayPrimitiveTest& test,
+    const float focus[3], const float desired[3], float dt, float outPosition[3])
+{
+    const float dir[3] = { desired[0] - focus[0], desired[1] - focus[1], desired[2] - focus[2] };
+    const float length = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+    if (length < 1e-6f)
+    {
+        outPosition[0] = focus[0]; outPosition[1] = focus[1]; outPosition[2] = focus[2];
+        mDistance = 0.0f;
+        mBlocked = false;
+        return;
+    }
+
+    // 1. focus -> desired  (t  0 ~ 1,   ٲ㼭)
+    Ray ray;
+    ray.OriginX = focus[0]; ray.OriginY = focus[1]; ray.OriginZ = focus[2];
+    ray.DirX = dir[0]; ray.DirY = dir[1]; ray.DirZ = dir[2];
+
+    std::uint32_t prim = 0;
+    float t = 1.0f;
+    mBlocked = world.SphereCast(ray, mSettings.Radius, 1.0f, test, prim, t);
+
+    float allowed = mBlocked ? t * length : length;
+    allowed = std::max(allowed, std::min(mSettings.MinDistance, length));
+
+    // 2.   ٷ, ־  
+    if (mDistance < 0.0f || allowed < mDistance)
+        mDistance = allowed;
+    else
+        mDistance += (allowed - mDistance) * (1.0f - std::exp(-mSettings.ReturnRate * dt));
+
+    const float s = mDistance / length;
+    outPosition[0] = focus[0] + dir[0] * s;
+    outPosition[1] = focus[1] + dir[1] * s;
+    outPosition[2] = focus[2] + dir[2] * s;
+}
+
+float CameraCollision::NearPlaneRadius(float nearZ, float fovY, float aspect)
+{
+    const float halfHeight = nearZ * std::tan(0.5f * fovY);
+    const float halfWidth = halfHeight * aspect;
+    return std::sqrt(nearZ * nearZ + halfHeight * halfHeight + halfWidth * halfWidth);
+}
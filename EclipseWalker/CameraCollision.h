@@ -0,0 +1,47 @@
+#pragma once
+#include "SceneBVH.h"
+
+// ==========================================================
+// 3Ī ī޶ 浹
+// - ٶ󺸴 (focus)  ϴ ī޶ ġ(desired)    (SceneBVH::SphereCast)
+//      Ÿ 
+// -    ӿ ٷ (  ̸  ǹǷ)
+//     Ǯ  Ÿ   õõ ư ( ĥ  Ƣ ʰ)
+// -    簢  ŭ (NearPlaneRadius)
+// D3D    (ġ float[3])
+// ==========================================================
+
+struct CameraCollisionSettings
+{
+    float Radius = 0.3f;        // ī޶  
+    float ReturnRate = 4.0f;    // ư  1ʿ  Ÿ 1 - e^-ReturnRate ŭ
+    float MinDistance = 0.0f;   // focus  ̺ ̴  
+};
+
+class CameraCollision
+{
+public:
+    explicit CameraCollision(const CameraCollisionSettings& settings = CameraCollisionSettings()) : mSettings(settings) {}
+
+    // ̹  ī޶ ġ (outPosition). test  Ƽ  ( Ƽ AABB)
+    void Update(const SceneBVH& world, const float focus[3], const float desired[3], float dt, float outPosition[3]);
+    void Update(const SceneBVH& world, const SceneBVH::RayPrimitiveTest& test,
+        const float focus[3], const float desired[3], float dt, float outPosition[3]);
+
+    //  ̵  ( Update    ٷ)
+    void Reset() { mDistance = -1.0f; }
+
+    void SetSettings(const CameraCollisionSettings& settings) { mSettings = settings; }
+    const CameraCollisionSettings& GetSettings()const { return mSettings; }
+
+    float GetDistance()const { return mDistance; }  //  focus κ Ÿ
+    bool IsBlocked()const { return mBlocked; }      // ̹   ¾Ҵ
+
+    //  簢 (ī޶ ġ)  Ÿ =    ̸    
+    static float NearPlaneRadius(float nearZ, float fovY, float aspect);
+
+private:
+    CameraCollisionSettings mSettings;
+    float mDistance = -1.0f; // < 0 ̸  ó
+    bool mBlocked = false;
+};
@@ -0,0 +1,265 @@
+#include "CameraCollisionBenchmark.h"
+#include "SceneBVH.h"
+#include "SweepTests.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float CellSize = 8.0f;        // ĭ  ϳ, ĭ 𼭸 
+    constexpr float CameraRadius = 0.3f;
+    constexpr float BackDistance = 6.0f;    // Ӱ   Ÿ
+    constexpr float UpOffset = 1.0f;
+
+    // ȸ + ϵ  ( 켱 4x4,   Ծ)
+    struct TestBox
+    {
+        float World[16];
+        float Extent[3];
+    };
+
+    //  ȸ ڱ Ÿ (double, )
+    double BoxDistance(const TestBox& box, const double p[3])
+    {
+        double sq = 0.0;
+        for (int i = 0; i < 3; ++i)
+        {
+            const float* axis = box.World + i * 4;
+            const double len = std::sqrt((double)axis[0] * axis[0] + (double)axis[1] * axis[1] + (double)axis[2] * axis[2]);
+            const double local = ((p[0] - box.World[12]) * axis[0] + (p[1] - box.World[13]) * axis[1] + (p[2] - box.World[14]) * axis[2]) / len;
+            const double h = box.Extent[i] * len;
+            const double d = std::max(std::fabs(local) - h, 0.0);
+            sq += d * d;
+        }
+        return std::sqrt(sq);
+    }
+
+    double DistanceAt(const TestBox& box, const Ray& ray, double t)
+    {
+        const double p[3] = { ray.OriginX + ray.DirX * t, ray.OriginY + ray.DirY * t, ray.OriginZ + ray.DirZ * t };
+        return BoxDistance(box, p);
+    }
+
+    //       Ÿ  Լ ->  Ž [a, b] ּ
+    double MinDistance(const TestBox& box, const Ray& ray, double a, double b)
+    {
+        for (int i = 0; i < 200; ++i)
+        {
+            const double m0 = a + (b - a) / 3.0;
+            const double m1 = b - (b - a) / 3.0;
+            if (DistanceAt(box, ray, m0) < DistanceAt(box, ray, m1))
+                b = m1;
+            else
+                a = m0;
+        }
+        return DistanceAt(box, ray, 0.5 * (a + b));
+    }
+
+    // 1.  ȸ  vs  . Ȯ ù 
+    std::uint32_t CheckSphereBox(std::uint32_t count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> size(0.2f, 2.0f);
+        std::uniform_real_distribution<float> radius(0.05f, 1.0f);
+
+        const double tol = 1e-3;
+        std::uint32_t errors = 0;
+
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            //  ʹϾ ->    3, ึ 
+            float q[4] = { unit(rng), unit(rng), unit(rng), unit(rng) };
+            const float qn = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            if (qn < 1e-3f)
+                continue;
+            for (float& c : q)
+                c /= qn;
+            const float x = q[0], y = q[1], z = q[2], w = q[3];
+            const float rot[9] =
+            {
+                1 - 2 * (y * y + z * z), 2 * (x * y + z * w),     2 * (x * z - y * w),
+                2 * (x * y - z * w),     1 - 2 * (x * x + z * z), 2 * (y * z + x * w),
+                2 * (x * z + y * w),     2 * (y * z - x * w),     1 - 2 * (x * x + y * y),
+            };
+
+            TestBox box;
+            for (int r = 0; r < 3; ++r)
+            {
+                const float scale = size(rng);
+                box.World[r * 4 + 0] = rot[r * 3 + 0] * scale;
+                box.World[r * 4 + 1] = rot[r * 3 + 1] * scale;
+                box.World[r * 4 + 2] = rot[r * 3 + 2] * scale;
+                box.World[r * 4 + 3] = 0.0f;
+                box.Extent[r] = size(rng);
+            }
+            box.World[12] = unit(rng); box.World[13] = unit(rng); box.World[14] = unit(rng); box.World[15] = 1.0f;
+
+            //  ó :    ߽ ó  
+            Ray ray;
+            ray.OriginX = unit(rng) * 8.0f; ray.OriginY = unit(rng) * 8.0f; ray.OriginZ = unit(rng) * 8.0f;
+            ray.DirX = box.World[12] + unit(rng) * 3.0f - ray.OriginX;
+            ray.DirY = box.World[13] + unit(rng) * 3.0f - ray.OriginY;
+            ray.DirZ = box.World[14] + unit(rng) * 3.0f - ray.OriginZ;
+            const float r = radius(rng);
+            const float tMax = 1.5f;
+
+            const float t = SweepTests::SphereBox(ray, r, box.World, box.Extent[0], box.Extent[1], box.Extent[2], tMax);
+
+            bool ok;
+            if (t < 0.0f)
+                ok = MinDistance(box, ray, 0.0, tMax) >= r - tol;
+            else if (t == 0.0f)
+                ok = DistanceAt(box, ray, 0.0) <= r + tol;
+            else
+                ok = std::fabs(DistanceAt(box, ray, t) - r) <= tol && MinDistance(box, ray, 0.0, t) >= r - tol;
+
+            if (!ok)
+                ++errors;
+        }
+        return errors;
+    }
+
+    // 2.   ( AABB)
+    void BuildCity(std::uint32_t count, std::mt19937& rng, std::vector<Aabb>& boxes, std::uint32_t& side)
+    {
+        std::uniform_real_distribution<float> jitter(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> width(0.5f, 3.0f);
+        std::uniform_real_distribution<float> height(1.0f, 10.0f);
+
+        side = (std::uint32_t)std::ceil(std::sqrt((double)count));
+        boxes.resize(count);
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const float cx = ((i % side) + 0.5f) * CellSize + jitter(rng);
+            const float cz = ((i / side) + 0.5f) * CellSize + jitter(rng);
+            const float ey = height(rng);
+            boxes[i] = Aabb::FromCenterExtent(cx, ey, cz, width(rng), ey, width(rng));
+        }
+    }
+
+    float BruteSweep(const std::vector<Aabb>& boxes, const Ray& ray, float radius, float tMax)
+    {
+        float best = -1.0f;
+        for (const Aabb& box : boxes)
+        {
+            const float t = SweepTests::SphereAabb(ray, radius, box, tMax);
+            if (t >= 0.0f && (best < 0.0f || t < best))
+                best = t;
+        }
+        return best;
+    }
+}
+
+namespace CameraCollisionBenchmark
+{
+    CameraCollisionBenchmarkResult Run(std::uint32_t primitiveCount, std::uint32_t queries, std::uint32_t seed)
+    {
+        CameraCollisionBenchmarkResult result;
+        result.Primitives = primitiveCount;
+        result.Queries = queries;
+
+        std::mt19937 rng(seed);
+        result.SweepErrors = CheckSphereBox(20000, rng);
+
+        // 1.  + BVH
+        std::vector<Aabb> boxes;
+        std::uint32_t side = 0;
+        BuildCity(primitiveCount, rng, boxes, side);
+
+        SceneBVH bvh;
+        auto t0 = Clock::now();
+        bvh.Build(boxes);
+        auto t1 = Clock::now();
+        result.BuildMs = ElapsedMs(t0, t1);
+        result.Nodes = bvh.GetNodeCount();
+
+        // 2.   ĳ Ӹ    ġ
+        std::uniform_int_distribution<std::uint32_t> corner(1, std::max(side, 2u) - 1);
+        std::uniform_real_distribution<float> yaw(0.0f, 6.2831853f);
+
+        std::vector<Ray> rays(queries);
+        for (Ray& ray : rays)
+        {
+            const float angle = yaw(rng);
+            ray.OriginX = corner(rng) * CellSize;
+            ray.OriginY = 1.5f;
+            ray.OriginZ = corner(rng) * CellSize;
+            ray.DirX = -std::cos(angle) * BackDistance;
+            ray.DirY = UpOffset;
+            ray.DirZ = -std::sin(angle) * BackDistance;
+        }
+
+        std::vector<float> hits(queries);
+        t0 = Clock::now();
+        for (std::uint32_t i = 0; i < queries; ++i)
+        {
+            std::uint32_t prim = 0;
+            float t = 1.0f;
+            hits[i] = bvh.SphereCast(rays[i], CameraRadius, 1.0f, prim, t) ? t : -1.0f;
+        }
+        t1 = Clock::now();
+        result.SweepUs = ElapsedMs(t0, t1) * 1000.0 / std::max(queries, 1u);
+
+        std::uint32_t hitCount = 0;
+        double pull = 0.0;
+        const double length = std::sqrt((double)BackDistance * BackDistance + UpOffset * UpOffset);
+        for (float t : hits)
+        {
+            if (t < 0.0f)
+                continue;
+            ++hitCount;
+            pull += (1.0 - t) * length;
+        }
+        result.HitPercent = 100.0 * hitCount / std::max(queries, 1u);
+        result.AveragePull = hitCount > 0 ? pull / hitCount : 0.0;
+
+        // 3. Ϻθ  Ⱦ  (Ƽ갡  )
+        const std::uint32_t bruteCount = std::min(queries, std::max(16u, 4000000u / std::max(primitiveCount, 1u)));
+        t0 = Clock::now();
+        for (std::uint32_t i = 0; i < bruteCount; ++i)
+        {
+            const float expected = BruteSweep(boxes, rays[i], CameraRadius, 1.0f);
+            if ((expected < 0.0f) != (hits[i] < 0.0f) || std::fabs(expected - hits[i]) > 1e-5f)
+                ++result.Mismatches;
+        }
+        t1 = Clock::now();
+        result.BruteUs = ElapsedMs(t0, t1) * 1000.0 / std::max(bruteCount, 1u);
+
+        result.Valid = result.SweepErrors == 0 && result.Mismatches == 0;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[CameraCollisionBenchmark]\n";
+        report += "     prims   nodes  build(ms)  sweep(us)  brute(us)  hit(%)  pull(m)  errors  valid\n";
+
+        bool valid = true;
+        for (std::uint32_t count : { 10000u, 100000u, 1000000u })
+        {
+            CameraCollisionBenchmarkResult r = Run(count, 100000);
+            valid = valid && r.Valid;
+
+            char line[160];
+            snprintf(line, sizeof(line), "%10u %7u %10.2f %10.3f %10.1f %7.1f %8.2f %7u  %s\n",
+                r.Primitives, r.Nodes, r.BuildMs, r.SweepUs, r.BruteUs, r.HitPercent, r.AveragePull,
+                r.SweepErrors + r.Mismatches, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
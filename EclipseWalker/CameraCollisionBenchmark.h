@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ī޶ 浹 ( )  (߿)
+//   (ĭ ũⰡ ٸ  ϳ)    ο 3Ī ī޶ ġ 
+//  Ȯ:
+//   1. SweepTests::SphereBox  Ȯ (ȸ ڿ   ּ Ÿ  ؼ )
+//   2. BVH   ȴ  
+// ==========================================================
+
+struct CameraCollisionBenchmarkResult
+{
+    std::uint32_t Primitives = 0;
+    std::uint32_t Nodes = 0;
+    std::uint32_t Queries = 0;
+
+    double BuildMs = 0.0;
+    double SweepUs = 0.0;           // BVH  1ȸ 
+    double BruteUs = 0.0;           //  ȱ 1ȸ  ( Ϻθ)
+    double HitPercent = 0.0;        //   
+    double AveragePull = 0.0;       //     Ÿ (m)
+
+    std::uint32_t SweepErrors = 0;  // Ȯ ˻  ( vs )
+    std::uint32_t Mismatches = 0;   // BVH !=  ȱ
+    bool Valid = false;
+};
+
+namespace CameraCollisionBenchmark
+{
+    CameraCollisionBenchmarkResult Run(std::uint32_t primitiveCount, std::uint32_t queries, std::uint32_t seed = 45);
+
+    // 10k / 100k / 1M
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,504 @@
+#include "CharacterBenchmark.h"
+#include "CharacterController.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float Dt = 1.0f / 60.0f;
+    constexpr float CellSize = 8.0f;
+    constexpr float WalkSpeed = 4.0f;       // m/s
+    constexpr std::uint32_t TurnTicks = 90; // ̸ŭ  ٲ
+
+    //  켱 4x4 ( =  x  1, ġ).  ũ AddBox  extent 
+    void BoxWorld(float cx, float cy, float cz, const float rows[9], float world[16])
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            world[i * 4 + 0] = rows[i * 3 + 0];
+            world[i * 4 + 1] = rows[i * 3 + 1];
+            world[i * 4 + 2] = rows[i * 3 + 2];
+            world[i * 4 + 3] = 0.0f;
+        }
+        world[12] = cx; world[13] = cy; world[14] = cz; world[15] = 1.0f;
+    }
+
+    void AddBox(CollisionWorld& world, float cx, float cy, float cz, float ex, float ey, float ez)
+    {
+        const float rows[9] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+        float m[16];
+        BoxWorld(cx, cy, cz, rows, m);
+        world.AddBox(m, ex, ey, ez);
+    }
+
+    // Y  ȸ (ǹ)
+    void AddYawBox(CollisionWorld& world, float cx, float cy, float cz, float ex, float ey, float ez, float yaw)
+    {
+        const float c = std::cos(yaw), s = std::sin(yaw);
+        const float rows[9] = { c, 0, -s, 0, 1, 0, s, 0, c };
+        float m[16];
+        BoxWorld(cx, cy, cz, rows, m);
+        world.AddBox(m, ex, ey, ez);
+    }
+
+    // +X  ö󰡴 :  (x0, 0)  ؼ  2 * ex ŭ
+    void AddRamp(CollisionWorld& world, float x0, float degrees, float ex, float ez)
+    {
+        const float a = degrees * 3.14159265f / 180.0f;
+        const float c = std::cos(a), s = std::sin(a);
+        const float ey = 0.25f;
+        const float rows[9] = { c, s, 0, -s, c, 0, 0, 0, 1 };
+        float m[16];
+        BoxWorld(x0 + ex * c + ey * s, ex * s - ey * c, 0.0f, rows, m);
+        world.AddBox(m, ex, ey, ez);
+    }
+
+    void AddGround(CollisionWorld& world, float halfSize)
+    {
+        AddBox(world, 0.0f, -0.5f, 0.0f, halfSize, 0.5f, halfSize);
+    }
+
+    // ---------------------------------------------------------
+    // 1. 麰 
+    // ---------------------------------------------------------
+    struct Walk
+    {
+        CharacterState Final;
+        std::uint32_t AirTicks = 0; //   ִ ƽ
+    };
+
+    Walk WalkFor(CollisionWorld& world, float x, float y, float z, float moveX, float moveZ, std::uint32_t ticks)
+    {
+        CharacterController controller;
+        const float start[3] = { x, y, z };
+        controller.Spawn(world, start);
+
+        Walk walk;
+        for (std::uint32_t i = 0; i < ticks; ++i)
+        {
+            controller.Move(world, moveX, moveZ, Dt);
+            if (i > 0 && !controller.GetState().Grounded)
+                ++walk.AirTicks;
+        }
+        walk.Final = controller.GetState();
+        controller.Despawn(world);
+        return walk;
+    }
+
+    std::uint32_t CheckScenarios()
+    {
+        const float r = CharacterSettings().Radius;
+        std::uint32_t failures = 0;
+        auto expect = [&failures](bool ok) { if (!ok) ++failures; };
+
+        //  (x = 2 )   / 񽺵    ̲
+        {
+            CollisionWorld world;
+            AddGround(world, 50.0f);
+            AddBox(world, 2.25f, 1.5f, 0.0f, 0.25f, 1.5f, 8.0f);
+
+            Walk straight = WalkFor(world, 0.0f, 0.0f, 0.0f, 0.05f, 0.0f, 120);
+            expect(straight.Final.Position[0] <= 2.0f - r + 0.01f && straight.Final.Position[0] >= 2.0f - r - 0.05f);
+            expect(std::fabs(straight.Final.Position[2]) < 0.01f && straight.Final.Grounded);
+
+            Walk slide = WalkFor(world, 0.0f, 0.0f, 0.0f, 0.05f, 0.05f, 120);
+            expect(slide.Final.Position[0] <= 2.0f - r + 0.01f && slide.Final.Position[2] > 4.0f);
+        }
+
+        //  8 ĭ (0.25 x 0.5)  ö  2   
+        {
+            CollisionWorld world;
+            AddGround(world, 50.0f);
+            for (int i = 0; i < 8; ++i)
+            {
+                const float top = 0.25f * (i + 1);
+                AddBox(world, 1.25f + 0.5f * i, 0.5f * top, 0.0f, 0.25f, 0.5f * top, 2.0f);
+            }
+            AddBox(world, 7.0f, 1.0f, 0.0f, 2.0f, 1.0f, 2.0f);
+
+            Walk stairs = WalkFor(world, 0.0f, 0.0f, 0.0f, 0.05f, 0.0f, 150);
+            expect(stairs.Final.Position[0] > 7.0f && std::fabs(stairs.Final.Position[1] - 2.0f) < 0.02f && stairs.Final.Grounded);
+        }
+
+        // 30  ö, 60  ö
+        {
+            CollisionWorld world;
+            AddGround(world, 50.0f);
+            AddRamp(world, 1.0f, 30.0f, 4.0f, 2.0f);
+
+            Walk gentle = WalkFor(world, 0.0f, 0.0f, 0.0f, 0.05f, 0.0f, 100);
+            expect(gentle.Final.Position[1] > 1.5f && gentle.Final.Grounded);
+        }
+        {
+            CollisionWorld world;
+            AddGround(world, 50.0f);
+            AddRamp(world, 1.0f, 60.0f, 4.0f, 2.0f);
+
+            Walk steep = WalkFor(world, 0.0f, 0.0f, 0.0f, 0.05f, 0.0f, 100);
+            expect(steep.Final.Position[1] < 0.5f && steep.Final.Position[0] < 1.5f);
+        }
+
+        // 0.3 ο    (̱), 2m ܿ  ٰ  
+        {
+            CollisionWorld world;
+            AddGround(world, 50.0f);
+            AddBox(world, 0.0f, 0.15f, 0.0f, 3.0f, 0.15f, 3.0f);
+
+            Walk ledge = WalkFor(world, 0.0f, 0.3f, 0.0f, 0.05f, 0.0f, 120);
+            expect(ledge.AirTicks == 0 && std::fabs(ledge.Final.Position[1]) < 0.01f);
+        }
+        {
+            CollisionWorld world;
+            AddGround(world, 50.0f);
+            AddBox(world, 0.0f, 1.0f, 0.0f, 3.0f, 1.0f, 3.0f);
+
+            Walk cliff = WalkFor(world, 0.0f, 2.0f, 0.0f, 0.05f, 0.0f, 120);
+            expect(cliff.AirTicks > 0 && std::fabs(cliff.Final.Position[1]) < 0.01f && cliff.Final.Grounded);
+        }
+        return failures;
+    }
+
+    // ---------------------------------------------------------
+    // 2. ε ܵ: ְ//̸ ְ Ǹ  񱳿  
+    // ---------------------------------------------------------
+    std::uint32_t CheckBroadphase(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.2f, 3.0f);
+        std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+        Broadphase broadphase;
+        std::vector<Broadphase::ProxyId> proxies;  //   -> Ͻ ( NullProxy)
+        std::vector<Aabb> bounds;
+        std::vector<std::uint8_t> moved;           //  UpdatePairs ڷ ٽ ־
+        std::uint32_t mismatches = 0;
+
+        auto randomBox = [&]()
+        {
+            return Aabb::FromCenterExtent(position(rng), position(rng) * 0.1f, position(rng), size(rng), size(rng), size(rng));
+        };
+        auto create = [&]()
+        {
+            const std::uint32_t user = (std::uint32_t)proxies.size();
+            bounds.push_back(randomBox());
+            proxies.push_back(broadphase.CreateProxy(bounds.back(), user));
+            moved.push_back(1);
+        };
+
+        for (int i = 0; i < 2000; ++i)
+            create();
+
+        std::vector<BroadphasePair> pairs;
+        std::vector<BroadphasePair> expected;
+        std::vector<std::uint32_t> found;
+        for (int round = 0; round < 20; ++round)
+        {
+            // ̱ (κ ,  ָ) /  / ֱ
+            for (std::uint32_t user = 0; user < proxies.size(); ++user)
+            {
+                if (proxies[user] == Broadphase::NullProxy)
+                    continue;
+
+                const float roll = chance(rng);
+                if (roll < 0.02f)
+                {
+                    broadphase.DestroyProxy(proxies[user]);
+                    proxies[user] = Broadphase::NullProxy;
+                    moved[user] = 0;
+                }
+                else if (roll < 0.4f)
+                {
+                    const float scale = roll < 0.05f ? 20.0f : 0.3f;
+                    const float dx = step(rng) * scale, dy = step(rng) * scale * 0.1f, dz = step(rng) * scale;
+                    Aabb& b = bounds[user];
+                    b.MinX += dx; b.MaxX += dx; b.MinY += dy; b.MaxY += dy; b.MinZ += dz; b.MaxZ += dz;
+                    if (broadphase.MoveProxy(proxies[user], b, dx, dy, dz))
+                        moved[user] = 1;
+                }
+            }
+            for (int i = 0; i < 40; ++i)
+                create();
+
+            //  AABB  ׻  AABB 
+            for (std::uint32_t user = 0; user < proxies.size(); ++user)
+            {
+                if (proxies[user] != Broadphase::NullProxy && !broadphase.GetFatBounds(proxies[user]).Contains(bounds[user]))
+                    ++mismatches;
+            }
+
+            // :  AABB  ġ ̶ ٽ  
+            expected.clear();
+            for (std::uint32_t a = 0; a < proxies.size(); ++a)
+            {
+                if (proxies[a] == Broadphase::NullProxy)
+                    continue;
+                for (std::uint32_t b = a + 1; b < proxies.size(); ++b)
+                {
+                    if (proxies[b] == Broadphase::NullProxy || !(moved[a] || moved[b]))
+                        continue;
+                    if (broadphase.GetFatBounds(proxies[a]).Overlaps(broadphase.GetFatBounds(proxies[b])))
+                        expected.push_back({ a, b });
+                }
+            }
+            broadphase.UpdatePairs(pairs);
+            if (pairs != expected)
+                ++mismatches;
+            std::fill(moved.begin(), moved.end(), (std::uint8_t)0);
+
+            // 
+            for (int q = 0; q < 16; ++q)
+            {
+                const Aabb box = randomBox().Expanded(5.0f);
+                found.clear();
+                broadphase.QueryOverlap(box, found);
+                std::sort(found.begin(), found.end());
+
+                std::vector<std::uint32_t> brute;
+                for (std::uint32_t user = 0; user < proxies.size(); ++user)
+                {
+                    if (proxies[user] != Broadphase::NullProxy && broadphase.GetFatBounds(proxies[user]).Overlaps(box))
+                        brute.push_back(user);
+                }
+                if (found != brute)
+                    ++mismatches;
+            }
+
+            if (!broadphase.Validate())
+                ++mismatches;
+        }
+        return mismatches;
+    }
+
+    // ---------------------------------------------------------
+    // 3. :  +   (ǹ +   )
+    // ---------------------------------------------------------
+    std::uint32_t BuildCity(CollisionWorld& world, std::uint32_t side, std::uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> width(0.5f, 2.5f);
+        std::uniform_real_distribution<float> height(1.0f, 4.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 1.5f);
+        std::uniform_real_distribution<float> jitter(-1.0f, 1.0f);
+
+        const float half = 0.5f * side * CellSize;
+        AddGround(world, half + 10.0f);
+
+        for (std::uint32_t z = 0; z < side; ++z)
+        {
+            for (std::uint32_t x = 0; x < side; ++x)
+            {
+                const float cx = (x + 0.5f) * CellSize - half;
+                const float cz = (z + 0.5f) * CellSize - half;
+                const float ey = height(rng);
+                AddYawBox(world, cx, ey, cz, width(rng), ey, width(rng), angle(rng));
+
+                // ĭ      ( Ⱑ Ͼ)
+                AddBox(world, cx - 0.5f * CellSize + jitter(rng), 0.1f, cz + 2.0f * jitter(rng), 0.4f, 0.1f, 1.0f);
+            }
+        }
+        return 1 + 2 * side * side;
+    }
+
+    struct Crowd
+    {
+        CollisionWorld World;
+        std::vector<CharacterController> Characters;
+    };
+
+    void SpawnCrowd(Crowd& crowd, std::uint32_t count, std::uint32_t side, std::uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<std::uint32_t> corner(1, side - 1);
+        std::uniform_real_distribution<float> jitter(-1.5f, 1.5f);
+
+        const float half = 0.5f * side * CellSize;
+        crowd.Characters.resize(count);
+        for (CharacterController& character : crowd.Characters)
+        {
+            const float p[3] = { corner(rng) * CellSize - half + jitter(rng), 0.0f, corner(rng) * CellSize - half + jitter(rng) };
+            character.Spawn(crowd.World, p);
+        }
+    }
+
+    //  :  .  Է  ,  ƽ ź
+    void CheckTamper(CharacterBenchmarkResult& result)
+    {
+        CollisionWorld clientWorld, serverWorld;
+        for (CollisionWorld* world : { &clientWorld, &serverWorld })
+        {
+            AddGround(*world, 50.0f);
+            AddBox(*world, 2.25f, 1.5f, 0.0f, 0.25f, 1.5f, 8.0f);
+        }
+
+        CharacterController client, server;
+        const float start[3] = { 0.0f, 0.0f, 0.0f };
+        client.Spawn(clientWorld, start);
+        server.Spawn(serverWorld, start);
+
+        for (std::uint32_t tick = 1; tick <= 60; ++tick)
+        {
+            client.Move(clientWorld, 0.05f, 0.03f, Dt);
+
+            float claimed[3] = { client.GetState().Position[0], client.GetState().Position[1], client.GetState().Position[2] };
+            const bool tamper = tick % 10 == 0;
+            if (tamper)
+            {
+                claimed[0] += 2.0f; //  ʸӷ
+                ++result.TamperCount;
+            }
+
+            const bool accepted = server.ValidateMove(serverWorld, 0.05f, 0.03f, Dt, claimed, 1e-3f);
+            if (tamper && !accepted)
+                ++result.TamperRejected;
+            if (!tamper && !accepted)
+                ++result.Rejected;
+        }
+    }
+}
+
+namespace CharacterBenchmark
+{
+    CharacterBenchmarkResult Run(std::uint32_t characters, std::uint32_t ticks, std::uint32_t seed)
+    {
+        CharacterBenchmarkResult result;
+        result.Characters = characters;
+        result.Ticks = ticks;
+
+        std::mt19937 rng(seed);
+        result.ScenarioFailures = CheckScenarios();
+        result.QueryMismatches = CheckBroadphase(rng);
+        CheckTamper(result);
+
+        // 1. ĭ ϳ    
+        const std::uint32_t side = std::max(4u, (std::uint32_t)std::ceil(std::sqrt(characters * 0.5)));
+        Crowd client;
+        result.StaticBodies = BuildCity(client.World, side, seed);
+        SpawnCrowd(client, characters, side, seed);
+
+        // 2. Է:   ٲٸ ȱ ( ٽ   ְ )
+        std::uniform_real_distribution<float> heading(0.0f, 6.2831853f);
+        std::vector<float> moveX(characters), moveZ(characters);
+        std::vector<float> inputs((std::size_t)ticks * characters * 2);
+        std::vector<float> claims((std::size_t)ticks * characters * 3);
+
+        std::vector<BroadphasePair> pairs;
+        double moveMs = 0.0, pairMs = 0.0, pairCount = 0.0;
+        for (std::uint32_t tick = 0; tick < ticks; ++tick)
+        {
+            for (std::uint32_t i = 0; i < characters; ++i)
+            {
+                if ((tick + i) % TurnTicks == 0)
+                {
+                    const float a = heading(rng);
+                    moveX[i] = std::cos(a) * WalkSpeed * Dt;
+                    moveZ[i] = std::sin(a) * WalkSpeed * Dt;
+                }
+                inputs[((std::size_t)tick * characters + i) * 2 + 0] = moveX[i];
+                inputs[((std::size_t)tick * characters + i) * 2 + 1] = moveZ[i];
+            }
+
+            auto t0 = Clock::now();
+            for (std::uint32_t i = 0; i < characters; ++i)
+                client.Characters[i].Move(client.World, moveX[i], moveZ[i], Dt);
+            auto t1 = Clock::now();
+            client.World.UpdatePairs(pairs);
+            auto t2 = Clock::now();
+
+            moveMs += ElapsedMs(t0, t1);
+            pairMs += ElapsedMs(t1, t2);
+            pairCount += (double)pairs.size();
+
+            for (std::uint32_t i = 0; i < characters; ++i)
+            {
+                const float* p = client.Characters[i].GetState().Position;
+                float* claim = &claims[((std::size_t)tick * characters + i) * 3];
+                claim[0] = p[0]; claim[1] = p[1]; claim[2] = p[2];
+                if (p[1] < -0.05f)
+                    ++result.Falls;
+            }
+
+            //  ٵ   ()
+            if (tick % 10 == 9)
+            {
+                std::vector<BodyId> candidates;
+                for (const CharacterController& character : client.Characters)
+                {
+                    const CharacterSettings& s = character.GetSettings();
+                    const float* p = character.GetState().Position;
+                    const float a[3] = { p[0], p[1] + s.Radius, p[2] };
+                    const float b[3] = { p[0], p[1] + s.Height - s.Radius, p[2] };
+
+                    candidates.clear();
+                    client.World.QueryOverlap(CollisionWorld::CapsuleBounds(p, s.Radius, s.Height), candidates);
+                    for (BodyId body : candidates)
+                    {
+                        CollisionContact contact;
+                        if (client.World.GetType(body) == ColliderType::Box && client.World.CapsuleContact(a, b, s.Radius, body, contact))
+                            result.MaxPenetration = std::max(result.MaxPenetration, contact.Depth);
+                    }
+                }
+            }
+        }
+
+        result.TickMs = (moveMs + pairMs) / std::max(ticks, 1u);
+        result.MoveUs = moveMs * 1000.0 / std::max((double)ticks * characters, 1.0);
+        result.PairMs = pairMs / std::max(ticks, 1u);
+        result.Pairs = pairCount / std::max(ticks, 1u);
+        result.TreeHeight = client.World.GetBroadphase().GetHeight();
+
+        // 3. :  带    Է ٽ  
+        Crowd server;
+        BuildCity(server.World, side, seed);
+        SpawnCrowd(server, characters, side, seed);
+        for (std::uint32_t tick = 0; tick < ticks; ++tick)
+        {
+            for (std::uint32_t i = 0; i < characters; ++i)
+            {
+                const float* input = &inputs[((std::size_t)tick * characters + i) * 2];
+                const float* claim = &claims[((std::size_t)tick * characters + i) * 3];
+                if (!server.Characters[i].ValidateMove(server.World, input[0], input[1], Dt, claim, 1e-3f))
+                    ++result.Rejected;
+            }
+        }
+
+        result.Valid = result.ScenarioFailures == 0 && result.QueryMismatches == 0 && result.Falls == 0 &&
+            result.MaxPenetration < 0.02f && result.Rejected == 0 && result.TamperRejected == result.TamperCount;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[CharacterBenchmark]\n";
+        report += "  chars  static  tick(ms)  move(us)  pairs(ms)  pairs  height  pen(cm)  falls  rejected  tamper  valid\n";
+
+        bool valid = true;
+        for (std::uint32_t count : { 500u, 2000u, 5000u })
+        {
+            CharacterBenchmarkResult r = Run(count, 120);
+            valid = valid && r.Valid && r.ScenarioFailures == 0;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%7u %7u %9.3f %9.2f %10.3f %6.0f %7d %8.2f %6u %9u %4u/%u  %s\n",
+                r.Characters, r.StaticBodies, r.TickMs, r.MoveUs, r.PairMs, r.Pairs, r.TreeHeight,
+                r.MaxPenetration * 100.0f, r.Falls, r.Rejected, r.TamperRejected, r.TamperCount,
+                (r.Valid && r.ScenarioFailures == 0) ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ĳ Ʈѷ + ε  (߿, 帮 -  )
+//  +   +   ε鿡 ĳ count  Ǯ   Ȱ ؼ ƽ ð 
+//  Ȯ:
+//   1. 麰  ( ,   ̲, , ϸ/ĸ ,   , )
+//   2.     /  Ʒ  ĳ
+//   3. ε  + ħ ǰ  񱳿 
+//   4.  :  Է ٸ 忡 ٽ   Ǵ,  ġ źεǴ
+// ==========================================================
+
+struct CharacterBenchmarkResult
+{
+    std::uint32_t Characters = 0;
+    std::uint32_t StaticBodies = 0;
+    std::uint32_t Ticks = 0;
+
+    double TickMs = 0.0;                //  ƽ ü (̵ +  )
+    double MoveUs = 0.0;                // ĳ    ƽ
+    double PairMs = 0.0;                // UpdatePairs
+    double Pairs = 0.0;                 // ƽ   
+    std::int32_t TreeHeight = 0;
+
+    float MaxPenetration = 0.0f;        // ƽ   ٵ     (m)
+    std::uint32_t Falls = 0;            //  Ʒ  ĳ
+    std::uint32_t ScenarioFailures = 0;
+    std::uint32_t QueryMismatches = 0;
+    std::uint32_t Rejected = 0;         //  Էε  ź  (0 ̾ )
+    std::uint32_t TamperRejected = 0;   //    źε  (= TamperCount  )
+    std::uint32_t TamperCount = 0;
+    bool Valid = false;
+};
+
+namespace CharacterBenchmark
+{
+    CharacterBenchmarkResult Run(std::uint32_t characters, std::uint32_t ticks, std::uint32_t seed = 46);
+
+    // 500 / 2000 / 5000 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
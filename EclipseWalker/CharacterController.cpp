@@ -0,0 +1,205 @@
+#include "CharacterController.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+CharacterController::CharacterController(const CharacterSettings& settings)
+    : mSettings(settings)
+{
+    assert(settings.Height >= 2.0f * settings.Radius);
+    assert(settings.StepHeight < settings.Radius); //  𼭸 Ʒ ݱ ƾ Resolve  øⰡ 
+    mMinGroundY = std::cos(settings.MaxSlopeDegrees * 3.14159265f / 180.0f);
+}
+
+void CharacterController::Spawn(CollisionWorld& world, const float position[3])
+{
+    assert(mBody == InvalidBody);
+    mState = CharacterState();
+    mState.Position[0] = position[0]; mState.Position[1] = position[1]; mState.Position[2] = position[2];
+    mBody = world.AddCapsule(position, mSettings.Radius, mSettings.Height);
+}
+
+void CharacterController::Despawn(CollisionWorld& world)
+{
+    if (mBody == InvalidBody)
+        return;
+    world.Remove(mBody);
+    mBody = InvalidBody;
+}
+
+void CharacterController::Teleport(CollisionWorld& world, const float position[3])
+{
+    mState.Position[0] = position[0]; mState.Position[1] = position[1]; mState.Position[2] = position[2];
+    mState.VerticalSpeed = 0.0f;
+    mState.Grounded = false;
+    world.MoveCapsule(mBody, position);
+}
+
+void CharacterController::Move(CollisionWorld& world, float moveX, float moveZ, float dt)
+{
+    float* pos = mState.Position;
+    const bool wasGrounded = mState.Grounded;
+
+    float groundNormal[3] = { 0.0f, 1.0f, 0.0f };
+    bool ceiling = false;
+
+    // 1.  ̵ (  з鼭 ̲,   Resolve  Ÿ ö󰡰 )
+    SlideMove(world, moveX, 0.0f, moveZ, groundNormal, ceiling);
+
+    // 2. ߷ ( ־ ݾ   з ö  )
+    mState.VerticalSpeed -= mSettings.Gravity * dt;
+    bool grounded = SlideMove(world, 0.0f, mState.VerticalSpeed * dt, 0.0f, groundNormal, ceiling);
+    if (grounded && mState.VerticalSpeed < 0.0f)
+        mState.VerticalSpeed = 0.0f;
+    if (ceiling && mState.VerticalSpeed > 0.0f)
+        mState.VerticalSpeed = 0.0f;
+
+    // 3.       (  ߰)
+    if (!grounded && wasGrounded && mState.VerticalSpeed <= 0.0f)
+    {
+        const float before[3] = { pos[0], pos[1], pos[2] };
+        if (SlideMove(world, 0.0f, -mSettings.SnapDistance, 0.0f, groundNormal, ceiling))
+        {
+            grounded = true;
+            mState.VerticalSpeed = 0.0f;
+        }
+        else
+        {
+            pos[0] = before[0]; pos[1] = before[1]; pos[2] = before[2];
+        }
+    }
+
+    mState.Grounded = grounded;
+    if (grounded)
+    {
+        mState.GroundNormal[0] = groundNormal[0];
+        mState.GroundNormal[1] = groundNormal[1];
+        mState.GroundNormal[2] = groundNormal[2];
+    }
+    world.MoveCapsule(mBody, pos);
+}
+
+bool CharacterController::ValidateMove(CollisionWorld& world, float moveX, float moveZ, float dt, const float claimed[3], float tolerance)
+{
+    Move(world, moveX, moveZ, dt);
+
+    const float dx = claimed[0] - mState.Position[0];
+    const float dy = claimed[1] - mState.Position[1];
+    const float dz = claimed[2] - mState.Position[2];
+    if (dx * dx + dy * dy + dz * dz > tolerance * tolerance)
+        return false;
+
+    // εҼ   Ŭ̾Ʈ ġ ״ ( ݾ ߳  ʰ)
+    mState.Position[0] = claimed[0]; mState.Position[1] = claimed[1]; mState.Position[2] = claimed[2];
+    world.MoveCapsule(mBody, claimed);
+    return true;
+}
+
+bool CharacterController::SlideMove(const CollisionWorld& world, float dx, float dy, float dz, float outGroundNormal[3], bool& outCeiling)
+{
+    //     Ϸ (  հ  ʰ)
+    const float length = std::sqrt(dx * dx + dy * dy + dz * dz);
+    const std::uint32_t steps = std::max(1u, (std::uint32_t)std::ceil(length / (0.5f * mSettings.Radius)));
+    const float inv = 1.0f / steps;
+
+    bool ground = false;
+    outCeiling = false;
+    for (std::uint32_t i = 0; i < steps; ++i)
+    {
+        mState.Position[0] += dx * inv;
+        mState.Position[1] += dy * inv;
+        mState.Position[2] += dz * inv;
+
+        float normal[3];
+        bool ceiling = false;
+        if (Resolve(world, normal, ceiling))
+        {
+            ground = true;
+            outGroundNormal[0] = normal[0]; outGroundNormal[1] = normal[1]; outGroundNormal[2] = normal[2];
+        }
+        outCeiling |= ceiling;
+    }
+    return ground;
+}
+
+bool CharacterController::Resolve(const CollisionWorld& world, float outGroundNormal[3], bool& outCeiling)
+{
+    float* pos = mState.Position;
+    const float r = mSettings.Radius;
+
+    bool ground = false;
+    outCeiling = false;
+    for (std::uint32_t iter = 0; iter < mSettings.MaxIterations; ++iter)
+    {
+        mCandidates.clear();
+        world.QueryOverlap(CollisionWorld::CapsuleBounds(pos, r, mSettings.Height), mCandidates);
+
+        // Ʈ  ( /̷)     о  ٽ   
+        // ٸ ĳ ,  ڴ  (߿ з   ä  ʰ)
+        std::sort(mCandidates.begin(), mCandidates.end(), [&world](BodyId a, BodyId b)
+        {
+            const bool boxA = world.GetType(a) == ColliderType::Box;
+            const bool boxB = world.GetType(b) == ColliderType::Box;
+            return boxA != boxB ? boxB : a < b;
+        });
+
+        bool pushed = false;
+        for (BodyId body : mCandidates)
+        {
+            if (body == mBody)
+                continue;
+
+            //   ġ ٲǷ е Ź
+            const float a[3] = { pos[0], pos[1] + r, pos[2] };
+            const float b[3] = { pos[0], pos[1] + mSettings.Height - r, pos[2] };
+
+            CollisionContact contact;
+            if (!world.CapsuleContact(a, b, r, body, contact) || contact.Depth <= 1e-5f)
+                continue;
+            pushed = true;
+
+            //  𼭸 ߿ StepHeight  = /:  ȶ ó 
+            const float* n = contact.Normal;
+            const bool step = contact.Edge && n[1] > 0.05f && contact.Point[1] - pos[1] <= mSettings.StepHeight;
+            if (n[1] >= mMinGroundY || step)
+            {
+                //   ִ : θ (翡   и)
+                // 𼭸   Ʒ ݱ     ̱ (   Depth / n.y  ʹ ŭ)
+                float lift = contact.Depth / n[1];
+                if (contact.Edge)
+                {
+                    const float hx = contact.Point[0] - pos[0], hz = contact.Point[2] - pos[2];
+                    const float hSq = hx * hx + hz * hz;
+                    if (hSq < r * r)
+                        lift = std::max(contact.Point[1] + std::sqrt(r * r - hSq) - (pos[1] + r), 0.0f);
+                }
+                pos[1] += lift;
+                if (!ground || n[1] > outGroundNormal[1])
+                {
+                    outGroundNormal[0] = n[0]; outGroundNormal[1] = n[1]; outGroundNormal[2] = n[2];
+                }
+                ground = true;
+            }
+            else if (n[1] > -mMinGroundY)
+            {
+                // /ĸ : θ ( Ÿ ö)
+                const float h = std::sqrt(n[0] * n[0] + n[2] * n[2]);
+                const float push = contact.Depth / h;
+                pos[0] += n[0] / h * push;
+                pos[2] += n[2] / h * push;
+            }
+            else
+            {
+                // õ
+                pos[0] += n[0] * contact.Depth;
+                pos[1] += n[1] * contact.Depth;
+                pos[2] += n[2] * contact.Depth;
+                outCeiling = true;
+            }
+        }
+
+        if (!pushed)
+            break;
+    }
+    return ground;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "CollisionWorld.h"
+#include <vector>
+
+// ==========================================================
+// Ű׸ƽ ĸ ĳ Ʈѷ
+// -  ƽ (Move):
+//   1.  ̵:   Ϸ  ̰ Ź ģ Ϳ о ->   ̲
+//      ߿ StepHeight   𼭸  ȶ ó  о / Ÿ 
+//   2. : ߷.   ִ ( MaxSlope )    
+//   3. ݱ  µ   SnapDistance    (/ )
+// - о    ִ  θ (翡  ̲), ĸ  θ ( ö)
+// -  Է(̵, dt)   ¿  ->   Է ٽ   (ValidateMove)
+// ġ ĸ Ʒ  ()
+// ==========================================================
+
+struct CharacterSettings
+{
+    float Radius = 0.4f;
+    float Height = 1.8f;            // ĸ  
+    float StepHeight = 0.35f;
+    float MaxSlopeDegrees = 45.0f;
+    float SnapDistance = 0.4f;      // StepHeight ̻̾     
+    float Gravity = 20.0f;
+    std::uint32_t MaxIterations = 4; //     о ݺ
+};
+
+struct CharacterState
+{
+    float Position[3] = {};
+    float VerticalSpeed = 0.0f;
+    bool Grounded = false;
+    float GroundNormal[3] = { 0.0f, 1.0f, 0.0f };
+};
+
+class CharacterController
+{
+public:
+    explicit CharacterController(const CharacterSettings& settings = CharacterSettings());
+
+    // 忡 ĸ ٵ  / 
+    void Spawn(CollisionWorld& world, const float position[3]);
+    void Despawn(CollisionWorld& world);
+
+    //  ƽ (moveX, moveZ = ̹ ƽ ϴ  ̵ m)
+    void Move(CollisionWorld& world, float moveX, float moveZ, float dt);
+
+    // : Ŭ̾Ʈ Է ٽ   Ŭ̾Ʈ  ġ 
+    // tolerance ̸ Ŭ̾Ʈ ġ  (true), ƴϸ    (false, GetState  )
+    bool ValidateMove(CollisionWorld& world, float moveX, float moveZ, float dt, const float claimed[3], float tolerance);
+
+    void Teleport(CollisionWorld& world, const float position[3]);
+
+    const CharacterState& GetState()const { return mState; }
+    BodyId GetBody()const { return mBody; }
+    const CharacterSettings& GetSettings()const { return mSettings; }
+
+private:
+    //  ġ ģ ͵ о.   ִ   true
+    bool Resolve(const CollisionWorld& world, float outGroundNormal[3], bool& outCeiling);
+
+    // delta ŭ  ̸ Resolve
+    bool SlideMove(const CollisionWorld& world, float dx, float dy, float dz, float outGroundNormal[3], bool& outCeiling);
+
+private:
+    CharacterSettings mSettings;
+    CharacterState mState;
+    BodyId mBody = InvalidBody;
+    float mMinGroundY = 0.0f; // cos(MaxSlope)
+
+    std::vector<BodyId> mCandidates; //  
+};
@@ -0,0 +1,308 @@
+#include "CollisionWorld.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+    float Dot(const float a[3], const float b[3])
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    float Clamp01(float v)
+    {
+        return std::min(std::max(v, 0.0f), 1.0f);
+    }
+
+    //   p   [-h, h]  Ÿ 
+    float BoxDistanceSq(const float p[3], const float h[3])
+    {
+        float sq = 0.0f;
+        for (int i = 0; i < 3; ++i)
+        {
+            const float d = std::max(std::fabs(p[i]) - h[i], 0.0f);
+            sq += d * d;
+        }
+        return sq;
+    }
+
+    //   p1-q1, p2-q2     Ű (Ericson, Real-Time Collision Detection 5.1.9)
+    void ClosestSegmentSegment(const float p1[3], const float q1[3], const float p2[3], const float q2[3], float& s, float& t)
+    {
+        const float d1[3] = { q1[0] - p1[0], q1[1] - p1[1], q1[2] - p1[2] };
+        const float d2[3] = { q2[0] - p2[0], q2[1] - p2[1], q2[2] - p2[2] };
+        const float r[3] = { p1[0] - p2[0], p1[1] - p2[1], p1[2] - p2[2] };
+        const float a = Dot(d1, d1), e = Dot(d2, d2), f = Dot(d2, r);
+        const float eps = 1e-12f;
+
+        if (a <= eps && e <= eps)
+        {
+            s = t = 0.0f;
+            return;
+        }
+        if (a <= eps)
+        {
+            s = 0.0f;
+            t = Clamp01(f / e);
+            return;
+        }
+
+        const float c = Dot(d1, r);
+        if (e <= eps)
+        {
+            t = 0.0f;
+            s = Clamp01(-c / a);
+            return;
+        }
+
+        const float b = Dot(d1, d2);
+        const float denom = a * e - b * b;
+        s = denom > eps ? Clamp01((b * f - c * e) / denom) : 0.0f;
+        t = (b * s + f) / e;
+        if (t < 0.0f)
+        {
+            t = 0.0f;
+            s = Clamp01(-c / a);
+        }
+        else if (t > 1.0f)
+        {
+            t = 1.0f;
+            s = Clamp01((b - c) / a);
+        }
+    }
+}
+
+Aabb CollisionWorld::CapsuleBounds(const float bottom[3], float radius, float height)
+{
+    Aabb b;
+    b.MinX = bottom[0] - radius; b.MaxX = bottom[0] + radius;
+    b.MinY = bottom[1];          b.MaxY = bottom[1] + height;
+    b.MinZ = bottom[2] - radius; b.MaxZ = bottom[2] + radius;
+    return b;
+}
+
+BodyId CollisionWorld::AllocateBody()
+{
+    if (!mFreeBodies.empty())
+    {
+        const BodyId body = mFreeBodies.back();
+        mFreeBodies.pop_back();
+        return body;
+    }
+    mBodies.emplace_back();
+    return (BodyId)mBodies.size() - 1;
+}
+
+BodyId CollisionWorld::AddBox(const float world[16], float extentX, float extentY, float extentZ)
+{
+    const BodyId id = AllocateBody();
+    Body& body = mBodies[id];
+    body.Type = ColliderType::Box;
+
+    // ึ ϵ   ->   +   ũ (SweepTests::SphereBox   )
+    const float extent[3] = { extentX, extentY, extentZ };
+    for (int i = 0; i < 3; ++i)
+    {
+        const float* axis = world + i * 4;
+        const float len = std::sqrt(Dot(axis, axis));
+        const float inv = len > 0.0f ? 1.0f / len : 0.0f;
+        body.Axis[i * 3 + 0] = axis[0] * inv;
+        body.Axis[i * 3 + 1] = axis[1] * inv;
+        body.Axis[i * 3 + 2] = axis[2] * inv;
+        body.HalfExtent[i] = extent[i] * len;
+    }
+    body.Center[0] = world[12]; body.Center[1] = world[13]; body.Center[2] = world[14];
+
+    //  AABB: ึ | | x  ũ
+    float e[3];
+    for (int k = 0; k < 3; ++k)
+    {
+        e[k] = std::fabs(body.Axis[0 * 3 + k]) * body.HalfExtent[0] +
+            std::fabs(body.Axis[1 * 3 + k]) * body.HalfExtent[1] +
+            std::fabs(body.Axis[2 * 3 + k]) * body.HalfExtent[2];
+    }
+    body.Proxy = mBroadphase.CreateProxy(Aabb::FromCenterExtent(body.Center[0], body.Center[1], body.Center[2], e[0], e[1], e[2]), id);
+    return id;
+}
+
+BodyId CollisionWorld::AddCapsule(const float bottom[3], float radius, float height)
+{
+    assert(height >= 2.0f * radius);
+
+    const BodyId id = AllocateBody();
+    Body& body = mBodies[id];
+    body.Type = ColliderType::Capsule;
+    body.Center[0] = bottom[0]; body.Center[1] = bottom[1]; body.Center[2] = bottom[2];
+    body.HalfExtent[0] = radius;
+    body.HalfExtent[1] = height;
+    body.Proxy = mBroadphase.CreateProxy(CapsuleBounds(bottom, radius, height), id);
+    return id;
+}
+
+void CollisionWorld::MoveCapsule(BodyId id, const float bottom[3])
+{
+    Body& body = mBodies[id];
+    assert(body.Type == ColliderType::Capsule);
+
+    const float dx = bottom[0] - body.Center[0];
+    const float dy = bottom[1] - body.Center[1];
+    const float dz = bottom[2] - body.Center[2];
+    body.Center[0] = bottom[0]; body.Center[1] = bottom[1]; body.Center[2] = bottom[2];
+    mBroadphase.MoveProxy(body.Proxy, CapsuleBounds(bottom, body.HalfExtent[0], body.HalfExtent[1]), dx, dy, dz);
+}
+
+void CollisionWorld::Remove(BodyId id)
+{
+    Body& body = mBodies[id];
+    mBroadphase.DestroyProxy(body.Proxy);
+    body.Proxy = Broadphase::NullProxy;
+    mFreeBodies.push_back(id);
+}
+
+bool CollisionWorld::CapsuleContact(const float a[3], const float b[3], float radius, BodyId id, CollisionContact& out)const
+{
+    const Body& body = mBodies[id];
+    out.Body = id;
+
+    if (body.Type == ColliderType::Capsule)
+    {
+        // 1. ĸ vs ĸ:       
+        const float r = body.HalfExtent[0];
+        const float p2[3] = { body.Center[0], body.Center[1] + r, body.Center[2] };
+        const float q2[3] = { body.Center[0], body.Center[1] + body.HalfExtent[1] - r, body.Center[2] };
+
+        float s, t;
+        ClosestSegmentSegment(a, b, p2, q2, s, t);
+
+        float d[3];
+        for (int i = 0; i < 3; ++i)
+            d[i] = (a[i] + (b[i] - a[i]) * s) - (p2[i] + (q2[i] - p2[i]) * t);
+
+        const float sum = radius + r;
+        const float distSq = Dot(d, d);
+        if (distSq >= sum * sum)
+            return false;
+
+        const float dist = std::sqrt(distSq);
+        if (dist > 1e-6f)
+        {
+            out.Normal[0] = d[0] / dist; out.Normal[1] = d[1] / dist; out.Normal[2] = d[2] / dist;
+        }
+        else
+        {
+            //  ħ: ƹ  
+            out.Normal[0] = 1.0f; out.Normal[1] = 0.0f; out.Normal[2] = 0.0f;
+        }
+        for (int i = 0; i < 3; ++i)
+            out.Point[i] = p2[i] + (q2[i] - p2[i]) * t + out.Normal[i] * r;
+        out.Depth = sum - dist;
+        out.Edge = false;
+        return true;
+    }
+
+    // 2. ĸ vs :   ÷ ű
+    float la[3], lb[3];
+    {
+        const float ra[3] = { a[0] - body.Center[0], a[1] - body.Center[1], a[2] - body.Center[2] };
+        const float rb[3] = { b[0] - body.Center[0], b[1] - body.Center[1], b[2] - body.Center[2] };
+        for (int i = 0; i < 3; ++i)
+        {
+            la[i] = Dot(ra, body.Axis + i * 3);
+            lb[i] = Dot(rb, body.Axis + i * 3);
+        }
+    }
+
+    // 3.      Ÿ  Լ -> Ȳ  Ž   
+    auto distanceAt = [&](float s, float p[3])
+    {
+        p[0] = la[0] + (lb[0] - la[0]) * s;
+        p[1] = la[1] + (lb[1] - la[1]) * s;
+        p[2] = la[2] + (lb[2] - la[2]) * s;
+        return BoxDistanceSq(p, body.HalfExtent);
+    };
+
+    const float golden = 0.618034f;
+    float lo = 0.0f, hi = 1.0f;
+    float p[3];
+    float x1 = hi - golden * (hi - lo), x2 = lo + golden * (hi - lo);
+    float f1 = distanceAt(x1, p), f2 = distanceAt(x2, p);
+    for (int iter = 0; iter < 24; ++iter)
+    {
+        if (f1 <= f2)
+        {
+            hi = x2; x2 = x1; f2 = f1;
+            x1 = hi - golden * (hi - lo);
+            f1 = distanceAt(x1, p);
+        }
+        else
+        {
+            lo = x1; x1 = x2; f1 = f2;
+            x2 = lo + golden * (hi - lo);
+            f2 = distanceAt(x2, p);
+        }
+    }
+
+    //       (Ž   )
+    float best = 0.5f * (lo + hi);
+    float bestSq = distanceAt(best, p);
+    for (float end : { 0.0f, 1.0f })
+    {
+        float q[3];
+        const float sq = distanceAt(end, q);
+        if (sq < bestSq)
+        {
+            bestSq = sq;
+            best = end;
+        }
+    }
+    distanceAt(best, p);
+
+    if (bestSq >= radius * radius)
+        return false;
+
+    // 4. о  () -> .      ̸̻ 𼭸/
+    float n[3], c[3];
+    for (int i = 0; i < 3; ++i)
+        c[i] = std::min(std::max(p[i], -body.HalfExtent[i]), body.HalfExtent[i]);
+
+    if (bestSq > 1e-12f)
+    {
+        const float dist = std::sqrt(bestSq);
+        int outside = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            n[i] = (p[i] - c[i]) / dist;
+            outside += p[i] != c[i] ? 1 : 0;
+        }
+        out.Depth = radius - dist;
+        out.Edge = outside >= 2;
+    }
+    else
+    {
+        //   :    
+        int axis = 0;
+        float shallow = body.HalfExtent[0] - std::fabs(p[0]);
+        for (int i = 1; i < 3; ++i)
+        {
+            const float pen = body.HalfExtent[i] - std::fabs(p[i]);
+            if (pen < shallow)
+            {
+                shallow = pen;
+                axis = i;
+            }
+        }
+        n[0] = n[1] = n[2] = 0.0f;
+        n[axis] = p[axis] < 0.0f ? -1.0f : 1.0f;
+        c[axis] = n[axis] * body.HalfExtent[axis];
+        out.Depth = shallow + radius;
+        out.Edge = false;
+    }
+
+    for (int k = 0; k < 3; ++k)
+    {
+        out.Normal[k] = n[0] * body.Axis[0 * 3 + k] + n[1] * body.Axis[1 * 3 + k] + n[2] * body.Axis[2 * 3 + k];
+        out.Point[k] = body.Center[k] + c[0] * body.Axis[0 * 3 + k] + c[1] * body.Axis[1 * 3 + k] + c[2] * body.Axis[2 * 3 + k];
+    }
+    return true;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "Broadphase.h"
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+// 浹  (ĳ Ʈѷ  + ε)
+// - : ȸ  ( /ǹ),  ĸ (ĳ)
+// - ٵ ȣ = ε  ,  ȣ 
+// -   ĸ vs ٵ ħ (о  + ). ĳ Ʈѷ ̰ɷ о ̲
+//    (D3D ,  Է  )
+// ==========================================================
+
+using BodyId = std::uint32_t;
+constexpr BodyId InvalidBody = 0xFFFFFFFFu;
+
+enum class ColliderType : std::uint8_t
+{
+    Box,
+    Capsule,
+};
+
+// ĸ vs ٵ  (Normal  ٵ𿡼 ĸ   , Depth ŭ и )
+struct CollisionContact
+{
+    BodyId Body = InvalidBody;
+    float Normal[3] = { 0.0f, 1.0f, 0.0f };
+    float Point[3] = {};    // ٵ    
+    float Depth = 0.0f;
+    bool Edge = false;      //   ƴ϶ 𼭸/ (Normal    ƴ)
+};
+
+class CollisionWorld
+{
+public:
+    // world =  켱 4x4 (  Ծ,  ),  ڴ [-extent, extent]
+    BodyId AddBox(const float world[16], float extentX, float extentY, float extentZ);
+
+    //  ĸ: bottom = Ʒ  (), height =   (>= 2 * radius)
+    BodyId AddCapsule(const float bottom[3], float radius, float height);
+    void MoveCapsule(BodyId body, const float bottom[3]);
+
+    void Remove(BodyId body);
+
+    //  AABB  ġ ٵ (out ڿ )
+    void QueryOverlap(const Aabb& box, std::vector<BodyId>& out)const { mBroadphase.QueryOverlap(box, out); }
+
+    //  a-b  radius ĸ body  ġ true
+    bool CapsuleContact(const float a[3], const float b[3], float radius, BodyId body, CollisionContact& out)const;
+
+    void UpdatePairs(std::vector<BroadphasePair>& outPairs) { mBroadphase.UpdatePairs(outPairs); }
+
+    ColliderType GetType(BodyId body)const { return mBodies[body].Type; }
+    std::uint32_t GetBodyCount()const { return mBroadphase.GetProxyCount(); }
+    const Broadphase& GetBroadphase()const { return mBroadphase; }
+
+    static Aabb CapsuleBounds(const float bottom[3], float radius, float height);
+
+private:
+    struct Body
+    {
+        ColliderType Type = ColliderType::Box;
+        Broadphase::ProxyId Proxy = Broadphase::NullProxy;
+
+        // : ߽,   3 (),  ũ ( )
+        // ĸ: Center = Ʒ , HalfExtent[0] = , HalfExtent[1] = 
+        float Center[3] = {};
+        float Axis[9] = {};
+        float HalfExtent[3] = {};
+    };
+
+    BodyId AllocateBody();
+
+private:
+    Broadphase mBroadphase;
+    std::vector<Body> mBodies;
+    std::vector<BodyId> mFreeBodies;
+};
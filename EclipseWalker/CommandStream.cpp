@@ -0,0 +1,122 @@
+#include "CommandStream.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+
+void CommandStream::Reset()
+{
+    for (std::uint32_t b = 0; b < mUsedBlocks; ++b)
+        mBlocks[b].Used = 0;
+    mUsedBlocks = 0;
+    mCommandCount = 0;
+}
+
+void* CommandStream::Allocate(std::uint32_t size)
+{
+    // 1.  Ͽ     (  踦  )
+    if (mUsedBlocks == 0 || mBlocks[mUsedBlocks - 1].Used + size > BlockSize)
+    {
+        if (mUsedBlocks == mBlocks.size())
+        {
+            Block block;
+            block.Data.reset(new std::uint8_t[BlockSize]);
+            mBlocks.push_back(std::move(block));
+        }
+        mBlocks[mUsedBlocks++].Used = 0;
+    }
+
+    // 2. 
+    Block& block = mBlocks[mUsedBlocks - 1];
+    void* memory = block.Data.get() + block.Used;
+    block.Used += size;
+    ++mCommandCount;
+    return memory;
+}
+
+std::uint64_t CommandStream::GetUsedBytes()const
+{
+    std::uint64_t bytes = 0;
+    for (std::uint32_t b = 0; b < mUsedBlocks; ++b)
+        bytes += mBlocks[b].Used;
+    return bytes;
+}
+
+void CommandStream::SetVertexBuffer(std::uint64_t address, std::uint32_t byteSize, std::uint32_t stride)
+{
+    CmdSetVertexBuffer& command = Push<CmdSetVertexBuffer>();
+    command.Address = address;
+    command.ByteSize = byteSize;
+    command.Stride = stride;
+}
+
+void CommandStream::SetIndexBuffer(std::uint64_t address, std::uint32_t byteSize, std::uint32_t indexByteSize)
+{
+    CmdSetIndexBuffer& command = Push<CmdSetIndexBuffer>();
+    command.Address = address;
+    command.ByteSize = byteSize;
+    command.IndexByteSize = indexByteSize;
+}
+
+void CommandStream::SetRootConstant(std::uint32_t slot, std::uint32_t value, std::uint32_t offset)
+{
+    CmdSetRootConstant& command = Push<CmdSetRootConstant>();
+    command.Slot = (std::uint16_t)slot;
+    command.Offset = (std::uint16_t)offset;
+    command.Value = value;
+}
+
+void CommandStream::SetRootConstantBuffer(std::uint32_t slot, std::uint64_t address)
+{
+    CmdSetRootConstantBuffer& command = Push<CmdSetRootConstantBuffer>();
+    command.Slot = slot;
+    command.Address = address;
+}
+
+void CommandStream::SetRootShaderResource(std::uint32_t slot, std::uint64_t address)
+{
+    CmdSetRootShaderResource& command = Push<CmdSetRootShaderResource>();
+    command.Slot = slot;
+    command.Address = address;
+}
+
+void CommandStream::DrawIndexed(std::uint32_t indexCount, std::uint32_t instanceCount,
+    std::uint32_t startIndex, std::int32_t baseVertex, std::uint32_t startInstance)
+{
+    CmdDrawIndexed& command = Push<CmdDrawIndexed>();
+    command.IndexCount = indexCount;
+    command.InstanceCount = instanceCount;
+    command.StartIndex = startIndex;
+    command.BaseVertex = baseVertex;
+    command.StartInstance = startInstance;
+}
+
+void CommandStreamSet::Record(std::uint32_t count, std::uint32_t maxStreams, std::uint32_t minItemsPerStream, const RecordFunc& record)
+{
+    PROFILE_SCOPE("CommandStreamSet::Record");
+
+    // 1. Ʈ  (׸  Ʈ ɰ   ŭ)
+    const std::uint32_t streamCount = std::max(1u, std::min(maxStreams, count / std::max(minItemsPerStream, 1u)));
+    if (mStreams.size() < streamCount)
+        mStreams.resize(streamCount);
+    mStreamCount = streamCount;
+
+    for (std::uint32_t s = 0; s < streamCount; ++s)
+        mStreams[s].Reset();
+
+    // 2. Ʈ   ϳ (Ʈ  = ׸ )
+    const std::uint32_t perStream = (count + streamCount - 1) / streamCount;
+    auto recordStreams = [&](std::uint32_t begin, std::uint32_t end)
+    {
+        for (std::uint32_t s = begin; s < end; ++s)
+        {
+            const std::uint32_t itemBegin = std::min(s * perStream, count);
+            const std::uint32_t itemEnd = std::min(itemBegin + perStream, count);
+            record(itemBegin, itemEnd, mStreams[s]);
+        }
+    };
+
+    if (streamCount > 1)
+        JobSystem::GetInstance()->ParallelFor(streamCount, 1, recordStreams);
+    else
+        recordStreams(0, 1);
+}
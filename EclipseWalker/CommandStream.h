@@ -0,0 +1,194 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
+
+// ==========================================================
+// API   ʴ   Ʈ
+// -  POD ü ( + ), 8Ʈ ķ  Ʒ  
+//   Ʒ 64KB  , Reset() ص  ܼ  ӿ 
+// -  ȣ, ۴ GPU  ּҷθ Ŵ (鿣尡 )
+// - Ʈ ϳ = 鿣  Ʈ ϳ. Ʈ ̿ ´ ̾ 
+//   ( Ʈ ʿ ¸ ó ٽ ؾ )
+// - CommandStreamSet::Record() ׸ Ʈ    JobSystem Ŀ ÿ 
+// ==========================================================
+
+enum class RenderCommandType : std::uint16_t
+{
+    SetPipeline,
+    SetVertexBuffer,
+    SetIndexBuffer,
+    SetRootConstant,
+    SetRootConstantBuffer,
+    SetRootShaderResource,
+    DrawIndexed,
+    Count
+};
+
+struct RenderCommandHeader
+{
+    RenderCommandType Type;
+    std::uint16_t Size; //  , 8 
+};
+
+struct CmdSetPipeline
+{
+    static constexpr RenderCommandType Type = RenderCommandType::SetPipeline;
+    RenderCommandHeader Header;
+    std::uint32_t Pipeline;
+};
+
+struct CmdSetVertexBuffer
+{
+    static constexpr RenderCommandType Type = RenderCommandType::SetVertexBuffer;
+    RenderCommandHeader Header;
+    std::uint32_t Stride;
+    std::uint64_t Address;
+    std::uint32_t ByteSize;
+    std::uint32_t Reserved;
+};
+
+struct CmdSetIndexBuffer
+{
+    static constexpr RenderCommandType Type = RenderCommandType::SetIndexBuffer;
+    RenderCommandHeader Header;
+    std::uint32_t IndexByteSize; // 2 Ǵ 4
+    std::uint64_t Address;
+    std::uint32_t ByteSize;
+    std::uint32_t Reserved;
+};
+
+struct CmdSetRootConstant
+{
+    static constexpr RenderCommandType Type = RenderCommandType::SetRootConstant;
+    RenderCommandHeader Header;
+    std::uint16_t Slot;
+    std::uint16_t Offset; // 32Ʈ 
+    std::uint32_t Value;
+};
+
+// Ʈ CBV/SRV    ( + ּ)
+struct CmdSetRootBuffer
+{
+    RenderCommandHeader Header;
+    std::uint32_t Slot;
+    std::uint64_t Address;
+};
+
+struct CmdSetRootConstantBuffer : CmdSetRootBuffer
+{
+    static constexpr RenderCommandType Type = RenderCommandType::SetRootConstantBuffer;
+};
+
+struct CmdSetRootShaderResource : CmdSetRootBuffer
+{
+    static constexpr RenderCommandType Type = RenderCommandType::SetRootShaderResource;
+};
+
+struct CmdDrawIndexed
+{
+    static constexpr RenderCommandType Type = RenderCommandType::DrawIndexed;
+    RenderCommandHeader Header;
+    std::uint32_t IndexCount;
+    std::uint32_t InstanceCount;
+    std::uint32_t StartIndex;
+    std::int32_t BaseVertex;
+    std::uint32_t StartInstance;
+};
+
+class CommandStream
+{
+public:
+    static constexpr std::uint32_t BlockSize = 64 * 1024;
+    static constexpr std::uint32_t Alignment = 8;
+
+    //    ( ӿ Ҵ  ٽ )
+    void Reset();
+
+    template<typename T>
+    T& Push()
+    {
+        constexpr std::uint32_t size = (sizeof(T) + Alignment - 1) & ~(Alignment - 1);
+        static_assert(size <= BlockSize, "command larger than arena block");
+
+        T* command = new (Allocate(size)) T{};
+        command->Header.Type = T::Type;
+        command->Header.Size = (std::uint16_t)size;
+        return *command;
+    }
+
+    // ---    ---
+    void SetPipeline(std::uint32_t pipeline) { Push<CmdSetPipeline>().Pipeline = pipeline; }
+    void SetVertexBuffer(std::uint64_t address, std::uint32_t byteSize, std::uint32_t stride);
+    void SetIndexBuffer(std::uint64_t address, std::uint32_t byteSize, std::uint32_t indexByteSize);
+    void SetRootConstant(std::uint32_t slot, std::uint32_t value, std::uint32_t offset = 0);
+    void SetRootConstantBuffer(std::uint32_t slot, std::uint64_t address);
+    void SetRootShaderResource(std::uint32_t slot, std::uint64_t address);
+    void DrawIndexed(std::uint32_t indexCount, std::uint32_t instanceCount,
+        std::uint32_t startIndex, std::int32_t baseVertex, std::uint32_t startInstance);
+
+    // func(const RenderCommandHeader&)    ȣ
+    template<typename Func>
+    void ForEach(Func&& func)const
+    {
+        for (std::uint32_t b = 0; b < mUsedBlocks; ++b)
+        {
+            const Block& block = mBlocks[b];
+            for (std::uint32_t offset = 0; offset < block.Used;)
+            {
+                const RenderCommandHeader& header = *reinterpret_cast<const RenderCommandHeader*>(block.Data.get() + offset);
+                func(header);
+                offset += header.Size;
+            }
+        }
+    }
+
+    template<typename T>
+    static const T& As(const RenderCommandHeader& header) { return *reinterpret_cast<const T*>(&header); }
+
+    std::uint32_t GetCommandCount()const { return mCommandCount; }
+    std::uint64_t GetUsedBytes()const;
+
+private:
+    struct Block
+    {
+        std::unique_ptr<std::uint8_t[]> Data;
+        std::uint32_t Used = 0;
+    };
+
+    void* Allocate(std::uint32_t size);
+
+    std::vector<Block> mBlocks;
+    std::uint32_t mUsedBlocks = 0; // [0, mUsedBlocks)  ̹  
+    std::uint32_t mCommandCount = 0;
+};
+
+// ׸ [0, count)     Ʈ  Ŀ 
+class CommandStreamSet
+{
+public:
+    using RecordFunc = std::function<void(std::uint32_t begin, std::uint32_t end, CommandStream& stream)>;
+
+    // Ʈ  = min(maxStreams, count / minItemsPerStream) (ּ 1)
+    void Record(std::uint32_t count, std::uint32_t maxStreams, std::uint32_t minItemsPerStream, const RecordFunc& record);
+
+    std::uint32_t GetStreamCount()const { return mStreamCount; }
+    const CommandStream& GetStream(std::uint32_t index)const { return mStreams[index]; }
+    const CommandStream* GetStreams()const { return mStreams.data(); }
+
+private:
+    std::vector<CommandStream> mStreams;
+    std::uint32_t mStreamCount = 0;
+};
+
+// Ʈ  ϴ  (D3D12 / )
+class RenderBackend
+{
+public:
+    virtual ~RenderBackend() = default;
+
+    // streams[0..count)     (Ʈ  ÿ ص )
+    virtual void Submit(const CommandStream* streams, std::uint32_t count) = 0;
+};
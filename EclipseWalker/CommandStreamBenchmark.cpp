@@ -0,0 +1,162 @@
+#include "CommandStreamBenchmark.h"
+#include "CommandStream.h"
+#include "NullRenderBackend.h"
+#include "JobSystem.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    //  DrawBatch + MeshGeometry    
+    struct SyntheticDraw
+    {
+        std::uint32_t Pipeline;
+        std::uint32_t Mesh;
+        std::uint32_t IndexCount;
+        std::uint32_t StartIndex;
+        std::uint32_t FirstInstance;
+        std::uint32_t InstanceCount;
+    };
+
+    // Ӱ  Ʈ  (0 = νϽ  , 1 = н CBV, 2 = νϽ SRV)
+    constexpr std::uint64_t PassAddress = 0x10000;
+    constexpr std::uint64_t InstanceAddress = 0x20000;
+    constexpr std::uint32_t MinDrawsPerStream = 256;
+
+    void RecordDraws(const std::vector<SyntheticDraw>& draws, std::uint32_t begin, std::uint32_t end, CommandStream& stream)
+    {
+        stream.SetRootConstantBuffer(1, PassAddress);
+        stream.SetRootShaderResource(2, InstanceAddress);
+
+        std::uint32_t boundPipeline = UINT32_MAX;
+        std::uint32_t boundMesh = UINT32_MAX;
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            const SyntheticDraw& draw = draws[i];
+            if (draw.Pipeline != boundPipeline)
+            {
+                stream.SetPipeline(draw.Pipeline);
+                boundPipeline = draw.Pipeline;
+            }
+            if (draw.Mesh != boundMesh)
+            {
+                const std::uint64_t base = 0x100000ull * (draw.Mesh + 1);
+                stream.SetVertexBuffer(base, 0x10000, 16);
+                stream.SetIndexBuffer(base + 0x10000, 0x8000, 2);
+                boundMesh = draw.Mesh;
+            }
+
+            stream.SetRootConstant(0, draw.FirstInstance);
+            stream.DrawIndexed(draw.IndexCount, draw.InstanceCount, draw.StartIndex, 0, 0);
+        }
+    }
+}
+
+namespace CommandStreamBenchmark
+{
+    CommandStreamBenchmarkResult Run(std::uint32_t drawCount, std::uint32_t meshCount)
+    {
+        CommandStreamBenchmarkResult result;
+        result.Draws = drawCount;
+
+        // 1.  ť ó PSO -> ޽  ĵ ο 
+        std::mt19937 rng(5);
+        std::uniform_int_distribution<std::uint32_t> lodDist(0, 3);
+        std::uniform_int_distribution<std::uint32_t> instanceDist(1, 8);
+
+        std::vector<SyntheticDraw> draws(drawCount);
+        std::uint32_t firstInstance = 0;
+        for (std::uint32_t i = 0; i < drawCount; ++i)
+        {
+            SyntheticDraw& draw = draws[i];
+            draw.Mesh = (std::uint32_t)((std::uint64_t)i * meshCount / drawCount);
+            draw.Pipeline = draw.Mesh * 2 < meshCount ? 0 : 1;
+            const std::uint32_t lod = lodDist(rng);
+            draw.IndexCount = 3000u >> lod;
+            draw.StartIndex = 6000u - (6000u >> lod);
+            draw.FirstInstance = firstInstance;
+            draw.InstanceCount = instanceDist(rng);
+            firstInstance += draw.InstanceCount;
+        }
+
+        auto record = [&draws](std::uint32_t begin, std::uint32_t end, CommandStream& stream)
+        {
+            RecordDraws(draws, begin, end, stream);
+        };
+
+        // 2.  (ù ° Ʒ  )
+        CommandStreamSet single;
+        CommandStreamSet parallel;
+        const std::uint32_t maxStreams = JobSystem::GetInstance()->GetThreadCount();
+        single.Record(drawCount, 1, MinDrawsPerStream, record);
+        parallel.Record(drawCount, maxStreams, MinDrawsPerStream, record);
+
+        const int iterations = 16;
+        for (int it = 0; it < iterations; ++it)
+        {
+            auto t0 = Clock::now();
+            single.Record(drawCount, 1, MinDrawsPerStream, record);
+            auto t1 = Clock::now();
+            parallel.Record(drawCount, maxStreams, MinDrawsPerStream, record);
+            auto t2 = Clock::now();
+
+            result.RecordSingleMs += ElapsedMs(t0, t1);
+            result.RecordParallelMs += ElapsedMs(t1, t2);
+        }
+        result.RecordSingleMs /= iterations;
+        result.RecordParallelMs /= iterations;
+        result.Streams = parallel.GetStreamCount();
+
+        // 3.  鿣 ؼ 
+        NullRenderBackend singleBackend;
+        singleBackend.Submit(single.GetStreams(), single.GetStreamCount());
+
+        NullRenderBackend parallelBackend;
+        auto t0 = Clock::now();
+        parallelBackend.Submit(parallel.GetStreams(), parallel.GetStreamCount());
+        auto t1 = Clock::now();
+        result.ReplayMs = ElapsedMs(t0, t1);
+
+        const NullBackendStats& stats = parallelBackend.GetStats();
+        result.Commands = stats.Commands;
+        for (std::uint32_t s = 0; s < parallel.GetStreamCount(); ++s)
+            result.Bytes += parallel.GetStream(s).GetUsedBytes();
+        result.Errors = stats.Errors + singleBackend.GetStats().Errors;
+        result.HashMatches = stats.Draws == drawCount && stats.DrawHash == singleBackend.GetStats().DrawHash;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[CommandStreamBenchmark]\n";
+        report += "     draws  streams  record 1T(ms)  record MT(ms)  replay(ms)  commands     bytes  errors  match\n";
+
+        const std::uint32_t counts[] = { 1000, 10000, 100000 };
+        bool valid = true;
+        for (std::uint32_t count : counts)
+        {
+            CommandStreamBenchmarkResult r = Run(count, count / 16);
+            valid = valid && r.HashMatches && r.Errors == 0;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%10u %8u %14.3f %14.3f %11.3f %9llu %9llu %7llu  %s\n",
+                r.Draws, r.Streams, r.RecordSingleMs, r.RecordParallelMs, r.ReplayMs,
+                (unsigned long long)r.Commands, (unsigned long long)r.Bytes, (unsigned long long)r.Errors,
+                r.HashMatches ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+//  Ʈ /  (߿, GPU   鿣)
+// ο N  (޽/PSO   ٲ) 
+// 1. Ʈ 1   2. Ŀ ŭ Ʈ   
+//   NullRenderBackend  ؼ ο ؽð  Ȯ
+// ==========================================================
+
+struct CommandStreamBenchmarkResult
+{
+    std::uint32_t Draws = 0;
+    std::uint32_t Streams = 0;         //    Ʈ 
+
+    double RecordSingleMs = 0.0;       //   ()
+    double RecordParallelMs = 0.0;
+    double ReplayMs = 0.0;             //  鿣 (  )
+
+    std::uint64_t Commands = 0;        //    (Ʈ ¸ ٽ ϹǷ  )
+    std::uint64_t Bytes = 0;
+    std::uint64_t Errors = 0;
+    bool HashMatches = false;
+};
+
+namespace CommandStreamBenchmark
+{
+    CommandStreamBenchmarkResult Run(std::uint32_t drawCount, std::uint32_t meshCount);
+
+    // ο 1k / 10k / 100k
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,89 @@
+#include "CookedMesh.h"
+
+bool CookedMesh::Open(const std::string& path)
+{
+    Close();
+
+    if (!mFile.Open(path))
+        return false;
+
+    if (!OpenMemory(mFile.GetData(), mFile.GetSize()))
+    {
+        mFile.Close();
+        return false;
+    }
+    return true;
+}
+
+bool CookedMesh::OpenMemory(const void* data, std::size_t size)
+{
+    mHeader = Validate(data, size);
+    mBase = mHeader != nullptr ? static_cast<const std::uint8_t*>(data) : nullptr;
+    return mHeader != nullptr;
+}
+
+void CookedMesh::Close()
+{
+    mHeader = nullptr;
+    mBase = nullptr;
+    mFile.Close();
+}
+
+const MeshFormat::Header* CookedMesh::Validate(const void* data, std::size_t size)
+{
+    using namespace MeshFormat;
+
+    if (data == nullptr || size < sizeof(Header) || ((std::uintptr_t)data & (Alignment - 1)) != 0)
+        return nullptr;
+
+    const Header* header = static_cast<const Header*>(data);
+    if (header->Magic != Magic || header->Version != Version || header->FileSize != size)
+        return nullptr;
+
+    if ((std::uint32_t)header->VertexLayout >= (std::uint32_t)VertexFormat::Count ||
+        header->VertexStride != GetVertexStride(header->VertexLayout) ||
+        (header->IndexType != IndexFormat::UInt16 && header->IndexType != IndexFormat::UInt32) ||
+        header->LodCount == 0 || header->LodCount > MaxLods)
+        return nullptr;
+
+    //   ĵ ְ  ȿ 
+    auto sectionFits = [size](std::uint64_t offset, std::uint64_t bytes)
+    {
+        return (offset & (Alignment - 1)) == 0 && offset >= sizeof(Header) && offset <= size && bytes <= size - offset;
+    };
+
+    if (!sectionFits(header->VertexOffset, (std::uint64_t)header->VertexCount * header->VertexStride) ||
+        !sectionFits(header->IndexOffset, (std::uint64_t)header->IndexCount * GetIndexStride(header->IndexType)) ||
+        !sectionFits(header->SubmeshOffset, (std::uint64_t)header->LodCount * header->SubmeshCount * sizeof(Submesh)) ||
+        !sectionFits(header->LodOffset, (std::uint64_t)header->LodCount * sizeof(Lod)))
+        return nullptr;
+
+    // ޽ / LOD  Ű ε  BaseVertex    (״ DrawIndexed  Ѿ)
+    auto indicesFit = [header](std::uint32_t start, std::uint32_t count)
+    {
+        return (std::uint64_t)start + count <= header->IndexCount;
+    };
+    auto baseVertexFits = [header](std::int32_t baseVertex, std::uint32_t indexCount)
+    {
+        //  ޽  ġ 
+        return baseVertex >= 0 && (indexCount == 0 ? (std::uint32_t)baseVertex <= header->VertexCount : (std::uint32_t)baseVertex < header->VertexCount);
+    };
+
+    const std::uint8_t* base = static_cast<const std::uint8_t*>(data);
+    const Submesh* submeshes = reinterpret_cast<const Submesh*>(base + header->SubmeshOffset);
+    for (std::uint64_t i = 0; i < (std::uint64_t)header->LodCount * header->SubmeshCount; ++i)
+    {
+        const Submesh& submesh = submeshes[i];
+        if (!indicesFit(submesh.IndexStart, submesh.IndexCount) || !baseVertexFits(submesh.BaseVertex, submesh.IndexCount))
+            return nullptr;
+    }
+
+    const Lod* lods = reinterpret_cast<const Lod*>(base + header->LodOffset);
+    for (std::uint32_t i = 0; i < header->LodCount; ++i)
+    {
+        if (!indicesFit(lods[i].IndexStart, lods[i].IndexCount))
+            return nullptr;
+    }
+
+    return header;
+}
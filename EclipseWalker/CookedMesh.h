@@ -0,0 +1,50 @@
+#pragma once
+#include "MeshFormat.h"
+#include "MappedFile.h"
+
+// ==========================================================
+// ŷ ޽ (.ewmesh) Ÿ δ
+//  ϰ  ޽ / LOD ǥ ˻  /ε/޽ ͸ ״ 
+// -> GPU ε  ε ޸𸮿 ¡ ٷ  (߰ 纻 )
+// ʹ CookedMesh   ִ ȸ ȿ
+// ==========================================================
+
+class CookedMesh
+{
+public:
+    CookedMesh() = default;
+    CookedMesh(const CookedMesh& rhs) = delete;
+    CookedMesh& operator=(const CookedMesh& rhs) = delete;
+
+    bool Open(const std::string& path);
+
+    // ̹ ޸𸮿 ִ ŷ  (data  16 Ʈ ,  ü  ƾ )
+    bool OpenMemory(const void* data, std::size_t size);
+
+    void Close();
+
+    bool IsValid()const { return mHeader != nullptr; }
+    const MeshFormat::Header& GetHeader()const { return *mHeader; }
+
+    const void* GetVertexData()const { return mBase + mHeader->VertexOffset; }
+    std::uint64_t GetVertexDataSize()const { return (std::uint64_t)mHeader->VertexCount * mHeader->VertexStride; }
+
+    const void* GetIndexData()const { return mBase + mHeader->IndexOffset; }
+    std::uint64_t GetIndexDataSize()const { return (std::uint64_t)mHeader->IndexCount * MeshFormat::GetIndexStride(mHeader->IndexType); }
+
+    // ޽ ̺ ü (LodCount x SubmeshCount, LOD )
+    const MeshFormat::Submesh* GetSubmeshes()const { return reinterpret_cast<const MeshFormat::Submesh*>(mBase + mHeader->SubmeshOffset); }
+    const MeshFormat::Submesh* GetLodSubmeshes(std::uint32_t lod)const { return GetSubmeshes() + (std::size_t)lod * mHeader->SubmeshCount; }
+    std::uint32_t GetSubmeshCount()const { return mHeader->SubmeshCount; }
+
+    const MeshFormat::Lod* GetLods()const { return reinterpret_cast<const MeshFormat::Lod*>(mBase + mHeader->LodOffset); }
+    std::uint32_t GetLodCount()const { return mHeader->LodCount; }
+
+    // ,  , ޽ / LOD  ε  BaseVertex ˻ (ε  Ŀ )
+    static const MeshFormat::Header* Validate(const void* data, std::size_t size);
+
+private:
+    MappedFile mFile;
+    const std::uint8_t* mBase = nullptr;
+    const MeshFormat::Header* mHeader = nullptr;
+};
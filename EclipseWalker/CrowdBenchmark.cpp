@@ -0,0 +1,338 @@
+#include "CrowdBenchmark.h"
+#include "CrowdSimulation.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float Dt = 1.0f / 30.0f;
+    constexpr float Radius = 0.4f;
+    constexpr float AreaPerAgent = 6.0f;        // m^2
+    constexpr float ArriveDist = 1.0f;          //  ̸  ǥ
+    constexpr std::uint32_t CheckEvery = 10;    // ƽ ħ / ̿ ˻
+    constexpr std::uint32_t CheckedAgents = 32;
+
+    struct Overlap
+    {
+        std::uint32_t Pairs = 0;
+        float MaxPenetration = 0.0f;
+    };
+
+    // ùķ̼ ڿ   (ĭ =  , ĭ ǥ Ű)
+    Overlap CountOverlaps(const std::vector<float>& x, const std::vector<float>& z)
+    {
+        const float sum = 2.0f * Radius;
+        auto key = [sum](float px, float pz)
+        {
+            const std::int64_t cx = (std::int64_t)std::floor(px / sum), cz = (std::int64_t)std::floor(pz / sum);
+            return (std::uint64_t)((cx << 32) ^ (cz & 0xFFFFFFFF));
+        };
+
+        std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> cells;
+        for (std::uint32_t i = 0; i < x.size(); ++i)
+            cells[key(x[i], z[i])].push_back(i);
+
+        Overlap result;
+        for (std::uint32_t i = 0; i < x.size(); ++i)
+        {
+            for (int dz = -1; dz <= 1; ++dz)
+            {
+                for (int dx = -1; dx <= 1; ++dx)
+                {
+                    auto it = cells.find(key(x[i] + dx * sum, z[i] + dz * sum));
+                    if (it == cells.end())
+                        continue;
+                    for (std::uint32_t j : it->second)
+                    {
+                        if (j <= i)
+                            continue;
+                        const float d = std::sqrt((x[j] - x[i]) * (x[j] - x[i]) + (z[j] - z[i]) * (z[j] - z[i]));
+                        if (d < 0.9f * sum)
+                            ++result.Pairs;
+                        result.MaxPenetration = std::max(result.MaxPenetration, (sum - d) / sum);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    // ---------------------------------------------------------
+    // 1. 麰
+    // ---------------------------------------------------------
+    struct Walker
+    {
+        float GoalX, GoalZ;
+    };
+
+    // ǥ ticks ƽ .   Ÿ (  )  ǥ   Ʈ Ÿ
+    void Walk(CrowdSimulation& crowd, const std::vector<CrowdAgentId>& ids, const std::vector<Walker>& walkers,
+        std::uint32_t ticks, float& outClosest, float& outWorstArrival)
+    {
+        std::vector<float> x(ids.size()), z(ids.size());
+        outClosest = 1e9f;
+        for (std::uint32_t tick = 0; tick < ticks; ++tick)
+        {
+            for (std::size_t k = 0; k < ids.size(); ++k)
+                crowd.SetTarget(ids[k], walkers[k].GoalX, walkers[k].GoalZ);
+            crowd.ComputeVelocities(false);
+            crowd.Integrate(Dt);
+
+            for (std::size_t k = 0; k < ids.size(); ++k)
+                crowd.GetPosition(ids[k], x[k], z[k]);
+            for (std::size_t a = 0; a < ids.size(); ++a)
+            {
+                for (std::size_t b = a + 1; b < ids.size(); ++b)
+                {
+                    const float d = std::sqrt((x[a] - x[b]) * (x[a] - x[b]) + (z[a] - z[b]) * (z[a] - z[b]));
+                    outClosest = std::min(outClosest, d / (2.0f * Radius));
+                }
+            }
+        }
+
+        outWorstArrival = 0.0f;
+        for (std::size_t k = 0; k < ids.size(); ++k)
+            outWorstArrival = std::max(outWorstArrival, std::hypot(x[k] - walkers[k].GoalX, z[k] - walkers[k].GoalZ));
+    }
+
+    std::uint32_t CheckScenarios()
+    {
+        std::uint32_t failures = 0;
+        auto expect = [&failures](bool ok) { if (!ok) ++failures; };
+        float closest, worst;
+
+        //    :  Ѽ 
+        {
+            CrowdSimulation crowd;
+            std::vector<CrowdAgentId> ids = { crowd.AddAgent(-5.0f, 0.0f, Radius, 3.5f), crowd.AddAgent(5.0f, 0.0f, Radius, 3.5f) };
+            std::vector<Walker> walkers = { { 5.0f, 0.0f }, { -5.0f, 0.0f } };
+            Walk(crowd, ids, walkers, 150, closest, worst);
+            expect(closest >= 0.95f && worst < 0.1f);
+        }
+
+        //  ( 10)  32  :  ѵ  ǳʰ
+        {
+            CrowdSimulation crowd;
+            std::vector<CrowdAgentId> ids;
+            std::vector<Walker> walkers;
+            for (std::uint32_t k = 0; k < 32; ++k)
+            {
+                const float a = k * 6.28318531f / 32.0f;
+                ids.push_back(crowd.AddAgent(10.0f * std::cos(a), 10.0f * std::sin(a), Radius, 3.5f));
+                walkers.push_back({ -10.0f * std::cos(a), -10.0f * std::sin(a) });
+            }
+            Walk(crowd, ids, walkers, 600, closest, worst);
+            expect(closest >= 0.8f && worst < 0.5f);
+        }
+        return failures;
+    }
+
+    // ---------------------------------------------------------
+    // 2.  ̿ =   (ComputeVelocities , ׶ ġ)
+    // ---------------------------------------------------------
+    std::uint32_t CheckNeighbors(const CrowdSimulation& crowd, const std::vector<CrowdAgentId>& ids, std::mt19937& rng)
+    {
+        const CrowdSettings& settings = crowd.GetSettings();
+        const float range = settings.NeighborDist * settings.NeighborDist;
+
+        std::vector<float> x(ids.size()), z(ids.size());
+        for (std::size_t k = 0; k < ids.size(); ++k)
+            crowd.GetPosition(ids[k], x[k], z[k]);
+
+        std::uniform_int_distribution<std::size_t> pick(0, ids.size() - 1);
+        std::vector<CrowdAgentId> found;
+        std::vector<float> expected, actual;
+        std::uint32_t mismatches = 0;
+        for (std::uint32_t n = 0; n < CheckedAgents; ++n)
+        {
+            const std::size_t a = pick(rng);
+            expected.clear();
+            for (std::size_t b = 0; b < ids.size(); ++b)
+            {
+                const float dx = x[b] - x[a], dz = z[b] - z[a];
+                const float d2 = dx * dx + dz * dz;
+                if (b != a && d2 < range)
+                    expected.push_back(d2);
+            }
+            std::sort(expected.begin(), expected.end());
+            expected.resize(std::min<std::size_t>(expected.size(), settings.MaxNeighbors));
+
+            crowd.GetNeighbors(ids[a], found);
+            actual.clear();
+            for (CrowdAgentId other : found)
+            {
+                float ox, oz;
+                crowd.GetPosition(other, ox, oz);
+                actual.push_back((ox - x[a]) * (ox - x[a]) + (oz - z[a]) * (oz - z[a]));
+            }
+
+            bool same = actual.size() == expected.size();
+            for (std::size_t k = 0; same && k < actual.size(); ++k)
+                same = std::fabs(actual[k] - expected[k]) <= 1e-5f * (1.0f + expected[k]);
+            if (!same)
+                ++mismatches;
+        }
+        return mismatches;
+    }
+}
+
+namespace CrowdBenchmark
+{
+    CrowdBenchmarkResult Run(std::uint32_t agents, std::uint32_t ticks, std::uint32_t seed)
+    {
+        CrowdBenchmarkResult result;
+        result.Agents = agents;
+        result.Ticks = ticks;
+        result.ScenarioFailures = CheckScenarios();
+
+        JobSystem* jobs = JobSystem::GetInstance();
+        jobs->Initialize();
+        result.Threads = jobs->GetThreadCount();
+
+        // 1.    (ó ġ ʰ), ְ ӵ 3 ~ 4 m/s
+        std::mt19937 rng(seed);
+        const std::uint32_t side = (std::uint32_t)std::ceil(std::sqrt((double)agents));
+        const float spacing = std::sqrt(AreaPerAgent);
+        const float half = 0.5f * side * spacing;
+        std::uniform_real_distribution<float> jitter(-0.5f * spacing + Radius, 0.5f * spacing - Radius);
+        std::uniform_real_distribution<float> speed(3.0f, 4.0f);
+        std::uniform_real_distribution<float> anywhere(-half, half);
+
+        CrowdSimulation parallel, serial;
+        std::vector<CrowdAgentId> ids(agents);
+        std::vector<float> goalX(agents), goalZ(agents), maxSpeed(agents);
+        std::vector<float> freeX(agents), freeZ(agents);     // ȸ  (ħ 񱳿)
+        parallel.Reserve(agents);
+        serial.Reserve(agents);
+        for (std::uint32_t i = 0; i < agents; ++i)
+        {
+            const float x = ((i % side) + 0.5f) * spacing - half + jitter(rng);
+            const float z = ((i / side) + 0.5f) * spacing - half + jitter(rng);
+            maxSpeed[i] = speed(rng);
+            ids[i] = parallel.AddAgent(x, z, Radius, maxSpeed[i]);
+            serial.AddAgent(x, z, Radius, maxSpeed[i]);
+            freeX[i] = x;
+            freeZ[i] = z;
+            goalX[i] = anywhere(rng);
+            goalZ[i] = anywhere(rng);
+        }
+
+        // 2. ƽ: ǥ  -> ӵ ( /  ) ->  -> ̵
+        std::vector<float> x(agents), z(agents);
+        double parallelMs = 0.0, serialMs = 0.0, speedSum = 0.0, prefSum = 0.0;
+        double overlaps = 0.0, freeOverlaps = 0.0;
+        std::uint32_t checks = 0;
+        for (std::uint32_t tick = 0; tick < ticks; ++tick)
+        {
+            for (std::uint32_t i = 0; i < agents; ++i)
+            {
+                parallel.GetPosition(ids[i], x[i], z[i]);
+                if (std::hypot(goalX[i] - x[i], goalZ[i] - z[i]) < ArriveDist)
+                {
+                    goalX[i] = anywhere(rng);
+                    goalZ[i] = anywhere(rng);
+                }
+                parallel.SetTarget(ids[i], goalX[i], goalZ[i]);
+                serial.SetTarget(ids[i], goalX[i], goalZ[i]);
+            }
+
+            auto t0 = Clock::now();
+            parallel.ComputeVelocities(true);
+            auto t1 = Clock::now();
+            serial.ComputeVelocities(false);
+            auto t2 = Clock::now();
+
+            for (std::uint32_t i = 0; i < agents; ++i)
+            {
+                float pvx, pvz, svx, svz;
+                parallel.GetVelocity(ids[i], pvx, pvz);
+                serial.GetVelocity(ids[i], svx, svz);
+                if (pvx != svx || pvz != svz)
+                    ++result.ParallelMismatches;
+
+                speedSum += std::sqrt(pvx * pvx + pvz * pvz);
+                prefSum += std::min(maxSpeed[i], std::hypot(goalX[i] - x[i], goalZ[i] - z[i]) / 0.5f);
+            }
+
+            if (tick % CheckEvery == 0)
+            {
+                result.NeighborMismatches += CheckNeighbors(parallel, ids, rng);
+
+                const Overlap avoid = CountOverlaps(x, z);
+                const Overlap free = CountOverlaps(freeX, freeZ);
+                overlaps += avoid.Pairs;
+                freeOverlaps += free.Pairs;
+                result.MaxPenetration = std::max(result.MaxPenetration, avoid.MaxPenetration);
+                ++checks;
+            }
+
+            auto t3 = Clock::now();
+            parallel.Integrate(Dt);
+            auto t4 = Clock::now();
+            serial.Integrate(Dt);
+
+            parallelMs += ElapsedMs(t0, t1) + ElapsedMs(t3, t4);
+            serialMs += ElapsedMs(t1, t2) + ElapsedMs(t3, t4);
+
+            // ȸ    ǥ ϴ ӵ ״
+            for (std::uint32_t i = 0; i < agents; ++i)
+            {
+                const float dx = goalX[i] - freeX[i], dz = goalZ[i] - freeZ[i];
+                const float dist = std::sqrt(dx * dx + dz * dz);
+                if (dist > 1e-4f)
+                {
+                    const float step = std::min(maxSpeed[i], dist / 0.5f) * Dt / dist;
+                    freeX[i] += dx * step;
+                    freeZ[i] += dz * step;
+                }
+            }
+        }
+
+        result.TickMs = parallelMs / std::max(ticks, 1u);
+        result.TickMsSerial = serialMs / std::max(ticks, 1u);
+        result.AgentUs = serialMs * 1000.0 / std::max((double)ticks * agents, 1.0);
+        result.SpeedRatio = prefSum > 0.0 ? speedSum / prefSum : 0.0;
+        result.Overlaps = overlaps / std::max(checks, 1u);
+        result.OverlapsNoAvoidance = freeOverlaps / std::max(checks, 1u);
+
+        result.Valid = result.ScenarioFailures == 0 && result.ParallelMismatches == 0 && result.NeighborMismatches == 0 &&
+            result.Overlaps * 10.0 < std::max(result.OverlapsNoAvoidance, 1.0);
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[CrowdBenchmark]\n";
+        report += "  agents  ticks  tick(ms)  serial(ms)  agent(us)  speed  overlap  no-avoid  pen(%)  valid\n";
+
+        bool valid = true;
+        for (std::uint32_t count : { 1000u, 4000u, 10000u })
+        {
+            CrowdBenchmarkResult r = Run(count, 150);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%8u %6u %9.3f %11.3f %10.3f %6.2f %8.1f %9.1f %7.1f  %s\n",
+                r.Agents, r.Ticks, r.TickMs, r.TickMsSerial, r.AgentUs, r.SpeedRatio,
+                r.Overlaps, r.OverlapsNoAvoidance, r.MaxPenetration * 100.0f, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
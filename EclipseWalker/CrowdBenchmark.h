@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+//  ȸ  (߿, 帮 -  )
+//   agents  Ǯ   ǥ  ϸ 30 Hz  ticks ƽ 
+//  Ȯ:
+//   1. 麰 (   ,    ǳʰ 32 ) - ,  ħ
+//   2.  ý   ӵ =    ӵ (Ʈ )
+//   3.  ̿ =  񱳷 ã   ̿ (Ÿ)
+//   4. ħ: ȸǸ  Ͱ   (ϴ ӵ ״)    ڷ 
+// ==========================================================
+
+struct CrowdBenchmarkResult
+{
+    std::uint32_t Agents = 0;
+    std::uint32_t Ticks = 0;
+    std::uint32_t Threads = 0;
+
+    double TickMs = 0.0;                // ComputeVelocities ( ý) + Integrate
+    double TickMsSerial = 0.0;          // ComputeVelocities ( ) + Integrate
+    double AgentUs = 0.0;               //    Ʈ ϳ
+    double SpeedRatio = 0.0;            //  ӷ / ϴ ӷ (  )
+
+    double Overlaps = 0.0;              // ˻ ƽ  ģ  (  90% )
+    double OverlapsNoAvoidance = 0.0;
+    float MaxPenetration = 0.0f;        //      ģ 
+
+    std::uint32_t ScenarioFailures = 0;
+    std::uint32_t ParallelMismatches = 0;
+    std::uint32_t NeighborMismatches = 0;
+    bool Valid = false;
+};
+
+namespace CrowdBenchmark
+{
+    CrowdBenchmarkResult Run(std::uint32_t agents, std::uint32_t ticks, std::uint32_t seed = 48);
+
+    // 1000 / 4000 / 10000  x 150 ƽ (5 )
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
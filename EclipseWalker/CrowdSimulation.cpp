@@ -0,0 +1,452 @@
+#include "CrowdSimulation.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+    constexpr std::uint32_t ParallelThreshold = 1024;
+    constexpr std::uint32_t ParallelGrain = 256;
+    constexpr std::uint32_t Padding = 4;            //  迭    (SIMD  Ѱ б)
+    constexpr float FarAway = 1e18f;
+    constexpr float OverlapInvTime = 1000.0f;       // ̹ ƴµ  ٰ ĺ = 1 ms  浹 
+    constexpr float TwoPi = 6.28318531f;
+
+    template <typename T>
+    void SwapRemove(std::vector<T>& v, std::uint32_t index)
+    {
+        v[index] = v.back();
+        v.pop_back();
+    }
+
+    std::int32_t CellOf(float v, float invCell)
+    {
+        return (std::int32_t)std::floor(v * invCell);
+    }
+}
+
+CrowdSimulation::CrowdSimulation(const CrowdSettings& settings)
+    : mSettings(settings)
+{
+    assert(settings.NeighborDist > 0.0f && settings.TimeHorizon > 0.0f);
+    assert(settings.MaxNeighbors <= MaxCrowdNeighbors);
+}
+
+// ---------------------------------------------------------
+// Ʈ
+// ---------------------------------------------------------
+void CrowdSimulation::Reserve(std::uint32_t count)
+{
+    mAgents.reserve(count);
+    for (std::vector<float>* v : { &mPosX, &mPosZ, &mVelX, &mVelZ, &mPrefX, &mPrefZ, &mRadius, &mMaxSpeed })
+        v->reserve(count);
+}
+
+void CrowdSimulation::Clear()
+{
+    mSparse.clear();
+    mFreeIds.clear();
+    mAgents.clear();
+    for (std::vector<float>* v : { &mPosX, &mPosZ, &mVelX, &mVelZ, &mPrefX, &mPrefZ, &mRadius, &mMaxSpeed })
+        v->clear();
+    mSorted.clear();
+    mSortedOf.clear();
+}
+
+CrowdAgentId CrowdSimulation::AddAgent(float x, float z, float radius, float maxSpeed)
+{
+    assert(radius > 0.0f && maxSpeed >= 0.0f);
+
+    CrowdAgentId agent;
+    if (!mFreeIds.empty())
+    {
+        agent = mFreeIds.back();
+        mFreeIds.pop_back();
+    }
+    else
+    {
+        agent = (CrowdAgentId)mSparse.size();
+        mSparse.push_back(InvalidCrowdAgent);
+    }
+
+    mSparse[agent] = (std::uint32_t)mAgents.size();
+    mAgents.push_back(agent);
+    mPosX.push_back(x); mPosZ.push_back(z);
+    mVelX.push_back(0.0f); mVelZ.push_back(0.0f);
+    mPrefX.push_back(0.0f); mPrefZ.push_back(0.0f);
+    mRadius.push_back(radius);
+    mMaxSpeed.push_back(maxSpeed);
+    return agent;
+}
+
+void CrowdSimulation::RemoveAgent(CrowdAgentId agent)
+{
+    assert(IsAlive(agent));
+
+    const std::uint32_t index = mSparse[agent];
+    mSparse[mAgents.back()] = index;
+    mSparse[agent] = InvalidCrowdAgent;
+    mFreeIds.push_back(agent);
+
+    SwapRemove(mAgents, index);
+    for (std::vector<float>* v : { &mPosX, &mPosZ, &mVelX, &mVelZ, &mPrefX, &mPrefZ, &mRadius, &mMaxSpeed })
+        SwapRemove(*v, index);
+
+    // ڴ  ComputeVelocities  ȿ
+    mSorted.clear();
+    mSortedOf.clear();
+}
+
+bool CrowdSimulation::IsAlive(CrowdAgentId agent)const
+{
+    return agent < mSparse.size() && mSparse[agent] != InvalidCrowdAgent;
+}
+
+void CrowdSimulation::SetPosition(CrowdAgentId agent, float x, float z)
+{
+    const std::uint32_t i = mSparse[agent];
+    mPosX[i] = x;
+    mPosZ[i] = z;
+}
+
+void CrowdSimulation::SetPreferredVelocity(CrowdAgentId agent, float vx, float vz)
+{
+    const std::uint32_t i = mSparse[agent];
+    mPrefX[i] = vx;
+    mPrefZ[i] = vz;
+}
+
+void CrowdSimulation::SetTarget(CrowdAgentId agent, float x, float z)
+{
+    const std::uint32_t i = mSparse[agent];
+    const float dx = x - mPosX[i], dz = z - mPosZ[i];
+    const float dist = std::sqrt(dx * dx + dz * dz);
+    if (dist < 1e-4f)
+    {
+        mPrefX[i] = mPrefZ[i] = 0.0f;
+        return;
+    }
+    const float speed = std::min(mMaxSpeed[i], dist / 0.5f);
+    mPrefX[i] = dx / dist * speed;
+    mPrefZ[i] = dz / dist * speed;
+}
+
+void CrowdSimulation::GetPosition(CrowdAgentId agent, float& x, float& z)const
+{
+    const std::uint32_t i = mSparse[agent];
+    x = mPosX[i];
+    z = mPosZ[i];
+}
+
+void CrowdSimulation::GetVelocity(CrowdAgentId agent, float& vx, float& vz)const
+{
+    const std::uint32_t i = mSparse[agent];
+    vx = mVelX[i];
+    vz = mVelZ[i];
+}
+
+// ---------------------------------------------------------
+// 
+// ---------------------------------------------------------
+std::uint32_t CrowdSimulation::Hash(std::int32_t cx, std::int32_t cz)const
+{
+    return (((std::uint32_t)cx * 73856093u) ^ ((std::uint32_t)cz * 19349663u)) & mBucketMask;
+}
+
+void CrowdSimulation::BuildGrid()
+{
+    const std::uint32_t count = GetCount();
+    const float invCell = 1.0f / mSettings.NeighborDist;
+
+    // 1. Ŷ  = Ʈ  x 2 ̻ 2 ŵ
+    std::uint32_t buckets = 64;
+    while (buckets < count * 2)
+        buckets <<= 1;
+    mBucketMask = buckets - 1;
+
+    // 2.  ->  -> Ѹ (Ŷ   ε   ׻ )
+    mBucketStart.assign(buckets + 1, 0);
+    mBucketOf.resize(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        mBucketOf[i] = Hash(CellOf(mPosX[i], invCell), CellOf(mPosZ[i], invCell));
+        ++mBucketStart[mBucketOf[i] + 1];
+    }
+    for (std::uint32_t b = 0; b < buckets; ++b)
+        mBucketStart[b + 1] += mBucketStart[b];
+
+    mSorted.resize(count);
+    mSortedOf.resize(count);
+    for (std::vector<float>* v : { &mSortedX, &mSortedZ, &mSortedVelX, &mSortedVelZ, &mSortedRadius })
+        v->resize(count + Padding);
+
+    std::vector<std::uint32_t> cursor(mBucketStart.begin(), mBucketStart.end() - 1);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        const std::uint32_t s = cursor[mBucketOf[i]]++;
+        mSorted[s] = i;
+        mSortedOf[i] = s;
+        mSortedX[s] = mPosX[i];
+        mSortedZ[s] = mPosZ[i];
+        mSortedVelX[s] = mVelX[i];
+        mSortedVelZ[s] = mVelZ[i];
+        mSortedRadius[s] = mRadius[i];
+    }
+    for (std::uint32_t s = count; s < count + Padding; ++s)
+    {
+        mSortedX[s] = mSortedZ[s] = FarAway;
+        mSortedVelX[s] = mSortedVelZ[s] = 0.0f;
+        mSortedRadius[s] = 0.0f;
+    }
+}
+
+// 3x3 ĭ (ؽð ģ Ŷ  )  4  SSE  Ÿ ˻ ->   MaxNeighbors 
+void CrowdSimulation::FindNeighbors(std::uint32_t sorted, NeighborList& out)const
+{
+    const float invCell = 1.0f / mSettings.NeighborDist;
+    const float px = mSortedX[sorted], pz = mSortedZ[sorted];
+    const std::int32_t cx = CellOf(px, invCell), cz = CellOf(pz, invCell);
+    const std::uint32_t maxCount = mSettings.MaxNeighbors;
+
+    const __m128 x4 = _mm_set1_ps(px);
+    const __m128 z4 = _mm_set1_ps(pz);
+    const __m128 range4 = _mm_set1_ps(mSettings.NeighborDist * mSettings.NeighborDist);
+
+    out.Count = 0;
+    auto insert = [&out, maxCount](float d2, std::uint32_t j)
+    {
+        // Ÿ   ȣ  (   )
+        if (out.Count == maxCount)
+        {
+            const std::uint32_t last = maxCount - 1;
+            if (d2 > out.DistSq[last] || (d2 == out.DistSq[last] && j > out.Sorted[last]))
+                return;
+        }
+        std::uint32_t p = out.Count < maxCount ? out.Count++ : maxCount - 1;
+        while (p > 0 && (out.DistSq[p - 1] > d2 || (out.DistSq[p - 1] == d2 && out.Sorted[p - 1] > j)))
+        {
+            out.DistSq[p] = out.DistSq[p - 1];
+            out.Sorted[p] = out.Sorted[p - 1];
+            --p;
+        }
+        out.DistSq[p] = d2;
+        out.Sorted[p] = j;
+    };
+
+    if (maxCount == 0)
+        return;
+
+    std::uint32_t visited[9];
+    std::uint32_t visitedCount = 0;
+    for (std::int32_t dz = -1; dz <= 1; ++dz)
+    {
+        for (std::int32_t dx = -1; dx <= 1; ++dx)
+        {
+            const std::uint32_t bucket = Hash(cx + dx, cz + dz);
+            if (std::find(visited, visited + visitedCount, bucket) != visited + visitedCount)
+                continue;
+            visited[visitedCount++] = bucket;
+
+            const std::uint32_t begin = mBucketStart[bucket], end = mBucketStart[bucket + 1];
+            for (std::uint32_t j = begin; j < end; j += 4)
+            {
+                const __m128 ddx = _mm_sub_ps(_mm_loadu_ps(&mSortedX[j]), x4);
+                const __m128 ddz = _mm_sub_ps(_mm_loadu_ps(&mSortedZ[j]), z4);
+                const __m128 d2 = _mm_add_ps(_mm_mul_ps(ddx, ddx), _mm_mul_ps(ddz, ddz));
+
+                // Ŷ   ĭ  (   Ǵ  Ŷ)
+                unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_cmplt_ps(d2, range4));
+                if (end - j < 4)
+                    mask &= (1u << (end - j)) - 1u;
+                if (!mask)
+                    continue;
+
+                alignas(16) float dist[4];
+                _mm_store_ps(dist, d2);
+                for (; mask; mask &= mask - 1)
+                {
+#if defined(_MSC_VER)
+                    unsigned long lane;
+                    _BitScanForward(&lane, mask);
+#else
+                    const unsigned int lane = (unsigned int)__builtin_ctz(mask);
+#endif
+                    if (j + lane != sorted)
+                        insert(dist[lane], j + lane);
+                }
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// ӵ  (RVO ø)
+// ---------------------------------------------------------
+void CrowdSimulation::SelectVelocity(std::uint32_t sorted, const NeighborList& neighbors)
+{
+    const std::uint32_t i = mSorted[sorted];
+    const float px = mSortedX[sorted], pz = mSortedZ[sorted];
+    const float vx = mSortedVelX[sorted], vz = mSortedVelZ[sorted];
+    const float radius = mSortedRadius[sorted];
+    const float maxSpeed = mMaxSpeed[i];
+
+    // 1. ĺ: ϴ ӵ (ְ ӵ ڸ) /  ӵ /  / ϴ ӵ  /   x 8 
+    //     Ʈ ٸ   ü    ʰ
+    float prefX = mPrefX[i], prefZ = mPrefZ[i];
+    const float prefLen = std::sqrt(prefX * prefX + prefZ * prefZ);
+    if (prefLen > maxSpeed && prefLen > 0.0f)
+    {
+        prefX *= maxSpeed / prefLen;
+        prefZ *= maxSpeed / prefLen;
+    }
+
+    alignas(16) float candX[CandidateCount];
+    alignas(16) float candZ[CandidateCount];
+    candX[0] = prefX;           candZ[0] = prefZ;
+    candX[1] = vx;              candZ[1] = vz;
+    candX[2] = 0.0f;            candZ[2] = 0.0f;
+    candX[3] = 0.5f * prefX;    candZ[3] = 0.5f * prefZ;
+
+    const float offset = std::fmod(mAgents[i] * 0.618034f, 1.0f) * (TwoPi / 8.0f);
+    for (std::uint32_t k = 0; k < 8; ++k)
+    {
+        const float a = offset + k * (TwoPi / 8.0f);
+        const float c = std::cos(a), s = std::sin(a);
+        const float half = TwoPi / 16.0f;
+        candX[4 + k] = c * maxSpeed;
+        candZ[4 + k] = s * maxSpeed;
+        candX[12 + k] = (c * std::cos(half) - s * std::sin(half)) * 0.5f * maxSpeed;
+        candZ[12 + k] = (s * std::cos(half) + c * std::sin(half)) * 0.5f * maxSpeed;
+    }
+
+    // 2. ̿ ( ġ p, ӵ,  , |p|^2 - R^2)
+    struct Other
+    {
+        float Px, Pz, SumVx, SumVz, C;
+    };
+    Other others[MaxCrowdNeighbors];
+    for (std::uint32_t n = 0; n < neighbors.Count; ++n)
+    {
+        const std::uint32_t j = neighbors.Sorted[n];
+        const float r = radius + mSortedRadius[j];
+        others[n].Px = mSortedX[j] - px;
+        others[n].Pz = mSortedZ[j] - pz;
+        others[n].SumVx = vx + mSortedVelX[j];
+        others[n].SumVz = vz + mSortedVelZ[j];
+        others[n].C = neighbors.DistSq[n] - r * r;
+    }
+
+    // 3. ĺ 4 :  ӵ w = 2v - v_i - v_j  |p - w t| = R  Ǵ  ̸ t
+    //    a t^2 - 2 b t + c = 0 (a = w.w, b = p.w). 1/t = a / (b - sqrt(b^2 - a c))
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 tiny = _mm_set1_ps(1e-6f);
+    const __m128 invHorizon = _mm_set1_ps(1.0f / mSettings.TimeHorizon);
+    const __m128 weight = _mm_set1_ps(mSettings.CollisionWeight);
+    const __m128 overlap = _mm_set1_ps(OverlapInvTime);
+    const __m128 prefX4 = _mm_set1_ps(prefX), prefZ4 = _mm_set1_ps(prefZ);
+
+    alignas(16) float penalty[CandidateCount];
+    for (std::uint32_t g = 0; g < CandidateCount; g += 4)
+    {
+        const __m128 cx = _mm_load_ps(&candX[g]);
+        const __m128 cz = _mm_load_ps(&candZ[g]);
+        const __m128 cx2 = _mm_add_ps(cx, cx), cz2 = _mm_add_ps(cz, cz);
+        __m128 invTime = zero;
+
+        for (std::uint32_t n = 0; n < neighbors.Count; ++n)
+        {
+            const Other& o = others[n];
+            const __m128 wx = _mm_sub_ps(cx2, _mm_set1_ps(o.SumVx));
+            const __m128 wz = _mm_sub_ps(cz2, _mm_set1_ps(o.SumVz));
+            const __m128 b = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(o.Px), wx), _mm_mul_ps(_mm_set1_ps(o.Pz), wz));
+            const __m128 approaching = _mm_cmpgt_ps(b, zero);
+
+            if (o.C <= 0.0f)
+            {
+                // ̹ ħ:  ٰ ĺ 
+                invTime = _mm_max_ps(invTime, _mm_and_ps(approaching, overlap));
+                continue;
+            }
+
+            const __m128 a = _mm_add_ps(_mm_mul_ps(wx, wx), _mm_mul_ps(wz, wz));
+            const __m128 disc = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(a, _mm_set1_ps(o.C)));
+            const __m128 hit = _mm_and_ps(approaching, _mm_cmpgt_ps(disc, zero));
+            const __m128 denom = _mm_max_ps(_mm_sub_ps(b, _mm_sqrt_ps(_mm_max_ps(disc, zero))), tiny);
+            invTime = _mm_max_ps(invTime, _mm_and_ps(hit, _mm_div_ps(a, denom)));
+        }
+
+        // þ  (TimeHorizon  ) 浹  
+        invTime = _mm_and_ps(invTime, _mm_cmpgt_ps(invTime, invHorizon));
+        const __m128 ex = _mm_sub_ps(cx, prefX4), ez = _mm_sub_ps(cz, prefZ4);
+        const __m128 dev = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ez, ez)));
+        _mm_store_ps(&penalty[g], _mm_add_ps(_mm_mul_ps(weight, invTime), dev));
+    }
+
+    // 4.    ĺ (  ȣ)
+    std::uint32_t best = 0;
+    for (std::uint32_t k = 1; k < CandidateCount; ++k)
+    {
+        if (penalty[k] < penalty[best])
+            best = k;
+    }
+    mVelX[i] = candX[best];
+    mVelZ[i] = candZ[best];
+}
+
+void CrowdSimulation::UpdateRange(std::uint32_t begin, std::uint32_t end)
+{
+    NeighborList neighbors;
+    for (std::uint32_t s = begin; s < end; ++s)
+    {
+        FindNeighbors(s, neighbors);
+        SelectVelocity(s, neighbors);
+    }
+}
+
+void CrowdSimulation::ComputeVelocities(bool parallel)
+{
+    PROFILE_SCOPE("CrowdSimulation::ComputeVelocities");
+
+    BuildGrid();
+
+    //   ƾ ̿ Ͱ ĳÿ  . б  纻,  ڱ mVel 
+    const std::uint32_t count = GetCount();
+    if (parallel && count >= ParallelThreshold)
+    {
+        JobSystem::GetInstance()->ParallelFor(count, ParallelGrain,
+            [this](std::uint32_t begin, std::uint32_t end) { UpdateRange(begin, end); });
+    }
+    else
+    {
+        UpdateRange(0, count);
+    }
+}
+
+void CrowdSimulation::Integrate(float dt)
+{
+    const std::uint32_t count = GetCount();
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        mPosX[i] += mVelX[i] * dt;
+        mPosZ[i] += mVelZ[i] * dt;
+    }
+}
+
+void CrowdSimulation::GetNeighbors(CrowdAgentId agent, std::vector<CrowdAgentId>& out)const
+{
+    out.clear();
+    if (mSortedOf.size() != GetCount())
+        return;
+
+    NeighborList neighbors;
+    FindNeighbors(mSortedOf[mSparse[agent]], neighbors);
+    for (std::uint32_t n = 0; n < neighbors.Count; ++n)
+        out.push_back(mAgents[mSorted[neighbors.Sorted[n]]]);
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+//  ȸ ( )
+// - Ʈ = XZ  . ġ / ӵ / ϴ ӵ /  / ְ ӵ SoA  (sparse set ̶  ȣ )
+// - ̿ ã:   (ĭ = NeighborDist, ĭ ǥ ؽ). ƽ ĭ   SoA   
+//   3x3 ĭ  ĺ SSE  4  Ÿ ˻ ->  MaxNeighbors 
+// - ӵ : RVO ø. ϴ ӵ /  ӵ /  /   x 8  = ĺ 20  SSE  4 
+//    = CollisionWeight / (  ε ð) + |ĺ - ϴ ӵ|
+//    ӵ (2v -  ӵ) - ̿ ӵ   (ȣ ӵ ֹ)  ݾ  
+// - Ʈ б⸸ ϰ ڱ ӵ Ƿ  ý   (    )
+// ̵  : Integrate()  ׳ űų,  ӵ CharacterController::Move  ְ
+//   ġ SetPosition()   (/ Ʈѷ ó)
+// ==========================================================
+
+using CrowdAgentId = std::uint32_t;
+constexpr CrowdAgentId InvalidCrowdAgent = 0xFFFFFFFFu;
+
+struct CrowdSettings
+{
+    float NeighborDist = 3.0f;          //  Ÿ (߽ ) ȸ ̿.  ĭ ũ
+    std::uint32_t MaxNeighbors = 10;    // MaxCrowdNeighbors 
+    float TimeHorizon = 2.0f;           // ̺ ʰ ε   ()
+    float CollisionWeight = 1.5f;       // 浹 ð   (m)
+};
+
+class CrowdSimulation
+{
+public:
+    static constexpr std::uint32_t MaxCrowdNeighbors = 16;
+    static constexpr std::uint32_t CandidateCount = 20;    // 4  
+
+    explicit CrowdSimulation(const CrowdSettings& settings = CrowdSettings());
+
+    void Reserve(std::uint32_t count);
+    void Clear();
+
+    CrowdAgentId AddAgent(float x, float z, float radius, float maxSpeed);
+    void RemoveAgent(CrowdAgentId agent);
+    bool IsAlive(CrowdAgentId agent)const;
+    std::uint32_t GetCount()const { return (std::uint32_t)mAgents.size(); }
+
+    void SetPosition(CrowdAgentId agent, float x, float z);
+    void SetPreferredVelocity(CrowdAgentId agent, float vx, float vz);
+
+    // ǥ   ְ ӵ ( 0.5   )
+    void SetTarget(CrowdAgentId agent, float x, float z);
+
+    void GetPosition(CrowdAgentId agent, float& x, float& z)const;
+    void GetVelocity(CrowdAgentId agent, float& vx, float& vz)const;
+
+    // ڸ ٽ    ӵ . Ʈ   ý
+    void ComputeVelocities(bool parallel = true);
+
+    // ġ += ӵ * dt (浹    )
+    void Integrate(float dt);
+
+    //  ComputeVelocities  ġ  ̿ ( ). ˻
+    void GetNeighbors(CrowdAgentId agent, std::vector<CrowdAgentId>& out)const;
+
+    const CrowdSettings& GetSettings()const { return mSettings; }
+
+private:
+    struct NeighborList
+    {
+        std::uint32_t Count = 0;
+        float DistSq[MaxCrowdNeighbors];
+        std::uint32_t Sorted[MaxCrowdNeighbors];   //  迭 ȣ
+    };
+
+    void BuildGrid();
+    std::uint32_t Hash(std::int32_t cx, std::int32_t cz)const;
+    void FindNeighbors(std::uint32_t sorted, NeighborList& out)const;
+    void SelectVelocity(std::uint32_t sorted, const NeighborList& neighbors);
+    void UpdateRange(std::uint32_t begin, std::uint32_t end);
+
+private:
+    CrowdSettings mSettings;
+
+    // sparse: CrowdAgentId ->  ε
+    std::vector<std::uint32_t> mSparse;
+    std::vector<CrowdAgentId> mFreeIds;
+
+    //  迭 (  )
+    std::vector<CrowdAgentId> mAgents;
+    std::vector<float> mPosX, mPosZ;
+    std::vector<float> mVelX, mVelZ;
+    std::vector<float> mPrefX, mPrefZ;
+    std::vector<float> mRadius, mMaxSpeed;
+
+    // : ĭ ؽ   纻 (ڿ SIMD  Ѱ о ǰ   4  )
+    std::uint32_t mBucketMask = 0;
+    std::vector<std::uint32_t> mBucketStart;   // Ŷ  + 1
+    std::vector<std::uint32_t> mBucketOf;      //  ε -> Ŷ
+    std::vector<std::uint32_t> mSorted;        //  ȣ ->  ε
+    std::vector<std::uint32_t> mSortedOf;      //  ε ->  ȣ
+    std::vector<float> mSortedX, mSortedZ;
+    std::vector<float> mSortedVelX, mSortedVelZ;
+    std::vector<float> mSortedRadius;
+};
@@ -0,0 +1,235 @@
+#include "D3D12PipelineCache.h"
+#include "ShaderKey.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <chrono>
+#include <cstdio>
+
+using ShaderArchiveFormat::EntryKind;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    UINT GetCompileFlags()
+    {
+        // d3dUtil::CompileShader   (÷׵ Ű )
+#if defined(_DEBUG) || defined(DEBUG)
+        return D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#else
+        return 0;
+#endif
+    }
+
+    void AddBytecode(ShaderKeyBuilder& key, const D3D12_SHADER_BYTECODE& bytecode)
+    {
+        key.Add(bytecode.BytecodeLength != 0 ? ShaderHash::Hash(bytecode.pShaderBytecode, bytecode.BytecodeLength) : 0);
+    }
+
+    template<typename T>
+    void AddPod(ShaderKeyBuilder& key, const T& value)
+    {
+        key.Add(&value, sizeof(value));
+    }
+}
+
+D3D12PipelineCache::D3D12PipelineCache(ID3D12Device* device, const std::string& archivePath)
+    : mDevice(device), mArchivePath(archivePath)
+{
+    // ų  ٸų   ĳ÷  (Save   )
+    if (!mArchive.Open(mArchivePath))
+        mDirty = true;
+}
+
+D3D12_SHADER_BYTECODE D3D12PipelineCache::LoadShader(const std::string& path, const D3D_SHADER_MACRO* defines,
+    const std::string& entryPoint, const std::string& target)
+{
+    PROFILE_SCOPE("D3D12PipelineCache::LoadShader");
+    auto t0 = Clock::now();
+
+    // 1. Ű
+    ShaderSourceDesc desc;
+    desc.Path = path;
+    desc.EntryPoint = entryPoint;
+    desc.Target = target;
+    desc.Flags = GetCompileFlags();
+    for (const D3D_SHADER_MACRO* define = defines; define != nullptr && define->Name != nullptr; ++define)
+        desc.Defines.push_back({ define->Name, define->Definition != nullptr ? define->Definition : "" });
+
+    ShaderSourceKey source;
+    std::string error;
+    if (!ShaderKey::Compute(desc, source, &error))
+    {
+        OutputDebugStringA((error + "\n").c_str());
+        ThrowIfFailed(HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND));
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // 2. ī̺꿡 ã
+    const void* data = nullptr;
+    std::size_t size = 0;
+    const ShaderLookup lookup = mArchive.Find(source.Key, EntryKind::Shader, data, size);
+    if (lookup == ShaderLookup::Found)
+    {
+        mUsed.Add(source.Key, EntryKind::Shader, data, size);
+        ++mStats.ShaderHits;
+        mStats.ShaderMs += ElapsedMs(t0, Clock::now());
+        return { data, size };
+    }
+    if (lookup == ShaderLookup::Corrupt)
+        ++mStats.CorruptEntries;
+
+    // 3.   (Ű   ҽ)
+    ComPtr<ID3DBlob> byteCode;
+    ComPtr<ID3DBlob> errors;
+    HRESULT hr = D3DCompile(source.Source.data(), source.Source.size(), path.c_str(), defines,
+        D3D_COMPILE_STANDARD_FILE_INCLUDE, entryPoint.c_str(), target.c_str(), desc.Flags, 0, &byteCode, &errors);
+
+    if (errors != nullptr)
+        OutputDebugStringA((char*)errors->GetBufferPointer());
+    ThrowIfFailed(hr);
+
+    mUsed.Add(source.Key, EntryKind::Shader, byteCode->GetBufferPointer(), byteCode->GetBufferSize());
+    mDirty = true;
+    ++mStats.ShaderMisses;
+
+    mCompiled.push_back(byteCode);
+    mStats.ShaderMs += ElapsedMs(t0, Clock::now());
+    return { byteCode->GetBufferPointer(), byteCode->GetBufferSize() };
+}
+
+void D3D12PipelineCache::CreateGraphicsPipelines(const D3D12_GRAPHICS_PIPELINE_STATE_DESC* descs, std::uint32_t count,
+    std::uint64_t rootSignatureKey, ComPtr<ID3D12PipelineState>* pipelines)
+{
+    PROFILE_SCOPE("D3D12PipelineCache::CreateGraphicsPipelines");
+    auto t0 = Clock::now();
+
+    // Ŀ throw  ʰ  Ƽ ⼭ Ȯ
+    std::vector<HRESULT> results(count, S_OK);
+
+    // ̹   ɸ ̶ ϳ   (CreateGraphicsPipelineState   )
+    JobSystem::GetInstance()->ParallelFor(count, 1,
+        [&](std::uint32_t begin, std::uint32_t end)
+        {
+            for (std::uint32_t i = begin; i < end; ++i)
+            {
+                D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = descs[i];
+                const std::uint64_t key = ComputePipelineKey(desc, rootSignatureKey);
+
+                // 1. ĳ  (Find  б⸸ ϹǷ  )
+                const void* data = nullptr;
+                std::size_t size = 0;
+                const ShaderLookup lookup = mArchive.Find(key, EntryKind::Pipeline, data, size);
+                if (lookup == ShaderLookup::Found)
+                {
+                    desc.CachedPSO = { data, size };
+                    if (SUCCEEDED(mDevice->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(pipelines[i].ReleaseAndGetAddressOf()))))
+                    {
+                        std::lock_guard<std::mutex> lock(mMutex);
+                        mUsed.Add(key, EntryKind::Pipeline, data, size);
+                        ++mStats.PipelineHits;
+                        continue;
+                    }
+                    desc.CachedPSO = {};
+                }
+
+                // 2. ó (źε    )
+                results[i] = mDevice->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(pipelines[i].ReleaseAndGetAddressOf()));
+
+                ComPtr<ID3DBlob> blob;
+                const bool cached = SUCCEEDED(results[i]) && SUCCEEDED(pipelines[i]->GetCachedBlob(&blob));
+
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (cached)
+                    mUsed.Add(key, EntryKind::Pipeline, blob->GetBufferPointer(), blob->GetBufferSize());
+                mDirty = true;
+                ++mStats.PipelineMisses;
+                if (lookup == ShaderLookup::Found)
+                    ++mStats.PipelineRejected;
+                else if (lookup == ShaderLookup::Corrupt)
+                    ++mStats.CorruptEntries;
+            }
+        });
+
+    mStats.PipelineMs += ElapsedMs(t0, Clock::now());
+
+    for (HRESULT hr : results)
+        ThrowIfFailed(hr);
+}
+
+void D3D12PipelineCache::Save()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mDirty && mUsed.GetEntryCount() == mArchive.GetEntryCount())
+        return;
+
+    //    ٲ  Ƿ ݰ  ( ׸ mUsed   )
+    mArchive.Close();
+
+    std::string error;
+    if (!mUsed.Write(mArchivePath, &error))
+        OutputDebugStringA(("D3D12PipelineCache: " + error + "\n").c_str());
+
+    mArchive.Open(mArchivePath);
+    mDirty = false;
+}
+
+std::string D3D12PipelineCache::GetStatsString()const
+{
+    char line[256];
+    snprintf(line, sizeof(line),
+        "[PipelineCache] shaders hit %u / miss %u (%.2f ms), pipelines hit %u / miss %u / rejected %u (%.2f ms), corrupt %u\n",
+        mStats.ShaderHits, mStats.ShaderMisses, mStats.ShaderMs,
+        mStats.PipelineHits, mStats.PipelineMisses, mStats.PipelineRejected, mStats.PipelineMs,
+        mStats.CorruptEntries);
+    return line;
+}
+
+std::uint64_t D3D12PipelineCache::ComputePipelineKey(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, std::uint64_t rootSignatureKey)
+{
+    // Ͱ ƴ϶ Ű  (ü ZeroMemory  ϹǷ е 0)
+    ShaderKeyBuilder key;
+    key.Add(rootSignatureKey);
+
+    AddBytecode(key, desc.VS);
+    AddBytecode(key, desc.PS);
+    AddBytecode(key, desc.DS);
+    AddBytecode(key, desc.HS);
+    AddBytecode(key, desc.GS);
+    assert(desc.StreamOutput.NumEntries == 0 && "stream output is not part of the pipeline key");
+
+    AddPod(key, desc.BlendState);
+    AddPod(key, desc.SampleMask);
+    AddPod(key, desc.RasterizerState);
+    AddPod(key, desc.DepthStencilState);
+    AddPod(key, desc.IBStripCutValue);
+    AddPod(key, desc.PrimitiveTopologyType);
+    AddPod(key, desc.NumRenderTargets);
+    AddPod(key, desc.RTVFormats);
+    AddPod(key, desc.DSVFormat);
+    AddPod(key, desc.SampleDesc);
+    AddPod(key, desc.NodeMask);
+    AddPod(key, desc.Flags);
+
+    key.Add((std::uint64_t)desc.InputLayout.NumElements);
+    for (UINT i = 0; i < desc.InputLayout.NumElements; ++i)
+    {
+        const D3D12_INPUT_ELEMENT_DESC& element = desc.InputLayout.pInputElementDescs[i];
+        key.Add(std::string(element.SemanticName));
+        AddPod(key, element.SemanticIndex);
+        AddPod(key, element.Format);
+        AddPod(key, element.InputSlot);
+        AddPod(key, element.AlignedByteOffset);
+        AddPod(key, element.InputSlotClass);
+        AddPod(key, element.InstanceDataStepRate);
+    }
+
+    return key.GetKey();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "d3dUtil.h"
+#include "ShaderArchive.h"
+#include <deque>
+#include <mutex>
+
+// ==========================================================
+// ̴ Ʈڵ + PSO ĳ (ShaderArchive  D3D12 )
+// - LoadShader: ҽ/Ŭ/ũ//Ÿ ؽ(ShaderKey) ã,  D3DCompile
+//   (Ű  ҽ Ʈ ״  -> Ű  ߳ ƴ )
+// - CreateGraphicsPipelines:  PSO  JobSystem Ŀ ÿ 
+//   PSO  ؽ÷ ̹ ĳ (GetCachedBlob) ã CachedPSO  ѱ
+//   ̹/GPU  ٲ  źϸ   ٽ    ü
+// - Save: ̹ ࿡  ׸  ٽ  (ٲ ̴  ׸  ʰ)
+//     ͵   ͵   
+// LoadShader   Ʈڵ ε  ų  Ƿ Save  ȿ
+// ==========================================================
+
+struct PipelineCacheStats
+{
+    std::uint32_t ShaderHits = 0;
+    std::uint32_t ShaderMisses = 0;
+    std::uint32_t PipelineHits = 0;
+    std::uint32_t PipelineMisses = 0;
+    std::uint32_t PipelineRejected = 0;  // ĳ  ̹ ź (Misses  )
+    std::uint32_t CorruptEntries = 0;    //  ؽð   ׸ (Misses  )
+    double ShaderMs = 0.0;               // LoadShader 
+    double PipelineMs = 0.0;             // CreateGraphicsPipelines  (ð)
+};
+
+class D3D12PipelineCache
+{
+public:
+    D3D12PipelineCache(ID3D12Device* device, const std::string& archivePath);
+    D3D12PipelineCache(const D3D12PipelineCache& rhs) = delete;
+    D3D12PipelineCache& operator=(const D3D12PipelineCache& rhs) = delete;
+
+    //    â  throw (d3dUtil::CompileShader  )
+    D3D12_SHADER_BYTECODE LoadShader(const std::string& path, const D3D_SHADER_MACRO* defines,
+        const std::string& entryPoint, const std::string& target);
+
+    // descs[i] -> pipelines[i]. rootSignatureKey = ȭ Ʈ ñ״ó ؽ (desc  ʹ ؽ  Ƿ)
+    void CreateGraphicsPipelines(const D3D12_GRAPHICS_PIPELINE_STATE_DESC* descs, std::uint32_t count,
+        std::uint64_t rootSignatureKey, ComPtr<ID3D12PipelineState>* pipelines);
+
+    void Save();
+
+    const PipelineCacheStats& GetStats()const { return mStats; }
+    std::string GetStatsString()const;
+
+    static std::uint64_t ComputePipelineKey(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, std::uint64_t rootSignatureKey);
+
+private:
+    ID3D12Device* mDevice = nullptr;
+    std::string mArchivePath;
+
+    ShaderArchive mArchive;
+    ShaderArchiveWriter mUsed;      // ̹ ࿡  ׸ (Save  ״ )
+    bool mDirty = false;            //  ų  ׸ 
+    std::mutex mMutex;              // mUsed / mStats (PSO  Ŀ )
+
+    std::deque<ComPtr<ID3DBlob>> mCompiled; //   Ʈڵ (  )
+    PipelineCacheStats mStats;
+};
@@ -0,0 +1,152 @@
+#include "D3D12RenderBackend.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+
+D3D12RenderBackend::D3D12RenderBackend(ID3D12Device* device, ID3D12CommandQueue* queue, std::uint32_t frameCount, std::uint32_t maxStreams)
+    : mDevice(device), mQueue(queue), mFrameCount(frameCount), mMaxStreams(maxStreams)
+{
+    assert(frameCount > 0 && maxStreams > 0);
+
+    mAllocators.resize((std::size_t)frameCount * maxStreams);
+    for (auto& allocator : mAllocators)
+    {
+        ThrowIfFailed(mDevice->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_DIRECT,
+            IID_PPV_ARGS(allocator.GetAddressOf())));
+    }
+
+    // Ʈ  ·  ΰ Submit  Reset
+    mCommandLists.resize(maxStreams);
+    for (std::uint32_t s = 0; s < maxStreams; ++s)
+    {
+        ThrowIfFailed(mDevice->CreateCommandList(
+            0,
+            D3D12_COMMAND_LIST_TYPE_DIRECT,
+            mAllocators[s].Get(),
+            nullptr,
+            IID_PPV_ARGS(mCommandLists[s].GetAddressOf())));
+        mCommandLists[s]->Close();
+        mSubmitLists.push_back(mCommandLists[s].Get());
+    }
+}
+
+void D3D12RenderBackend::SetPipeline(std::uint32_t id, ID3D12PipelineState* pso)
+{
+    if (id >= mPipelines.size())
+        mPipelines.resize(id + 1, nullptr);
+    mPipelines[id] = pso;
+}
+
+void D3D12RenderBackend::BeginFrame(std::uint32_t frameIndex)
+{
+    assert(frameIndex < mFrameCount);
+    mFrameIndex = frameIndex;
+
+    for (std::uint32_t s = 0; s < mMaxStreams; ++s)
+        ThrowIfFailed(mAllocators[(std::size_t)frameIndex * mMaxStreams + s]->Reset());
+}
+
+void D3D12RenderBackend::Submit(const CommandStream* streams, std::uint32_t count)
+{
+    PROFILE_SCOPE("D3D12RenderBackend::Submit");
+
+    assert(count <= mMaxStreams);
+    if (count == 0)
+        return;
+
+    // 1. Ʈ ڱ Ʈ  (Ʈ/Ҵڰ Ʈ ζ ÿ ص )
+    JobSystem::GetInstance()->ParallelFor(count, 1,
+        [this, streams](std::uint32_t begin, std::uint32_t end)
+        {
+            for (std::uint32_t s = begin; s < end; ++s)
+            {
+                ID3D12GraphicsCommandList* commandList = mCommandLists[s].Get();
+                ThrowIfFailed(commandList->Reset(mAllocators[(std::size_t)mFrameIndex * mMaxStreams + s].Get(), nullptr));
+                Translate(streams[s], commandList);
+                ThrowIfFailed(commandList->Close());
+            }
+        });
+
+    // 2. Ʈ    
+    mQueue->ExecuteCommandLists(count, mSubmitLists.data());
+}
+
+void D3D12RenderBackend::Translate(const CommandStream& stream, ID3D12GraphicsCommandList* commandList)const
+{
+    // 1. н  (Ʈ ó)
+    commandList->SetGraphicsRootSignature(mPassState.RootSignature);
+    commandList->RSSetViewports(1, &mPassState.Viewport);
+    commandList->RSSetScissorRects(1, &mPassState.Scissor);
+    commandList->OMSetRenderTargets(1, &mPassState.RenderTarget, true, &mPassState.DepthStencil);
+    commandList->IASetPrimitiveTopology(mPassState.Topology);
+
+    // 2.  
+    stream.ForEach([&](const RenderCommandHeader& header)
+    {
+        switch (header.Type)
+        {
+        case RenderCommandType::SetPipeline:
+        {
+            const CmdSetPipeline& command = CommandStream::As<CmdSetPipeline>(header);
+            assert(command.Pipeline < mPipelines.size() && mPipelines[command.Pipeline] != nullptr);
+            commandList->SetPipelineState(mPipelines[command.Pipeline]);
+            break;
+        }
+
+        case RenderCommandType::SetVertexBuffer:
+        {
+            const CmdSetVertexBuffer& command = CommandStream::As<CmdSetVertexBuffer>(header);
+            D3D12_VERTEX_BUFFER_VIEW vbv;
+            vbv.BufferLocation = command.Address;
+            vbv.SizeInBytes = command.ByteSize;
+            vbv.StrideInBytes = command.Stride;
+            commandList->IASetVertexBuffers(0, 1, &vbv);
+            break;
+        }
+
+        case RenderCommandType::SetIndexBuffer:
+        {
+            const CmdSetIndexBuffer& command = CommandStream::As<CmdSetIndexBuffer>(header);
+            D3D12_INDEX_BUFFER_VIEW ibv;
+            ibv.BufferLocation = command.Address;
+            ibv.SizeInBytes = command.ByteSize;
+            ibv.Format = command.IndexByteSize == 4 ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT;
+            commandList->IASetIndexBuffer(&ibv);
+            break;
+        }
+
+        case RenderCommandType::SetRootConstant:
+        {
+            const CmdSetRootConstant& command = CommandStream::As<CmdSetRootConstant>(header);
+            commandList->SetGraphicsRoot32BitConstant(command.Slot, command.Value, command.Offset);
+            break;
+        }
+
+        case RenderCommandType::SetRootConstantBuffer:
+        {
+            const CmdSetRootBuffer& command = CommandStream::As<CmdSetRootBuffer>(header);
+            commandList->SetGraphicsRootConstantBufferView(command.Slot, command.Address);
+            break;
+        }
+
+        case RenderCommandType::SetRootShaderResource:
+        {
+            const CmdSetRootBuffer& command = CommandStream::As<CmdSetRootBuffer>(header);
+            commandList->SetGraphicsRootShaderResourceView(command.Slot, command.Address);
+            break;
+        }
+
+        case RenderCommandType::DrawIndexed:
+        {
+            const CmdDrawIndexed& command = CommandStream::As<CmdDrawIndexed>(header);
+            commandList->DrawIndexedInstanced(command.IndexCount, command.InstanceCount,
+                command.StartIndex, command.BaseVertex, command.StartInstance);
+            break;
+        }
+
+        default:
+            assert(false && "unknown render command");
+            break;
+        }
+    });
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "d3dUtil.h"
+#include "CommandStream.h"
+
+// ==========================================================
+//  Ʈ -> D3D12  Ʈ 
+// - Ʈ  Ʈ ϳ,  JobSystem Ŀ ÿ
+//    Ʈ  ExecuteCommandLists  
+// -  Ʈ ۿ н (Ʈ ñ״ó/Ʈ/ Ÿ/) ٽ 
+//   (Ʈ ̿ ° ̾ Ƿ)
+// - Ҵڴ ( ҽ x Ʈ) . BeginFrame    ͸ Reset
+//   -> ȣϴ    潺 ̹ ٷȾ 
+//  Ÿ 踮 ⼭   (  Ʈ յڷ)
+// ==========================================================
+
+struct D3D12PassState
+{
+    ID3D12RootSignature* RootSignature = nullptr;
+    D3D12_VIEWPORT Viewport = {};
+    D3D12_RECT Scissor = {};
+    D3D12_CPU_DESCRIPTOR_HANDLE RenderTarget = {};
+    D3D12_CPU_DESCRIPTOR_HANDLE DepthStencil = {};
+    D3D12_PRIMITIVE_TOPOLOGY Topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+};
+
+class D3D12RenderBackend : public RenderBackend
+{
+public:
+    D3D12RenderBackend(ID3D12Device* device, ID3D12CommandQueue* queue, std::uint32_t frameCount, std::uint32_t maxStreams);
+    D3D12RenderBackend(const D3D12RenderBackend& rhs) = delete;
+    D3D12RenderBackend& operator=(const D3D12RenderBackend& rhs) = delete;
+
+    // Ʈ  ȣ -> PSO (nullptr ̸  ȣ   )
+    void SetPipeline(std::uint32_t id, ID3D12PipelineState* pso);
+
+    void BeginFrame(std::uint32_t frameIndex);
+    void SetPassState(const D3D12PassState& state) { mPassState = state; }
+
+    // ִ maxStreams  ( assert)
+    void Submit(const CommandStream* streams, std::uint32_t count) override;
+
+    std::uint32_t GetMaxStreams()const { return mMaxStreams; }
+
+private:
+    void Translate(const CommandStream& stream, ID3D12GraphicsCommandList* commandList)const;
+
+private:
+    ID3D12Device* mDevice = nullptr;
+    ID3D12CommandQueue* mQueue = nullptr;
+    std::uint32_t mFrameCount = 0;
+    std::uint32_t mMaxStreams = 0;
+    std::uint32_t mFrameIndex = 0;
+
+    std::vector<ComPtr<ID3D12CommandAllocator>> mAllocators;   // frame * mMaxStreams + stream
+    std::vector<ComPtr<ID3D12GraphicsCommandList>> mCommandLists; // Ʈ ( ߿ Reset )
+    std::vector<ID3D12CommandList*> mSubmitLists;                  // ExecuteCommandLists   
+    std::vector<ID3D12PipelineState*> mPipelines;
+
+    D3D12PassState mPassState;
+};
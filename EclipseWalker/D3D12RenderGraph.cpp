@@ -0,0 +1,54 @@
+#include "D3D12RenderGraph.h"
+#include <algorithm>
+
+namespace D3D12RenderGraph
+{
+    D3D12_RESOURCE_STATES ToResourceStates(std::uint32_t state)
+    {
+        D3D12_RESOURCE_STATES states = D3D12_RESOURCE_STATE_COMMON;
+        if (state & RgState::RenderTarget)    states |= D3D12_RESOURCE_STATE_RENDER_TARGET;
+        if (state & RgState::DepthWrite)      states |= D3D12_RESOURCE_STATE_DEPTH_WRITE;
+        if (state & RgState::DepthRead)       states |= D3D12_RESOURCE_STATE_DEPTH_READ;
+        if (state & RgState::ShaderResource)  states |= D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+        if (state & RgState::UnorderedAccess) states |= D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+        if (state & RgState::CopySource)      states |= D3D12_RESOURCE_STATE_COPY_SOURCE;
+        if (state & RgState::CopyDest)        states |= D3D12_RESOURCE_STATE_COPY_DEST;
+        return states;
+    }
+
+    void RecordBarriers(ID3D12GraphicsCommandList* commandList, const RgBarrier* barriers, std::uint32_t count,
+        ID3D12Resource* const* resources)
+    {
+        //        (ġ  )
+        constexpr std::uint32_t MaxBatch = 32;
+        D3D12_RESOURCE_BARRIER batch[MaxBatch];
+
+        for (std::uint32_t begin = 0; begin < count; begin += MaxBatch)
+        {
+            const std::uint32_t batchCount = std::min(count - begin, MaxBatch);
+            for (std::uint32_t i = 0; i < batchCount; ++i)
+            {
+                const RgBarrier& barrier = barriers[begin + i];
+                ID3D12Resource* resource = resources[barrier.Resource];
+
+                switch (barrier.Type)
+                {
+                case RgBarrierType::Transition:
+                    batch[i] = CD3DX12_RESOURCE_BARRIER::Transition(resource,
+                        ToResourceStates(barrier.StateBefore), ToResourceStates(barrier.StateAfter));
+                    break;
+
+                case RgBarrierType::Aliasing:
+                    batch[i] = CD3DX12_RESOURCE_BARRIER::Aliasing(
+                        barrier.Before != InvalidRgResource ? resources[barrier.Before] : nullptr, resource);
+                    break;
+
+                case RgBarrierType::UnorderedAccess:
+                    batch[i] = CD3DX12_RESOURCE_BARRIER::UAV(resource);
+                    break;
+                }
+            }
+            commandList->ResourceBarrier(batchCount, batch);
+        }
+    }
+}
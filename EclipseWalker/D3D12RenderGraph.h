@@ -0,0 +1,16 @@
+#pragma once
+#include "d3dUtil.h"
+#include "RenderGraph.h"
+
+// ==========================================================
+// RenderGraph 踮 -> D3D12 踮
+//  ϳ ResourceBarrier    (resources  RgResource ȣ ε)
+// ==========================================================
+
+namespace D3D12RenderGraph
+{
+    D3D12_RESOURCE_STATES ToResourceStates(std::uint32_t state);
+
+    void RecordBarriers(ID3D12GraphicsCommandList* commandList, const RgBarrier* barriers, std::uint32_t count,
+        ID3D12Resource* const* resources);
+}
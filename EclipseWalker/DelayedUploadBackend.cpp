@@ -0,0 +1,90 @@
+#include "DelayedUploadBackend.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+DelayedUploadBackend::DelayedUploadBackend(const std::uint8_t* stagingMemory, std::uint32_t completionDelay)
+    : mStaging(stagingMemory), mCompletionDelay(completionDelay)
+{
+    assert(stagingMemory != nullptr);
+}
+
+void DelayedUploadBackend::SubmitUploads(const UploadCopyCommand* commands, std::size_t count, UploadTicket ticket)
+{
+    if (ticket != mLastSubmitted + 1)
+        ++mOrderErrors;
+    mLastSubmitted = ticket;
+
+    // ¡     ( ż Complete   )
+    Batch batch;
+    batch.Ticket = ticket;
+    batch.DueTick = mTick + mCompletionDelay;
+    batch.Commands.assign(commands, commands + count);
+
+    std::uint64_t bytes = 0;
+    for (const UploadCopyCommand& command : batch.Commands)
+        bytes += command.Size;
+
+    ++mSubmittedBatches;
+    mSubmittedCommands += count;
+    mLargestBatchBytes = std::max(mLargestBatchBytes, bytes);
+
+    mInFlight.push_back(std::move(batch));
+    if (mCompletionDelay == 0)
+        Tick();
+}
+
+void DelayedUploadBackend::WaitForTicket(UploadTicket ticket)
+{
+    if (ticket <= mCompletedTicket)
+        return;
+
+    ++mWaitCount;
+    while (!mInFlight.empty() && mInFlight.front().Ticket <= ticket)
+    {
+        Complete(mInFlight.front());
+        mInFlight.pop_front();
+    }
+}
+
+void DelayedUploadBackend::Tick()
+{
+    if (mCompletionDelay > 0)
+        ++mTick;
+
+    while (!mInFlight.empty() && mInFlight.front().DueTick <= mTick)
+    {
+        Complete(mInFlight.front());
+        mInFlight.pop_front();
+    }
+}
+
+void DelayedUploadBackend::Complete(const Batch& batch)
+{
+    for (const UploadCopyCommand& command : batch.Commands)
+    {
+        std::uint8_t* dst = static_cast<std::uint8_t*>(command.Dst);
+        const std::uint8_t* src = mStaging + command.SrcOffset;
+
+        if (command.Kind == UploadCopyCommand::Type::Buffer)
+        {
+            memcpy(dst + command.DstOffset, src, (size_t)command.Size);
+            continue;
+        }
+
+        // ؽó: ¡   (RowPitch) ->   
+        const UploadTextureFootprint& f = command.Footprint;
+        const std::uint64_t srcSlice = (std::uint64_t)f.RowPitch * f.RowCount;
+        const std::uint64_t dstSlice = f.RowBytes * f.RowCount;
+        for (std::uint32_t z = 0; z < f.Depth; ++z)
+        {
+            for (std::uint32_t row = 0; row < f.RowCount; ++row)
+            {
+                memcpy(dst + z * dstSlice + row * f.RowBytes,
+                    src + z * srcSlice + (std::uint64_t)row * f.RowPitch, (size_t)f.RowBytes);
+            }
+        }
+    }
+
+    mCompletedTicket = std::max(mCompletedTicket, batch.Ticket);
+}
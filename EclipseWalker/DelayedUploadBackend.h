@@ -0,0 +1,58 @@
+#pragma once
+#include "UploadBatcher.h"
+#include <deque>
+#include <vector>
+
+// ==========================================================
+// ¥ ε 鿣 (߿, GPU  UploadBatcher Ȯ)
+// -  ġ Tick()  completionDelay  θ ڿ  ϰ Ƽ ȣ
+//   ->  ť ʰ  Ȳ ״:  ̿ ¡   Ͱ Ʋ
+// - WaitForTicket   Ƽϱ и ġ  ٷ  (CPU  ٸ )
+// Dst  CPU ޸ ͷ ؼ (ؽó     RowBytes x RowCount x Depth)
+// ==========================================================
+
+class DelayedUploadBackend : public UploadBackend
+{
+public:
+    DelayedUploadBackend(const std::uint8_t* stagingMemory, std::uint32_t completionDelay);
+    DelayedUploadBackend(const DelayedUploadBackend& rhs) = delete;
+    DelayedUploadBackend& operator=(const DelayedUploadBackend& rhs) = delete;
+
+    void SubmitUploads(const UploadCopyCommand* commands, std::size_t count, UploadTicket ticket) override;
+    UploadTicket GetCompletedTicket() override { return mCompletedTicket; }
+    void WaitForTicket(UploadTicket ticket) override;
+
+    // ð  ĭ ( ϳ) ,   ġ 
+    void Tick();
+
+    std::uint64_t GetSubmittedBatches()const { return mSubmittedBatches; }
+    std::uint64_t GetSubmittedCommands()const { return mSubmittedCommands; }
+    std::uint64_t GetLargestBatchBytes()const { return mLargestBatchBytes; }
+    std::uint64_t GetWaitCount()const { return mWaitCount; }        //   ٸ Ƚ
+    std::uint64_t GetOrderErrors()const { return mOrderErrors; }    // Ƽ 1    
+
+private:
+    struct Batch
+    {
+        UploadTicket Ticket = 0;
+        std::uint64_t DueTick = 0;
+        std::vector<UploadCopyCommand> Commands;
+    };
+
+    void Complete(const Batch& batch);
+
+private:
+    const std::uint8_t* mStaging = nullptr;
+    std::uint32_t mCompletionDelay = 0;
+
+    std::uint64_t mTick = 0;
+    std::deque<Batch> mInFlight; //  
+    UploadTicket mLastSubmitted = 0;
+    UploadTicket mCompletedTicket = 0;
+
+    std::uint64_t mSubmittedBatches = 0;
+    std::uint64_t mSubmittedCommands = 0;
+    std::uint64_t mLargestBatchBytes = 0;
+    std::uint64_t mWaitCount = 0;
+    std::uint64_t mOrderErrors = 0;
+};
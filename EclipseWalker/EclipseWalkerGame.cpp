@@ -1,7 +1,20 @@
 #include "EclipseWalkerGame.h"
+#include "MeshCooker.h"
+#include "VertexCompression.h"
+#include "NavMeshBuilder.h"
+#include "SweepTests.h"
+#include "ShaderKey.h"
+#include "D3D12RenderGraph.h"
+#include "JobSystem.h"
 #include <windowsx.h>
 
 
+// ŷ  ˰ VertexTypes  ߳  
+static_assert(sizeof(VertexTypes::VertexPosColor) == 28, "MeshFormat::VertexFormat::PosColor stride");
+static_assert(sizeof(VertexTypes::VertexPosNormalTex) == 32, "MeshFormat::VertexFormat::PosNormalTex stride");
+static_assert(sizeof(VertexTypes::VertexPackedPosColor) == 12, "MeshFormat::VertexFormat::PackedPosColor stride");
+static_assert(sizeof(VertexTypes::VertexPackedPosNormalTex) == 16, "MeshFormat::VertexFormat::PackedPosNormalTex stride");
+
 EclipseWalkerGame::EclipseWalkerGame(HINSTANCE hInstance)
     : GameFramework(hInstance)
 {
@@ -9,6 +22,19 @@ EclipseWalkerGame::EclipseWalkerGame(HINSTANCE hInstance)
 
 EclipseWalkerGame::~EclipseWalkerGame()
 {
+    //  ۸ GPU  а   
+    if (md3dDevice != nullptr && mCommandQueue != nullptr)
+        FlushCommandQueue();
+
+    //  ť  ޽ ۿ    
+    if (mUploadManager != nullptr)
+        mUploadManager->WaitIdle();
+
+    for (auto& mesh : mMeshes)
+    {
+        mGpuMemory->Free(mesh->VertexBufferGPU);
+        mGpuMemory->Free(mesh->IndexBufferGPU);
+    }
 }
 
 bool EclipseWalkerGame::Initialize()
@@ -16,29 +42,23 @@ bool EclipseWalkerGame::Initialize()
     if (!GameFramework::Initialize())
         return false;
 
-    ThrowIfFailed(mCommandList->Reset(mDirectCmdListAlloc.Get(), nullptr));
-
-    BuildConstantBuffer();
+    BuildFrameResources();
     BuildRootSignature();
     BuildShadersAndInputLayout();
     BuildPSO();
+    BuildRenderBackend();
 
-    // 
-    BuildBoxGeometry();
+    //  ʹ   θ (⼭ ̴ Ʈڵ  )
+    mPipelineCache->Save();
+    mvsByteCode = {};
+    mpsByteCode = {};
+    mParticleVsByteCode = {};
+    mParticlePsByteCode = {};
+    OutputDebugStringA(mPipelineCache->GetStatsString().c_str());
 
-    ThrowIfFailed(mCommandList->Close());
-    ID3D12CommandList* cmdsLists[] = { mCommandList.Get() };
-    mCommandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
-
-    mCurrentFence++;
-    mCommandQueue->Signal(mFence.Get(), mCurrentFence);
-    if (mFence->GetCompletedValue() < mCurrentFence)
-    {
-        HANDLE eventHandle = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-        mFence->SetEventOnCompletion(mCurrentFence, eventHandle);
-        WaitForSingleObject(eventHandle, INFINITE);
-        CloseHandle(eventHandle);
-    }
+    //  ( ť ö󰡴 ߿ ٸ .  Update  ǰ    ׷)
+    BuildBoxGeometry();
+    BuildScene();
 
     mCamera.SetPosition(0.0f, 2.0f, -5.0f);
     mCamera.LookAt(
@@ -46,7 +66,7 @@ bool EclipseWalkerGame::Initialize()
         XMFLOAT3(0.0f, 0.0f, 0.0f),  
         XMFLOAT3(0.0f, 1.0f, 0.0f)   
     );
-    mCamera.SetLens(0.25f * 3.14f, AspectRatio(), 1.0f, 1000.0f);
+    mCamera.SetLens(0.25f * 3.14f, AspectRatio(), NearZ, 1000.0f);
 
     return true;
 }
@@ -54,7 +74,13 @@ bool EclipseWalkerGame::Initialize()
 void EclipseWalkerGame::OnResize()
 {
     GameFramework::OnResize();
-    mCamera.SetLens(0.25f * 3.14f, AspectRatio(), 1.0f, 1000.0f);
+    mCamera.SetLens(0.25f * 3.14f, AspectRatio(), NearZ, 1000.0f);
+
+    // ī޶   簢        (μ  ٲ )
+    CameraCollisionSettings cameraCollision;
+    cameraCollision.Radius = CameraCollision::NearPlaneRadius(NearZ, 0.25f * 3.14f, AspectRatio()) + 0.02f;
+    cameraCollision.MinDistance = 0.5f;
+    mCameraCollision.SetSettings(cameraCollision);
 }
 
 LRESULT EclipseWalkerGame::MsgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
@@ -76,6 +102,18 @@ LRESULT EclipseWalkerGame::MsgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lP
     case WM_MOUSEMOVE:
         OnMouseMove(wParam, GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
         return 0;
+
+    case WM_KEYDOWN:
+#if EW_PROFILER_ENABLED
+        // F9: 120  ĸó -> chrome://tracing Ǵ ui.perfetto.dev  
+        if (wParam == VK_F9 && !Profiler::GetInstance()->IsCapturing())
+        {
+            std::string path = "Profile_" + std::to_string((long long)(mTimer.TotalTime() * 1000.0f)) + ".json";
+            Profiler::GetInstance()->RequestCapture(120, path);
+            return 0;
+        }
+#endif
+        break;
     }
 
     return GameFramework::MsgProc(hwnd, msg, wParam, lParam);
@@ -83,94 +121,127 @@ LRESULT EclipseWalkerGame::MsgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lP
 
 void EclipseWalkerGame::Update(const GameTimer& gt)
 {
+    PROFILE_SCOPE("Update");
+
+    // 1.   ҽ ȯ
+    //    GPU      (= CPU N  ռ ) ׶ ٸ
+    mCurrFrameResourceIndex = (mCurrFrameResourceIndex + 1) % NumFrameResources;
+    mCurrFrameResource = mFrameResources[mCurrFrameResourceIndex].get();
+
+    if (mCurrFrameResource->Fence != 0 && mFence->GetCompletedValue() < mCurrFrameResource->Fence)
+    {
+        PROFILE_SCOPE("WaitForGPU");
+        WaitForFence(mCurrFrameResource->Fence);
+    }
+    mUploadRing->Retire(mFence->GetCompletedValue());
+
+    //  ε带  ť ϰ  ġ ¡ ȯ
+    mUploadManager->Update();
+
+    // 2.  
     OnKeyboardInput(gt);
-    UpdateCamera();
-    UpdateObjectCBs(gt);
+    UpdateMonsters(gt);
+    UpdateParticles(gt);
+    UpdateCamera(gt);
+    UpdateTransforms();
+    UpdateVisibility();
+    UpdateLods();
+    UpdateRenderQueue();
+
+    // 3. ̹  
+    UpdateInstanceData();
+    UpdateParticleData();
+    UpdatePassCB();
 }
 
 void EclipseWalkerGame::Draw(const GameTimer& gt)
 {
-    // 1.  Ҵ 
-    ThrowIfFailed(mDirectCmdListAlloc->Reset());
-
-    // 2.  Ʈ 
-    ThrowIfFailed(mCommandList->Reset(mDirectCmdListAlloc.Get(), mPSO.Get()));
+    PROFILE_SCOPE("Draw");
 
-    // 3. ҽ 踮 
-    CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-        mSwapChainBuffer[mCurrBackBuffer].Get(),
-        D3D12_RESOURCE_STATE_PRESENT,
-        D3D12_RESOURCE_STATE_RENDER_TARGET);
-    mCommandList->ResourceBarrier(1, &barrier);
+    // 1.  Ҵ  (  ҽ   Update    Ȯ)
+    auto cmdListAlloc = mCurrFrameResource->CmdListAlloc;
+    ThrowIfFailed(cmdListAlloc->Reset());
+    mRenderBackend->BeginFrame((std::uint32_t)mCurrFrameResourceIndex);
 
-    // 4. Ʈ/ 
-    mCommandList->RSSetViewports(1, &mScreenViewport);
-    mCommandList->RSSetScissorRects(1, &mScissorRect);
+    // 2.  Ʈ 
+    //  Ʈ ׷ 踮 ⸸ (׸ 鿣尡  Ʈ鿡)
+    ThrowIfFailed(mCommandList->Reset(cmdListAlloc.Get(), nullptr));
 
-    // 5.  Ÿ ڵ(RTV) 
+    // 3.  Ÿ ڵ(RTV) /  ٽ ڵ(DSV) 
     D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(
         mRtvHeap->GetCPUDescriptorHandleForHeapStart(),
         mCurrBackBuffer,
         mRtvDescriptorSize);
-
-    //  ٽ ڵ(DSV) 
     D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = mDsvHeap->GetCPUDescriptorHandleForHeapStart();
 
-    // 6. ȭ  (Ķ)
-    float clearColor[] = { 0.0f, 0.2f, 0.4f, 1.0f };
-    mCommandList->ClearRenderTargetView(rtvHandle, clearColor, 0, nullptr);
-
-    //   
-    mCommandList->ClearDepthStencilView(
-        dsvHandle,
-        D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, nullptr);
-
-    // 7.  Ÿ 
-    mCommandList->OMSetRenderTargets(1, &rtvHandle, true, &dsvHandle);
-
-    mCommandList->SetGraphicsRootSignature(mRootSignature.Get());
-    mCommandList->SetGraphicsRootConstantBufferView(0, mObjectCB->GetGPUVirtualAddress());
-
-    auto vbv = mBoxGeo->VertexBufferView();
-    auto ibv = mBoxGeo->IndexBufferView();
-    mCommandList->IASetVertexBuffers(0, 1, &vbv);
-    mCommandList->IASetIndexBuffer(&ibv);
+    // 4.  ׷:  / ۸  н  (̴ ׷ )
+    mFrameGraph.Reset();
+    const RgResource backBuffer = mFrameGraph.ImportResource("BackBuffer", RgState::Present, RgState::Present);
+    const RgResource depthBuffer = mFrameGraph.ImportResource("DepthStencil", RgState::DepthWrite, RgState::DepthWrite);
 
-    mCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    mFrameGraph.AddPass("Scene", [&]() { DrawScenePass(cmdListAlloc.Get(), rtvHandle, dsvHandle); });
+    mFrameGraph.Write(backBuffer, RgState::RenderTarget);
+    mFrameGraph.Write(depthBuffer, RgState::DepthWrite);
+    mFrameGraph.Compile();
 
-    mCommandList->DrawIndexedInstanced(
-        mBoxGeo->IndexBufferByteSize / sizeof(uint16_t), 
-        1, 0, 0, 0);
-
-    barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-        mSwapChainBuffer[mCurrBackBuffer].Get(),
-        D3D12_RESOURCE_STATE_RENDER_TARGET,
-        D3D12_RESOURCE_STATE_PRESENT);
-    mCommandList->ResourceBarrier(1, &barrier);
+    // 5. н 踮  -> н ü,  Present   
+    //    (graphResources  =   RgResource )
+    ID3D12Resource* graphResources[] = { mSwapChainBuffer[mCurrBackBuffer].Get(), mDepthStencilBuffer.Get() };
+    mFrameGraph.Execute([&](const RgBarrier* barriers, std::uint32_t count)
+    {
+        D3D12RenderGraph::RecordBarriers(mCommandList.Get(), barriers, count, graphResources);
+    });
 
     ThrowIfFailed(mCommandList->Close());
 
     ID3D12CommandList* cmdsLists[] = { mCommandList.Get() };
     mCommandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
 
-    ThrowIfFailed(mSwapChain->Present(0, 0));
+    {
+        PROFILE_SCOPE("Present");
+        ThrowIfFailed(mSwapChain->Present(0, 0));
+    }
     mCurrBackBuffer = (mCurrBackBuffer + 1) % SwapChainBufferCount;
 
+    // ⼭ ٸ : 潺 ΰ   ҽ ٽ   Ȯ
     mCurrentFence++;
+    mCurrFrameResource->Fence = mCurrentFence;
     ThrowIfFailed(mCommandQueue->Signal(mFence.Get(), mCurrentFence));
+    mUploadRing->FinishFrame(mCurrentFence);
+}
 
-    if (mFence->GetCompletedValue() < mCurrentFence)
-    {
-        HANDLE eventHandle = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-        if (eventHandle == nullptr)
-        {
-            ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
-        }
+void EclipseWalkerGame::DrawScenePass(ID3D12CommandAllocator* allocator,
+    D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle, D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle)
+{
+    // 1. ȭ  (Ķ) +    (׷ տ  踮  Ʈ)
+    float clearColor[] = { 0.0f, 0.2f, 0.4f, 1.0f };
+    mCommandList->ClearRenderTargetView(rtvHandle, clearColor, 0, nullptr);
+    mCommandList->ClearDepthStencilView(
+        dsvHandle,
+        D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, nullptr);
 
-        ThrowIfFailed(mFence->SetEventOnCompletion(mCurrentFence, eventHandle));
-        WaitForSingleObject(eventHandle, INFINITE);
-        CloseHandle(eventHandle);
-    }
+    // 2.    (鿣 Ʈ  ڿ )
+    ThrowIfFailed(mCommandList->Close());
+    ID3D12CommandList* clearLists[] = { mCommandList.Get() };
+    mCommandQueue->ExecuteCommandLists(_countof(clearLists), clearLists);
+
+    // 3.  ť ġ  Ʈ ( Ŀ  ) -> 鿣尡 Ʈ   ؼ  
+    //    ƼŬ  ġ ڿ  ϳ  (  ׷)
+    const std::uint32_t itemCount = (std::uint32_t)mRenderQueue.GetBatches().size() + (mParticleDrawCount > 0 ? 1 : 0);
+    mCommandStreams.Record(itemCount, mRenderBackend->GetMaxStreams(), MinBatchesPerStream,
+        [this](std::uint32_t begin, std::uint32_t end, CommandStream& stream) { RecordDrawBatches(begin, end, stream); });
+
+    D3D12PassState passState;
+    passState.RootSignature = mRootSignature.Get();
+    passState.Viewport = mScreenViewport;
+    passState.Scissor = mScissorRect;
+    passState.RenderTarget = rtvHandle;
+    passState.DepthStencil = dsvHandle;
+    mRenderBackend->SetPassState(passState);
+    mRenderBackend->Submit(mCommandStreams.GetStreams(), mCommandStreams.GetStreamCount());
+
+    // 4.  踮  ޵  Ҵڷ Ʈ ٽ 
+    ThrowIfFailed(mCommandList->Reset(allocator, nullptr));
 }
 
 void EclipseWalkerGame::BuildBoxGeometry()
@@ -215,28 +286,249 @@ void EclipseWalkerGame::BuildBoxGeometry()
         4, 3, 7
     };
 
-    const UINT vbByteSize = (UINT)vertices.size() * sizeof(VertexTypes::VertexPosColor);
-    const UINT ibByteSize = (UINT)indices.size() * sizeof(std::uint16_t);
+    // ڵ   ŷ ޽  η ø (  28 -> 12 Ʈ)
+    MeshCookSource source;
+    source.VertexLayout = MeshFormat::VertexFormat::PosColor;
+    source.Vertices.resize(sizeof(vertices));
+    memcpy(source.Vertices.data(), vertices.data(), sizeof(vertices));
+    source.Indices.assign(indices.begin(), indices.end());
+    VertexCompression::CompressVertices(source);
+
+    const std::vector<std::uint8_t> cookedBytes = MeshCooker::Cook(source);
+
+    CookedMesh cooked;
+    if (!cooked.OpenMemory(cookedBytes.data(), cookedBytes.size()))
+        ThrowIfFailed(E_FAIL);
+
+    std::uint32_t meshId = CreateMesh("boxGeo", cooked);
+    assert(meshId == BoxMeshId);
+
+    // ڴ ״ Ŭε  ( ޽, ո ð )
+    if (mOccluderMeshes.size() <= meshId)
+        mOccluderMeshes.resize(meshId + 1);
+    OccluderMesh& occluder = mOccluderMeshes[meshId];
+    for (const VertexTypes::VertexPosColor& v : vertices)
+        occluder.Positions.insert(occluder.Positions.end(), { v.Pos.x, v.Pos.y, v.Pos.z });
+    occluder.Indices.assign(indices.begin(), indices.end());
+}
+
+std::uint32_t EclipseWalkerGame::LoadMesh(const std::string& name, const std::string& path)
+{
+    //  θ ϰ ٷ ε (Ľ ). ε ġ ǰ   ݾƵ 
+    CookedMesh cooked;
+    if (!cooked.Open(path))
+        return UINT32_MAX;
+
+    return CreateMesh(name, cooked);
+}
+
+std::uint32_t EclipseWalkerGame::CreateMesh(const std::string& name, const CookedMesh& cooked)
+{
+    const MeshFormat::Header& header = cooked.GetHeader();
+
+    // ̴ ִ ˸ ( color.hlsl   PosColor / PackedPosColor)
+    assert(mPSOs[(std::size_t)header.VertexLayout] != nullptr);
+
+    auto mesh = std::make_unique<MeshGeometry>();
+    mesh->Name = name;
 
-    mBoxGeo = std::make_unique<MeshGeometry>();
-    mBoxGeo->Name = "boxGeo";
+    // 1. ε Ϳ ٷ  ť (߰ CPU 纻 )
+    UploadTicket vbTicket = 0, ibTicket = 0;
+    mesh->VertexBufferGPU = CreateGeometryBuffer(cooked.GetVertexData(), cooked.GetVertexDataSize(), vbTicket);
+    mesh->IndexBufferGPU = CreateGeometryBuffer(cooked.GetIndexData(), cooked.GetIndexDataSize(), ibTicket);
+    mesh->ReadyTicket = std::max(vbTicket, ibTicket);
 
-    ThrowIfFailed(D3DCreateBlob(vbByteSize, &mBoxGeo->VertexBufferCPU));
-    CopyMemory(mBoxGeo->VertexBufferCPU->GetBufferPointer(), vertices.data(), vbByteSize);
+    // 2. /׸ 
+    mesh->VertexLayout = header.VertexLayout;
+    mesh->VertexByteStride = header.VertexStride;
+    mesh->VertexBufferByteSize = (UINT)cooked.GetVertexDataSize();
+    mesh->IndexFormat = header.IndexType == MeshFormat::IndexFormat::UInt16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+    mesh->IndexBufferByteSize = (UINT)cooked.GetIndexDataSize();
 
-    ThrowIfFailed(D3DCreateBlob(ibByteSize, &mBoxGeo->IndexBufferCPU));
-    CopyMemory(mBoxGeo->IndexBufferCPU->GetBufferPointer(), indices.data(), ibByteSize);
+    mesh->Bounds.Grow(header.BoundsMin[0], header.BoundsMin[1], header.BoundsMin[2]);
+    mesh->Bounds.Grow(header.BoundsMax[0], header.BoundsMax[1], header.BoundsMax[2]);
 
-    mBoxGeo->VertexBufferGPU = d3dUtil::CreateDefaultBuffer(md3dDevice.Get(),
-        mCommandList.Get(), vertices.data(), vbByteSize, mBoxGeo->VertexBufferUploader);
+    if (MeshFormat::IsPacked(header.VertexLayout))
+    {
+        const PositionQuantization quantization = PositionQuantization::FromBounds(header.BoundsMin, header.BoundsMax);
+        mesh->PositionScale = XMFLOAT3(quantization.Scale[0], quantization.Scale[1], quantization.Scale[2]);
+        mesh->PositionBias = XMFLOAT3(quantization.Bias[0], quantization.Bias[1], quantization.Bias[2]);
+    }
 
-    mBoxGeo->IndexBufferGPU = d3dUtil::CreateDefaultBuffer(md3dDevice.Get(),
-        mCommandList.Get(), indices.data(), ibByteSize, mBoxGeo->IndexBufferUploader);
+    // 3. LOD  ޽ (LOD ) + ÿ  
+    mesh->SubmeshCount = cooked.GetSubmeshCount();
+    mesh->LodCount = cooked.GetLodCount();
 
-    mBoxGeo->VertexByteStride = sizeof(VertexTypes::VertexPosColor);
-    mBoxGeo->VertexBufferByteSize = vbByteSize;
-    mBoxGeo->IndexFormat = DXGI_FORMAT_R16_UINT;
-    mBoxGeo->IndexBufferByteSize = ibByteSize;
+    LodMeshInfo lodInfo;
+    lodInfo.LodCount = cooked.GetLodCount();
+    for (std::uint32_t lod = 0; lod < lodInfo.LodCount; ++lod)
+        lodInfo.Error[lod] = cooked.GetLods()[lod].Error;
+
+    const MeshFormat::Submesh* submeshes = cooked.GetSubmeshes();
+    for (std::uint32_t i = 0; i < cooked.GetLodCount() * cooked.GetSubmeshCount(); ++i)
+    {
+        SubmeshGeometry submesh;
+        submesh.IndexCount = submeshes[i].IndexCount;
+        submesh.StartIndexLocation = submeshes[i].IndexStart;
+        submesh.BaseVertexLocation = submeshes[i].BaseVertex;
+        submesh.MaterialIndex = submeshes[i].MaterialIndex;
+        submesh.Bounds.Grow(submeshes[i].BoundsMin[0], submeshes[i].BoundsMin[1], submeshes[i].BoundsMin[2]);
+        submesh.Bounds.Grow(submeshes[i].BoundsMax[0], submeshes[i].BoundsMax[1], submeshes[i].BoundsMax[2]);
+        mesh->Submeshes.push_back(submesh);
+    }
+
+    mMeshes.push_back(std::move(mesh));
+    mMeshLods.push_back(lodInfo);
+    return (std::uint32_t)mMeshes.size() - 1;
+}
+
+void EclipseWalkerGame::BuildScene()
+{
+    const std::uint32_t fieldSize = 64; // 64 x 64   
+    const float spacing = 6.0f;
+
+    mTransforms.Reserve(1 + MonsterCount + fieldSize * fieldSize);
+
+    // 1. ÷̾ ( [-1, 1] ڸ 0.5)
+    mPlayer = mTransforms.Create(0.0f, 0.0f, 0.0f, BoxMeshId);
+    mTransforms.SetScale(mPlayer, 0.5f, 0.5f, 0.5f);
+    mTransforms.SetLocalExtent(mPlayer, 1.0f, 1.0f, 1.0f);
+
+    // 2. ֺ 򸮴  ڵ (  Ǹ ٽ Ƽ  )
+    const float half = 0.5f * spacing * (fieldSize - 1);
+    for (std::uint32_t z = 0; z < fieldSize; ++z)
+    {
+        for (std::uint32_t x = 0; x < fieldSize; ++x)
+        {
+            float px = x * spacing - half;
+            float pz = z * spacing - half;
+            if (fabsf(px) < spacing && fabsf(pz) < spacing)
+                continue; // ÷̾  ġ 
+
+            float height = 0.5f + 0.25f * ((x * 7 + z * 13) % 5);
+            EntityId e = mTransforms.Create(px, height - 0.5f, pz, BoxMeshId);
+            mTransforms.SetScale(e, 0.75f, height, 0.75f);
+            mTransforms.SetRotationY(e, 0.3f * ((x + z) % 4));
+            mTransforms.SetLocalExtent(e, 1.0f, 1.0f, 1.0f);
+        }
+    }
+
+    assert(mTransforms.GetCount() + MonsterCount <= MaxInstancesPerFrame);
+
+    // 3.  Ʈ BVH ( AABB  ʿϹǷ ⼭   )
+    mTransforms.UpdateWorld();
+    const AabbSoA& bounds = mTransforms.GetWorldBounds();
+    const std::uint32_t playerIndex = mTransforms.GetIndex(mPlayer);
+
+    std::vector<Aabb> staticBounds;
+    staticBounds.reserve(mTransforms.GetCount());
+    mStaticObjects.clear();
+    for (std::uint32_t i = 0; i < mTransforms.GetCount(); ++i)
+    {
+        if (i == playerIndex)
+            continue;
+        staticBounds.push_back(Aabb::FromCenterExtent(bounds.CenterX[i], bounds.CenterY[i], bounds.CenterZ[i],
+            bounds.ExtentX[i], bounds.ExtentY[i], bounds.ExtentZ[i]));
+        mStaticObjects.push_back(i);
+    }
+    mStaticBvh.Build(staticBounds);
+
+    // 4. ̵ 浹:  ( y = -0.5) +  ڸ ȸ ״
+    //    ÷̾  ( 1)  δ ĸ, ġ  ̶  ߽ɺ 0.5 Ʒ
+    const float groundExtent = half + 2.0f * spacing;
+    const float ground[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -1.0f, 0, 1 };
+    mCollision.AddBox(ground, groundExtent, 0.5f, groundExtent);
+
+    NavInputGeometry navGeometry;
+    navGeometry.AddBox(ground, groundExtent, 0.5f, groundExtent);
+
+    for (std::uint32_t index : mStaticObjects)
+    {
+        float world[16], ex, ey, ez;
+        mTransforms.GetWorldMatrix(index, world);
+        mTransforms.GetLocalExtent(index, ex, ey, ez);
+        mCollision.AddBox(world, ex, ey, ez);
+        navGeometry.AddBox(world, ex, ey, ez);
+    }
+
+    CharacterSettings player;
+    player.Radius = 0.45f;
+    player.Height = 1.0f;
+    player.StepHeight = 0.3f;
+    mPlayerController = CharacterController(player);
+
+    const float foot[3] = { 0.0f, -0.5f, 0.0f };
+    mPlayerController.Spawn(mCollision, foot);
+
+    // 5. ׺޽: 4   ڵ,  ũ ÷̾ ĸ  (Ÿ   )
+    NavBuildSettings nav;
+    nav.AgentRadius = player.Radius;
+    nav.AgentHeight = player.Height;
+    nav.AgentMaxClimb = player.StepHeight;
+    NavMeshBuilder(navGeometry, nav).BuildAll(mNavMesh, true);
+
+    // 6. : ÷̾     (6  )  16 x 8
+    //     BVH / ׺޽  ڶ ̴ Ʈθ 
+    mCrowd.Clear();
+    mCrowd.Reserve(MonsterCount);
+    mMonsters.clear();
+    mMonsters.resize(MonsterCount);
+    for (std::uint32_t i = 0; i < MonsterCount; ++i)
+    {
+        Monster& monster = mMonsters[i];
+        const float spawn[3] = { spacing * ((float)(i % 16) - 8.0f), -0.5f, 4.0f * spacing + spacing * (float)(i / 16) };
+
+        monster.Entity = mTransforms.Create(spawn[0], spawn[1] + 0.5f, spawn[2], BoxMeshId);
+        mTransforms.SetScale(monster.Entity, 0.5f, 0.5f, 0.5f);
+        mTransforms.SetLocalExtent(monster.Entity, 1.0f, 1.0f, 1.0f);
+
+        monster.Controller = CharacterController(player);
+        monster.Controller.Spawn(mCollision, spawn);
+        monster.Agent = mCrowd.AddAgent(spawn[0], spawn[2], player.Radius, MonsterSpeed);
+        monster.RepathTime = MonsterRepathInterval * (float)i / MonsterCount;   // û  ӿ  ʰ
+    }
+
+    // 7. Ʈ: ÷̾      м, ߹ؿ 
+    for (std::uint32_t i = 0; i < FountainCount; ++i)
+    {
+        ParticleEmitterSettings fountain;
+        fountain.Position[0] = (i & 1 ? 2.0f : -2.0f) * spacing;
+        fountain.Position[1] = -0.5f;
+        fountain.Position[2] = (i & 2 ? 2.0f : -2.0f) * spacing;
+        fountain.Spread = 0.25f;
+        fountain.SpeedMin = 6.0f;
+        fountain.SpeedMax = 8.0f;
+        fountain.LifetimeMin = 1.2f;
+        fountain.LifetimeMax = 1.8f;
+        fountain.Rate = 4000.0f;
+        fountain.Drag = 0.1f;
+        fountain.StartSize = 0.04f;
+        fountain.EndSize = 0.12f;
+        fountain.StartColor[0] = 0.4f; fountain.StartColor[1] = 0.8f; fountain.StartColor[2] = 1.0f; fountain.StartColor[3] = 0.8f;
+        fountain.EndColor[0] = 0.1f; fountain.EndColor[1] = 0.3f; fountain.EndColor[2] = 1.0f; fountain.EndColor[3] = 0.0f;
+        fountain.MaxParticles = 8192;
+        fountain.Seed = 1 + i;
+        mParticles.AddEmitter(fountain);
+    }
+
+    ParticleEmitterSettings dust;
+    dust.Position[0] = foot[0];
+    dust.Position[1] = foot[1];
+    dust.Position[2] = foot[2];
+    dust.Spread = 1.2f;
+    dust.SpeedMin = 0.5f;
+    dust.SpeedMax = 1.5f;
+    dust.LifetimeMin = 0.4f;
+    dust.LifetimeMax = 0.8f;
+    dust.Rate = 0.0f;
+    dust.Gravity = 1.0f;
+    dust.Drag = 2.0f;
+    dust.StartSize = 0.08f;
+    dust.EndSize = 0.3f;
+    dust.StartColor[0] = 0.6f; dust.StartColor[1] = 0.5f; dust.StartColor[2] = 0.4f; dust.StartColor[3] = 0.5f;
+    dust.EndColor[0] = 0.6f; dust.EndColor[1] = 0.5f; dust.EndColor[2] = 0.4f; dust.EndColor[3] = 0.0f;
+    dust.MaxParticles = 1024;
+    mPlayerDust = mParticles.AddEmitter(dust);
 }
 
 float EclipseWalkerGame::AspectRatio() const
@@ -246,11 +538,13 @@ float EclipseWalkerGame::AspectRatio() const
 
 void EclipseWalkerGame::BuildRootSignature()
 {
-    CD3DX12_ROOT_PARAMETER slotRootParameter[1];
+    CD3DX12_ROOT_PARAMETER slotRootParameter[3];
 
-    slotRootParameter[0].InitAsConstantBufferView(0);
+    slotRootParameter[0].InitAsConstants(1, 0);       // ġ  νϽ ȣ
+    slotRootParameter[1].InitAsConstantBufferView(1); // н
+    slotRootParameter[2].InitAsShaderResourceView(0); // νϽ  (ȭ )
 
-    CD3DX12_ROOT_SIGNATURE_DESC rootSigDesc(1, slotRootParameter, 0, nullptr,
+    CD3DX12_ROOT_SIGNATURE_DESC rootSigDesc(3, slotRootParameter, 0, nullptr,
         D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
     ComPtr<ID3DBlob> serializedRootSig = nullptr;
@@ -265,6 +559,8 @@ void EclipseWalkerGame::BuildRootSignature()
     }
     ThrowIfFailed(hr);
 
+    mRootSignatureKey = ShaderHash::Hash(serializedRootSig->GetBufferPointer(), serializedRootSig->GetBufferSize());
+
     ThrowIfFailed(md3dDevice->CreateRootSignature(
         0,
         serializedRootSig->GetBufferPointer(),
@@ -274,14 +570,43 @@ void EclipseWalkerGame::BuildRootSignature()
 
 void EclipseWalkerGame::BuildShadersAndInputLayout()
 {
-    mvsByteCode = d3dUtil::CompileShader(L"color.hlsl", nullptr, "VS", "vs_5_0");
-    mpsByteCode = d3dUtil::CompileShader(L"color.hlsl", nullptr, "PS", "ps_5_0");
+    // ҽ/Ŭ/ũΰ ״θ  ࿡  Ʈڵ带 ؼ 
+    mPipelineCache = std::make_unique<D3D12PipelineCache>(md3dDevice.Get(), "ShaderCache.ewsc");
+    mvsByteCode = mPipelineCache->LoadShader("color.hlsl", nullptr, "VS", "vs_5_0");
+    mpsByteCode = mPipelineCache->LoadShader("color.hlsl", nullptr, "PS", "ps_5_0");
+    mParticleVsByteCode = mPipelineCache->LoadShader("particle.hlsl", nullptr, "VS", "vs_5_0");
+    mParticlePsByteCode = mPipelineCache->LoadShader("particle.hlsl", nullptr, "PS", "ps_5_0");
 
-    mInputLayout =
+    using MeshFormat::VertexFormat;
+
+    mInputLayouts[(std::size_t)VertexFormat::PosColor] =
     {
         { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
         { "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
     };
+
+    mInputLayouts[(std::size_t)VertexFormat::PosNormalTex] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+    };
+
+    //  : ڵ Է Ⱑ  (UNORM -> [0, 1], ȭ  Ŀ  )
+    // ̴ Է float3 POSITION ״ζ color.hlsl   
+    mInputLayouts[(std::size_t)VertexFormat::PackedPosColor] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 8, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+    };
+
+    //  ȸü SNORM16x2 -> ̴ z = 1 - |x| - |y|   
+    mInputLayouts[(std::size_t)VertexFormat::PackedPosNormalTex] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, 8, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+    };
 }
 
 void EclipseWalkerGame::BuildPSO()
@@ -289,18 +614,9 @@ void EclipseWalkerGame::BuildPSO()
     D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc;
     ZeroMemory(&psoDesc, sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC));
 
-    psoDesc.InputLayout = { mInputLayout.data(), (UINT)mInputLayout.size() };
     psoDesc.pRootSignature = mRootSignature.Get();
-    psoDesc.VS =
-    {
-        reinterpret_cast<BYTE*>(mvsByteCode->GetBufferPointer()),
-        mvsByteCode->GetBufferSize()
-    };
-    psoDesc.PS = 
-    {
-        reinterpret_cast<BYTE*>(mpsByteCode->GetBufferPointer()),
-        mpsByteCode->GetBufferSize()
-    };
+    psoDesc.VS = mvsByteCode;
+    psoDesc.PS = mpsByteCode;
 
     psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
 
@@ -317,25 +633,166 @@ void EclipseWalkerGame::BuildPSO()
     psoDesc.SampleDesc.Quality = m4xMsaaState ? (m4xMsaaQuality - 1) : 0;
     psoDesc.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
 
-    ThrowIfFailed(md3dDevice->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&mPSO)));
+    // color.hlsl   ˸ (/UV   ̴  ߰)
+    const MeshFormat::VertexFormat colorFormats[] =
+    {
+        MeshFormat::VertexFormat::PosColor,
+        MeshFormat::VertexFormat::PackedPosColor
+    };
+
+    // Է ġ ٸ  Ƽ ĳð Ŀ Ѳ 
+    const std::uint32_t colorFormatCount = (std::uint32_t)_countof(colorFormats);
+    std::array<D3D12_GRAPHICS_PIPELINE_STATE_DESC, _countof(colorFormats)> descs;
+    std::array<ComPtr<ID3D12PipelineState>, _countof(colorFormats)> pipelines;
+    for (std::uint32_t i = 0; i < colorFormatCount; ++i)
+    {
+        const std::vector<D3D12_INPUT_ELEMENT_DESC>& inputLayout = mInputLayouts[(std::size_t)colorFormats[i]];
+        descs[i] = psoDesc;
+        descs[i].InputLayout = { inputLayout.data(), (UINT)inputLayout.size() };
+    }
+
+    mPipelineCache->CreateGraphicsPipelines(descs.data(), colorFormatCount, mRootSignatureKey, pipelines.data());
+
+    for (std::uint32_t i = 0; i < colorFormatCount; ++i)
+        mPSOs[(std::size_t)colorFormats[i]] = pipelines[i];
+
+    // ƼŬ:  ȭ ۿ о Է ġ , ,  , ̴ б⸸
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC particleDesc = psoDesc;
+    particleDesc.VS = mParticleVsByteCode;
+    particleDesc.PS = mParticlePsByteCode;
+    particleDesc.InputLayout = { nullptr, 0 };
+    particleDesc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;
+
+    D3D12_RENDER_TARGET_BLEND_DESC& blend = particleDesc.BlendState.RenderTarget[0];
+    blend.BlendEnable = TRUE;
+    blend.SrcBlend = D3D12_BLEND_SRC_ALPHA;
+    blend.DestBlend = D3D12_BLEND_ONE;
+    blend.BlendOp = D3D12_BLEND_OP_ADD;
+    blend.SrcBlendAlpha = D3D12_BLEND_ZERO;
+    blend.DestBlendAlpha = D3D12_BLEND_ONE;
+    blend.BlendOpAlpha = D3D12_BLEND_OP_ADD;
+
+    particleDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ZERO;
+
+    mPipelineCache->CreateGraphicsPipelines(&particleDesc, 1, mRootSignatureKey, &mParticlePSO);
 }
 
-void EclipseWalkerGame::BuildConstantBuffer()
+void EclipseWalkerGame::BuildRenderBackend()
 {
-    UINT elementByteSize = (sizeof(ObjectConstants) + 255) & ~255;
+    // Ʈ ִ  ŭ (Ŀ ϳ /)
+    mRenderBackend = std::make_unique<D3D12RenderBackend>(md3dDevice.Get(), mCommandQueue.Get(),
+        (std::uint32_t)NumFrameResources, JobSystem::GetInstance()->GetThreadCount());
+
+    //  ȣ =   (DrawKey  PSO ʵ )
+    for (std::size_t format = 0; format < VertexFormatCount; ++format)
+        mRenderBackend->SetPipeline((std::uint32_t)format, mPSOs[format].Get());
+    mRenderBackend->SetPipeline(ParticlePipelineId, mParticlePSO.Get());
+}
+
+void EclipseWalkerGame::RecordDrawBatches(std::uint32_t begin, std::uint32_t end, CommandStream& stream)const
+{
+    // 1. Ʈ ¸ ó (ٸ Ʈ ̾ )
+    stream.SetRootConstantBuffer(1, mPassCBAddress);
+    if (mInstanceDataAddress != 0)
+        stream.SetRootShaderResource(2, mInstanceDataAddress);
+
+    // 2. ġ νϽ ο ϳ (Ű  PSO/޽ ٲ  ٽ ε)
+    const std::vector<DrawBatch>& batches = mRenderQueue.GetBatches();
+    const std::uint32_t batchCount = (std::uint32_t)batches.size();
+    std::uint32_t boundPipeline = UINT32_MAX;
+    std::uint32_t boundMesh = UINT32_MAX;
+    const MeshGeometry* mesh = nullptr;
+
+    for (std::uint32_t b = begin; b < std::min(end, batchCount); ++b)
+    {
+        const DrawBatch& batch = batches[b];
+
+        const std::uint32_t pipeline = DrawKey::GetPipeline(batch.Key);
+        if (pipeline != boundPipeline)
+        {
+            stream.SetPipeline(pipeline);
+            boundPipeline = pipeline;
+        }
+
+        const std::uint32_t meshId = DrawKey::GetMesh(batch.Key);
+        if (meshId != boundMesh)
+        {
+            mesh = mMeshes[meshId].get();
+            stream.SetVertexBuffer(mesh->VertexBufferGPU.GpuAddress, mesh->VertexBufferByteSize, mesh->VertexByteStride);
+            stream.SetIndexBuffer(mesh->IndexBufferGPU.GpuAddress, mesh->IndexBufferByteSize,
+                mesh->IndexFormat == DXGI_FORMAT_R32_UINT ? 4 : 2);
+            boundMesh = meshId;
+        }
 
-    auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-    auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(elementByteSize);
+        // SV_InstanceID  StartInstanceLocation   ֹǷ  ȣ Ʈ 
+        stream.SetRootConstant(0, batch.FirstInstance);
+
+        const SubmeshGeometry& submesh = mesh->GetLodSubmeshes(DrawKey::GetLod(batch.Key))[DrawKey::GetSubmesh(batch.Key)];
+        stream.DrawIndexed(submesh.IndexCount, batch.InstanceCount,
+            submesh.StartIndexLocation, submesh.BaseVertexLocation, 0);
+    }
 
-    ThrowIfFailed(md3dDevice->CreateCommittedResource(
-        &heapProps,
-        D3D12_HEAP_FLAG_NONE,
-        &bufferDesc,
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_PPV_ARGS(&mObjectCB)));
+    // 3. ġ   = ƼŬ (簢 ϳ x ƼŬ ,    )
+    if (end > batchCount)
+    {
+        stream.SetPipeline(ParticlePipelineId);
+        stream.SetRootShaderResource(2, mParticleDataAddress);
+        stream.SetIndexBuffer(mParticleIndexAddress, 6 * sizeof(std::uint16_t), 2);
+        stream.DrawIndexed(6, mParticleDrawCount, 0, 0, 0);
+    }
+}
 
-    ThrowIfFailed(mObjectCB->Map(0, nullptr, reinterpret_cast<void**>(&mMappedData)));
+void EclipseWalkerGame::BuildFrameResources()
+{
+    for (int i = 0; i < NumFrameResources; ++i)
+        mFrameResources.push_back(std::make_unique<FrameResource>(md3dDevice.Get()));
+    mCurrFrameResource = mFrameResources[mCurrFrameResourceIndex].get();
+
+    // Ӹ (νϽ ִġ + ƼŬ ִġ + 簢 ε + н )  N  
+    const UINT64 perFrameBytes =
+        d3dUtil::CalcConstantBufferByteSize((UINT)(MaxInstancesPerFrame * sizeof(InstanceData))) +
+        d3dUtil::CalcConstantBufferByteSize((UINT)(MaxParticlesPerFrame * sizeof(ParticleVertex))) +
+        d3dUtil::CalcConstantBufferByteSize(6 * sizeof(std::uint16_t)) +
+        d3dUtil::CalcConstantBufferByteSize(sizeof(PassConstants));
+    mUploadRing = std::make_unique<UploadRing>(md3dDevice.Get(), perFrameBytes * NumFrameResources);
+}
+
+UploadAllocation EclipseWalkerGame::AllocateUpload(UINT64 byteSize)
+{
+    UploadAllocation allocation = mUploadRing->Allocate(byteSize);
+
+    //   á      ٷȴٰ ȯ  ٽ õ
+    while (allocation.Cpu == nullptr)
+    {
+        UINT64 oldestFence = mUploadRing->GetOldestFence();
+        if (oldestFence == 0)
+        {
+            //    µ   =  ū û
+            ThrowIfFailed(E_OUTOFMEMORY);
+        }
+
+        PROFILE_SCOPE("WaitForUploadRing");
+        WaitForFence(oldestFence);
+        mUploadRing->Retire(mFence->GetCompletedValue());
+        allocation = mUploadRing->Allocate(byteSize);
+    }
+
+    return allocation;
+}
+
+GpuBufferAllocation EclipseWalkerGame::CreateGeometryBuffer(const void* initData, UINT64 byteSize, UploadTicket& ticket)
+{
+    // 1. ⺻   ȿ ڸ 
+    GpuBufferAllocation buffer = mGpuMemory->Allocate(GpuMemoryCategory::Geometry, byteSize);
+    if (!buffer.IsValid())
+        ThrowIfFailed(E_OUTOFMEMORY);
+
+    // 2.  ť ε (ġ 𿴴ٰ Flush/Update  )
+    //    ۴ COMMON ¶   COPY_DEST , ׸  б · Ͻ °ݵ
+    //    ( ť  ҽ  ٽ COMMON  )
+    ticket = mUploadManager->UploadBuffer(buffer, initData, byteSize);
+
+    return buffer;
 }
 
 
@@ -369,31 +826,188 @@ void EclipseWalkerGame::OnMouseMove(WPARAM btnState, int x, int y)
     mLastMousePos.y = y;
 }
 
-void EclipseWalkerGame::UpdateObjectCBs(const GameTimer& gt)
+void EclipseWalkerGame::UpdateTransforms()
 {
-    static float t = 0.0f;
-    t += gt.DeltaTime();
+    PROFILE_SCOPE("UpdateTransforms");
 
-    XMMATRIX scale = XMMatrixScaling(0.5f, 0.5f, 0.5f);
+    // ÷̾ ī޶ ݴ ٶ
+    mTransforms.SetRotationY(mPlayer, mCameraTheta + 3.141592f);
 
-    XMMATRIX rot = XMMatrixRotationY(mCameraTheta + 3.141592f);
+    // Ƽ ͸   /  AABB 
+    mTransforms.UpdateWorld();
+}
 
-    XMMATRIX trans = XMMatrixTranslation(mTargetPos.x, mTargetPos.y, mTargetPos.z);
+void EclipseWalkerGame::UpdateInstanceData()
+{
+    PROFILE_SCOPE("UpdateInstanceData");
 
-    XMMATRIX world = scale * rot * trans;
+    mInstanceDataAddress = 0;
+    const std::vector<DrawItem>& items = mRenderQueue.GetItems();
+    if (items.empty())
+        return;
 
-    XMStoreFloat4x4(&mWorld, world);
-    XMMATRIX viewProj = mCamera.GetViewProj();
-    XMMATRIX worldViewProj = world * viewProj;
+    // ĵ  ŭ   ߶  ä (ȭ ۶ 256    ä)
+    UploadAllocation allocation = AllocateUpload((UINT64)sizeof(InstanceData) * items.size());
+    mInstanceDataAddress = allocation.Gpu;
+    InstanceData* instances = reinterpret_cast<InstanceData*>(allocation.Cpu);
 
-    ObjectConstants objConstants;
-    XMStoreFloat4x4(&objConstants.WorldViewProj, XMMatrixTranspose(worldViewProj));
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        XMFLOAT4X4 world;
+        mTransforms.GetWorldMatrix(items[i].Object, &world.m[0][0]);
+        XMMATRIX worldMatrix = XMLoadFloat4x4(&world);
 
-    memcpy(mMappedData, &objConstants, sizeof(ObjectConstants));
+        //  ޽: [0, 1] ġ ->  (Scale  Bias) -> 
+        const MeshGeometry& mesh = *mMeshes[DrawKey::GetMesh(items[i].Key)];
+        if (MeshFormat::IsPacked(mesh.VertexLayout))
+        {
+            XMMATRIX dequantize = XMMatrixScaling(mesh.PositionScale.x, mesh.PositionScale.y, mesh.PositionScale.z) *
+                XMMatrixTranslation(mesh.PositionBias.x, mesh.PositionBias.y, mesh.PositionBias.z);
+            worldMatrix = dequantize * worldMatrix;
+        }
+
+        XMStoreFloat4x4(&instances[i].World, XMMatrixTranspose(worldMatrix));
+    }
 }
 
-void EclipseWalkerGame::UpdateCamera()
+void EclipseWalkerGame::UpdateParticleData()
 {
+    PROFILE_SCOPE("UpdateParticleData");
+
+    mParticleDrawCount = 0;
+    const std::uint32_t count = std::min(mParticles.GetParticleCount(), MaxParticlesPerFrame);
+    if (count == 0)
+        return;
+
+    // 1. 簢 ε (SV_VertexID = 𼭸 ȣ, particle.hlsl)
+    const std::uint16_t quadIndices[6] = { 0, 1, 2, 2, 1, 3 };
+    UploadAllocation indices = AllocateUpload(sizeof(quadIndices));
+    memcpy(indices.Cpu, quadIndices, sizeof(quadIndices));
+    mParticleIndexAddress = indices.Gpu;
+
+    // 2.  ε  ޸𸮿 ٷ (SoA -> , տ  ⸸)
+    UploadAllocation vertices = AllocateUpload((UINT64)sizeof(ParticleVertex) * count);
+    mParticleDrawCount = mParticles.WriteVertices(reinterpret_cast<ParticleVertex*>(vertices.Cpu), count);
+    mParticleDataAddress = vertices.Gpu;
+}
+
+void EclipseWalkerGame::UpdatePassCB()
+{
+    PassConstants passConstants;
+    XMStoreFloat4x4(&passConstants.ViewProj, XMMatrixTranspose(mCamera.GetViewProj()));
+    XMStoreFloat4(&passConstants.CameraRight, mCamera.GetRight());
+    XMStoreFloat4(&passConstants.CameraUp, mCamera.GetUp());
+
+    UploadAllocation allocation = AllocateUpload(d3dUtil::CalcConstantBufferByteSize(sizeof(PassConstants)));
+    memcpy(allocation.Cpu, &passConstants, sizeof(PassConstants));
+    mPassCBAddress = allocation.Gpu;
+}
+
+void EclipseWalkerGame::UpdateVisibility()
+{
+    PROFILE_SCOPE("UpdateVisibility");
+
+    //  AABB UpdateWorld()   ŵ
+    const AabbSoA& bounds = mTransforms.GetWorldBounds();
+    FrustumCulling::CullAabbs(mCamera.GetFrustum(), bounds, mFrustumVisible);
+
+    // 1. ü    ȭ鿡 ū  Ŭ
+    XMFLOAT4X4 viewProj;
+    XMStoreFloat4x4(&viewProj, mCamera.GetViewProj());
+    const XMFLOAT3 eye = mCamera.GetPosition3f();
+
+    mOcclusion.BeginFrame(&viewProj._11);
+    OcclusionCuller::SelectOccluders(bounds, mFrustumVisible, eye.x, eye.y, eye.z, 0.05f, 64, mOccluders);
+
+    float world[16];
+    for (std::uint32_t index : mOccluders)
+    {
+        const std::uint32_t meshId = mTransforms.GetMeshId(index);
+        if (meshId >= mOccluderMeshes.size() || mOccluderMeshes[meshId].IsEmpty())
+            continue;
+        mTransforms.GetWorldMatrix(index, world);
+        mOcclusion.AddOccluder(mOccluderMeshes[meshId], world);
+    }
+
+    // 2.  +  ->    ( )
+    mOcclusion.Rasterize();
+    mOcclusion.CullAabbs(bounds, mFrustumVisible, mVisibleObjects);
+}
+
+void EclipseWalkerGame::UpdateLods()
+{
+    PROFILE_SCOPE("UpdateLods");
+
+    // ̴ ͸ ( ̴   LOD   -> ٽ   ׸ý )
+    XMFLOAT3 cameraPos = mCamera.GetPosition3f();
+
+    LodSelectParams params;
+    params.CameraX = cameraPos.x;
+    params.CameraY = cameraPos.y;
+    params.CameraZ = cameraPos.z;
+    params.ProjectionScale = LodSelection::ComputeProjectionScale(mCamera.GetFovY(), (float)mClientHeight);
+
+    LodSelection::SelectLods(params, mMeshLods, mTransforms, mVisibleObjects);
+}
+
+void EclipseWalkerGame::UpdateRenderQueue()
+{
+    PROFILE_SCOPE("UpdateRenderQueue");
+
+    // 1. ε尡  ޽ (  ޽  ƿ  )
+    mMeshReady.resize(mMeshes.size());
+    for (std::size_t m = 0; m < mMeshes.size(); ++m)
+        mMeshReady[m] = mUploadManager->IsComplete(mMeshes[m]->ReadyTicket) ? 1 : 0;
+
+    // 2.  = ī޶ չ Ÿ /   (  ȿ տ ڷ)
+    XMFLOAT3 eye = mCamera.GetPosition3f();
+    XMFLOAT3 look;
+    XMStoreFloat3(&look, mCamera.GetLook());
+    const float invFarZ = 1.0f / mCamera.GetFarZ();
+
+    const AabbSoA& bounds = mTransforms.GetWorldBounds();
+
+    // 3. ̴ Ʈ x LOD ޽  ( ٸ 忡 Ҹ, б⸸ )
+    mRenderQueue.Gather((std::uint32_t)mVisibleObjects.size(),
+        [&](std::uint32_t begin, std::uint32_t end, std::vector<DrawItem>& out)
+        {
+            for (std::uint32_t i = begin; i < end; ++i)
+            {
+                const std::uint32_t index = mVisibleObjects[i];
+                const std::uint32_t meshId = mTransforms.GetMeshId(index);
+                if (mMeshReady[meshId] == 0)
+                    continue;
+
+                const MeshGeometry& mesh = *mMeshes[meshId];
+                const std::uint32_t lod = mTransforms.GetLod(index);
+                const float depth = ((bounds.CenterX[index] - eye.x) * look.x +
+                    (bounds.CenterY[index] - eye.y) * look.y +
+                    (bounds.CenterZ[index] - eye.z) * look.z) * invFarZ;
+
+                const SubmeshGeometry* submeshes = mesh.GetLodSubmeshes(lod);
+                for (UINT s = 0; s < mesh.SubmeshCount; ++s)
+                {
+                    if (submeshes[s].IndexCount == 0)
+                        continue;
+
+                    DrawItem item;
+                    item.Key = DrawKey::Make(DrawPass::Opaque, (std::uint32_t)mesh.VertexLayout,
+                        submeshes[s].MaterialIndex, meshId, lod, s, depth);
+                    item.Object = index;
+                    out.push_back(item);
+                }
+            }
+        });
+
+    // 4. Ű  -> ̸ ٸ   νϽ ο
+    mRenderQueue.Sort();
+    mRenderQueue.BuildBatches();
+}
+
+void EclipseWalkerGame::UpdateCamera(const GameTimer& gt)
+{
+    PROFILE_SCOPE("UpdateCamera");
+
     // 1. ī޶   ٽ  
     float x = sinf(mCameraPhi) * cosf(mCameraTheta);
     float z = sinf(mCameraPhi) * sinf(mCameraTheta);
@@ -407,7 +1021,9 @@ void EclipseWalkerGame::UpdateCamera()
     XMVECTOR flatForward = XMVector3Normalize(XMVectorSet(x, 0.0f, z, 0.0f));
 
     // 2.  ġ 
-    XMVECTOR targetPos = XMLoadFloat3(&mTargetPos);
+    float px, py, pz;
+    mTransforms.GetPosition(mPlayer, px, py, pz);
+    XMVECTOR targetPos = XMVectorSet(px, py, pz, 1.0f);
 
     float shoulderOffset = 2.0f;
     float upOffset = 2.5f;
@@ -423,12 +1039,31 @@ void EclipseWalkerGame::UpdateCamera()
         + (rightVec * shoulderOffset)
         + (upVec * 1.5f);
 
+    // 4. ٶ󺸴  ī޶ ġ   ->  Ʈ   ձ 
+    //    (BVH   AABB,   ȸ  ״)
+    XMFLOAT3 focus, desired, collided;
+    XMStoreFloat3(&focus, focusPoint);
+    XMStoreFloat3(&desired, cameraPos);
+
+    auto boxTest = [this, radius = mCameraCollision.GetSettings().Radius](std::uint32_t prim, const Ray& ray, float limit) -> float
+    {
+        const std::uint32_t index = mStaticObjects[prim];
+        float world[16], ex, ey, ez;
+        mTransforms.GetWorldMatrix(index, world);
+        mTransforms.GetLocalExtent(index, ex, ey, ez);
+        return SweepTests::SphereBox(ray, radius, world, ex, ey, ez, limit);
+    };
+    mCameraCollision.Update(mStaticBvh, boxTest, &focus.x, &desired.x, gt.DeltaTime(), &collided.x);
+    cameraPos = XMLoadFloat3(&collided);
+
     mCamera.LookAt(cameraPos, focusPoint, upVec);
     mCamera.UpdateViewMatrix();
 }
 
 void EclipseWalkerGame::OnKeyboardInput(const GameTimer& gt)
 {
+    PROFILE_SCOPE("OnKeyboardInput");
+
     float dt = gt.DeltaTime();
     float speed = 10.0f;
 
@@ -440,24 +1075,135 @@ void EclipseWalkerGame::OnKeyboardInput(const GameTimer& gt)
     XMVECTOR flatForward = XMVector3Normalize(XMVectorSet(x, 0.0f, z, 0.0f)); 
     XMVECTOR rightVec = XMVector3Normalize(XMVector3Cross(XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f), lookVec));
 
+    float moveX = 0.0f;
+    float moveZ = 0.0f;
+
     if (GetAsyncKeyState('W') & 0x8000)
     {
-        mTargetPos.x += XMVectorGetX(flatForward) * speed * dt;
-        mTargetPos.z += XMVectorGetZ(flatForward) * speed * dt;
+        moveX += XMVectorGetX(flatForward) * speed * dt;
+        moveZ += XMVectorGetZ(flatForward) * speed * dt;
     }
     if (GetAsyncKeyState('S') & 0x8000)
     {
-        mTargetPos.x -= XMVectorGetX(flatForward) * speed * dt;
-        mTargetPos.z -= XMVectorGetZ(flatForward) * speed * dt;
+        moveX -= XMVectorGetX(flatForward) * speed * dt;
+        moveZ -= XMVectorGetZ(flatForward) * speed * dt;
     }
     if (GetAsyncKeyState('D') & 0x8000)
     {
-        mTargetPos.x += XMVectorGetX(rightVec) * speed * dt;
-        mTargetPos.z += XMVectorGetZ(rightVec) * speed * dt;
+        moveX += XMVectorGetX(rightVec) * speed * dt;
+        moveZ += XMVectorGetZ(rightVec) * speed * dt;
     }
     if (GetAsyncKeyState('A') & 0x8000)
     {
-        mTargetPos.x -= XMVectorGetX(rightVec) * speed * dt;
-        mTargetPos.z -= XMVectorGetZ(rightVec) * speed * dt;
+        moveX -= XMVectorGetX(rightVec) * speed * dt;
+        moveZ -= XMVectorGetZ(rightVec) * speed * dt;
+    }
+
+    //  ־ ߷/ٴ ̱    . ġ ٲ  Ƽ ǥ
+    float px, py, pz;
+    mTransforms.GetPosition(mPlayer, px, py, pz);
+
+    mPlayerController.Move(mCollision, moveX, moveZ, dt);
+    const float* foot = mPlayerController.GetState().Position;
+    if (foot[0] != px || foot[1] + 0.5f != py || foot[2] != pz)
+        mTransforms.SetPosition(mPlayer, foot[0], foot[1] + 0.5f, foot[2]);
+}
+
+void EclipseWalkerGame::UpdateMonsters(const GameTimer& gt)
+{
+    PROFILE_SCOPE("UpdateMonsters");
+
+    const float dt = gt.DeltaTime();
+    const float* target = mPlayerController.GetState().Position;
+
+    // 1.   ޱ +   ʹ ÷̾  ٽ û
+    for (Monster& monster : mMonsters)
+    {
+        if (monster.Request != InvalidPathHandle)
+        {
+            std::vector<float> points;
+            const NavStatus status = mPathQueue.TakePath(monster.Request, points);
+            if (status != NavStatus::InProgress)
+            {
+                monster.Request = InvalidPathHandle;
+                if (status != NavStatus::Failed)
+                {
+                    monster.Path.swap(points);
+                    monster.Corner = 0;
+                }
+            }
+        }
+
+        monster.RepathTime -= dt;
+        if (monster.RepathTime <= 0.0f && monster.Request == InvalidPathHandle)
+        {
+            monster.Request = mPathQueue.Request(monster.Controller.GetState().Position, target);
+            monster.RepathTime += MonsterRepathInterval;
+        }
     }
+    {
+        PROFILE_SCOPE("PathQueue");
+        mPathQueue.Update(PathIterationsPerFrame);
+    }
+
+    // 2.  ̴  ǥ (   ѱ). ÷̾ ̸ 
+    const float stopDist = 2.0f * mPlayerController.GetSettings().Radius + 0.5f;
+    for (Monster& monster : mMonsters)
+    {
+        const float* foot = monster.Controller.GetState().Position;
+        const std::uint32_t corners = (std::uint32_t)monster.Path.size() / 3;
+        while (monster.Corner + 1 < corners)
+        {
+            const float* corner = &monster.Path[monster.Corner * 3];
+            if ((corner[0] - foot[0]) * (corner[0] - foot[0]) + (corner[2] - foot[2]) * (corner[2] - foot[2]) > 0.25f * 0.25f)
+                break;
+            ++monster.Corner;
+        }
+
+        const float toPlayerX = target[0] - foot[0], toPlayerZ = target[2] - foot[2];
+        if (corners == 0 || toPlayerX * toPlayerX + toPlayerZ * toPlayerZ < stopDist * stopDist)
+            mCrowd.SetPreferredVelocity(monster.Agent, 0.0f, 0.0f);
+        else
+            mCrowd.SetTarget(monster.Agent, monster.Path[monster.Corner * 3], monster.Path[monster.Corner * 3 + 2]);
+    }
+
+    // 3.  Ű ӵ ( ý) -> Ʈѷ  ̵ (/) ->   ߿ 
+    mCrowd.ComputeVelocities();
+    for (Monster& monster : mMonsters)
+    {
+        float vx, vz;
+        mCrowd.GetVelocity(monster.Agent, vx, vz);
+        monster.Controller.Move(mCollision, vx * dt, vz * dt, dt);
+
+        const float* foot = monster.Controller.GetState().Position;
+        mCrowd.SetPosition(monster.Agent, foot[0], foot[2]);
+
+        float px, py, pz;
+        mTransforms.GetPosition(monster.Entity, px, py, pz);
+        if (foot[0] != px || foot[1] + 0.5f != py || foot[2] != pz)
+        {
+            mTransforms.SetPosition(monster.Entity, foot[0], foot[1] + 0.5f, foot[2]);
+            if (vx * vx + vz * vz > 0.01f)
+                mTransforms.SetRotationY(monster.Entity, atan2f(vx, vz));
+        }
+    }
+}
+
+void EclipseWalkerGame::UpdateParticles(const GameTimer& gt)
+{
+    PROFILE_SCOPE("UpdateParticles");
+
+    const float dt = gt.DeltaTime();
+
+    // 1.  ߹ 󰡰,  ̹   Ÿŭ 
+    const CharacterState& player = mPlayerController.GetState();
+    const float* last = mParticles.GetSettings(mPlayerDust).Position;
+    const float dx = player.Position[0] - last[0];
+    const float dz = player.Position[2] - last[2];
+    const float speed = dt > 0.0f ? sqrtf(dx * dx + dz * dz) / dt : 0.0f;
+    mParticles.SetEmitterRate(mPlayerDust, player.Grounded ? DustPerMeter * speed : 0.0f);
+    mParticles.SetEmitterPosition(mPlayerDust, player.Position[0], player.Position[1], player.Position[2]);
+
+    // 2. ùķ̼ +  +  (ƼŬ  ̹   ý)
+    mParticles.Update(dt);
 }
\ No newline at end of file
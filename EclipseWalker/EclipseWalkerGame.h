@@ -4,14 +4,32 @@
 #include "Vertices.h"       
 #include "MeshGeometry.h"
 #include "Camera.h"
+#include "FrustumCulling.h"
+#include "OcclusionCulling.h"
+#include "SceneBVH.h"
+#include "CameraCollision.h"
+#include "CharacterController.h"
+#include "NavPathQueue.h"
+#include "CrowdSimulation.h"
+#include "ParticleSystem.h"
+#include "TransformStorage.h"
+#include "FrameResource.h"
+#include "CookedMesh.h"
+#include "LodSelection.h"
+#include "RenderQueue.h"
+#include "D3D12RenderBackend.h"
+#include "RenderGraph.h"
+#include "D3D12PipelineCache.h"
 
 #include <DirectXColors.h>
 #include <algorithm>
 
 // GPU   ü
-struct ObjectConstants
+// νϽ (t0 ȭ ):  ť     ä
+// ̴ SV_InstanceID + ġ  ȣ(b0 Ʈ ) 
+struct InstanceData
 {
-    DirectX::XMFLOAT4X4 WorldViewProj = {
+    DirectX::XMFLOAT4X4 World = {
         1.0f, 0.0f, 0.0f, 0.0f,
         0.0f, 1.0f, 0.0f, 0.0f,
         0.0f, 0.0f, 1.0f, 0.0f,
@@ -19,6 +37,19 @@ struct ObjectConstants
     };
 };
 
+// н (b1): ī޶ ٲ  ٽ 
+struct PassConstants
+{
+    DirectX::XMFLOAT4X4 ViewProj = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    DirectX::XMFLOAT4 CameraRight = { 1.0f, 0.0f, 0.0f, 0.0f }; // ƼŬ 带 ġ 
+    DirectX::XMFLOAT4 CameraUp = { 0.0f, 1.0f, 0.0f, 0.0f };
+};
+
 class EclipseWalkerGame : public GameFramework
 {
 public:
@@ -41,12 +72,29 @@ private:
     void BuildShadersAndInputLayout();
     void BuildBoxGeometry();
     void BuildPSO();
-    void BuildConstantBuffer();
+    void BuildRenderBackend();
+    void BuildFrameResources();
+    void BuildScene();
 
     // --- [   Լ] ---
     void OnKeyboardInput(const GameTimer& gt); // Ű ̵
-    void UpdateCamera();                       // ī޶ ġ 
-    void UpdateObjectCBs(const GameTimer& gt); //    
+    void UpdateMonsters(const GameTimer& gt);  //  û/󰡱 +  ȸ -> ĳ Ʈѷ
+    void UpdateParticles(const GameTimer& gt); // ̹ 󰡱 + ƼŬ ùķ̼
+    void UpdateCamera(const GameTimer& gt);    // ī޶ ġ  ( Ʈ  )
+    void UpdateTransforms();                   // Ƽ Ʈ   
+    void UpdateVisibility();                   // ü ø (̴ Ʈ  )
+    void UpdateLods();                         // ̴ Ʈ LOD (ȭ  )
+    void UpdateRenderQueue();                  // ׸   + νϽ ġ
+    void UpdateInstanceData();                 //   νϽ  
+    void UpdateParticleData();                 // ƼŬ   ε  ٷ 
+    void UpdatePassCB();                       // ī޶  
+    void DrawScenePass(ID3D12CommandAllocator* allocator,
+        D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle, D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle); //  + 鿣 
+    void RecordDrawBatches(std::uint32_t begin, std::uint32_t end, CommandStream& stream)const; //  ť ġ ->  (Ŀ Ҹ)
+    UploadAllocation AllocateUpload(UINT64 byteSize); //      ٸ
+    GpuBufferAllocation CreateGeometryBuffer(const void* initData, UINT64 byteSize, UploadTicket& ticket); // ⺻   +  ť ε
+    std::uint32_t CreateMesh(const std::string& name, const CookedMesh& cooked); // ޽ ȣ ȯ
+    std::uint32_t LoadMesh(const std::string& name, const std::string& path);    // .ewmesh, ϸ UINT32_MAX
     float AspectRatio() const;                 // ȭ  
 
     // --- [Է ó ̵] ---
@@ -57,34 +105,114 @@ private:
 private:
     // --- 1. DirectX ھ ҽ ---
     Microsoft::WRL::ComPtr<ID3D12RootSignature> mRootSignature = nullptr;
-    Microsoft::WRL::ComPtr<ID3D12PipelineState> mPSO = nullptr;
-
-    Microsoft::WRL::ComPtr<ID3DBlob> mvsByteCode = nullptr;
-    Microsoft::WRL::ComPtr<ID3DBlob> mpsByteCode = nullptr;
-
-    std::vector<D3D12_INPUT_ELEMENT_DESC> mInputLayout;
+    std::uint64_t mRootSignatureKey = 0; // ȭ Ʈ ñ״ó ؽ (PSO ĳ Ű)
+    //  ˸ Է ġ/PSO (̴    PSO  nullptr)
+    static constexpr std::size_t VertexFormatCount = (std::size_t)MeshFormat::VertexFormat::Count;
+    std::array<Microsoft::WRL::ComPtr<ID3D12PipelineState>, VertexFormatCount> mPSOs;
+    // ƼŬ (particle.hlsl, Է ġ  +  ).  ȣ   
+    static constexpr std::uint32_t ParticlePipelineId = (std::uint32_t)VertexFormatCount;
+    Microsoft::WRL::ComPtr<ID3D12PipelineState> mParticlePSO;
+
+    // ̴/PSO ĳ (ShaderCache.ewsc). Ʈڵ BuildPSO   (Save   )
+    std::unique_ptr<D3D12PipelineCache> mPipelineCache;
+    D3D12_SHADER_BYTECODE mvsByteCode = {};
+    D3D12_SHADER_BYTECODE mpsByteCode = {};
+    D3D12_SHADER_BYTECODE mParticleVsByteCode = {};
+    D3D12_SHADER_BYTECODE mParticlePsByteCode = {};
+
+    std::array<std::vector<D3D12_INPUT_ELEMENT_DESC>, VertexFormatCount> mInputLayouts;
 
     // --- 2. Ʈ    ---
-    std::unique_ptr<MeshGeometry> mBoxGeo = nullptr; // ڽ ޽
-
-    Microsoft::WRL::ComPtr<ID3D12Resource> mObjectCB = nullptr; //  
-    BYTE* mMappedData = nullptr; // ε ޸ ּ
-
-    //   ( ķ ʱȭ)
-    DirectX::XMFLOAT4X4 mWorld = {
-        1.0f, 0.0f, 0.0f, 0.0f,
-        0.0f, 1.0f, 0.0f, 0.0f,
-        0.0f, 0.0f, 1.0f, 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f
+    // ޽ ȣ = ε (TransformStorage  ޽ ȣ Ŵ)
+    static constexpr std::uint32_t BoxMeshId = 0;
+    std::vector<std::unique_ptr<MeshGeometry>> mMeshes;
+    std::vector<LodMeshInfo> mMeshLods; // mMeshes    (LOD ÿ )
+    std::vector<OccluderMesh> mOccluderMeshes; // ޽ ȣ Ŭ CPU ޽ (  Ŭ  )
+
+    //  ҽ (CPU GPU ִ NumFrameResources  ռ )
+    static constexpr int NumFrameResources = 3;
+    std::vector<std::unique_ptr<FrameResource>> mFrameResources;
+    FrameResource* mCurrFrameResource = nullptr;
+    int mCurrFrameResourceIndex = 0;
+
+    // /νϽ ۴    ߶  (256 Ʈ )
+    static constexpr std::uint32_t MaxInstancesPerFrame = 65536; // ̴ Ʈ x ޽
+    std::unique_ptr<UploadRing> mUploadRing;
+    D3D12_GPU_VIRTUAL_ADDRESS mPassCBAddress = 0;
+    D3D12_GPU_VIRTUAL_ADDRESS mInstanceDataAddress = 0; //  ť    ġ
+
+    // ƼŬ    (ġ ŭ ׸ )
+    static constexpr std::uint32_t MaxParticlesPerFrame = 65536;
+    D3D12_GPU_VIRTUAL_ADDRESS mParticleDataAddress = 0;
+    D3D12_GPU_VIRTUAL_ADDRESS mParticleIndexAddress = 0; // 簢 ϳ (ε 6 )
+    std::uint32_t mParticleDrawCount = 0;
+
+    // ---  Ʈ (ġ/ȸ//޽/  SoA) ---
+    TransformStorage mTransforms;
+    EntityId mPlayer = InvalidEntity;
+
+    //  Ʈ  BVH (Ƽ ȣ -> mStaticObjects   ε). ī޶ 浹
+    SceneBVH mStaticBvh;
+    std::vector<std::uint32_t> mStaticObjects;
+
+    // ÷̾ ̵ 浹 ( +  , ÷̾ ĸ).   ڵ ̵ 
+    CollisionWorld mCollision;
+    CharacterController mPlayerController;
+
+    //  :    Ÿ ׺޽ + Ӹ 길ŭ A*   û ť
+    static constexpr std::uint32_t PathIterationsPerFrame = 4096;
+    NavMesh mNavMesh;
+    NavPathQueue mPathQueue{ mNavMesh };
+
+    // :   ̴  ǥ  ȸǰ ӵ ,  ӵ ĳ Ʈѷ  
+    struct Monster
+    {
+        EntityId Entity = InvalidEntity;
+        CrowdAgentId Agent = InvalidCrowdAgent;
+        CharacterController Controller;
+        NavPathHandle Request = InvalidPathHandle;
+        std::vector<float> Path;        // ̴  x, y, z ݺ
+        std::uint32_t Corner = 0;       //  ϴ 
+        float RepathTime = 0.0f;        // 0  Ǹ ÷̾  ٽ û
     };
+    static constexpr std::uint32_t MonsterCount = 128;
+    static constexpr float MonsterSpeed = 4.0f;
+    static constexpr float MonsterRepathInterval = 1.0f;
+    CrowdSimulation mCrowd;
+    std::vector<Monster> mMonsters;
+
+    // Ʈ:   м   + ÷̾ ߹  ( Ÿŭ )
+    static constexpr std::uint32_t FountainCount = 4;
+    static constexpr float DustPerMeter = 60.0f;
+    ParticleSystem mParticles;
+    ParticleEmitterId mPlayerDust = InvalidParticleEmitter;
 
     // --- 3. ī޶   ÷  ---
+    static constexpr float NearZ = 0.25f; // ī޶ 浹   ̰  (OnResize)
     Camera mCamera;
+    CameraCollision mCameraCollision;
 
     POINT mLastMousePos; // 콺 ġ 
 
-    // ĳ(Target) ġ
-    DirectX::XMFLOAT3 mTargetPos = { 0.0f, 0.0f, 0.0f };
+    // ̹ ӿ ̴ Ʈ (TransformStorage  ε)
+    std::vector<std::uint32_t> mVisibleObjects;
+
+    // ü  -> Ʈ Ŭ ( ū Ʈ Ŭ ׷ ڿ   )
+    OcclusionCuller mOcclusion;
+    std::vector<std::uint32_t> mFrustumVisible;
+    std::vector<std::uint32_t> mOccluders;
+
+    // ̴ Ʈ ޽  Ű ->  ³ νϽ ο
+    RenderQueue mRenderQueue;
+    std::vector<std::uint8_t> mMeshReady; // ޽ ȣ  ť ε Ϸ  (Gather ߿ б⸸)
+
+    // ġ  Ʈ      -> D3D12 鿣尡 Ʈ 
+    static constexpr std::uint32_t MinBatchesPerStream = 64;
+    CommandStreamSet mCommandStreams;
+    std::unique_ptr<D3D12RenderBackend> mRenderBackend;
+
+    // Ӹ ٽ / (ҽ ̿ 踮  ⼭ )
+    RenderGraph mFrameGraph;
 
     // ī޶ ȸ  ( ǥ)
     float mCameraTheta = 1.5f * DirectX::XM_PI; // 
@@ -0,0 +1,51 @@
+#include "FrameResource.h"
+
+FrameResource::FrameResource(ID3D12Device* device)
+{
+    ThrowIfFailed(device->CreateCommandAllocator(
+        D3D12_COMMAND_LIST_TYPE_DIRECT,
+        IID_PPV_ARGS(CmdListAlloc.GetAddressOf())));
+}
+
+UploadRing::UploadRing(ID3D12Device* device, UINT64 capacity)
+{
+    //  0 ư 256 Ʈ  ǵ
+    capacity = (capacity + D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1) & ~(UINT64)(D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT - 1);
+
+    auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+    auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(capacity);
+
+    ThrowIfFailed(device->CreateCommittedResource(
+        &heapProps,
+        D3D12_HEAP_FLAG_NONE,
+        &bufferDesc,
+        D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr,
+        IID_PPV_ARGS(&mBuffer)));
+
+    // ε    ֵ  (Unmap  Ҹڿ)
+    ThrowIfFailed(mBuffer->Map(0, nullptr, reinterpret_cast<void**>(&mMappedData)));
+
+    mAllocator.Reset(capacity);
+}
+
+UploadRing::~UploadRing()
+{
+    if (mBuffer != nullptr)
+        mBuffer->Unmap(0, nullptr);
+
+    mMappedData = nullptr;
+}
+
+UploadAllocation UploadRing::Allocate(UINT64 size, UINT64 alignment)
+{
+    UploadAllocation allocation;
+
+    UINT64 offset = mAllocator.Allocate(size, alignment);
+    if (offset == UploadRingAllocator::InvalidOffset)
+        return allocation;
+
+    allocation.Cpu = mMappedData + offset;
+    allocation.Gpu = mBuffer->GetGPUVirtualAddress() + offset;
+    return allocation;
+}
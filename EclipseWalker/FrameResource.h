@@ -0,0 +1,55 @@
+#pragma once
+#include "d3dUtil.h"
+#include "UploadRingAllocator.h"
+
+// ==========================================================
+//  ҽ (N   )
+// - Ӹ  Ҵڿ      潺 
+// -     ε ʹ UploadRing ϳ    
+//   (   潺 , GPU  ° ȯ)
+// CPU N  ռ   ٸ
+// ==========================================================
+
+struct FrameResource
+{
+    FrameResource(ID3D12Device* device);
+    FrameResource(const FrameResource& rhs) = delete;
+    FrameResource& operator=(const FrameResource& rhs) = delete;
+
+    // GPU       Reset ϸ  
+    ComPtr<ID3D12CommandAllocator> CmdListAlloc;
+
+    //   ϰ  潺 (0 ̸     )
+    UINT64 Fence = 0;
+};
+
+//  ε ε  ϳ +  Ҵ
+struct UploadAllocation
+{
+    BYTE* Cpu = nullptr;
+    D3D12_GPU_VIRTUAL_ADDRESS Gpu = 0;
+};
+
+class UploadRing
+{
+public:
+    UploadRing(ID3D12Device* device, UINT64 capacity);
+    UploadRing(const UploadRing& rhs) = delete;
+    UploadRing& operator=(const UploadRing& rhs) = delete;
+    ~UploadRing();
+
+    //   Cpu == nullptr (ȣ ʿ   ٸ  Retire ϰ ٽ õ)
+    UploadAllocation Allocate(UINT64 size, UINT64 alignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+
+    void FinishFrame(UINT64 fenceValue) { mAllocator.FinishFrame(fenceValue); }
+    void Retire(UINT64 completedFenceValue) { mAllocator.Retire(completedFenceValue); }
+
+    UINT64 GetOldestFence()const { return mAllocator.GetOldestFence(); }
+    UINT64 GetUsedBytes()const { return mAllocator.GetUsedBytes(); }
+    UINT64 GetCapacity()const { return mAllocator.GetCapacity(); }
+
+private:
+    ComPtr<ID3D12Resource> mBuffer;
+    BYTE* mMappedData = nullptr;
+    UploadRingAllocator mAllocator;
+};
@@ -0,0 +1,119 @@
+#include "FrameStats.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+FrameStats::FrameStats()
+{
+    Reset();
+}
+
+void FrameStats::Reset()
+{
+    std::memset(mRing, 0, sizeof(mRing));
+    std::memset(mSorted, 0, sizeof(mSorted));
+    mHead = 0;
+    mCount = 0;
+    mSumMs = 0.0;
+    mSummary = Summary();
+}
+
+void FrameStats::SetHitchThreshold(float factor, float minMs)
+{
+    mHitchFactor = factor;
+    mHitchMinMs = minMs;
+}
+
+bool FrameStats::AddFrame(double deltaSeconds)
+{
+    float ms = (float)(deltaSeconds * 1000.0);
+    if (ms < 0.0f)
+        ms = 0.0f;
+
+    // 1. ġ  (̹  ֱ  ߾Ӱ ,  ʹ  )
+    bool isHitch = false;
+    if (mCount >= 8)
+    {
+        float threshold = std::max(mHitchMinMs, mSummary.P50Ms * mHitchFactor);
+        isHitch = ms > threshold;
+    }
+
+    // 2. 찡  á    
+    if (mCount == WindowSize)
+    {
+        float oldest = mRing[mHead];
+        RemoveSorted(oldest);
+        mSumMs -= oldest;
+        --mCount;
+    }
+
+    mRing[mHead] = ms;
+    InsertSorted(ms);
+    mSumMs += ms;
+    ++mCount;
+    mHead = (mHead + 1) % WindowSize;
+
+    //    :     հ踦 ٽ 
+    if (mHead == 0)
+    {
+        mSumMs = 0.0;
+        for (int i = 0; i < mCount; ++i)
+            mSumMs += mSorted[i];
+    }
+
+    // 3.  
+    mSummary.LastMs = ms;
+    mSummary.AvgMs = (float)(mSumMs / mCount);
+    mSummary.P50Ms = Percentile(0.50f);
+    mSummary.P95Ms = Percentile(0.95f);
+    mSummary.P99Ms = Percentile(0.99f);
+    mSummary.MaxMs = mSorted[mCount - 1];
+    mSummary.Fps = mSummary.AvgMs > 0.0f ? 1000.0f / mSummary.AvgMs : 0.0f;
+    mSummary.SampleCount = mCount;
+    mSummary.FrameIndex++;
+
+    mSummary.LastFrameWasHitch = isHitch;
+    if (isHitch)
+    {
+        mSummary.HitchCount++;
+        mSummary.LastHitchMs = ms;
+    }
+
+    return isHitch;
+}
+
+float FrameStats::GetFrameTime(int framesAgo)const
+{
+    if (framesAgo < 0 || framesAgo >= mCount)
+        return 0.0f;
+
+    int index = (mHead - 1 - framesAgo + WindowSize) % WindowSize;
+    return mRing[index];
+}
+
+void FrameStats::RemoveSorted(float ms)
+{
+    float* end = mSorted + mCount;
+    float* it = std::lower_bound(mSorted, end, ms);
+    if (it == end)
+        return;
+
+    std::memmove(it, it + 1, (end - it - 1) * sizeof(float));
+}
+
+void FrameStats::InsertSorted(float ms)
+{
+    float* end = mSorted + mCount;
+    float* it = std::upper_bound(mSorted, end, ms);
+
+    std::memmove(it + 1, it, (end - it) * sizeof(float));
+    *it = ms;
+}
+
+// nearest-rank 
+float FrameStats::Percentile(float p)const
+{
+    int rank = (int)std::ceil(p * mCount) - 1;
+    rank = std::clamp(rank, 0, mCount - 1);
+    return mSorted[rank];
+}
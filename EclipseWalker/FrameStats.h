@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+
+// ֱ  ð  ۿ Ƶΰ (, , ִ, ġ) ִ ϱ
+//  ũ⸸ŭ ĵ 纻  ؼ   O(N) memmove    ٷ 
+class FrameStats
+{
+public:
+    static constexpr int WindowSize = 256; // ֱ   
+
+    struct Summary
+    {
+        float LastMs = 0.0f;  //   
+        float AvgMs = 0.0f;
+        float P50Ms = 0.0f;
+        float P95Ms = 0.0f;
+        float P99Ms = 0.0f;
+        float MaxMs = 0.0f;
+        float Fps = 0.0f;     //   ð 
+
+        int SampleCount = 0;          //  ȿ ִ  
+        std::uint64_t FrameIndex = 0; // ݱ ϵ   
+
+        std::uint64_t HitchCount = 0; //  ġ 
+        float LastHitchMs = 0.0f;     //  ġ  ð
+        bool LastFrameWasHitch = false;
+    };
+
+    FrameStats();
+
+    void Reset();
+
+    //   ȣ (deltaSeconds = GameTimer::PreciseDeltaTime())
+    // ̹  ġ true
+    bool AddFrame(double deltaSeconds);
+
+    // ġ :  ð > max(minMs, ߾Ӱ * factor)
+    void SetHitchThreshold(float factor, float minMs);
+
+    const Summary& GetSummary()const { return mSummary; }
+
+    // framesAgo = 0   ֱ  (׷ ׸  )
+    float GetFrameTime(int framesAgo)const;
+    int GetSampleCount()const { return mCount; }
+
+private:
+    void RemoveSorted(float ms);
+    void InsertSorted(float ms);
+    float Percentile(float p)const;
+
+private:
+    float mRing[WindowSize];   //  
+    float mSorted[WindowSize]; // 
+    int mHead = 0;             //   ġ
+    int mCount = 0;
+
+    double mSumMs = 0.0;
+
+    float mHitchFactor = 2.0f;
+    float mHitchMinMs = 20.0f;
+
+    Summary mSummary;
+};
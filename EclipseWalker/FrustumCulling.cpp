@@ -0,0 +1,323 @@
+#include "FrustumCulling.h"
+#include <cmath>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ---------------------------------------------------------
+// SoA ̳
+// ---------------------------------------------------------
+void AabbSoA::Clear()
+{
+    CenterX.clear(); CenterY.clear(); CenterZ.clear();
+    ExtentX.clear(); ExtentY.clear(); ExtentZ.clear();
+}
+
+void AabbSoA::Reserve(std::size_t count)
+{
+    CenterX.reserve(count); CenterY.reserve(count); CenterZ.reserve(count);
+    ExtentX.reserve(count); ExtentY.reserve(count); ExtentZ.reserve(count);
+}
+
+std::uint32_t AabbSoA::Add(float cx, float cy, float cz, float ex, float ey, float ez)
+{
+    CenterX.push_back(cx); CenterY.push_back(cy); CenterZ.push_back(cz);
+    ExtentX.push_back(ex); ExtentY.push_back(ey); ExtentZ.push_back(ez);
+    return (std::uint32_t)(CenterX.size() - 1);
+}
+
+void AabbSoA::Set(std::size_t i, float cx, float cy, float cz, float ex, float ey, float ez)
+{
+    CenterX[i] = cx; CenterY[i] = cy; CenterZ[i] = cz;
+    ExtentX[i] = ex; ExtentY[i] = ey; ExtentZ[i] = ez;
+}
+
+void SphereSoA::Clear()
+{
+    CenterX.clear(); CenterY.clear(); CenterZ.clear();
+    Radius.clear();
+}
+
+void SphereSoA::Reserve(std::size_t count)
+{
+    CenterX.reserve(count); CenterY.reserve(count); CenterZ.reserve(count);
+    Radius.reserve(count);
+}
+
+std::uint32_t SphereSoA::Add(float cx, float cy, float cz, float r)
+{
+    CenterX.push_back(cx); CenterY.push_back(cy); CenterZ.push_back(cz);
+    Radius.push_back(r);
+    return (std::uint32_t)(CenterX.size() - 1);
+}
+
+void SphereSoA::Set(std::size_t i, float cx, float cy, float cz, float r)
+{
+    CenterX[i] = cx; CenterY[i] = cy; CenterZ[i] = cz;
+    Radius[i] = r;
+}
+
+namespace
+{
+    inline int CountTrailingZeros(unsigned int v)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, v);
+        return (int)index;
+#else
+        return __builtin_ctz(v);
+#endif
+    }
+
+    // 8   Ʈũ -> ε 
+    inline std::size_t EmitVisible(unsigned int mask, std::uint32_t base, std::uint32_t* out, std::size_t n)
+    {
+        while (mask != 0)
+        {
+            out[n++] = base + (std::uint32_t)CountTrailingZeros(mask);
+            mask &= mask - 1;
+        }
+        return n;
+    }
+
+#if defined(__AVX__)
+    //    ۿ ̸ εĳƮ 
+    struct PlaneLanes
+    {
+        __m256 Nx, Ny, Nz, D;
+        __m256 AbsNx, AbsNy, AbsNz;
+    };
+
+    inline void LoadPlanes(const Frustum& frustum, PlaneLanes* lanes)
+    {
+        for (int p = 0; p < Frustum::Count; ++p)
+        {
+            const FrustumPlane& pl = frustum.Planes[p];
+            lanes[p].Nx = _mm256_set1_ps(pl.Nx);
+            lanes[p].Ny = _mm256_set1_ps(pl.Ny);
+            lanes[p].Nz = _mm256_set1_ps(pl.Nz);
+            lanes[p].D = _mm256_set1_ps(pl.D);
+            lanes[p].AbsNx = _mm256_set1_ps(std::fabs(pl.Nx));
+            lanes[p].AbsNy = _mm256_set1_ps(std::fabs(pl.Ny));
+            lanes[p].AbsNz = _mm256_set1_ps(std::fabs(pl.Nz));
+        }
+    }
+
+    inline unsigned int AabbMask8(const PlaneLanes* lanes, const AabbSoA& b, std::size_t i)
+    {
+        __m256 cx = _mm256_loadu_ps(&b.CenterX[i]);
+        __m256 cy = _mm256_loadu_ps(&b.CenterY[i]);
+        __m256 cz = _mm256_loadu_ps(&b.CenterZ[i]);
+        __m256 ex = _mm256_loadu_ps(&b.ExtentX[i]);
+        __m256 ey = _mm256_loadu_ps(&b.ExtentY[i]);
+        __m256 ez = _mm256_loadu_ps(&b.ExtentZ[i]);
+
+        __m256 outside = _mm256_setzero_ps();
+        for (int p = 0; p < Frustum::Count; ++p)
+        {
+            const PlaneLanes& pl = lanes[p];
+            // ߽ɱ Ÿ +      < 0 ̸  ٱ
+            __m256 dist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(pl.Nx, cx), _mm256_mul_ps(pl.Ny, cy)),
+                _mm256_add_ps(_mm256_mul_ps(pl.Nz, cz), pl.D));
+            __m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(pl.AbsNx, ex), _mm256_mul_ps(pl.AbsNy, ey)),
+                _mm256_mul_ps(pl.AbsNz, ez));
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(dist, radius), _mm256_setzero_ps(), _CMP_LT_OQ));
+        }
+        return ~(unsigned int)_mm256_movemask_ps(outside) & 0xFFu;
+    }
+
+    inline unsigned int SphereMask8(const PlaneLanes* lanes, const SphereSoA& s, std::size_t i)
+    {
+        __m256 cx = _mm256_loadu_ps(&s.CenterX[i]);
+        __m256 cy = _mm256_loadu_ps(&s.CenterY[i]);
+        __m256 cz = _mm256_loadu_ps(&s.CenterZ[i]);
+        __m256 r = _mm256_loadu_ps(&s.Radius[i]);
+
+        __m256 outside = _mm256_setzero_ps();
+        for (int p = 0; p < Frustum::Count; ++p)
+        {
+            const PlaneLanes& pl = lanes[p];
+            __m256 dist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(pl.Nx, cx), _mm256_mul_ps(pl.Ny, cy)),
+                _mm256_add_ps(_mm256_mul_ps(pl.Nz, cz), pl.D));
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(dist, r), _mm256_setzero_ps(), _CMP_LT_OQ));
+        }
+        return ~(unsigned int)_mm256_movemask_ps(outside) & 0xFFu;
+    }
+#else
+    struct PlaneLanes
+    {
+        __m128 Nx, Ny, Nz, D;
+        __m128 AbsNx, AbsNy, AbsNz;
+    };
+
+    inline void LoadPlanes(const Frustum& frustum, PlaneLanes* lanes)
+    {
+        for (int p = 0; p < Frustum::Count; ++p)
+        {
+            const FrustumPlane& pl = frustum.Planes[p];
+            lanes[p].Nx = _mm_set1_ps(pl.Nx);
+            lanes[p].Ny = _mm_set1_ps(pl.Ny);
+            lanes[p].Nz = _mm_set1_ps(pl.Nz);
+            lanes[p].D = _mm_set1_ps(pl.D);
+            lanes[p].AbsNx = _mm_set1_ps(std::fabs(pl.Nx));
+            lanes[p].AbsNy = _mm_set1_ps(std::fabs(pl.Ny));
+            lanes[p].AbsNz = _mm_set1_ps(std::fabs(pl.Nz));
+        }
+    }
+
+    inline unsigned int AabbMask4(const PlaneLanes* lanes, const AabbSoA& b, std::size_t i)
+    {
+        __m128 cx = _mm_loadu_ps(&b.CenterX[i]);
+        __m128 cy = _mm_loadu_ps(&b.CenterY[i]);
+        __m128 cz = _mm_loadu_ps(&b.CenterZ[i]);
+        __m128 ex = _mm_loadu_ps(&b.ExtentX[i]);
+        __m128 ey = _mm_loadu_ps(&b.ExtentY[i]);
+        __m128 ez = _mm_loadu_ps(&b.ExtentZ[i]);
+
+        __m128 outside = _mm_setzero_ps();
+        for (int p = 0; p < Frustum::Count; ++p)
+        {
+            const PlaneLanes& pl = lanes[p];
+            __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pl.Nx, cx), _mm_mul_ps(pl.Ny, cy)),
+                _mm_add_ps(_mm_mul_ps(pl.Nz, cz), pl.D));
+            __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pl.AbsNx, ex), _mm_mul_ps(pl.AbsNy, ey)),
+                _mm_mul_ps(pl.AbsNz, ez));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, radius), _mm_setzero_ps()));
+        }
+        return ~(unsigned int)_mm_movemask_ps(outside) & 0xFu;
+    }
+
+    inline unsigned int SphereMask4(const PlaneLanes* lanes, const SphereSoA& s, std::size_t i)
+    {
+        __m128 cx = _mm_loadu_ps(&s.CenterX[i]);
+        __m128 cy = _mm_loadu_ps(&s.CenterY[i]);
+        __m128 cz = _mm_loadu_ps(&s.CenterZ[i]);
+        __m128 r = _mm_loadu_ps(&s.Radius[i]);
+
+        __m128 outside = _mm_setzero_ps();
+        for (int p = 0; p < Frustum::Count; ++p)
+        {
+            const PlaneLanes& pl = lanes[p];
+            __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pl.Nx, cx), _mm_mul_ps(pl.Ny, cy)),
+                _mm_add_ps(_mm_mul_ps(pl.Nz, cz), pl.D));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, r), _mm_setzero_ps()));
+        }
+        return ~(unsigned int)_mm_movemask_ps(outside) & 0xFu;
+    }
+
+    // SSE 忡   8 (4 x 2)
+    inline unsigned int AabbMask8(const PlaneLanes* lanes, const AabbSoA& b, std::size_t i)
+    {
+        return AabbMask4(lanes, b, i) | (AabbMask4(lanes, b, i + 4) << 4);
+    }
+
+    inline unsigned int SphereMask8(const PlaneLanes* lanes, const SphereSoA& s, std::size_t i)
+    {
+        return SphereMask4(lanes, s, i) | (SphereMask4(lanes, s, i + 4) << 4);
+    }
+#endif
+}
+
+namespace FrustumCulling
+{
+    void ExtractPlanes(const float* m, Frustum& out)
+    {
+        // clip = p * M ̹Ƿ (column)   (Gribb-Hartmann)
+        auto col = [m](int c, int r) { return m[r * 4 + c]; };
+
+        auto set = [&](int index, float a, float b, float c, float d)
+        {
+            float len = std::sqrt(a * a + b * b + c * c);
+            float inv = len > 0.0f ? 1.0f / len : 0.0f;
+            out.Planes[index] = { a * inv, b * inv, c * inv, d * inv };
+        };
+
+        set(Frustum::Left,   col(3, 0) + col(0, 0), col(3, 1) + col(0, 1), col(3, 2) + col(0, 2), col(3, 3) + col(0, 3));
+        set(Frustum::Right,  col(3, 0) - col(0, 0), col(3, 1) - col(0, 1), col(3, 2) - col(0, 2), col(3, 3) - col(0, 3));
+        set(Frustum::Bottom, col(3, 0) + col(1, 0), col(3, 1) + col(1, 1), col(3, 2) + col(1, 2), col(3, 3) + col(1, 3));
+        set(Frustum::Top,    col(3, 0) - col(1, 0), col(3, 1) - col(1, 1), col(3, 2) - col(1, 2), col(3, 3) - col(1, 3));
+        set(Frustum::Near,   col(2, 0),             col(2, 1),             col(2, 2),             col(2, 3));
+        set(Frustum::Far,    col(3, 0) - col(2, 0), col(3, 1) - col(2, 1), col(3, 2) - col(2, 2), col(3, 3) - col(2, 3));
+    }
+
+    // ϴ  SIMD ο  (迡 ģ ͵  )
+    bool TestAabb(const Frustum& frustum, float cx, float cy, float cz, float ex, float ey, float ez)
+    {
+        for (const FrustumPlane& p : frustum.Planes)
+        {
+            float dist = (p.Nx * cx + p.Ny * cy) + (p.Nz * cz + p.D);
+            float radius = std::fabs(p.Nx) * ex + std::fabs(p.Ny) * ey + std::fabs(p.Nz) * ez;
+            if (dist + radius < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    bool TestSphere(const Frustum& frustum, float cx, float cy, float cz, float r)
+    {
+        for (const FrustumPlane& p : frustum.Planes)
+        {
+            float dist = (p.Nx * cx + p.Ny * cy) + (p.Nz * cz + p.D);
+            if (dist + r < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    std::size_t CullAabbs(const Frustum& frustum, const AabbSoA& boxes, std::vector<std::uint32_t>& outVisible)
+    {
+        const std::size_t count = boxes.Size();
+        outVisible.resize(count);
+
+        PlaneLanes lanes[Frustum::Count];
+        LoadPlanes(frustum, lanes);
+
+        std::uint32_t* out = outVisible.data();
+        std::size_t n = 0;
+        std::size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+            n = EmitVisible(AabbMask8(lanes, boxes, i), (std::uint32_t)i, out, n);
+
+        //   Į
+        for (; i < count; ++i)
+        {
+            if (TestAabb(frustum, boxes.CenterX[i], boxes.CenterY[i], boxes.CenterZ[i],
+                boxes.ExtentX[i], boxes.ExtentY[i], boxes.ExtentZ[i]))
+            {
+                out[n++] = (std::uint32_t)i;
+            }
+        }
+
+        outVisible.resize(n);
+        return n;
+    }
+
+    std::size_t CullSpheres(const Frustum& frustum, const SphereSoA& spheres, std::vector<std::uint32_t>& outVisible)
+    {
+        const std::size_t count = spheres.Size();
+        outVisible.resize(count);
+
+        PlaneLanes lanes[Frustum::Count];
+        LoadPlanes(frustum, lanes);
+
+        std::uint32_t* out = outVisible.data();
+        std::size_t n = 0;
+        std::size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+            n = EmitVisible(SphereMask8(lanes, spheres, i), (std::uint32_t)i, out, n);
+
+        for (; i < count; ++i)
+        {
+            if (TestSphere(frustum, spheres.CenterX[i], spheres.CenterY[i], spheres.CenterZ[i], spheres.Radius[i]))
+                out[n++] = (std::uint32_t)i;
+        }
+
+        outVisible.resize(n);
+        return n;
+    }
+}
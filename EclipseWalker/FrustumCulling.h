@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+// ü ø
+// -   ,    (np + d >= 0 ̸ )
+// - AABB/ SoA 迭 Ƽ   8 SIMD 
+//   (__AVX__  AVX 1ȸ, ƴϸ SSE 4 x 2ȸ)
+// D3D/Windows   ʾƼ ٸ ÷ ״ 
+// ==========================================================
+
+struct FrustumPlane
+{
+    float Nx, Ny, Nz, D;
+};
+
+struct Frustum
+{
+    enum { Left, Right, Bottom, Top, Near, Far, Count };
+    FrustumPlane Planes[Count];
+};
+
+// AABB  (߽ +  )
+struct AabbSoA
+{
+    std::vector<float> CenterX, CenterY, CenterZ;
+    std::vector<float> ExtentX, ExtentY, ExtentZ;
+
+    std::size_t Size()const { return CenterX.size(); }
+    void Clear();
+    void Reserve(std::size_t count);
+    std::uint32_t Add(float cx, float cy, float cz, float ex, float ey, float ez);
+    void Set(std::size_t i, float cx, float cy, float cz, float ex, float ey, float ez);
+};
+
+// ٿ  
+struct SphereSoA
+{
+    std::vector<float> CenterX, CenterY, CenterZ;
+    std::vector<float> Radius;
+
+    std::size_t Size()const { return CenterX.size(); }
+    void Clear();
+    void Reserve(std::size_t count);
+    std::uint32_t Add(float cx, float cy, float cz, float r);
+    void Set(std::size_t i, float cx, float cy, float cz, float r);
+};
+
+namespace FrustumCulling
+{
+    //   Ծ(DirectXMath) viewProj (row-major 16)  6  (D3D Ŭ  z: 0~w)
+    void ExtractPlanes(const float* viewProj, Frustum& out);
+
+    // ϳ   (Į)
+    bool TestAabb(const Frustum& frustum, float cx, float cy, float cz, float ex, float ey, float ez);
+    bool TestSphere(const Frustum& frustum, float cx, float cy, float cz, float r);
+
+    // ̴ ͵ ε outVisible ä  
+    std::size_t CullAabbs(const Frustum& frustum, const AabbSoA& boxes, std::vector<std::uint32_t>& outVisible);
+    std::size_t CullSpheres(const Frustum& frustum, const SphereSoA& spheres, std::vector<std::uint32_t>& outVisible);
+}
@@ -0,0 +1,170 @@
+#include "FrustumCullingBenchmark.h"
+#include "FrustumCulling.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float WorldHalfSize = 500.0f;
+    constexpr float Pi = 3.14159265f;
+
+    //   Ծ (DirectXMath  LookAtLH * PerspectiveFovLH   ),  +Y
+    void MakeViewProj(float eyeX, float eyeY, float eyeZ, float yaw, float aspect, float* out)
+    {
+        const float fx = std::sin(yaw), fz = std::cos(yaw);   //  ()
+        const float rx = fz, rz = -fx;                          //  = up x 
+
+        const float view[16] =
+        {
+            rx,   0.0f, fx,   0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            rz,   0.0f, fz,   0.0f,
+            -(rx * eyeX + rz * eyeZ), -eyeY, -(fx * eyeX + fz * eyeZ), 1.0f
+        };
+
+        const float nearZ = 0.5f, farZ = 1000.0f;
+        const float yScale = 1.0f / std::tan(0.5f * 0.25f * Pi); // Ӱ  fovY = pi/4
+        const float xScale = yScale / aspect;
+        const float range = farZ / (farZ - nearZ);
+        const float proj[16] =
+        {
+            xScale, 0.0f,   0.0f,            0.0f,
+            0.0f,   yScale, 0.0f,            0.0f,
+            0.0f,   0.0f,   range,           1.0f,
+            0.0f,   0.0f,   -nearZ * range,  0.0f
+        };
+
+        for (int r = 0; r < 4; ++r)
+            for (int c = 0; c < 4; ++c)
+                out[r * 4 + c] = view[r * 4 + 0] * proj[0 * 4 + c] + view[r * 4 + 1] * proj[1 * 4 + c] +
+                    view[r * 4 + 2] * proj[2 * 4 + c] + view[r * 4 + 3] * proj[3 * 4 + c];
+    }
+}
+
+namespace FrustumCullingBenchmark
+{
+    FrustumCullingBenchmarkResult Run(std::uint32_t objects, std::uint32_t views, std::uint32_t seed)
+    {
+        FrustumCullingBenchmarkResult result;
+        result.Objects = objects;
+        result.Views = views;
+
+        // 1. Ʈ:  ߽ɿ AABB  װ δ 
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-WorldHalfSize, WorldHalfSize);
+        std::uniform_real_distribution<float> extent(0.5f, 5.0f);
+
+        AabbSoA boxes;
+        SphereSoA spheres;
+        boxes.Reserve(objects);
+        spheres.Reserve(objects);
+        for (std::uint32_t i = 0; i < objects; ++i)
+        {
+            const float cx = position(rng), cy = position(rng), cz = position(rng);
+            const float ex = extent(rng), ey = extent(rng), ez = extent(rng);
+            boxes.Add(cx, cy, cz, ex, ey, ez);
+            spheres.Add(cx, cy, cz, std::sqrt(ex * ex + ey * ey + ez * ez));
+        }
+
+        // 2. ⸶ SIMD / Į  ð   
+        std::vector<std::uint32_t> visible, reference;
+        visible.reserve(objects);
+        reference.reserve(objects);
+
+        double aabbMs = 0.0, aabbScalarMs = 0.0, sphereMs = 0.0, sphereScalarMs = 0.0;
+        std::uint64_t visibleTotal = 0;
+        for (std::uint32_t v = 0; v < views; ++v)
+        {
+            float viewProj[16];
+            MakeViewProj(0.0f, 0.0f, 0.0f, 2.0f * Pi * (float)v / (float)std::max(1u, views), 16.0f / 9.0f, viewProj);
+
+            Frustum frustum;
+            FrustumCulling::ExtractPlanes(viewProj, frustum);
+
+            // AABB
+            Clock::time_point t0 = Clock::now();
+            FrustumCulling::CullAabbs(frustum, boxes, visible);
+            Clock::time_point t1 = Clock::now();
+
+            reference.clear();
+            for (std::uint32_t i = 0; i < objects; ++i)
+            {
+                if (FrustumCulling::TestAabb(frustum, boxes.CenterX[i], boxes.CenterY[i], boxes.CenterZ[i],
+                    boxes.ExtentX[i], boxes.ExtentY[i], boxes.ExtentZ[i]))
+                {
+                    reference.push_back(i);
+                }
+            }
+            Clock::time_point t2 = Clock::now();
+
+            aabbMs += ElapsedMs(t0, t1);
+            aabbScalarMs += ElapsedMs(t1, t2);
+            visibleTotal += visible.size();
+            if (visible != reference)
+                ++result.AabbMismatches;
+
+            // 
+            t0 = Clock::now();
+            FrustumCulling::CullSpheres(frustum, spheres, visible);
+            t1 = Clock::now();
+
+            reference.clear();
+            for (std::uint32_t i = 0; i < objects; ++i)
+            {
+                if (FrustumCulling::TestSphere(frustum, spheres.CenterX[i], spheres.CenterY[i], spheres.CenterZ[i], spheres.Radius[i]))
+                    reference.push_back(i);
+            }
+            t2 = Clock::now();
+
+            sphereMs += ElapsedMs(t0, t1);
+            sphereScalarMs += ElapsedMs(t1, t2);
+            if (visible != reference)
+                ++result.SphereMismatches;
+        }
+
+        const double viewCount = std::max(1u, views);
+        result.AabbMs = aabbMs / viewCount;
+        result.AabbScalarMs = aabbScalarMs / viewCount;
+        result.SphereMs = sphereMs / viewCount;
+        result.SphereScalarMs = sphereScalarMs / viewCount;
+        result.VisibleRatio = objects > 0 ? (double)visibleTotal / viewCount / objects : 0.0;
+
+        result.Valid = result.AabbMismatches == 0 && result.SphereMismatches == 0;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[FrustumCullingBenchmark]\n";
+        report += "  objects  aabb(ms)  scalar(ms)  sphere(ms)  scalar(ms)  visible(%)  valid\n";
+
+        // 8   ƴ  ϳ ( Į )
+        bool valid = true;
+        for (std::uint32_t count : { 10000u, 100000u, 100003u, 1000000u })
+        {
+            FrustumCullingBenchmarkResult r = Run(count, 16);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%9u %9.3f %11.3f %11.3f %11.3f %11.1f  %s\n",
+                r.Objects, r.AabbMs, r.AabbScalarMs, r.SphereMs, r.SphereScalarMs,
+                r.VisibleRatio * 100.0, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ü ø  (߿, 帮)
+//   1 km ü ȿ  Ʈ N  ī޶ ڸ  views  ø
+// (AABB / ٿ  , SIMD   vs ϳ Į )
+//  Ȯ: CullAabbs / CullSpheres  = TestAabb / TestSphere  ϳ θ  (ε  ״)
+// ==========================================================
+
+struct FrustumCullingBenchmarkResult
+{
+    std::uint32_t Objects = 0;
+    std::uint32_t Views = 0;
+
+    double AabbMs = 0.0;            // ø   ()
+    double AabbScalarMs = 0.0;
+    double SphereMs = 0.0;
+    double SphereScalarMs = 0.0;
+    double VisibleRatio = 0.0;      // AABB  
+
+    std::uint32_t AabbMismatches = 0;   //  ٸ  
+    std::uint32_t SphereMismatches = 0;
+    bool Valid = false;
+};
+
+namespace FrustumCullingBenchmark
+{
+    FrustumCullingBenchmarkResult Run(std::uint32_t objects, std::uint32_t views, std::uint32_t seed = 28);
+
+    // 10k / 100k / 1M Ʈ x 16 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -17,10 +17,11 @@ GameFramework::GameFramework(HINSTANCE hInstance)
 
 GameFramework::~GameFramework()
 {
-    if (md3dDevice != nullptr)
-        //   GPU      ( ȭ)
-        // δ FlushCommandQueue ؼ ȣؾ 
-        return;
+    JobSystem::GetInstance()->Shutdown();
+
+    //   GPU     
+    if (md3dDevice != nullptr && mCommandQueue != nullptr)
+        FlushCommandQueue();
 }
 
 //  ޽ ó
@@ -34,6 +35,7 @@ int GameFramework::Run()
     MSG msg = { 0 };
 
     mTimer.Reset(); 
+    PROFILE_THREAD("Main Thread");
 
     while (msg.message != WM_QUIT)
     {
@@ -48,6 +50,9 @@ int GameFramework::Run()
 
             if (!mAppPaused)
             {
+                PROFILE_FRAME();
+                PROFILE_SCOPE("Frame");
+
                 CalculateFrameStats(); 
 
                 Update(mTimer);
@@ -70,6 +75,9 @@ bool GameFramework::Initialize()
     if (!InitDirect3D())
         return false;
 
+    // Ŀ  (BVH    ۾)
+    JobSystem::GetInstance()->Initialize();
+
     OnResize();
 
     return true;
@@ -150,6 +158,9 @@ CreateCommandObjects();
 CreateSwapChain();
 CreateRtvAndDsvDescriptorHeaps();
 
+mGpuMemory = std::make_unique<GpuMemoryAllocator>(md3dDevice.Get());
+mUploadManager = std::make_unique<UploadManager>(md3dDevice.Get());
+
 return true;
 }
 
@@ -227,16 +238,8 @@ void GameFramework::OnResize()
     assert(mDirectCmdListAlloc);
 
     // 1. GPU  ҽ    ٸ (ϰ ϱ )
-    // ( Flush  )
-    mCurrentFence++;
-    mCommandQueue->Signal(mFence.Get(), mCurrentFence);
-    if (mFence->GetCompletedValue() < mCurrentFence)
-    {
-        HANDLE eventHandle = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-        mFence->SetEventOnCompletion(mCurrentFence, eventHandle);
-        WaitForSingleObject(eventHandle, INFINITE);
-        CloseHandle(eventHandle);
-    }
+    //    (      Ƿ )
+    FlushCommandQueue();
 
     // 2.  Ʈ ʱȭ
     ThrowIfFailed(mCommandList->Reset(mDirectCmdListAlloc.Get(), nullptr));
@@ -289,40 +292,26 @@ void GameFramework::OnResize()
     optClear.DepthStencil.Stencil = 0;
 
     // GPU ޸ Ҵ (Default Heap)
+    // ó Depth Write ·  ( ׷  ·  )
     CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
     ThrowIfFailed(md3dDevice->CreateCommittedResource(
         &heapProps,
         D3D12_HEAP_FLAG_NONE,
         &depthStencilDesc,
-        D3D12_RESOURCE_STATE_COMMON,
+        D3D12_RESOURCE_STATE_DEPTH_WRITE,
         &optClear,
         IID_PPV_ARGS(mDepthStencilBuffer.GetAddressOf())));
 
     // DSV  
     md3dDevice->CreateDepthStencilView(mDepthStencilBuffer.Get(), nullptr, mDepthStencilBufferHandle());
 
-    // ҽ   (Common -> Depth Write)
-    CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-        mDepthStencilBuffer.Get(),
-        D3D12_RESOURCE_STATE_COMMON,
-        D3D12_RESOURCE_STATE_DEPTH_WRITE);
-    mCommandList->ResourceBarrier(1, &barrier);
-
     // 7.    ݱ
     ThrowIfFailed(mCommandList->Close());
     ID3D12CommandList* cmdsLists[] = { mCommandList.Get() };
     mCommandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
 
     // 8. GPU ۾ Ϸ 
-    mCurrentFence++;
-    mCommandQueue->Signal(mFence.Get(), mCurrentFence);
-    if (mFence->GetCompletedValue() < mCurrentFence)
-    {
-        HANDLE eventHandle = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-        mFence->SetEventOnCompletion(mCurrentFence, eventHandle);
-        WaitForSingleObject(eventHandle, INFINITE);
-        CloseHandle(eventHandle);
-    }
+    FlushCommandQueue();
 
     // 9. Ʈ Ʈ
     mScreenViewport.TopLeftX = 0;
@@ -335,6 +324,29 @@ void GameFramework::OnResize()
     mScissorRect = { 0, 0, mClientWidth, mClientHeight };
 }
 
+void GameFramework::WaitForFence(UINT64 fenceValue)
+{
+    if (mFence->GetCompletedValue() >= fenceValue)
+        return;
+
+    HANDLE eventHandle = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (eventHandle == nullptr)
+    {
+        ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
+    }
+
+    ThrowIfFailed(mFence->SetEventOnCompletion(fenceValue, eventHandle));
+    WaitForSingleObject(eventHandle, INFINITE);
+    CloseHandle(eventHandle);
+}
+
+void GameFramework::FlushCommandQueue()
+{
+    mCurrentFence++;
+    ThrowIfFailed(mCommandQueue->Signal(mFence.Get(), mCurrentFence));
+    WaitForFence(mCurrentFence);
+}
+
 LRESULT GameFramework::MsgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
     switch (msg)
@@ -348,20 +360,20 @@ LRESULT GameFramework::MsgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam
 
 void GameFramework::CalculateFrameStats()
 {
-    static int frameCnt = 0;
-    static float timeElapsed = 0.0f;
-
-    frameCnt++;
+    mFrameStats.AddFrame(mTimer.PreciseDeltaTime());
 
-    if ((mTimer.TotalTime() - timeElapsed) >= 1.0f)
+    // â  1ʿ    (SetWindowText )
+    if ((mTimer.TotalTime() - mLastTitleUpdateTime) >= 1.0f)
     {
-        float fps = (float)frameCnt; 
-        float mspf = 1000.0f / fps;  
+        const FrameStats::Summary& stats = mFrameStats.GetSummary();
 
-        std::wstring windowText = L"Eclipse Walker Game    fps: " + std::to_wstring((int)fps);
+        wchar_t windowText[256];
+        swprintf_s(windowText,
+            L"Eclipse Walker Game    fps: %d   avg: %.2fms   p99: %.2fms   max: %.2fms   hitches: %llu",
+            (int)stats.Fps, stats.AvgMs, stats.P99Ms, stats.MaxMs,
+            (unsigned long long)stats.HitchCount);
 
-        SetWindowText(mhMainWnd, windowText.c_str());
-        frameCnt = 0;
-        timeElapsed += 1.0f;
+        SetWindowText(mhMainWnd, windowText);
+        mLastTitleUpdateTime = mTimer.TotalTime();
     }
 }
\ No newline at end of file
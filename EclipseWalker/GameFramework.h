@@ -1,6 +1,11 @@
 #pragma once
 #include "d3dUtil.h"
 #include "GameTimer.h" 
+#include "FrameStats.h"
+#include "Profiler.h"
+#include "JobSystem.h"
+#include "GpuMemoryAllocator.h"
+#include "UploadManager.h"
 
 #pragma comment(lib,"d3dcompiler.lib")
 #pragma comment(lib, "D3D12.lib")
@@ -18,6 +23,9 @@ protected:
 public:
     static GameFramework* GetApp();
 
+    //  ð  (, p50/p95/p99, ִ, ġ)
+    const FrameStats& GetFrameStats()const { return mFrameStats; }
+
     int Run();
     virtual bool Initialize();
     virtual LRESULT MsgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
@@ -37,6 +45,10 @@ protected:
     void CreateSwapChain();
     void CreateRtvAndDsvDescriptorHeaps();
 
+    // GPU fenceValue     / ݱ    
+    void WaitForFence(UINT64 fenceValue);
+    void FlushCommandQueue();
+
     void CalculateFrameStats();
 
 protected:
@@ -53,6 +65,8 @@ protected:
     UINT      m4xMsaaQuality = 0;
 
     GameTimer mTimer; 
+    FrameStats mFrameStats;
+    float mLastTitleUpdateTime = 0.0f; // â   ð
 
     ComPtr<IDXGIFactory4> mdxgiFactory;
     ComPtr<IDXGISwapChain> mSwapChain;
@@ -70,6 +84,12 @@ protected:
     ComPtr<ID3D12Resource> mSwapChainBuffer[SwapChainBufferCount];
     ComPtr<ID3D12Resource> mDepthStencilBuffer;
 
+    // /ε  ⺻  ۴ ⼭  Ҵ (ҽ Ŀ )
+    std::unique_ptr<GpuMemoryAllocator> mGpuMemory;
+
+    // ҽ ε  ť (mGpuMemory   ıǾ ϹǷ ڿ )
+    std::unique_ptr<UploadManager> mUploadManager;
+
     ComPtr<ID3D12DescriptorHeap> mRtvHeap;
     ComPtr<ID3D12DescriptorHeap> mDsvHeap;
 
@@ -1,39 +1,54 @@
 #include "GameTimer.h"
-#include <windows.h>
 
 GameTimer::GameTimer()
     : mSecondsPerCount(0.0), mDeltaTime(-1.0), mBaseTime(0),
-    mPausedTime(0), mPrevTime(0), mCurrTime(0), mStopped(false)
+    mPausedTime(0), mStopTime(0), mPrevTime(0), mCurrTime(0), mStopped(false)
 {
-    __int64 countsPerSec;
-    QueryPerformanceFrequency((LARGE_INTEGER*)&countsPerSec);
-    mSecondsPerCount = 1.0 / (double)countsPerSec;
+    // ƽ  ʷ  (duration_cast )
+    mSecondsPerCount = 1.0 / 1'000'000'000.0;
+}
+
+std::int64_t GameTimer::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
 }
 
 //    ð 
 float GameTimer::TotalTime()const
+{
+    return (float)PreciseTotalTime();
+}
+
+float GameTimer::DeltaTime()const
+{
+    return (float)mDeltaTime;
+}
+
+double GameTimer::PreciseTotalTime()const
 {
     if (mStopped)
     {
-        return (float)(((mStopTime - mPausedTime) - mBaseTime) * mSecondsPerCount);
+        return ((mStopTime - mPausedTime) - mBaseTime) * mSecondsPerCount;
     }
     else
     {
-        return (float)(((mCurrTime - mPausedTime) - mBaseTime) * mSecondsPerCount);
+        return ((mCurrTime - mPausedTime) - mBaseTime) * mSecondsPerCount;
     }
 }
 
-float GameTimer::DeltaTime()const
+double GameTimer::PreciseDeltaTime()const
 {
-    return (float)mDeltaTime;
+    return mDeltaTime;
 }
 
 void GameTimer::Reset()
 {
-    __int64 currTime;
-    QueryPerformanceCounter((LARGE_INTEGER*)&currTime);
+    std::int64_t currTime = Now();
 
     mBaseTime = currTime;
+    mCurrTime = currTime;
+    mPausedTime = 0;
     mPrevTime = currTime;
     mStopTime = 0;
     mStopped = false;
@@ -41,8 +56,7 @@ void GameTimer::Reset()
 
 void GameTimer::Start()
 {
-    __int64 startTime;
-    QueryPerformanceCounter((LARGE_INTEGER*)&startTime);
+    std::int64_t startTime = Now();
 
     if (mStopped)
     {
@@ -57,9 +71,7 @@ void GameTimer::Stop()
 {
     if (!mStopped)
     {
-        __int64 currTime;
-        QueryPerformanceCounter((LARGE_INTEGER*)&currTime);
-        mStopTime = currTime;
+        mStopTime = Now();
         mStopped = true;
     }
 }
@@ -72,9 +84,7 @@ void GameTimer::Tick()
         return;
     }
 
-    __int64 currTime;
-    QueryPerformanceCounter((LARGE_INTEGER*)&currTime);
-    mCurrTime = currTime;
+    mCurrTime = Now();
 
     //  ð -  ð = Ÿ Ÿ
     mDeltaTime = (mCurrTime - mPrevTime) * mSecondsPerCount;
@@ -1,28 +1,39 @@
 #pragma once
-#include <windows.h>
+#include <chrono>
+#include <cstdint>
 
+// ÷  Ÿ̸
+// std::chrono::steady_clock  (Windows QPC, Linux clock_gettime(CLOCK_MONOTONIC) )
 class GameTimer
 {
 public:
+    using Clock = std::chrono::steady_clock;
+
     GameTimer();
 
     float TotalTime()const; //     帥 ð ()
     float DeltaTime()const; //  Ӻ  ӱ ɸ ð ()
 
+    // е ʿ ( , Ϸ)  double 
+    double PreciseTotalTime()const;
+    double PreciseDeltaTime()const;
+
     void Reset(); // Ÿ̸ 
     void Start(); // Ÿ̸  (Ͻ )
     void Stop();  // Ÿ̸ Ͻ
     void Tick();  //  Ӹ ȣؼ ð 
 
 private:
+    static std::int64_t Now(); //  ð (  ƽ)
+
     double mSecondsPerCount;
     double mDeltaTime;
 
-    __int64 mBaseTime;
-    __int64 mPausedTime;
-    __int64 mStopTime;
-    __int64 mPrevTime;
-    __int64 mCurrTime;
+    std::int64_t mBaseTime;
+    std::int64_t mPausedTime;
+    std::int64_t mStopTime;
+    std::int64_t mPrevTime;
+    std::int64_t mCurrTime;
 
     bool mStopped;
-};
\ No newline at end of file
+};
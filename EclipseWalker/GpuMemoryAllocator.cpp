@@ -0,0 +1,190 @@
+#include "GpuMemoryAllocator.h"
+#include "TlsfAllocator.h"
+#include <algorithm>
+
+GpuMemoryAllocator::GpuMemoryAllocator(ID3D12Device* device, UINT64 heapSize)
+    : mDevice(device)
+{
+    //  ũ 64KB(ġ ҽ ) 
+    const UINT64 align = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    mHeapSize = (heapSize + align - 1) & ~(align - 1);
+}
+
+std::uint32_t GpuMemoryAllocator::CreateHeap(GpuMemoryCategory category, UINT64 size)
+{
+    CategoryStats& stats = mStats[(int)category];
+    if (stats.ReservedBytes + size > stats.Budget)
+        return UINT32_MAX;
+
+    Heap heap;
+    heap.Category = category;
+
+    D3D12_HEAP_DESC heapDesc = {};
+    heapDesc.SizeInBytes = size;
+    heapDesc.Properties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
+    heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+
+    if (FAILED(mDevice->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap.D3DHeap))))
+        return UINT32_MAX;
+
+    //  ü   ϳ ( Ҵ   )
+    auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(size);
+    ThrowIfFailed(mDevice->CreatePlacedResource(
+        heap.D3DHeap.Get(),
+        0,
+        &bufferDesc,
+        D3D12_RESOURCE_STATE_COMMON,
+        nullptr,
+        IID_PPV_ARGS(&heap.Buffer)));
+
+    heap.Allocator = std::make_unique<TlsfAllocator>(size);
+
+    stats.ReservedBytes += size;
+    stats.HeapCount++;
+
+    // ݳ ĭ  
+    for (std::uint32_t i = 0; i < (std::uint32_t)mHeaps.size(); ++i)
+    {
+        if (mHeaps[i].D3DHeap == nullptr)
+        {
+            mHeaps[i] = std::move(heap);
+            return i;
+        }
+    }
+
+    mHeaps.push_back(std::move(heap));
+    return (std::uint32_t)mHeaps.size() - 1;
+}
+
+GpuBufferAllocation GpuMemoryAllocator::MakeAllocation(std::uint32_t heapIndex, const OffsetAllocation& offset)const
+{
+    const Heap& heap = mHeaps[heapIndex];
+
+    GpuBufferAllocation allocation;
+    allocation.Resource = heap.Buffer.Get();
+    allocation.Offset = offset.Offset;
+    allocation.Size = offset.Size;
+    allocation.Alignment = offset.Alignment;
+    allocation.GpuAddress = heap.Buffer->GetGPUVirtualAddress() + offset.Offset;
+    allocation.Category = heap.Category;
+    allocation.HeapIndex = heapIndex;
+    allocation.Handle = offset.Handle;
+    return allocation;
+}
+
+GpuBufferAllocation GpuMemoryAllocator::Allocate(GpuMemoryCategory category, UINT64 size, UINT64 alignment)
+{
+    // 1.  īװ   
+    for (std::uint32_t i = 0; i < (std::uint32_t)mHeaps.size(); ++i)
+    {
+        Heap& heap = mHeaps[i];
+        if (heap.D3DHeap == nullptr || heap.Category != category)
+            continue;
+
+        OffsetAllocation offset = heap.Allocator->Allocate(size, alignment);
+        if (offset.IsValid())
+        {
+            mStats[(int)category].UsedBytes += offset.Size;
+            mStats[(int)category].AllocationCount++;
+            return MakeAllocation(i, offset);
+        }
+    }
+
+    // 2.   (⺻ ũ⺸ ū û  ´ ũ)
+    const UINT64 align = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    const UINT64 heapSize = std::max(mHeapSize, (size + alignment + align - 1) & ~(align - 1));
+
+    std::uint32_t heapIndex = CreateHeap(category, heapSize);
+    if (heapIndex == UINT32_MAX)
+        return GpuBufferAllocation();
+
+    OffsetAllocation offset = mHeaps[heapIndex].Allocator->Allocate(size, alignment);
+    if (!offset.IsValid())
+        return GpuBufferAllocation();
+
+    mStats[(int)category].UsedBytes += offset.Size;
+    mStats[(int)category].AllocationCount++;
+    return MakeAllocation(heapIndex, offset);
+}
+
+void GpuMemoryAllocator::Free(GpuBufferAllocation& allocation)
+{
+    if (!allocation.IsValid())
+        return;
+
+    Heap& heap = mHeaps[allocation.HeapIndex];
+    heap.Allocator->Free(allocation.Handle);
+
+    CategoryStats& stats = mStats[(int)heap.Category];
+    stats.UsedBytes -= allocation.Size;
+    stats.AllocationCount--;
+
+    allocation = GpuBufferAllocation();
+}
+
+std::vector<GpuDefragMove> GpuMemoryAllocator::PlanDefragment(GpuMemoryCategory category, UINT64 maxBytes)
+{
+    std::vector<GpuDefragMove> moves;
+    UINT64 plannedBytes = 0;
+
+    //    Ҵ  ڸ Űܺ
+    for (std::uint32_t h = (std::uint32_t)mHeaps.size(); h-- > 0;)
+    {
+        Heap& heap = mHeaps[h];
+        if (heap.D3DHeap == nullptr || heap.Category != category)
+            continue;
+
+        std::vector<OffsetAllocation> live;
+        heap.Allocator->ForEachAllocation([&](const OffsetAllocation& a) { live.push_back(a); });
+
+        for (auto it = live.rbegin(); it != live.rend() && plannedBytes < maxBytes; ++it)
+        {
+            //  ڸ  ķ ƺ ( ȣ, )    ƴϸ ǵ
+            for (std::uint32_t t = 0; t <= h; ++t)
+            {
+                Heap& target = mHeaps[t];
+                if (target.D3DHeap == nullptr || target.Category != category)
+                    continue;
+
+                OffsetAllocation dst = target.Allocator->Allocate(it->Size, it->Alignment);
+                if (!dst.IsValid())
+                    continue;
+
+                if (t < h || dst.Offset < it->Offset)
+                {
+                    mStats[(int)category].UsedBytes += dst.Size;
+                    mStats[(int)category].AllocationCount++;
+
+                    GpuDefragMove move;
+                    move.From = MakeAllocation(h, *it);
+                    move.To = MakeAllocation(t, dst);
+                    moves.push_back(move);
+                    plannedBytes += it->Size;
+                }
+                else
+                {
+                    target.Allocator->Free(dst.Handle);
+                }
+                break;
+            }
+        }
+    }
+
+    return moves;
+}
+
+void GpuMemoryAllocator::ReleaseEmptyHeaps()
+{
+    for (Heap& heap : mHeaps)
+    {
+        if (heap.D3DHeap == nullptr || heap.Allocator->GetAllocationCount() != 0)
+            continue;
+
+        CategoryStats& stats = mStats[(int)heap.Category];
+        stats.ReservedBytes -= heap.Allocator->GetCapacity();
+        stats.HeapCount--;
+
+        heap = Heap();
+    }
+}
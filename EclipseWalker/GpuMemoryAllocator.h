@@ -0,0 +1,95 @@
+#pragma once
+#include "d3dUtil.h"
+#include "OffsetAllocator.h"
+#include <memory>
+
+// ==========================================================
+// ⺻ (Default Heap)   Ҵ
+// - ū ID3D12Heap    ü  ġ(placed)  ϳ ø 
+//      OffsetAllocator(TLSF) 
+//   -> ޽ CreateCommittedResource  
+// - 뵵(īװ)   ΰ   Ҵ 
+// -  : PlanDefragment() ű  ָ ȣ ʿ GPU  
+//    ٲٰ CompleteDefragMove()  ڸ ȯ
+// ۴ COMMON · ΰ Ͻ °/迡 ñ ( -> COPY_DEST, ׸ -> б )
+// ==========================================================
+
+enum class GpuMemoryCategory : std::uint8_t
+{
+    Geometry,   //  /ε
+    Streaming,  // Ʈ   
+    Misc,
+    Count
+};
+
+struct GpuBufferAllocation
+{
+    ID3D12Resource* Resource = nullptr;
+    UINT64 Offset = 0;
+    UINT64 Size = 0;
+    UINT64 Alignment = 0; // Allocate  ѱ 
+    D3D12_GPU_VIRTUAL_ADDRESS GpuAddress = 0;
+
+    GpuMemoryCategory Category = GpuMemoryCategory::Misc;
+    std::uint32_t HeapIndex = 0;
+    std::uint32_t Handle = OffsetAllocation::InvalidHandle;
+
+    bool IsValid()const { return Handle != OffsetAllocation::InvalidHandle; }
+};
+
+struct GpuDefragMove
+{
+    GpuBufferAllocation From;
+    GpuBufferAllocation To;
+};
+
+class GpuMemoryAllocator
+{
+public:
+    struct CategoryStats
+    {
+        UINT64 Budget = UINT64_MAX;
+        UINT64 UsedBytes = 0;     // Ҵ ũ 
+        UINT64 ReservedBytes = 0; //    ũ 
+        std::uint32_t HeapCount = 0;
+        std::uint32_t AllocationCount = 0;
+    };
+
+    GpuMemoryAllocator(ID3D12Device* device, UINT64 heapSize = 64ull << 20);
+    GpuMemoryAllocator(const GpuMemoryAllocator& rhs) = delete;
+    GpuMemoryAllocator& operator=(const GpuMemoryAllocator& rhs) = delete;
+
+    //  ෮   (⺻ )
+    void SetBudget(GpuMemoryCategory category, UINT64 bytes) { mStats[(int)category].Budget = bytes; }
+    const CategoryStats& GetStats(GpuMemoryCategory category)const { return mStats[(int)category]; }
+
+    //  Ѱų    IsValid() == false
+    GpuBufferAllocation Allocate(GpuMemoryCategory category, UINT64 size, UINT64 alignment = 256);
+    void Free(GpuBufferAllocation& allocation);
+
+    //   ( Ҵ  ڸ). maxBytes ŭ ȹ
+    std::vector<GpuDefragMove> PlanDefragment(GpuMemoryCategory category, UINT64 maxBytes);
+    void CompleteDefragMove(GpuDefragMove& move) { Free(move.From); }
+
+    //  ִ  ݳ (   , GPU    Ȯ )
+    void ReleaseEmptyHeaps();
+
+private:
+    struct Heap
+    {
+        ComPtr<ID3D12Heap> D3DHeap;
+        ComPtr<ID3D12Resource> Buffer;
+        std::unique_ptr<OffsetAllocator> Allocator;
+        GpuMemoryCategory Category = GpuMemoryCategory::Misc;
+    };
+
+    std::uint32_t CreateHeap(GpuMemoryCategory category, UINT64 size);
+    GpuBufferAllocation MakeAllocation(std::uint32_t heapIndex, const OffsetAllocation& offset)const;
+
+private:
+    ID3D12Device* mDevice = nullptr;
+    UINT64 mHeapSize = 0;
+
+    std::vector<Heap> mHeaps; // ݳ ĭ D3DHeap == nullptr (ε )
+    CategoryStats mStats[(int)GpuMemoryCategory::Count];
+};
@@ -0,0 +1,153 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdio>
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+void JobSystem::Initialize(std::uint32_t workerCount)
+{
+    if (!mWorkers.empty())
+        return;
+
+    if (workerCount == 0)
+    {
+        std::uint32_t cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 1;
+    }
+
+    mQuit = false;
+    for (std::uint32_t i = 0; i < workerCount; ++i)
+        mWorkers.emplace_back(&JobSystem::WorkerLoop, this, i);
+}
+
+void JobSystem::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mQuit = true;
+    }
+    mWakeUp.notify_all();
+
+    for (std::thread& worker : mWorkers)
+        worker.join();
+    mWorkers.clear();
+}
+
+void JobSystem::Run(JobCounter& counter, std::function<void()> job)
+{
+    counter.Pending.fetch_add(1, std::memory_order_relaxed);
+
+    // Ŀ  (ʱȭ ) ׳ ٷ 
+    if (mWorkers.empty())
+    {
+        Job inlineJob{ std::move(job), &counter };
+        Execute(inlineJob);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mQueue.push_back(Job{ std::move(job), &counter });
+    }
+    mWakeUp.notify_one();
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    //   ť ִ ۾  ó
+    while (!counter.IsDone())
+    {
+        if (!TryRunOne())
+            std::this_thread::yield();
+    }
+}
+
+void JobSystem::ParallelFor(std::uint32_t count, std::uint32_t grain,
+    const std::function<void(std::uint32_t begin, std::uint32_t end)>& func)
+{
+    if (count == 0)
+        return;
+
+    grain = std::max(grain, 1u);
+    const std::uint32_t chunkCount = (count + grain - 1) / grain;
+
+    if (chunkCount == 1 || mWorkers.empty())
+    {
+        func(0, count);
+        return;
+    }
+
+    //  ȣ  ϳ   (  尡   )
+    std::atomic<std::uint32_t> nextChunk{ 0 };
+    auto drain = [&]()
+    {
+        for (;;)
+        {
+            std::uint32_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunkCount)
+                break;
+
+            std::uint32_t begin = chunk * grain;
+            std::uint32_t end = std::min(begin + grain, count);
+            func(begin, end);
+        }
+    };
+
+    JobCounter counter;
+    const std::uint32_t helpers = std::min(chunkCount - 1, (std::uint32_t)mWorkers.size());
+    for (std::uint32_t i = 0; i < helpers; ++i)
+        Run(counter, drain);
+
+    drain();
+    Wait(counter);
+}
+
+bool JobSystem::TryRunOne()
+{
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (mQueue.empty())
+            return false;
+
+        job = std::move(mQueue.front());
+        mQueue.pop_front();
+    }
+
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Execute(Job& job)
+{
+    job.Func();
+    job.Counter->Pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void JobSystem::WorkerLoop(std::uint32_t index)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "Worker %u", index);
+    PROFILE_THREAD(name);
+
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            mWakeUp.wait(lock, [this]() { return mQuit || !mQueue.empty(); });
+
+            if (mQuit && mQueue.empty())
+                return;
+
+            job = std::move(mQueue.front());
+            mQueue.pop_front();
+        }
+
+        Execute(job);
+    }
+}
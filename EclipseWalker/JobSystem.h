@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ==========================================================
+//  Ŀ  Ǯ
+// - Run() ۾  JobCounter   ٸ
+// - ٸ 嵵 ť  ۾  óϹǷ ۾ ȿ  ۾   
+// - ParallelFor() [0, count) grain  ߶ Ŀ  
+// ==========================================================
+
+//  ۾  (0 Ǹ )
+struct JobCounter
+{
+    std::atomic<std::uint32_t> Pending{ 0 };
+
+    bool IsDone()const { return Pending.load(std::memory_order_acquire) == 0; }
+};
+
+class JobSystem
+{
+public:
+    static JobSystem* GetInstance()
+    {
+        static JobSystem instance;
+        return &instance;
+    }
+
+    // workerCount = 0 ̸ (ھ  - 1)
+    void Initialize(std::uint32_t workerCount = 0);
+    void Shutdown();
+
+    // ȣ     
+    std::uint32_t GetThreadCount()const { return (std::uint32_t)mWorkers.size() + 1; }
+
+    void Run(JobCounter& counter, std::function<void()> job);
+    void Wait(JobCounter& counter);
+
+    // func(begin, end)  ķ ȣϰ    ٸ
+    void ParallelFor(std::uint32_t count, std::uint32_t grain,
+        const std::function<void(std::uint32_t begin, std::uint32_t end)>& func);
+
+private:
+    JobSystem() = default;
+    ~JobSystem();
+
+    struct Job
+    {
+        std::function<void()> Func;
+        JobCounter* Counter = nullptr;
+    };
+
+    void WorkerLoop(std::uint32_t index);
+    bool TryRunOne();
+    static void Execute(Job& job);
+
+private:
+    std::vector<std::thread> mWorkers;
+
+    std::mutex mLock;
+    std::condition_variable mWakeUp;
+    std::deque<Job> mQueue;
+    bool mQuit = false;
+};
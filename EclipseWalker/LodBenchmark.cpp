@@ -0,0 +1,187 @@
+#include "LodBenchmark.h"
+#include "LodSelection.h"
+#include "MeshSimplifier.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    // PosNormalTex  (ó ϸϰ )
+    MeshCookSource MakeGrid(std::uint32_t gridSize)
+    {
+        struct Vertex
+        {
+            float Pos[3];
+            float Normal[3];
+            float TexC[2];
+        };
+
+        std::vector<Vertex> vertices;
+        vertices.reserve((std::size_t)gridSize * gridSize);
+        for (std::uint32_t z = 0; z < gridSize; ++z)
+        {
+            for (std::uint32_t x = 0; x < gridSize; ++x)
+            {
+                Vertex v = {};
+                v.Pos[0] = (float)x;
+                v.Pos[1] = 2.0f * std::sin(x * 0.05f) * std::cos(z * 0.07f);
+                v.Pos[2] = (float)z;
+                v.Normal[1] = 1.0f;
+                v.TexC[0] = (float)x / gridSize;
+                v.TexC[1] = (float)z / gridSize;
+                vertices.push_back(v);
+            }
+        }
+
+        MeshCookSource source;
+        source.VertexLayout = MeshFormat::VertexFormat::PosNormalTex;
+        source.Vertices.resize(vertices.size() * sizeof(Vertex));
+        memcpy(source.Vertices.data(), vertices.data(), source.Vertices.size());
+
+        for (std::uint32_t z = 0; z + 1 < gridSize; ++z)
+        {
+            for (std::uint32_t x = 0; x + 1 < gridSize; ++x)
+            {
+                const std::uint32_t a = z * gridSize + x, b = a + 1, c = a + gridSize, d = c + 1;
+                source.Indices.insert(source.Indices.end(), { a, c, b, b, c, d });
+            }
+        }
+        return source;
+    }
+}
+
+namespace LodBenchmark
+{
+    LodSimplifyBenchmarkResult RunSimplify(std::uint32_t gridSize)
+    {
+        LodSimplifyBenchmarkResult result;
+
+        MeshCookSource source = MakeGrid(gridSize);
+        result.Triangles = (std::uint32_t)(source.Indices.size() / 3);
+
+        const LodChainReport report = MeshSimplifier::GenerateLods(source);
+        result.LodCount = report.LodCount;
+        result.LastLodTriangles = report.Triangles[report.LodCount - 1];
+        result.LastLodError = report.Error[report.LodCount - 1];
+        result.SimplifyMs = report.SimplifyMs;
+        return result;
+    }
+
+    LodSelectBenchmarkResult RunSelect(std::uint32_t instanceCount)
+    {
+        LodSelectBenchmarkResult result;
+        result.Instances = instanceCount;
+
+        // 1. ޽ ϳ (LOD 4,  1  ü )
+        std::vector<LodMeshInfo> meshes(1);
+        meshes[0].LodCount = 4;
+        meshes[0].Error[1] = 0.01f;
+        meshes[0].Error[2] = 0.04f;
+        meshes[0].Error[3] = 0.15f;
+
+        // 2. 1km x 1km   
+        TransformStorage transforms;
+        transforms.Reserve(instanceCount);
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> coord(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+
+        std::vector<std::uint32_t> objects(instanceCount);
+        for (std::uint32_t i = 0; i < instanceCount; ++i)
+        {
+            EntityId e = transforms.Create(coord(rng), 0.0f, coord(rng), 0);
+            const float s = scale(rng);
+            transforms.SetScale(e, s, s, s);
+            transforms.SetLocalExtent(e, 1.0f, 1.0f, 1.0f);
+            objects[i] = transforms.GetIndex(e);
+        }
+        transforms.UpdateWorld();
+
+        // 3. ī޶ 0.5  յڷ   (1080p, 45)
+        LodSelectParams params;
+        params.ProjectionScale = LodSelection::ComputeProjectionScale(0.25f * 3.14159265f, 1080.0f);
+        params.CameraY = 2.0f;
+
+        LodSelectParams noHysteresis = params;
+        noHysteresis.Hysteresis = 0.0f;
+
+        TransformStorage reference = transforms;
+        std::vector<std::uint8_t> previous(instanceCount, 0), previousReference(instanceCount, 0);
+
+        const int frames = 32;
+        double totalMs = 0.0;
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            const float offset = (frame & 1) ? 0.5f : -0.5f;
+            params.CameraZ = noHysteresis.CameraZ = offset;
+
+            auto t0 = Clock::now();
+            LodSelection::SelectLods(params, meshes, transforms, objects);
+            auto t1 = Clock::now();
+            totalMs += ElapsedMs(t0, t1);
+
+            LodSelection::SelectLods(noHysteresis, meshes, reference, objects);
+
+            for (std::uint32_t i = 0; i < instanceCount; ++i)
+            {
+                const std::uint8_t lod = (std::uint8_t)transforms.GetLod(objects[i]);
+                const std::uint8_t referenceLod = (std::uint8_t)reference.GetLod(objects[i]);
+                if (frame > 0)
+                {
+                    result.SwitchesWithHysteresis += lod != previous[i];
+                    result.SwitchesWithout += referenceLod != previousReference[i];
+                }
+                previous[i] = lod;
+                previousReference[i] = referenceLod;
+            }
+        }
+        result.SelectMs = totalMs / frames;
+
+        for (std::uint32_t i = 0; i < instanceCount; ++i)
+            ++result.LodHistogram[std::min(transforms.GetLod(objects[i]), 3u)];
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[LodBenchmark]\n";
+        report += "      tris  lods  last tris  last err  simplify(ms)\n";
+
+        const std::uint32_t sizes[] = { 128, 256 };
+        for (std::uint32_t size : sizes)
+        {
+            LodSimplifyBenchmarkResult r = RunSimplify(size);
+
+            char line[128];
+            snprintf(line, sizeof(line), "%10u %5u %10u %9.4f %13.1f\n",
+                r.Triangles, r.LodCount, r.LastLodTriangles, r.LastLodError, r.SimplifyMs);
+            report += line;
+        }
+
+        LodSelectBenchmarkResult s = RunSelect(100000);
+        char line[224];
+        snprintf(line, sizeof(line),
+            "  select %u instances: %.3f ms, lod0-3 %u/%u/%u/%u, switches over 31 jitter frames: %llu (hysteresis) vs %llu (none)\n",
+            s.Instances, s.SelectMs,
+            s.LodHistogram[0], s.LodHistogram[1], s.LodHistogram[2], s.LodHistogram[3],
+            (unsigned long long)s.SwitchesWithHysteresis, (unsigned long long)s.SwitchesWithout);
+        report += line;
+
+        // ð  ǥ Ʋ  ִ  
+        if (allValid)
+            *allValid = true;
+        return report;
+    }
+}
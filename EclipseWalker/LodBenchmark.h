@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// LOD   (߿)
+// 1. ܼȭ:   ޽ LOD ü  ð
+// 2. : νϽ N   LodSelection::SelectLods   ð
+//    ī޶ յڷ ݾ 鼭 LOD  ٲ Ƚ ׸ý  
+// ==========================================================
+
+struct LodSimplifyBenchmarkResult
+{
+    std::uint32_t Triangles = 0;
+    std::uint32_t LodCount = 0;
+    std::uint32_t LastLodTriangles = 0;
+    float LastLodError = 0.0f;
+    double SimplifyMs = 0.0;
+};
+
+struct LodSelectBenchmarkResult
+{
+    std::uint32_t Instances = 0;
+    double SelectMs = 0.0;              //   ()
+    std::uint32_t LodHistogram[4] = {};
+    std::uint64_t SwitchesWithHysteresis = 0;
+    std::uint64_t SwitchesWithout = 0;
+};
+
+namespace LodBenchmark
+{
+    LodSimplifyBenchmarkResult RunSimplify(std::uint32_t gridSize);
+    LodSelectBenchmarkResult RunSelect(std::uint32_t instanceCount);
+
+    // 128 / 256 , νϽ 100k
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,74 @@
+#include "LodSelection.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // ī޶  ȿ   Ÿ (  LOD)
+    constexpr float MinDistance = 1e-3f;
+}
+
+namespace LodSelection
+{
+    float ComputeProjectionScale(float fovY, float viewportHeight)
+    {
+        return viewportHeight / (2.0f * std::tan(0.5f * fovY));
+    }
+
+    std::uint32_t SelectLod(const LodMeshInfo& mesh, float worldScale, float distance,
+        std::uint32_t currentLod, const LodSelectParams& params)
+    {
+        const std::uint32_t lodCount = std::max(mesh.LodCount, 1u);
+        const std::uint32_t current = std::min(currentLod, lodCount - 1);
+
+        // 1.  Ÿ Ǵ   
+        const float pixelsPerUnit = worldScale * params.ProjectionScale;
+        if (pixelsPerUnit <= 0.0f)
+            return lodCount - 1;
+        const float budget = params.ThresholdPixels * std::max(distance, MinDistance) / pixelsPerUnit;
+
+        // 2.  ġ   ģ LOD
+        std::uint32_t target = 0;
+        for (std::uint32_t lod = lodCount - 1; lod > 0; --lod)
+        {
+            if (mesh.Error[lod] <= budget)
+            {
+                target = lod;
+                break;
+            }
+        }
+
+        // 3. ĥ    
+        if (target > current)
+        {
+            const float strictBudget = budget * (1.0f - params.Hysteresis);
+            while (target > current && mesh.Error[target] > strictBudget)
+                --target;
+        }
+        return target;
+    }
+
+    void SelectLods(const LodSelectParams& params, const std::vector<LodMeshInfo>& meshes,
+        TransformStorage& transforms, const std::vector<std::uint32_t>& objects)
+    {
+        const AabbSoA& bounds = transforms.GetWorldBounds();
+
+        for (std::uint32_t index : objects)
+        {
+            const LodMeshInfo& mesh = meshes[transforms.GetMeshId(index)];
+            if (mesh.LodCount <= 1)
+            {
+                transforms.SetLod(index, 0);
+                continue;
+            }
+
+            const float dx = bounds.CenterX[index] - params.CameraX;
+            const float dy = bounds.CenterY[index] - params.CameraY;
+            const float dz = bounds.CenterZ[index] - params.CameraZ;
+            const float ex = bounds.ExtentX[index], ey = bounds.ExtentY[index], ez = bounds.ExtentZ[index];
+
+            const float distance = std::sqrt(dx * dx + dy * dy + dz * dz) - std::sqrt(ex * ex + ey * ey + ez * ez);
+            transforms.SetLod(index, SelectLod(mesh, transforms.GetMaxScale(index), distance, transforms.GetLod(index), params));
+        }
+    }
+}
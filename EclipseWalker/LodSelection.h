@@ -0,0 +1,41 @@
+#pragma once
+#include "MeshFormat.h"
+#include "TransformStorage.h"
+#include <vector>
+
+// ==========================================================
+// Ʈ LOD  (ȭ  )
+// ȼ  = LOD () * ִ  * ProjectionScale / Ÿ
+//   ProjectionScale = Ʈ  / (2 * tan(fovY / 2))  (Ÿ 1  1    ȼ)
+//   Ÿ = ī޶󿡼  AABB  δ  ǥ (ȿ   ٰ )
+//  ThresholdPixels   ģ LOD  
+// ׸ý:  ģ LOD    Threshold * (1 - Hysteresis)   
+//   ( Ÿ   ٲ Ƣ  ,   LOD δ ٷ ö)
+// ==========================================================
+
+struct LodMeshInfo
+{
+    std::uint32_t LodCount = 1;
+    float Error[MeshFormat::MaxLods] = {}; // ŷ Lod::Error (  Ÿ)
+};
+
+struct LodSelectParams
+{
+    float CameraX = 0.0f, CameraY = 0.0f, CameraZ = 0.0f;
+    float ProjectionScale = 1.0f;
+    float ThresholdPixels = 1.0f;
+    float Hysteresis = 0.25f;
+};
+
+namespace LodSelection
+{
+    float ComputeProjectionScale(float fovY, float viewportHeight);
+
+    std::uint32_t SelectLod(const LodMeshInfo& mesh, float worldScale, float distance,
+        std::uint32_t currentLod, const LodSelectParams& params);
+
+    // objects( ε) TransformStorage  LOD  
+    // meshes  ޽ ȣ ε
+    void SelectLods(const LodSelectParams& params, const std::vector<LodMeshInfo>& meshes,
+        TransformStorage& transforms, const std::vector<std::uint32_t>& objects);
+}
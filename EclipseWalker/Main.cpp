@@ -1,4 +1,63 @@
 #include "EclipseWalkerGame.h"
+#include "MeshCooker.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+
+//     ("..."    ϳ)
+static std::vector<std::string> SplitCommandLine(const char* cmdLine)
+{
+    std::vector<std::string> args;
+    std::string current;
+    bool quoted = false, hasToken = false;
+
+    for (const char* c = cmdLine; *c != '\0'; ++c)
+    {
+        if (*c == '"')
+        {
+            quoted = !quoted;
+            hasToken = true;
+        }
+        else if ((*c == ' ' || *c == '\t') && !quoted)
+        {
+            if (hasToken)
+                args.push_back(current);
+            current.clear();
+            hasToken = false;
+        }
+        else
+        {
+            current += *c;
+            hasToken = true;
+        }
+    }
+    if (hasToken)
+        args.push_back(current);
+
+    return args;
+}
+
+//  ŷ: EclipseWalker.exe -cook <Է.obj> <.ewmesh> [<Է.obj> <.ewmesh> ...]
+// â  ʰ . ϸ  â   1 ȯ
+static int RunMeshCooker(const std::vector<std::string>& args)
+{
+    int result = 0;
+    for (std::size_t i = 1; i + 1 < args.size(); i += 2)
+    {
+        std::string error;
+        MeshOptimizeReport report;
+        LodChainReport lodReport;
+        if (MeshCooker::CookObjFile(args[i], args[i + 1], &error, &report, &lodReport))
+        {
+            OutputDebugStringA(("cooked " + args[i + 1] + " (" + report.ToString() + ", " + lodReport.ToString() + ")\n").c_str());
+        }
+        else
+        {
+            OutputDebugStringA(("cook failed " + args[i] + ": " + error + "\n").c_str());
+            result = 1;
+        }
+    }
+    return result;
+}
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE prevInstance,
     PSTR cmdLine, int showCmd)
@@ -8,6 +67,10 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE prevInstance,
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif
 
+    std::vector<std::string> args = SplitCommandLine(cmdLine);
+    if (!args.empty() && args[0] == "-cook")
+        return RunMeshCooker(args);
+
     try
     {
         //  ü 
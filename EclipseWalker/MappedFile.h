@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// б  ޸  
+//   о  ʰ  ޸𸮿 Ḹ  ( ó   )
+// Windows: CreateFileMapping / MapViewOfFile,  : mmap
+// ==========================================================
+
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile& rhs) = delete;
+    MappedFile& operator=(const MappedFile& rhs) = delete;
+    MappedFile(MappedFile&& rhs) noexcept;
+    MappedFile& operator=(MappedFile&& rhs) noexcept;
+    ~MappedFile() { Close(); }
+
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen()const { return mData != nullptr; }
+    const std::uint8_t* GetData()const { return mData; }
+    std::size_t GetSize()const { return mSize; }
+
+private:
+    const std::uint8_t* mData = nullptr;
+    std::size_t mSize = 0;
+
+#if defined(_WIN32)
+    void* mFile = nullptr;    // HANDLE
+    void* mMapping = nullptr; // HANDLE
+#else
+    int mFile = -1;
+#endif
+};
@@ -0,0 +1,481 @@
+#include "MeshCooker.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "VertexCompression.h"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+namespace
+{
+    struct ObjCorner
+    {
+        int Position = 0;
+        int TexCoord = 0;
+        int Normal = 0;
+    };
+
+    struct ObjCornerHash
+    {
+        std::size_t operator()(const ObjCorner& c)const
+        {
+            return ((std::size_t)c.Position * 73856093u) ^ ((std::size_t)c.TexCoord * 19349663u) ^ ((std::size_t)c.Normal * 83492791u);
+        }
+    };
+
+    bool operator==(const ObjCorner& a, const ObjCorner& b)
+    {
+        return a.Position == b.Position && a.TexCoord == b.TexCoord && a.Normal == b.Normal;
+    }
+
+    // PosNormalTex   ġ (VertexTypes::VertexPosNormalTex)
+    struct CookVertex
+    {
+        float Pos[3];
+        float Normal[3];
+        float TexC[2];
+    };
+    static_assert(sizeof(CookVertex) == 32, "CookVertex must match VertexPosNormalTex");
+
+    //   ȿ ū б
+    struct LineReader
+    {
+        const char* Cur;
+        const char* End;
+
+        void SkipSpaces()
+        {
+            while (Cur < End && (*Cur == ' ' || *Cur == '\t'))
+                ++Cur;
+        }
+
+        bool ReadFloat(float& value)
+        {
+            SkipSpaces();
+            auto result = std::from_chars(Cur, End, value);
+            if (result.ec != std::errc())
+                return false;
+            Cur = result.ptr;
+            return true;
+        }
+
+        bool ReadInt(int& value)
+        {
+            auto result = std::from_chars(Cur, End, value);
+            if (result.ec != std::errc())
+                return false;
+            Cur = result.ptr;
+            return true;
+        }
+
+        // "v", "v/vt", "v//vn", "v/vt/vn"
+        bool ReadCorner(ObjCorner& corner)
+        {
+            SkipSpaces();
+            if (Cur >= End || !ReadInt(corner.Position))
+                return false;
+
+            corner.TexCoord = corner.Normal = 0;
+            if (Cur < End && *Cur == '/')
+            {
+                ++Cur;
+                if (Cur < End && *Cur != '/')
+                    ReadInt(corner.TexCoord);
+                if (Cur < End && *Cur == '/')
+                {
+                    ++Cur;
+                    ReadInt(corner.Normal);
+                }
+            }
+            return true;
+        }
+    };
+
+    // OBJ ε 1,  ڿ
+    int ResolveIndex(int index, std::size_t count)
+    {
+        if (index > 0)
+            return index - 1;
+        if (index < 0)
+            return (int)count + index;
+        return -1;
+    }
+
+    void SetError(std::string* error, int line, const char* message)
+    {
+        if (error != nullptr)
+        {
+            char buffer[128];
+            snprintf(buffer, sizeof(buffer), "line %d: %s", line, message);
+            *error = buffer;
+        }
+    }
+}
+
+namespace MeshCooker
+{
+    bool ParseObj(const char* text, std::size_t length, MeshCookSource& out, std::string* error)
+    {
+        std::vector<float> positions, texCoords, normals;
+        std::vector<CookVertex> vertices;
+        std::vector<std::uint32_t> indices;
+        std::vector<MeshFormat::Submesh> submeshes;
+        std::unordered_map<ObjCorner, std::uint32_t, ObjCornerHash> vertexMap;
+        bool missingNormals = false;
+
+        //  ޽ ݰ   (  ״ )
+        auto beginSubmesh = [&]()
+        {
+            if (!submeshes.empty() && submeshes.back().IndexCount == 0)
+                return;
+
+            MeshFormat::Submesh submesh = {};
+            submesh.IndexStart = (std::uint32_t)indices.size();
+            submesh.MaterialIndex = (std::uint32_t)submeshes.size();
+            submeshes.push_back(submesh);
+        };
+        beginSubmesh();
+
+        std::uint32_t cornerVertex[64];
+
+        const char* cur = text;
+        const char* end = text + length;
+        int lineNumber = 0;
+
+        while (cur < end)
+        {
+            const char* lineEnd = static_cast<const char*>(memchr(cur, '\n', (std::size_t)(end - cur)));
+            if (lineEnd == nullptr)
+                lineEnd = end;
+
+            LineReader line{ cur, lineEnd };
+            cur = lineEnd + 1;
+            ++lineNumber;
+
+            line.SkipSpaces();
+            if (line.Cur >= line.End)
+                continue;
+
+            const char c0 = line.Cur[0];
+            const char c1 = (line.Cur + 1 < line.End) ? line.Cur[1] : '\0';
+
+            if (c0 == 'v' && (c1 == ' ' || c1 == '\t'))
+            {
+                line.Cur += 1;
+                float x, y, z;
+                if (!line.ReadFloat(x) || !line.ReadFloat(y) || !line.ReadFloat(z))
+                {
+                    SetError(error, lineNumber, "bad position");
+                    return false;
+                }
+                positions.insert(positions.end(), { x, y, -z }); //  -> ޼ ǥ
+            }
+            else if (c0 == 'v' && c1 == 't')
+            {
+                line.Cur += 2;
+                float u = 0.0f, v = 0.0f;
+                if (!line.ReadFloat(u))
+                {
+                    SetError(error, lineNumber, "bad texcoord");
+                    return false;
+                }
+                line.ReadFloat(v);
+                // OBJ   Ʒ , D3D   
+                texCoords.insert(texCoords.end(), { u, 1.0f - v });
+            }
+            else if (c0 == 'v' && c1 == 'n')
+            {
+                line.Cur += 2;
+                float x, y, z;
+                if (!line.ReadFloat(x) || !line.ReadFloat(y) || !line.ReadFloat(z))
+                {
+                    SetError(error, lineNumber, "bad normal");
+                    return false;
+                }
+                normals.insert(normals.end(), { x, y, -z });
+            }
+            else if (c0 == 'f' && (c1 == ' ' || c1 == '\t'))
+            {
+                line.Cur += 1;
+
+                // 1.   ȣ
+                int cornerCount = 0;
+                ObjCorner corner;
+                while (cornerCount < 64 && line.ReadCorner(corner))
+                {
+                    corner.Position = ResolveIndex(corner.Position, positions.size() / 3);
+                    corner.TexCoord = ResolveIndex(corner.TexCoord, texCoords.size() / 2);
+                    corner.Normal = ResolveIndex(corner.Normal, normals.size() / 3);
+
+                    if (corner.Position < 0 || corner.Position >= (int)(positions.size() / 3) ||
+                        corner.TexCoord >= (int)(texCoords.size() / 2) ||
+                        corner.Normal >= (int)(normals.size() / 3))
+                    {
+                        SetError(error, lineNumber, "face index out of range");
+                        return false;
+                    }
+
+                    auto found = vertexMap.find(corner);
+                    if (found == vertexMap.end())
+                    {
+                        CookVertex v = {};
+                        memcpy(v.Pos, &positions[corner.Position * 3], sizeof(v.Pos));
+                        if (corner.TexCoord >= 0)
+                            memcpy(v.TexC, &texCoords[corner.TexCoord * 2], sizeof(v.TexC));
+                        if (corner.Normal >= 0)
+                            memcpy(v.Normal, &normals[corner.Normal * 3], sizeof(v.Normal));
+                        else
+                            missingNormals = true;
+
+                        found = vertexMap.emplace(corner, (std::uint32_t)vertices.size()).first;
+                        vertices.push_back(v);
+                    }
+
+                    cornerVertex[cornerCount] = found->second;
+                    ++cornerCount;
+                }
+
+                if (cornerCount < 3)
+                {
+                    SetError(error, lineNumber, "face with fewer than 3 vertices");
+                    return false;
+                }
+
+                // 2. ä ﰢȭ (Z   ⵵ ݴ -> D3D ð )
+                for (int i = 1; i + 1 < cornerCount; ++i)
+                {
+                    indices.push_back(cornerVertex[0]);
+                    indices.push_back(cornerVertex[i + 1]);
+                    indices.push_back(cornerVertex[i]);
+                }
+                submeshes.back().IndexCount = (std::uint32_t)indices.size() - submeshes.back().IndexStart;
+            }
+            else if ((c0 == 'o' || c0 == 'g') && (c1 == ' ' || c1 == '\t'))
+            {
+                beginSubmesh();
+            }
+            else if (line.End - line.Cur >= 6 && strncmp(line.Cur, "usemtl", 6) == 0)
+            {
+                beginSubmesh();
+            }
+            //   (mtllib, s, #, ...)  
+        }
+
+        if (!submeshes.empty() && submeshes.back().IndexCount == 0)
+            submeshes.pop_back();
+
+        if (indices.empty())
+        {
+            SetError(error, lineNumber, "no faces");
+            return false;
+        }
+
+        // 3.     ( ) ؼ ä
+        if (missingNormals)
+        {
+            std::vector<float> accum(vertices.size() * 3, 0.0f);
+            for (std::size_t i = 0; i < indices.size(); i += 3)
+            {
+                const float* p0 = vertices[indices[i + 0]].Pos;
+                const float* p1 = vertices[indices[i + 1]].Pos;
+                const float* p2 = vertices[indices[i + 2]].Pos;
+                const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+                const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+                const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+                for (int k = 0; k < 3; ++k)
+                    for (int a = 0; a < 3; ++a)
+                        accum[indices[i + k] * 3 + a] += n[a];
+            }
+
+            for (std::size_t v = 0; v < vertices.size(); ++v)
+            {
+                float* n = vertices[v].Normal;
+                if (n[0] != 0.0f || n[1] != 0.0f || n[2] != 0.0f)
+                    continue;
+
+                const float* a = &accum[v * 3];
+                const float len = std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+                if (len > 0.0f)
+                {
+                    n[0] = a[0] / len; n[1] = a[1] / len; n[2] = a[2] / len;
+                }
+            }
+        }
+
+        out.VertexLayout = MeshFormat::VertexFormat::PosNormalTex;
+        out.Vertices.resize(vertices.size() * sizeof(CookVertex));
+        memcpy(out.Vertices.data(), vertices.data(), out.Vertices.size());
+        out.Indices = std::move(indices);
+        out.Submeshes = std::move(submeshes);
+        return true;
+    }
+
+    bool LoadObj(const std::string& path, MeshCookSource& out, std::string* error)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            if (error != nullptr)
+                *error = "cannot open " + path;
+            return false;
+        }
+
+        std::vector<char> text((std::size_t)file.tellg());
+        file.seekg(0);
+        file.read(text.data(), (std::streamsize)text.size());
+
+        return ParseObj(text.data(), text.size(), out, error);
+    }
+
+    std::vector<std::uint8_t> Cook(const MeshCookSource& source)
+    {
+        using namespace MeshFormat;
+
+        const std::uint32_t stride = GetVertexStride(source.VertexLayout);
+        const std::uint32_t vertexCount = source.GetVertexCount();
+        const IndexFormat indexType = vertexCount <= 65536 ? IndexFormat::UInt16 : IndexFormat::UInt32;
+        const std::uint32_t indexCount = (std::uint32_t)source.Indices.size();
+
+        std::vector<Submesh> submeshes = source.Submeshes;
+        if (submeshes.empty())
+        {
+            Submesh all = {};
+            all.IndexCount = indexCount;
+            submeshes.push_back(all);
+        }
+
+        // LOD   ü LOD0 ϳ
+        const std::uint32_t lodCount = source.LodErrors.empty() ? 1u : (std::uint32_t)source.LodErrors.size();
+        const std::uint32_t submeshesPerLod = (std::uint32_t)submeshes.size() / lodCount;
+
+        std::vector<Lod> lods(lodCount);
+        for (std::uint32_t l = 0; l < lodCount; ++l)
+        {
+            lods[l] = {};
+            lods[l].Error = source.LodErrors.empty() ? 0.0f : source.LodErrors[l];
+            lods[l].IndexStart = submeshes[(std::size_t)l * submeshesPerLod].IndexStart;
+            for (std::uint32_t s = 0; s < submeshesPerLod; ++s)
+                lods[l].IndexCount += submeshes[(std::size_t)l * submeshesPerLod + s].IndexCount;
+        }
+
+        // 1. ġ  ( 16 Ʈ )
+        Header header = {};
+        header.Magic = Magic;
+        header.Version = Version;
+        header.VertexLayout = source.VertexLayout;
+        header.VertexStride = stride;
+        header.VertexCount = vertexCount;
+        header.IndexType = indexType;
+        header.IndexCount = indexCount;
+        header.SubmeshCount = submeshesPerLod;
+        header.LodCount = lodCount;
+        header.VertexOffset = AlignUp(sizeof(Header));
+        header.IndexOffset = AlignUp(header.VertexOffset + (std::uint64_t)vertexCount * stride);
+        header.SubmeshOffset = AlignUp(header.IndexOffset + (std::uint64_t)indexCount * GetIndexStride(indexType));
+        header.LodOffset = AlignUp(header.SubmeshOffset + submeshes.size() * sizeof(Submesh));
+        header.FileSize = AlignUp(header.LodOffset + lods.size() * sizeof(Lod));
+
+        // 2.  (  ȭ     -> Ÿ ȭ )
+        for (int a = 0; a < 3; ++a)
+        {
+            header.BoundsMin[a] = vertexCount > 0 ? INFINITY : 0.0f;
+            header.BoundsMax[a] = vertexCount > 0 ? -INFINITY : 0.0f;
+        }
+        if (IsPacked(source.VertexLayout))
+        {
+            memcpy(header.BoundsMin, source.QuantizeMin, sizeof(header.BoundsMin));
+            memcpy(header.BoundsMax, source.QuantizeMax, sizeof(header.BoundsMax));
+        }
+        else
+        {
+            float p[3];
+            for (std::uint32_t v = 0; v < vertexCount; ++v)
+            {
+                VertexCompression::DecodePosition(source, v, p);
+                for (int a = 0; a < 3; ++a)
+                {
+                    header.BoundsMin[a] = std::fmin(header.BoundsMin[a], p[a]);
+                    header.BoundsMax[a] = std::fmax(header.BoundsMax[a], p[a]);
+                }
+            }
+        }
+
+        for (Submesh& submesh : submeshes)
+        {
+            for (int a = 0; a < 3; ++a)
+            {
+                submesh.BoundsMin[a] = INFINITY;
+                submesh.BoundsMax[a] = -INFINITY;
+            }
+            float p[3];
+            for (std::uint32_t i = 0; i < submesh.IndexCount; ++i)
+            {
+                VertexCompression::DecodePosition(source, source.Indices[submesh.IndexStart + i] + submesh.BaseVertex, p);
+                for (int a = 0; a < 3; ++a)
+                {
+                    submesh.BoundsMin[a] = std::fmin(submesh.BoundsMin[a], p[a]);
+                    submesh.BoundsMax[a] = std::fmax(submesh.BoundsMax[a], p[a]);
+                }
+            }
+        }
+
+        // 3.  (  0)
+        std::vector<std::uint8_t> bytes((std::size_t)header.FileSize, 0);
+        memcpy(bytes.data(), &header, sizeof(header));
+        memcpy(bytes.data() + header.VertexOffset, source.Vertices.data(), (std::size_t)vertexCount * stride);
+
+        if (indexType == IndexFormat::UInt16)
+        {
+            std::uint16_t* dst = reinterpret_cast<std::uint16_t*>(bytes.data() + header.IndexOffset);
+            for (std::uint32_t i = 0; i < indexCount; ++i)
+                dst[i] = (std::uint16_t)source.Indices[i];
+        }
+        else
+        {
+            memcpy(bytes.data() + header.IndexOffset, source.Indices.data(), (std::size_t)indexCount * 4);
+        }
+
+        memcpy(bytes.data() + header.SubmeshOffset, submeshes.data(), submeshes.size() * sizeof(Submesh));
+        memcpy(bytes.data() + header.LodOffset, lods.data(), lods.size() * sizeof(Lod));
+        return bytes;
+    }
+
+    bool WriteFile(const std::string& path, const std::vector<std::uint8_t>& bytes)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+
+        file.write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+        return (bool)file;
+    }
+
+    bool CookObjFile(const std::string& objPath, const std::string& outPath, std::string* error,
+        MeshOptimizeReport* report, LodChainReport* lodReport)
+    {
+        MeshCookSource source;
+        if (!LoadObj(objPath, source, error))
+            return false;
+
+        const MeshOptimizeReport optimized = MeshOptimizer::Optimize(source);
+        if (report != nullptr)
+            *report = optimized;
+
+        const LodChainReport lods = MeshSimplifier::GenerateLods(source);
+        if (lodReport != nullptr)
+            *lodReport = lods;
+
+        VertexCompression::CompressVertices(source);
+
+        if (!WriteFile(outPath, Cook(source)))
+        {
+            if (error != nullptr)
+                *error = "cannot write " + outPath;
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "MeshFormat.h"
+#include <string>
+#include <vector>
+
+// ==========================================================
+//  ޽ Ŀ
+// (OBJ, ڵ  ) -> .ewmesh Ʈ (MeshFormat.h)
+// - OBJ: ġ/UV/ ε  ϳ  ġ ٰ ä÷ ﰢȭ
+//    ǥ(ݽð) D3D ޼ ǥ(ð): Z  +   
+//   usemtl / o / g  ٲ  ޽ ,     ؼ 
+// -  65536  ϸ 16Ʈ ε
+// -  (VertexCompression.h)̸  Bounds  ġ ȭ 
+// : EclipseWalker.exe -cook <Է.obj> <.ewmesh>
+// ==========================================================
+
+struct MeshCookSource
+{
+    MeshFormat::VertexFormat VertexLayout = MeshFormat::VertexFormat::PosNormalTex;
+    std::vector<std::uint8_t> Vertices; // VertexLayout ü 迭 (Pos   )
+    std::vector<std::uint32_t> Indices;
+
+    //   ü ޽ ϳ. (Bounds) Cook  
+    std::vector<MeshFormat::Submesh> Submeshes;
+
+    // LOD   (MeshSimplifier::GenerateLods  ä).   LOD0 ϳ
+    //  Submeshes  LOD  LodErrors.size() x (LOD ϳ ޽ )
+    std::vector<float> LodErrors;
+
+    //   ġ ȭ  (VertexCompression::CompressVertices  ä,  Bounds  )
+    float QuantizeMin[3] = { 0.0f, 0.0f, 0.0f };
+    float QuantizeMax[3] = { 0.0f, 0.0f, 0.0f };
+
+    std::uint32_t GetVertexCount()const
+    {
+        return (std::uint32_t)(Vertices.size() / MeshFormat::GetVertexStride(VertexLayout));
+    }
+};
+
+struct MeshOptimizeReport;
+struct LodChainReport;
+
+namespace MeshCooker
+{
+    bool ParseObj(const char* text, std::size_t length, MeshCookSource& out, std::string* error = nullptr);
+    bool LoadObj(const std::string& path, MeshCookSource& out, std::string* error = nullptr);
+
+    //  Ʈ 16 Ʈ ĵ  θ CookedMesh::OpenMemory  ٷ   
+    std::vector<std::uint8_t> Cook(const MeshCookSource& source);
+
+    bool WriteFile(const std::string& path, const std::vector<std::uint8_t>& bytes);
+    // б -> MeshOptimizer::Optimize -> MeshSimplifier::GenerateLods -> VertexCompression::CompressVertices
+    // -> ŷ -> . report / lodReport    ä
+    bool CookObjFile(const std::string& objPath, const std::string& outPath, std::string* error = nullptr,
+        MeshOptimizeReport* report = nullptr, LodChainReport* lodReport = nullptr);
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// ==========================================================
+// ŷ ޽   (.ewmesh,  2)
+// [Header][ Ʈ][ε][޽ ̺][LOD ̺]     16 Ʈ 
+// - LOD   Ʈ   ε  (޽ ̺ LOD  LodCount x SubmeshCount)
+// -  VertexTypes ü ״ (GPU ۿ ٷ )
+// -  ޸ ؼ ͸   (Ľ )
+// Ʋ  .  ٲ Version  ø ٽ ŷ
+// ==========================================================
+
+namespace MeshFormat
+{
+    constexpr std::uint32_t Magic = 0x534D5745; // "EWMS"
+    constexpr std::uint32_t Version = 2;
+    constexpr std::uint64_t Alignment = 16;
+    constexpr std::uint32_t MaxLods = 8;
+
+    // VertexTypes   /ũ (EclipseWalkerGame.cpp  static_assert)
+    //  (Packed*) ġ  Bounds  16Ʈ ȭ  (VertexCompression.h)
+    enum class VertexFormat : std::uint32_t
+    {
+        PosColor = 0,           // XMFLOAT3 Pos, XMFLOAT4 Color
+        PosNormalTex = 1,       // XMFLOAT3 Pos, XMFLOAT3 Normal, XMFLOAT2 TexC
+        PackedPosColor = 2,     // UNORM16x4 Pos, RGBA8 Color
+        PackedPosNormalTex = 3, // UNORM16x4 Pos, SNORM16x2 ȸü Normal, FLOAT16x2 TexC
+        Count
+    };
+
+    inline bool IsPacked(VertexFormat format)
+    {
+        return format == VertexFormat::PackedPosColor || format == VertexFormat::PackedPosNormalTex;
+    }
+
+    enum class IndexFormat : std::uint32_t
+    {
+        UInt16 = 0,
+        UInt32 = 1
+    };
+
+    inline std::uint32_t GetVertexStride(VertexFormat format)
+    {
+        switch (format)
+        {
+        case VertexFormat::PosColor:           return 28;
+        case VertexFormat::PosNormalTex:       return 32;
+        case VertexFormat::PackedPosColor:     return 12;
+        case VertexFormat::PackedPosNormalTex: return 16;
+        default:                               return 0;
+        }
+    }
+
+    inline std::uint32_t GetIndexStride(IndexFormat format)
+    {
+        return format == IndexFormat::UInt16 ? 2u : 4u;
+    }
+
+    inline std::uint64_t AlignUp(std::uint64_t value)
+    {
+        return (value + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    struct alignas(16) Header
+    {
+        std::uint32_t Magic;
+        std::uint32_t Version;
+        std::uint64_t FileSize;
+
+        VertexFormat VertexLayout;
+        std::uint32_t VertexStride;
+        std::uint32_t VertexCount;
+        IndexFormat IndexType;
+
+        std::uint32_t IndexCount;    //  LOD 
+        std::uint32_t SubmeshCount;  // LOD ϳ
+        std::uint64_t VertexOffset;  //   
+
+        std::uint64_t IndexOffset;
+        std::uint64_t SubmeshOffset;
+
+        float BoundsMin[3];
+        float BoundsMax[3];
+        std::uint32_t LodCount;      // 1 ̻
+        std::uint32_t Reserved0;
+
+        std::uint64_t LodOffset;
+        std::uint64_t Reserved1;
+    };
+    static_assert(sizeof(Header) == 112, "MeshFormat::Header layout changed");
+
+    struct Submesh
+    {
+        std::uint32_t IndexStart;
+        std::uint32_t IndexCount;
+        std::int32_t BaseVertex;
+        std::uint32_t MaterialIndex;
+
+        float BoundsMin[3];
+        float BoundsMax[3];
+        std::uint32_t Reserved[2];
+    };
+    static_assert(sizeof(Submesh) == 48, "MeshFormat::Submesh layout changed");
+
+    // Error: LOD0   ִ Ÿ ( ,  1 ). LOD0  0
+    struct Lod
+    {
+        float Error;
+        std::uint32_t IndexStart;
+        std::uint32_t IndexCount;
+        std::uint32_t Reserved;
+    };
+    static_assert(sizeof(Lod) == 16, "MeshFormat::Lod layout changed");
+}
@@ -1,5 +1,20 @@
 #pragma once
 #include "d3dUtil.h"
+#include "GpuMemoryAllocator.h"
+#include "UploadBatcher.h"
+#include "Bounds.h"
+#include "MeshFormat.h"
+
+// ޽  ׸  ( ٸ κ )
+struct SubmeshGeometry
+{
+    UINT IndexCount = 0;
+    UINT StartIndexLocation = 0;
+    INT BaseVertexLocation = 0;
+    UINT MaterialIndex = 0;
+
+    Aabb Bounds; //  
+};
 
 //  ϳ ϴ ̳
 struct MeshGeometry
@@ -7,30 +22,41 @@ struct MeshGeometry
     // 1. ̸ (: "boxGeo", "waterGeo")
     std::string Name;
 
-    // 2. ý ޸ 纻 (CPU  ִ  )
-    // ID3DBlob ׳ " " 
-    ComPtr<ID3DBlob> VertexBufferCPU = nullptr;
-    ComPtr<ID3DBlob> IndexBufferCPU = nullptr;
+    // 2. ޽ ϰ ü  (ŷ  ޽ ̺/ )
+    // CPU   纻    (ε Ͽ ٷ ε)
+    // LOD  LodCount x SubmeshCount (LOD   ۸   ε  ٸ)
+    std::vector<SubmeshGeometry> Submeshes;
+    UINT SubmeshCount = 0; // LOD ϳ
+    UINT LodCount = 1;
+    Aabb Bounds;
+
+    const SubmeshGeometry* GetLodSubmeshes(UINT lod)const { return Submeshes.data() + (size_t)lod * SubmeshCount; }
 
     // 3. GPU ޸ ( ׷ī尡  )
-    ComPtr<ID3D12Resource> VertexBufferGPU = nullptr;
-    ComPtr<ID3D12Resource> IndexBufferGPU = nullptr;
+    // GpuMemoryAllocator  ū    (  ʿ Free)
+    // ε UploadManager  ¡  ϹǷ    ӽ ۴ 
+    GpuBufferAllocation VertexBufferGPU;
+    GpuBufferAllocation IndexBufferGPU;
 
-    // 4. ε ӽ  (CPU -> GPU     )
-    ComPtr<ID3D12Resource> VertexBufferUploader = nullptr;
-    ComPtr<ID3D12Resource> IndexBufferUploader = nullptr;
+    //  ť  Ƽ  ׸   (UploadManager::IsComplete)
+    UploadTicket ReadyTicket = 0;
 
-    // 5.  
+    // 4.  
+    MeshFormat::VertexFormat VertexLayout = MeshFormat::VertexFormat::PosColor; // Է ġ/PSO 
     UINT VertexByteStride = 0; //  ϳ ũ (Ʈ)
     UINT VertexBufferByteSize = 0; // ü   ũ
     DXGI_FORMAT IndexFormat = DXGI_FORMAT_R16_UINT; // ε  (16Ʈ)
     UINT IndexBufferByteSize = 0; // ü ε  ũ
 
-    // 6. GPU "⼭  о" ˷ִ (View) ȯ Լ
+    //   ġ ȭ ( = Bias + unorm * Scale).   տ ؼ 
+    DirectX::XMFLOAT3 PositionScale = { 1.0f, 1.0f, 1.0f };
+    DirectX::XMFLOAT3 PositionBias = { 0.0f, 0.0f, 0.0f };
+
+    // 5. GPU "⼭  о" ˷ִ (View) ȯ Լ
     D3D12_VERTEX_BUFFER_VIEW VertexBufferView()const
     {
         D3D12_VERTEX_BUFFER_VIEW vbv;
-        vbv.BufferLocation = VertexBufferGPU->GetGPUVirtualAddress();
+        vbv.BufferLocation = VertexBufferGPU.GpuAddress;
         vbv.SizeInBytes = VertexBufferByteSize;
         vbv.StrideInBytes = VertexByteStride;
         return vbv;
@@ -39,16 +65,9 @@ struct MeshGeometry
     D3D12_INDEX_BUFFER_VIEW IndexBufferView()const
     {
         D3D12_INDEX_BUFFER_VIEW ibv;
-        ibv.BufferLocation = IndexBufferGPU->GetGPUVirtualAddress();
+        ibv.BufferLocation = IndexBufferGPU.GpuAddress;
         ibv.Format = IndexFormat;
         ibv.SizeInBytes = IndexBufferByteSize;
         return ibv;
     }
-
-    // ߿ ҽ   ϰ Ϸ (Ҹڴ ⺻ )
-    void DisposeUploaders()
-    {
-        VertexBufferUploader = nullptr;
-        IndexBufferUploader = nullptr;
-    }
 };
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ޽ ε   (߿)
+//  ޽ OBJ ؽƮ .ewmesh  ӽ   ΰ
+// " -> ε  "  ɸ ð Ѵ (  OS  ĳÿ ö )
+// ==========================================================
+
+struct MeshLoadBenchmarkResult
+{
+    std::uint32_t VertexCount = 0;
+    std::uint32_t TriangleCount = 0;
+    std::uint64_t ObjBytes = 0;
+    std::uint64_t CookedBytes = 0;
+
+    double ObjLoadMs = 0.0;    //  б + Ľ + ¡ 
+    double CookedLoadMs = 0.0; //  +  ˻ + ¡ 
+};
+
+namespace MeshLoadBenchmark
+{
+    // gridSize x gridSize  
+    MeshLoadBenchmarkResult Run(std::uint32_t gridSize);
+
+    // 64k / 1M 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
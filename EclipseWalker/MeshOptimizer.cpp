@@ -0,0 +1,504 @@
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+namespace
+{
+    // ---------------------------------------------------------
+    // Forsyth  (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation")
+    // ---------------------------------------------------------
+    constexpr std::uint32_t ForsythCacheSize = 32;
+    constexpr float CacheDecayPower = 1.5f;
+    constexpr float LastTriScore = 0.75f;
+    constexpr float ValenceBoostScale = 2.0f;
+    constexpr float ValenceBoostPower = 0.5f;
+    constexpr std::uint32_t MaxValenceTable = 32;
+
+    struct ForsythTables
+    {
+        float Cache[ForsythCacheSize];
+        float Valence[MaxValenceTable];
+
+        ForsythTables()
+        {
+            for (std::uint32_t i = 0; i < ForsythCacheSize; ++i)
+            {
+                //   ﰢ     (ٷ ٽ   ﰢ ֺ  )
+                if (i < 3)
+                    Cache[i] = LastTriScore;
+                else
+                    Cache[i] = std::pow(1.0f - (float)(i - 3) / (ForsythCacheSize - 3), CacheDecayPower);
+            }
+
+            for (std::uint32_t i = 0; i < MaxValenceTable; ++i)
+                Valence[i] = i == 0 ? 0.0f : ValenceBoostScale * std::pow((float)i, -ValenceBoostPower);
+        }
+    };
+
+    const ForsythTables& GetForsythTables()
+    {
+        static const ForsythTables tables;
+        return tables;
+    }
+
+    float VertexScore(int cachePosition, std::uint32_t remainingValence)
+    {
+        if (remainingValence == 0)
+            return -1.0f; //   ﰢ 
+
+        const ForsythTables& tables = GetForsythTables();
+        float score = cachePosition >= 0 ? tables.Cache[cachePosition] : 0.0f;
+        score += remainingValence < MaxValenceTable
+            ? tables.Valence[remainingValence]
+            : ValenceBoostScale * std::pow((float)remainingValence, -ValenceBoostPower);
+        return score;
+    }
+
+    const float* PositionOf(const std::uint8_t* positions, std::uint32_t stride, std::uint32_t v)
+    {
+        return reinterpret_cast<const float*>(positions + (std::size_t)v * stride);
+    }
+
+    // ޽ BaseVertex  ε Ǯ  ( ܰ  ε ٷ)
+    void FlattenBaseVertex(MeshCookSource& source)
+    {
+        for (MeshFormat::Submesh& submesh : source.Submeshes)
+        {
+            if (submesh.BaseVertex == 0)
+                continue;
+
+            for (std::uint32_t i = 0; i < submesh.IndexCount; ++i)
+                source.Indices[submesh.IndexStart + i] += submesh.BaseVertex;
+            submesh.BaseVertex = 0;
+        }
+    }
+}
+
+std::string MeshOptimizeReport::ToString()const
+{
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer),
+        "verts %u -> %u, tris %u, clusters %u, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+        VerticesBefore, VerticesAfter, Triangles, OverdrawClusters,
+        Before.Acmr, After.Acmr, Before.Atvr, After.Atvr);
+    return buffer;
+}
+
+namespace MeshOptimizer
+{
+    VertexCacheStats AnalyzeVertexCache(const std::uint32_t* indices, std::size_t indexCount,
+        std::uint32_t vertexCount, std::uint32_t cacheSize)
+    {
+        VertexCacheStats stats;
+        if (indexCount < 3 || vertexCount == 0)
+            return stats;
+
+        // FIFO ĳ:   ð  (ð ̰ cacheSize ̸̸ ĳ )
+        std::vector<std::uint32_t> timestamps(vertexCount, 0);
+        std::uint32_t time = cacheSize + 1;
+
+        for (std::size_t i = 0; i < indexCount; ++i)
+        {
+            const std::uint32_t v = indices[i];
+            if (time - timestamps[v] > cacheSize)
+            {
+                timestamps[v] = time++;
+                ++stats.Misses;
+            }
+        }
+
+        stats.Acmr = (float)stats.Misses / (float)(indexCount / 3);
+        stats.Atvr = (float)stats.Misses / (float)vertexCount;
+        return stats;
+    }
+
+    std::uint32_t DeduplicateVertices(MeshCookSource& source)
+    {
+        FlattenBaseVertex(source);
+
+        const std::uint32_t stride = MeshFormat::GetVertexStride(source.VertexLayout);
+        const std::uint32_t vertexCount = source.GetVertexCount();
+
+        // Ʈ ؽ -> ù  (浹 memcmp  Ȯ)
+        auto hashVertex = [&](std::uint32_t v)
+        {
+            const std::uint8_t* p = source.Vertices.data() + (std::size_t)v * stride;
+            std::uint64_t h = 14695981039346656037ull;
+            for (std::uint32_t i = 0; i < stride; ++i)
+                h = (h ^ p[i]) * 1099511628211ull;
+            return h;
+        };
+
+        std::unordered_multimap<std::uint64_t, std::uint32_t> firstByHash;
+        firstByHash.reserve(vertexCount);
+
+        std::vector<std::uint32_t> remap(vertexCount);
+        std::vector<std::uint8_t> unique;
+        unique.reserve(source.Vertices.size());
+        std::uint32_t uniqueCount = 0;
+
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+        {
+            const std::uint8_t* p = source.Vertices.data() + (std::size_t)v * stride;
+            const std::uint64_t h = hashVertex(v);
+
+            std::uint32_t found = UINT32_MAX;
+            auto range = firstByHash.equal_range(h);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (memcmp(unique.data() + (std::size_t)it->second * stride, p, stride) == 0)
+                {
+                    found = it->second;
+                    break;
+                }
+            }
+
+            if (found == UINT32_MAX)
+            {
+                found = uniqueCount++;
+                unique.insert(unique.end(), p, p + stride);
+                firstByHash.emplace(h, found);
+            }
+            remap[v] = found;
+        }
+
+        for (std::uint32_t& index : source.Indices)
+            index = remap[index];
+
+        source.Vertices = std::move(unique);
+        return vertexCount - uniqueCount;
+    }
+
+    void OptimizeVertexCache(std::uint32_t* indices, std::size_t indexCount, std::uint32_t vertexCount)
+    {
+        const std::uint32_t triangleCount = (std::uint32_t)(indexCount / 3);
+        if (triangleCount < 2)
+            return;
+
+        // 1.  -> ﰢ   (CSR)
+        std::vector<std::uint32_t> valence(vertexCount, 0);
+        for (std::size_t i = 0; i < indexCount; ++i)
+            ++valence[indices[i]];
+
+        std::vector<std::uint32_t> adjacencyStart(vertexCount + 1, 0);
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+            adjacencyStart[v + 1] = adjacencyStart[v] + valence[v];
+
+        std::vector<std::uint32_t> adjacency(indexCount);
+        {
+            std::vector<std::uint32_t> fill(adjacencyStart.begin(), adjacencyStart.end() - 1);
+            for (std::uint32_t t = 0; t < triangleCount; ++t)
+                for (int k = 0; k < 3; ++k)
+                    adjacency[fill[indices[t * 3 + k]]++] = t;
+        }
+
+        // 2. ʱ 
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScore(vertexCount);
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+            vertexScore[v] = VertexScore(-1, valence[v]);
+
+        std::vector<float> triangleScore(triangleCount);
+        std::vector<std::uint8_t> emitted(triangleCount, 0);
+        for (std::uint32_t t = 0; t < triangleCount; ++t)
+            triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+
+        std::uint32_t bestTriangle = (std::uint32_t)(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+
+        std::vector<std::uint32_t> source(indices, indices + indexCount);
+        std::uint32_t cache[ForsythCacheSize + 3];
+        std::uint32_t cacheCount = 0;
+        std::uint32_t deadEndCursor = 0;
+
+        for (std::uint32_t out = 0; out < triangleCount; ++out)
+        {
+            // 3.       ﰢ ƹų (տ)
+            if (bestTriangle == UINT32_MAX)
+            {
+                while (emitted[deadEndCursor])
+                    ++deadEndCursor;
+                bestTriangle = deadEndCursor;
+            }
+
+            // 4. ﰢ  +  Ͽ 
+            const std::uint32_t* tri = &source[bestTriangle * 3];
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t v = tri[k];
+                indices[out * 3 + k] = v;
+
+                std::uint32_t* begin = &adjacency[adjacencyStart[v]];
+                std::uint32_t* end = begin + valence[v];
+                std::uint32_t* it = std::find(begin, end, bestTriangle);
+                *it = *(end - 1);
+                --valence[v];
+            }
+            emitted[bestTriangle] = 1;
+
+            // 5. LRU ĳ :     
+            std::uint32_t newCache[ForsythCacheSize + 3];
+            std::uint32_t newCount = 0;
+            for (int k = 0; k < 3; ++k)
+                newCache[newCount++] = tri[k];
+            for (std::uint32_t i = 0; i < cacheCount; ++i)
+            {
+                const std::uint32_t v = cache[i];
+                if (v != tri[0] && v != tri[1] && v != tri[2])
+                    newCache[newCount++] = v;
+            }
+
+            // 6. ĳ (׸  з)    ->  ﰢ  
+            for (std::uint32_t i = 0; i < newCount; ++i)
+            {
+                const std::uint32_t v = newCache[i];
+                cachePosition[v] = i < ForsythCacheSize ? (int)i : -1;
+
+                const float newScore = VertexScore(cachePosition[v], valence[v]);
+                const float delta = newScore - vertexScore[v];
+                vertexScore[v] = newScore;
+
+                for (std::uint32_t a = adjacencyStart[v]; a < adjacencyStart[v] + valence[v]; ++a)
+                    triangleScore[adjacency[a]] += delta;
+            }
+
+            cacheCount = std::min(newCount, ForsythCacheSize);
+            memcpy(cache, newCache, cacheCount * sizeof(std::uint32_t));
+
+            // 7.  ĺ ĳ    ﰢ  ְ
+            bestTriangle = UINT32_MAX;
+            float bestScore = -1.0f;
+            for (std::uint32_t i = 0; i < cacheCount; ++i)
+            {
+                const std::uint32_t v = cache[i];
+                for (std::uint32_t a = adjacencyStart[v]; a < adjacencyStart[v] + valence[v]; ++a)
+                {
+                    const std::uint32_t t = adjacency[a];
+                    if (triangleScore[t] > bestScore)
+                    {
+                        bestScore = triangleScore[t];
+                        bestTriangle = t;
+                    }
+                }
+            }
+        }
+    }
+
+    std::uint32_t OptimizeOverdraw(std::uint32_t* indices, std::size_t indexCount,
+        const std::uint8_t* positions, std::uint32_t stride, std::uint32_t vertexCount, float threshold)
+    {
+        const std::uint32_t triangleCount = (std::uint32_t)(indexCount / 3);
+        if (triangleCount < 2)
+            return 0;
+
+        const VertexCacheStats before = AnalyzeVertexCache(indices, indexCount, vertexCount);
+
+        // 1. Ŭ  (Ŭͳ  ٲ㵵 ĳ ȿ  ״ )
+        std::vector<std::uint32_t> timestamps(vertexCount, 0);
+        std::uint32_t time = AnalyzeCacheSize + 1;
+
+        auto triangleMisses = [&](std::uint32_t t)
+        {
+            std::uint32_t misses = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t v = indices[t * 3 + k];
+                if (time - timestamps[v] > AnalyzeCacheSize)
+                {
+                    timestamps[v] = time++;
+                    ++misses;
+                }
+            }
+            return misses;
+        };
+        auto resetCache = [&]() { time += AnalyzeCacheSize + 1; };
+
+        // 1-1. ϵ : ĳð    (   ̽)
+        std::vector<std::uint32_t> hardStart;
+        for (std::uint32_t t = 0; t < triangleCount; ++t)
+        {
+            if (triangleMisses(t) == 3 || t == 0)
+                hardStart.push_back(t);
+        }
+        hardStart.push_back(triangleCount);
+
+        // 1-2. Ʈ : ϵ Ŭ ȿ ݱ ACMR  (Ŭ ü ACMR * threshold) Ϸ
+        //        ڸ (ڸ ʹ  ĳ÷ Ѵٰ  )
+        std::vector<std::uint32_t> clusterStart;
+        for (std::size_t h = 0; h + 1 < hardStart.size(); ++h)
+        {
+            const std::uint32_t begin = hardStart[h], end = hardStart[h + 1];
+
+            resetCache();
+            std::uint32_t clusterMisses = 0;
+            for (std::uint32_t t = begin; t < end; ++t)
+                clusterMisses += triangleMisses(t);
+            const float clusterThreshold = threshold * (float)clusterMisses / (float)(end - begin);
+
+            resetCache();
+            std::uint32_t start = begin, misses = 0;
+            clusterStart.push_back(begin);
+            for (std::uint32_t t = begin; t < end; ++t)
+            {
+                misses += triangleMisses(t);
+                if ((float)misses / (float)(t - start + 1) <= clusterThreshold && t + 1 < end)
+                {
+                    start = t + 1;
+                    misses = 0;
+                    clusterStart.push_back(start);
+                    resetCache();
+                }
+            }
+        }
+
+        const std::uint32_t clusterCount = (std::uint32_t)clusterStart.size();
+        if (clusterCount < 2)
+            return 0;
+        clusterStart.push_back(triangleCount);
+
+        // 2. Ŭ͸   ߽/
+        std::vector<float> centroids(clusterCount * 3, 0.0f), normals(clusterCount * 3, 0.0f);
+        float meshCenter[3] = {}, meshArea = 0.0f;
+
+        for (std::uint32_t c = 0; c < clusterCount; ++c)
+        {
+            float area = 0.0f;
+            for (std::uint32_t t = clusterStart[c]; t < clusterStart[c + 1]; ++t)
+            {
+                const float* p0 = PositionOf(positions, stride, indices[t * 3 + 0]);
+                const float* p1 = PositionOf(positions, stride, indices[t * 3 + 1]);
+                const float* p2 = PositionOf(positions, stride, indices[t * 3 + 2]);
+
+                const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+                const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+                const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+                const float a = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+                for (int k = 0; k < 3; ++k)
+                {
+                    centroids[c * 3 + k] += (p0[k] + p1[k] + p2[k]) * (a / 3.0f);
+                    normals[c * 3 + k] += n[k];
+                }
+                area += a;
+            }
+
+            for (int k = 0; k < 3; ++k)
+            {
+                meshCenter[k] += centroids[c * 3 + k];
+                if (area > 0.0f)
+                    centroids[c * 3 + k] /= area;
+            }
+            meshArea += area;
+        }
+
+        if (meshArea > 0.0f)
+            for (int k = 0; k < 3; ++k)
+                meshCenter[k] /= meshArea;
+
+        // 3. ٱ ϴ (=  ׸ ڸ ) Ŭͺ
+        std::vector<float> sortKey(clusterCount);
+        for (std::uint32_t c = 0; c < clusterCount; ++c)
+        {
+            const float* n = &normals[c * 3];
+            const float len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            float key = 0.0f;
+            if (len > 0.0f)
+                for (int k = 0; k < 3; ++k)
+                    key += (centroids[c * 3 + k] - meshCenter[k]) * n[k] / len;
+            sortKey[c] = key;
+        }
+
+        std::vector<std::uint32_t> order(clusterCount);
+        for (std::uint32_t c = 0; c < clusterCount; ++c)
+            order[c] = c;
+        std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) { return sortKey[a] > sortKey[b]; });
+
+        std::vector<std::uint32_t> original(indices, indices + indexCount);
+        std::size_t out = 0;
+        for (std::uint32_t c : order)
+        {
+            const std::size_t begin = (std::size_t)clusterStart[c] * 3, end = (std::size_t)clusterStart[c + 1] * 3;
+            memcpy(indices + out, original.data() + begin, (end - begin) * sizeof(std::uint32_t));
+            out += end - begin;
+        }
+
+        // 4. ĳ ȿ ʹ  ǵ
+        const VertexCacheStats after = AnalyzeVertexCache(indices, indexCount, vertexCount);
+        if ((float)after.Misses > (float)before.Misses * threshold)
+        {
+            memcpy(indices, original.data(), indexCount * sizeof(std::uint32_t));
+            return 0;
+        }
+        return clusterCount;
+    }
+
+    void OptimizeVertexFetch(MeshCookSource& source)
+    {
+        FlattenBaseVertex(source);
+
+        const std::uint32_t stride = MeshFormat::GetVertexStride(source.VertexLayout);
+        const std::uint32_t vertexCount = source.GetVertexCount();
+
+        // ε ó   ȣ  ű ( ̴  )
+        std::vector<std::uint32_t> remap(vertexCount, UINT32_MAX);
+        std::vector<std::uint8_t> reordered;
+        reordered.reserve(source.Vertices.size());
+        std::uint32_t next = 0;
+
+        for (std::uint32_t& index : source.Indices)
+        {
+            if (remap[index] == UINT32_MAX)
+            {
+                remap[index] = next++;
+                const std::uint8_t* p = source.Vertices.data() + (std::size_t)index * stride;
+                reordered.insert(reordered.end(), p, p + stride);
+            }
+            index = remap[index];
+        }
+
+        source.Vertices = std::move(reordered);
+    }
+
+    MeshOptimizeReport Optimize(MeshCookSource& source)
+    {
+        MeshOptimizeReport report;
+        FlattenBaseVertex(source);
+
+        const std::uint32_t stride = MeshFormat::GetVertexStride(source.VertexLayout);
+        report.VerticesBefore = source.GetVertexCount();
+        report.Triangles = (std::uint32_t)(source.Indices.size() / 3);
+        report.Before = AnalyzeVertexCache(source.Indices.data(), source.Indices.size(), report.VerticesBefore);
+
+        // 1. ߺ 
+        DeduplicateVertices(source);
+        const std::uint32_t vertexCount = source.GetVertexCount();
+
+        // 2~3. ޽  ȿ ĳ/ 
+        std::vector<MeshFormat::Submesh> ranges = source.Submeshes;
+        if (ranges.empty())
+        {
+            MeshFormat::Submesh all = {};
+            all.IndexCount = (std::uint32_t)source.Indices.size();
+            ranges.push_back(all);
+        }
+
+        for (const MeshFormat::Submesh& range : ranges)
+        {
+            std::uint32_t* indices = source.Indices.data() + range.IndexStart;
+            OptimizeVertexCache(indices, range.IndexCount, vertexCount);
+
+            //   float ġ ʿ ( ȭ  ܰ)
+            if (!MeshFormat::IsPacked(source.VertexLayout))
+                report.OverdrawClusters += OptimizeOverdraw(indices, range.IndexCount, source.Vertices.data(), stride, vertexCount);
+        }
+
+        // 4.  fetch 
+        OptimizeVertexFetch(source);
+
+        report.VerticesAfter = source.GetVertexCount();
+        report.After = AnalyzeVertexCache(source.Indices.data(), source.Indices.size(), report.VerticesAfter);
+        return report;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "MeshCooker.h"
+#include <string>
+
+// ==========================================================
+// ޽ ȭ (ŷ ܰ迡  )
+// 1.  ߺ  (Ʈ    ġ)
+// 2.  ĳ  (Forsyth: ĳÿ ִ    ﰢ)
+// 3.   (ĳð ų Ŭ ACMR  threshold ȿ    ٱ  ͺ)
+//    -> ĳ ȿ threshold ̻  ǵ
+// 4.  fetch  (ε ó ̴   ġ)
+// ޽ ﰢ ڱ  ȿ 
+// ACMR = ĳ ̽ / ﰢ ( ,  0.5 ó)
+// ATVR = ĳ ̽ /   ( 1.0)
+// ==========================================================
+
+struct VertexCacheStats
+{
+    std::uint32_t Misses = 0;
+    float Acmr = 0.0f;
+    float Atvr = 0.0f;
+};
+
+struct MeshOptimizeReport
+{
+    std::uint32_t VerticesBefore = 0;
+    std::uint32_t VerticesAfter = 0;
+    std::uint32_t Triangles = 0;
+    std::uint32_t OverdrawClusters = 0; // 0 ̸   ǵ
+
+    VertexCacheStats Before;
+    VertexCacheStats After;
+
+    std::string ToString()const;
+};
+
+namespace MeshOptimizer
+{
+    // м  FIFO ĳ ũ (ֱ GPU  post-transform ĳ ٻ)
+    constexpr std::uint32_t AnalyzeCacheSize = 16;
+
+    VertexCacheStats AnalyzeVertexCache(const std::uint32_t* indices, std::size_t indexCount,
+        std::uint32_t vertexCount, std::uint32_t cacheSize = AnalyzeCacheSize);
+
+    //    ȯ
+    std::uint32_t DeduplicateVertices(MeshCookSource& source);
+
+    void OptimizeVertexCache(std::uint32_t* indices, std::size_t indexCount, std::uint32_t vertexCount);
+
+    // positions:  float3 (stride Ʈ ).  Ŭ  ȯ (ǵ 0)
+    std::uint32_t OptimizeOverdraw(std::uint32_t* indices, std::size_t indexCount,
+        const std::uint8_t* positions, std::uint32_t stride, std::uint32_t vertexCount, float threshold = 1.05f);
+
+    void OptimizeVertexFetch(MeshCookSource& source);
+
+    //  ܰ踦  (޽) 
+    MeshOptimizeReport Optimize(MeshCookSource& source);
+}
@@ -0,0 +1,494 @@
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+namespace
+{
+    //   ġ ( 麸 ũ -> 谡   ʰ)
+    constexpr double BorderWeight = 10.0;
+
+    // Q(p) = p'Ap + 2b'p + c (A  Ī̶ 6)
+    struct Quadric
+    {
+        double A00 = 0, A01 = 0, A02 = 0, A11 = 0, A12 = 0, A22 = 0;
+        double B0 = 0, B1 = 0, B2 = 0;
+        double C = 0;
+        double W = 0; // ġ  ()
+
+        //  n.p + d = 0 (n   )
+        void AddPlane(double nx, double ny, double nz, double d, double w)
+        {
+            A00 += w * nx * nx; A01 += w * nx * ny; A02 += w * nx * nz;
+            A11 += w * ny * ny; A12 += w * ny * nz; A22 += w * nz * nz;
+            B0 += w * nx * d; B1 += w * ny * d; B2 += w * nz * d;
+            C += w * d * d;
+            W += w;
+        }
+
+        void Add(const Quadric& q)
+        {
+            A00 += q.A00; A01 += q.A01; A02 += q.A02;
+            A11 += q.A11; A12 += q.A12; A22 += q.A22;
+            B0 += q.B0; B1 += q.B1; B2 += q.B2;
+            C += q.C;
+            W += q.W;
+        }
+
+        //  Ÿ 
+        double Evaluate(const float p[3])const
+        {
+            const double x = p[0], y = p[1], z = p[2];
+            const double value =
+                A00 * x * x + A11 * y * y + A22 * z * z +
+                2.0 * (A01 * x * y + A02 * x * z + A12 * y * z) +
+                2.0 * (B0 * x + B1 * y + B2 * z) + C;
+            return W > 0.0 ? std::max(value, 0.0) / W : 0.0;
+        }
+    };
+
+    enum class VertexKind : std::uint8_t
+    {
+        Manifold, // Ӱ ̵
+        Border,   //   󼭸
+        Locked    //  / پü:   (    )
+    };
+
+    struct EdgeCollapse
+    {
+        std::uint32_t From;
+        std::uint32_t To;
+        double Cost; // Ÿ 
+    };
+
+    struct PositionKey
+    {
+        std::uint32_t Bits[3];
+
+        bool operator==(const PositionKey& rhs)const
+        {
+            return Bits[0] == rhs.Bits[0] && Bits[1] == rhs.Bits[1] && Bits[2] == rhs.Bits[2];
+        }
+    };
+
+    struct PositionKeyHash
+    {
+        std::size_t operator()(const PositionKey& key)const
+        {
+            return ((std::size_t)key.Bits[0] * 73856093u) ^ ((std::size_t)key.Bits[1] * 19349663u) ^ ((std::size_t)key.Bits[2] * 83492791u);
+        }
+    };
+
+    std::uint64_t EdgeKey(std::uint32_t a, std::uint32_t b)
+    {
+        return ((std::uint64_t)a << 32) | b;
+    }
+
+    void Cross(const float a[3], const float b[3], const float c[3], double out[3])
+    {
+        const double e0[3] = { (double)b[0] - a[0], (double)b[1] - a[1], (double)b[2] - a[2] };
+        const double e1[3] = { (double)c[0] - a[0], (double)c[1] - a[1], (double)c[2] - a[2] };
+        out[0] = e0[1] * e1[2] - e0[2] * e1[1];
+        out[1] = e0[2] * e1[0] - e0[0] * e1[2];
+        out[2] = e0[0] * e1[1] - e0[1] * e1[0];
+    }
+}
+
+std::string LodChainReport::ToString()const
+{
+    std::string text;
+    char buffer[96];
+    snprintf(buffer, sizeof(buffer), "lods %u (%.1f ms):", LodCount, SimplifyMs);
+    text += buffer;
+    for (std::uint32_t l = 0; l < LodCount; ++l)
+    {
+        snprintf(buffer, sizeof(buffer), " [%u tris, err %.4f]", Triangles[l], Error[l]);
+        text += buffer;
+    }
+    return text;
+}
+
+namespace MeshSimplifier
+{
+    std::size_t Simplify(std::uint32_t* indices, std::size_t indexCount,
+        const std::uint8_t* positions, std::uint32_t stride, std::uint32_t vertexCount,
+        std::size_t targetIndexCount, float targetError, float* resultError)
+    {
+        if (resultError != nullptr)
+            *resultError = 0.0f;
+        if (indexCount < 3 || targetIndexCount >= indexCount)
+            return indexCount;
+
+        auto position = [&](std::uint32_t v) { return reinterpret_cast<const float*>(positions + (std::size_t)v * stride); };
+
+        // 1.  ġ   (ǥ = ó  )
+        std::vector<std::uint32_t> weld(vertexCount, UINT32_MAX);
+        std::vector<std::uint32_t> groupSize(vertexCount, 0);
+        {
+            std::unordered_map<PositionKey, std::uint32_t, PositionKeyHash> firstAt;
+            for (std::size_t i = 0; i < indexCount; ++i)
+            {
+                const std::uint32_t v = indices[i];
+                if (weld[v] != UINT32_MAX)
+                    continue;
+
+                PositionKey key;
+                memcpy(key.Bits, position(v), sizeof(key.Bits));
+                auto result = firstAt.emplace(key, v);
+                weld[v] = result.first->second;
+                ++groupSize[weld[v]];
+            }
+        }
+
+        // 2.  з (    ִ : ݴ   ,   ̸̻ پü)
+        std::vector<VertexKind> kind(vertexCount, VertexKind::Manifold);
+        std::unordered_map<std::uint64_t, std::uint32_t> edgeCount;
+        edgeCount.reserve(indexCount);
+        for (std::size_t i = 0; i < indexCount; i += 3)
+        {
+            for (int k = 0; k < 3; ++k)
+                ++edgeCount[EdgeKey(weld[indices[i + k]], weld[indices[i + (k + 1) % 3]])];
+        }
+
+        auto isBorderEdge = [&](std::uint32_t wa, std::uint32_t wb) { return edgeCount.find(EdgeKey(wb, wa)) == edgeCount.end(); };
+
+        for (const auto& [key, count] : edgeCount)
+        {
+            const std::uint32_t wa = (std::uint32_t)(key >> 32), wb = (std::uint32_t)key;
+            if (count > 1)
+            {
+                kind[wa] = kind[wb] = VertexKind::Locked;
+            }
+            else if (isBorderEdge(wa, wb))
+            {
+                if (kind[wa] == VertexKind::Manifold) kind[wa] = VertexKind::Border;
+                if (kind[wb] == VertexKind::Manifold) kind[wb] = VertexKind::Border;
+            }
+        }
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+        {
+            if (weld[v] == v && groupSize[v] > 1)
+                kind[v] = VertexKind::Locked; // UV/ 
+        }
+
+        // 3. quadric (  +    )
+        std::vector<Quadric> quadrics(vertexCount);
+        for (std::size_t i = 0; i < indexCount; i += 3)
+        {
+            const std::uint32_t w[3] = { weld[indices[i]], weld[indices[i + 1]], weld[indices[i + 2]] };
+            const float* p[3] = { position(w[0]), position(w[1]), position(w[2]) };
+
+            double n[3];
+            Cross(p[0], p[1], p[2], n);
+            const double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            if (length <= 0.0)
+                continue;
+
+            n[0] /= length; n[1] /= length; n[2] /= length;
+            const double d = -(n[0] * p[0][0] + n[1] * p[0][1] + n[2] * p[0][2]);
+            for (int k = 0; k < 3; ++k)
+                quadrics[w[k]].AddPlane(n[0], n[1], n[2], d, 0.5 * length);
+
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t wa = w[k], wb = w[(k + 1) % 3];
+                if (!isBorderEdge(wa, wb))
+                    continue;
+
+                //   鿡  
+                const double e[3] = { (double)p[(k + 1) % 3][0] - p[k][0], (double)p[(k + 1) % 3][1] - p[k][1], (double)p[(k + 1) % 3][2] - p[k][2] };
+                double m[3] = { e[1] * n[2] - e[2] * n[1], e[2] * n[0] - e[0] * n[2], e[0] * n[1] - e[1] * n[0] };
+                const double edgeLength2 = e[0] * e[0] + e[1] * e[1] + e[2] * e[2];
+                const double mLength = std::sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+                if (mLength <= 0.0)
+                    continue;
+
+                m[0] /= mLength; m[1] /= mLength; m[2] /= mLength;
+                const double md = -(m[0] * p[k][0] + m[1] * p[k][1] + m[2] * p[k][2]);
+                quadrics[wa].AddPlane(m[0], m[1], m[2], md, edgeLength2 * BorderWeight);
+                quadrics[wb].AddPlane(m[0], m[1], m[2], md, edgeLength2 * BorderWeight);
+            }
+        }
+
+        // 4. н ݺ: ĺ  ->    ->   ͺ ġ -> ε ٽ 
+        const double maxCost = (double)targetError * targetError;
+        double worstCost = 0.0;
+
+        std::vector<std::uint32_t> triangleStart(vertexCount + 1);
+        std::vector<std::uint32_t> triangles;
+        std::vector<std::uint64_t> edges;
+        std::vector<EdgeCollapse> candidates;
+        std::vector<std::uint8_t> locked(vertexCount);
+        std::vector<std::uint32_t> collapseTo(vertexCount);
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+            collapseTo[v] = v;
+
+        while (indexCount > targetIndexCount)
+        {
+            const std::uint32_t triangleCount = (std::uint32_t)(indexCount / 3);
+
+            // 4-1.  -> ﰢ (CSR)
+            std::fill(triangleStart.begin(), triangleStart.end(), 0);
+            for (std::size_t i = 0; i < indexCount; ++i)
+                ++triangleStart[indices[i] + 1];
+            for (std::uint32_t v = 0; v < vertexCount; ++v)
+                triangleStart[v + 1] += triangleStart[v];
+
+            triangles.resize(indexCount);
+            {
+                std::vector<std::uint32_t> fill(triangleStart.begin(), triangleStart.end() - 1);
+                for (std::uint32_t t = 0; t < triangleCount; ++t)
+                    for (int k = 0; k < 3; ++k)
+                        triangles[fill[indices[t * 3 + k]]++] = t;
+            }
+
+            // from ֺ ﰢ  weld  to     = ġ  ﰢ
+            auto sharedTriangles = [&](std::uint32_t from, std::uint32_t weldTo)
+            {
+                std::uint32_t shared = 0;
+                for (std::uint32_t i = triangleStart[from]; i < triangleStart[from + 1]; ++i)
+                {
+                    const std::uint32_t* tri = indices + (std::size_t)triangles[i] * 3;
+                    if (weld[tri[0]] == weldTo || weld[tri[1]] == weldTo || weld[tri[2]] == weldTo)
+                        ++shared;
+                }
+                return shared;
+            };
+
+            auto canCollapse = [&](std::uint32_t from, std::uint32_t to)
+            {
+                switch (kind[weld[from]])
+                {
+                case VertexKind::Manifold: return true;
+                case VertexKind::Border:   return kind[weld[to]] != VertexKind::Manifold && sharedTriangles(from, weld[to]) == 1;
+                default:                   return false;
+                }
+            };
+
+            // 4-2. ĺ (   ϳ)
+            edges.clear();
+            for (std::size_t i = 0; i < indexCount; i += 3)
+            {
+                for (int k = 0; k < 3; ++k)
+                {
+                    const std::uint32_t a = indices[i + k], b = indices[i + (k + 1) % 3];
+                    edges.push_back(EdgeKey(std::min(a, b), std::max(a, b)));
+                }
+            }
+            std::sort(edges.begin(), edges.end());
+            edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+            candidates.clear();
+            for (std::uint64_t edge : edges)
+            {
+                const std::uint32_t a = (std::uint32_t)(edge >> 32), b = (std::uint32_t)edge;
+                if (weld[a] == weld[b])
+                    continue;
+
+                Quadric merged = quadrics[weld[a]];
+                merged.Add(quadrics[weld[b]]);
+
+                EdgeCollapse best = { 0, 0, -1.0 };
+                if (canCollapse(a, b))
+                    best = { a, b, merged.Evaluate(position(b)) };
+                if (canCollapse(b, a))
+                {
+                    const double cost = merged.Evaluate(position(a));
+                    if (best.Cost < 0.0 || cost < best.Cost)
+                        best = { b, a, cost };
+                }
+                if (best.Cost >= 0.0 && best.Cost <= maxCost)
+                    candidates.push_back(best);
+            }
+
+            std::sort(candidates.begin(), candidates.end(),
+                [](const EdgeCollapse& lhs, const EdgeCollapse& rhs) { return lhs.Cost < rhs.Cost; });
+
+            // 4-3. ġ (ģ  1-ring  ̹ н  ->  ˻簡 ȿϰ )
+            std::fill(locked.begin(), locked.end(), 0);
+            std::size_t predictedIndexCount = indexCount;
+            std::uint32_t collapses = 0;
+
+            for (const EdgeCollapse& collapse : candidates)
+            {
+                if (predictedIndexCount <= targetIndexCount)
+                    break;
+                if (locked[collapse.From] || locked[collapse.To])
+                    continue;
+
+                //  ﰢ ˻
+                const float* target = position(collapse.To);
+                bool flips = false;
+                for (std::uint32_t i = triangleStart[collapse.From]; i < triangleStart[collapse.From + 1] && !flips; ++i)
+                {
+                    const std::uint32_t* tri = indices + (std::size_t)triangles[i] * 3;
+                    if (weld[tri[0]] == weld[collapse.To] || weld[tri[1]] == weld[collapse.To] || weld[tri[2]] == weld[collapse.To])
+                        continue; //  ﰢ
+
+                    const float* p[3] = { position(tri[0]), position(tri[1]), position(tri[2]) };
+                    double before[3], after[3];
+                    Cross(p[0], p[1], p[2], before);
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        if (tri[k] == collapse.From)
+                            p[k] = target;
+                    }
+                    Cross(p[0], p[1], p[2], after);
+
+                    const double dot = before[0] * after[0] + before[1] * after[1] + before[2] * after[2];
+                    flips = dot <= 0.0;
+                }
+                if (flips)
+                    continue;
+
+                predictedIndexCount -= 3 * (std::size_t)sharedTriangles(collapse.From, weld[collapse.To]);
+                collapseTo[collapse.From] = collapse.To;
+                quadrics[weld[collapse.To]].Add(quadrics[collapse.From]);
+                worstCost = std::max(worstCost, collapse.Cost);
+                ++collapses;
+
+                for (std::uint32_t i = triangleStart[collapse.From]; i < triangleStart[collapse.From + 1]; ++i)
+                {
+                    const std::uint32_t* tri = indices + (std::size_t)triangles[i] * 3;
+                    locked[tri[0]] = locked[tri[1]] = locked[tri[2]] = 1;
+                }
+            }
+
+            if (collapses == 0)
+                break;
+
+            // 4-4. ε ٽ  (ȭ ﰢ )
+            std::size_t write = 0;
+            for (std::size_t i = 0; i < indexCount; i += 3)
+            {
+                const std::uint32_t a = collapseTo[indices[i]], b = collapseTo[indices[i + 1]], c = collapseTo[indices[i + 2]];
+                if (weld[a] == weld[b] || weld[b] == weld[c] || weld[c] == weld[a])
+                    continue;
+
+                indices[write++] = a;
+                indices[write++] = b;
+                indices[write++] = c;
+            }
+            for (const EdgeCollapse& collapse : candidates)
+                collapseTo[collapse.From] = collapse.From;
+
+            indexCount = write;
+        }
+
+        if (resultError != nullptr)
+            *resultError = (float)std::sqrt(worstCost);
+        return indexCount;
+    }
+
+    LodChainReport GenerateLods(MeshCookSource& source, const LodChainSettings& settings)
+    {
+        LodChainReport report;
+        report.Triangles[0] = (std::uint32_t)(source.Indices.size() / 3);
+
+        //   float ġ, ̹ ü  ״
+        if (MeshFormat::IsPacked(source.VertexLayout) || !source.LodErrors.empty() || source.Indices.empty())
+            return report;
+
+        auto t0 = std::chrono::steady_clock::now();
+
+        const std::uint32_t stride = MeshFormat::GetVertexStride(source.VertexLayout);
+        const std::uint32_t vertexCount = source.GetVertexCount();
+
+        // 1.   = ޽  
+        float extent = 0.0f;
+        {
+            float boundsMin[3] = { INFINITY, INFINITY, INFINITY }, boundsMax[3] = { -INFINITY, -INFINITY, -INFINITY };
+            for (std::uint32_t v = 0; v < vertexCount; ++v)
+            {
+                const float* p = reinterpret_cast<const float*>(source.Vertices.data() + (std::size_t)v * stride);
+                for (int a = 0; a < 3; ++a)
+                {
+                    boundsMin[a] = std::min(boundsMin[a], p[a]);
+                    boundsMax[a] = std::max(boundsMax[a], p[a]);
+                }
+            }
+            for (int a = 0; a < 3; ++a)
+                extent = std::max(extent, boundsMax[a] - boundsMin[a]);
+        }
+        const float errorBudget = extent * settings.MaxRelativeError;
+
+        if (source.Submeshes.empty())
+        {
+            MeshFormat::Submesh all = {};
+            all.IndexCount = (std::uint32_t)source.Indices.size();
+            source.Submeshes.push_back(all);
+        }
+
+        // 2.  LOD  ٽ ٿ  ( )
+        const std::size_t submeshCount = source.Submeshes.size();
+        const std::uint32_t maxLods = std::min(settings.MaxLods, MeshFormat::MaxLods);
+        std::vector<float> lodErrors = { 0.0f };
+        std::vector<std::uint32_t> scratch;
+        float accumulatedError = 0.0f;
+
+        for (std::uint32_t lod = 1; lod < maxLods; ++lod)
+        {
+            const float stepBudget = errorBudget - accumulatedError;
+            if (stepBudget <= 0.0f)
+                break;
+
+            const std::size_t previousFirst = (lod - 1) * submeshCount;
+            const std::size_t indexEnd = source.Indices.size();
+            std::size_t previousTotal = 0, newTotal = 0;
+            float stepError = 0.0f;
+
+            std::vector<MeshFormat::Submesh> lodSubmeshes;
+            for (std::size_t s = 0; s < submeshCount; ++s)
+            {
+                const MeshFormat::Submesh previous = source.Submeshes[previousFirst + s];
+                previousTotal += previous.IndexCount;
+
+                //  ε Ǯ ܼȭ -> ĳ  -> ٽ BaseVertex 
+                scratch.resize(previous.IndexCount);
+                for (std::uint32_t i = 0; i < previous.IndexCount; ++i)
+                    scratch[i] = source.Indices[previous.IndexStart + i] + previous.BaseVertex;
+
+                const std::size_t target = (std::size_t)(previous.IndexCount / 3 * settings.Reduction) * 3;
+                float error = 0.0f;
+                const std::size_t count = Simplify(scratch.data(), scratch.size(), source.Vertices.data(), stride, vertexCount,
+                    target, stepBudget, &error);
+                MeshOptimizer::OptimizeVertexCache(scratch.data(), count, vertexCount);
+                stepError = std::max(stepError, error);
+
+                MeshFormat::Submesh submesh = previous;
+                submesh.IndexStart = (std::uint32_t)source.Indices.size();
+                submesh.IndexCount = (std::uint32_t)count;
+                for (std::size_t i = 0; i < count; ++i)
+                    source.Indices.push_back(scratch[i] - previous.BaseVertex);
+
+                lodSubmeshes.push_back(submesh);
+                newTotal += count;
+            }
+
+            // 3.   پ  
+            if ((double)newTotal > (double)previousTotal * settings.MinReduction)
+            {
+                source.Indices.resize(indexEnd);
+                break;
+            }
+
+            accumulatedError += stepError;
+            lodErrors.push_back(accumulatedError);
+            source.Submeshes.insert(source.Submeshes.end(), lodSubmeshes.begin(), lodSubmeshes.end());
+
+            report.Triangles[lod] = (std::uint32_t)(newTotal / 3);
+            report.Error[lod] = accumulatedError;
+        }
+
+        report.LodCount = (std::uint32_t)lodErrors.size();
+        if (report.LodCount > 1)
+            source.LodErrors = std::move(lodErrors);
+
+        report.SimplifyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        return report;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "MeshCooker.h"
+#include <string>
+
+// ==========================================================
+// ޽ ܼȭ / LOD ü  (ŷ ܰ)
+// - QEM (Garland-Heckbert):  ֺ   Ÿ  (quadric) 
+//         ٸ  ħ ( ۴ ״, ε ٲ)
+// -   鿡   ؼ   Ŵ
+//     踦 󼭸 ̰,  ġ Ӽ ٸ (UV/ ) 
+// -  ﰢ  ġ ǳʶ
+// -   ĥ  ִ  (  1-ring  ) ε ٽ   ݺ
+//    Ÿ (quadric  /  ġ )
+// ==========================================================
+
+struct LodChainSettings
+{
+    std::uint32_t MaxLods = 4;          // LOD0 
+    float Reduction = 0.5f;             // LOD  ﰢ ǥ  ( LOD )
+    float MaxRelativeError = 0.05f;     //  LOD    (޽  )
+    float MinReduction = 0.9f;          // ̺  پ ü 
+};
+
+struct LodChainReport
+{
+    std::uint32_t LodCount = 1;
+    std::uint32_t Triangles[MeshFormat::MaxLods] = {};
+    float Error[MeshFormat::MaxLods] = {};
+    double SimplifyMs = 0.0;
+
+    std::string ToString()const;
+};
+
+namespace MeshSimplifier
+{
+    // indices  ڸ ̰  ε  ȯ
+    // targetIndexCount  ų  ġ  targetError(Ÿ)  
+    // positions:  float3 (stride Ʈ )
+    std::size_t Simplify(std::uint32_t* indices, std::size_t indexCount,
+        const std::uint8_t* positions, std::uint32_t stride, std::uint32_t vertexCount,
+        std::size_t targetIndexCount, float targetError, float* resultError = nullptr);
+
+    // source  (LOD0) ޽ ܼȭؼ LOD  ε/޽ ڿ ̰ LodErrors  ä
+    // float ġ ˸ (  ȣ)
+    LodChainReport GenerateLods(MeshCookSource& source, const LodChainSettings& settings = LodChainSettings());
+}
@@ -0,0 +1,230 @@
+#include "NavMesh.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+    constexpr float EdgeEpsilon = 1e-3f; // Ÿ    (   ϹǷ ۾Ƶ )
+}
+
+void NavMesh::Init(const NavMeshParams& params)
+{
+    assert(params.TilesX > 0 && params.TilesZ > 0 && params.TileSize > 0.0f);
+    mParams = params;
+    mTiles.clear();
+    mTiles.resize((std::size_t)params.TilesX * params.TilesZ);
+    mTileCount = 0;
+    mPolyCount = 0;
+    ++mRevision;
+}
+
+std::int32_t NavMesh::TileIndex(std::int32_t x, std::int32_t z)const
+{
+    if (x < 0 || z < 0 || x >= mParams.TilesX || z >= mParams.TilesZ)
+        return -1;
+    return z * mParams.TilesX + x;
+}
+
+bool NavMesh::IsValid(NavPolyRef ref)const
+{
+    if (ref == NullPoly)
+        return false;
+    const std::uint32_t tile = ref >> NavPolyBits;
+    return tile < mTiles.size() && mTiles[tile].Valid && (ref & (MaxPolysPerTile - 1)) < mTiles[tile].Polys.size();
+}
+
+// ---------------------------------------------------------
+// Ÿ ֱ / 
+// ---------------------------------------------------------
+void NavMesh::AddTile(const NavTileData& data)
+{
+    const std::int32_t index = TileIndex(data.X, data.Z);
+    assert(index >= 0);
+    assert(data.Polys.size() <= MaxPolysPerTile);
+    if (mTiles[index].Valid)
+        RemoveTile(data.X, data.Z);
+
+    // 1. /ũ  (Ÿ  ȣ -> NavPolyRef)
+    Tile& tile = mTiles[index];
+    tile.Valid = true;
+    tile.Polys = data.Polys;
+    tile.Links = data.Links;
+    tile.FreeLink = NullLink;
+    const NavPolyRef base = (NavPolyRef)index << NavPolyBits;
+    for (NavLink& link : tile.Links)
+        link.Neighbor = base | link.Neighbor;
+
+    // 2.  ̿ Ÿϰ  ũ
+    const std::int32_t left = TileIndex(data.X - 1, data.Z), right = TileIndex(data.X + 1, data.Z);
+    const std::int32_t down = TileIndex(data.X, data.Z - 1), up = TileIndex(data.X, data.Z + 1);
+    if (left >= 0 && mTiles[left].Valid) ConnectTiles(left, index, 0);
+    if (right >= 0 && mTiles[right].Valid) ConnectTiles(index, right, 0);
+    if (down >= 0 && mTiles[down].Valid) ConnectTiles(down, index, 1);
+    if (up >= 0 && mTiles[up].Valid) ConnectTiles(index, up, 1);
+
+    ++mTileCount;
+    mPolyCount += (std::uint32_t)tile.Polys.size();
+    ++mRevision;
+}
+
+void NavMesh::RemoveTile(std::int32_t x, std::int32_t z)
+{
+    const std::int32_t index = TileIndex(x, z);
+    if (index < 0 || !mTiles[index].Valid)
+        return;
+
+    for (std::int32_t neighbor : { TileIndex(x - 1, z), TileIndex(x + 1, z), TileIndex(x, z - 1), TileIndex(x, z + 1) })
+    {
+        if (neighbor >= 0 && mTiles[neighbor].Valid)
+            UnlinkFrom(neighbor, index);
+    }
+
+    Tile& tile = mTiles[index];
+    --mTileCount;
+    mPolyCount -= (std::uint32_t)tile.Polys.size();
+    tile = Tile();
+    ++mRevision;
+}
+
+std::uint32_t NavMesh::AllocateLink(Tile& tile)
+{
+    if (tile.FreeLink != NullLink)
+    {
+        const std::uint32_t link = tile.FreeLink;
+        tile.FreeLink = tile.Links[link].Next;
+        return link;
+    }
+    tile.Links.emplace_back();
+    return (std::uint32_t)tile.Links.size() - 1;
+}
+
+void NavMesh::AddLink(NavPolyRef from, NavPolyRef to, float ax, float az, float bx, float bz)
+{
+    Tile& tile = mTiles[from >> NavPolyBits];
+    NavPoly& poly = tile.Polys[from & (MaxPolysPerTile - 1)];
+
+    const std::uint32_t index = AllocateLink(tile);
+    NavLink& link = tile.Links[index];
+    link.Neighbor = to;
+    link.Ax = ax; link.Az = az; link.Bx = bx; link.Bz = bz;
+    link.Next = poly.FirstLink;
+    poly.FirstLink = index;
+}
+
+// side 0: b  a  +X , side 1: b  a  +Z 
+void NavMesh::ConnectTiles(std::int32_t a, std::int32_t b, int side)
+{
+    const std::int32_t ax = a % mParams.TilesX, az = a / mParams.TilesX;
+    const float edge = side == 0 ? mParams.OriginX + (ax + 1) * mParams.TileSize : mParams.OriginZ + (az + 1) * mParams.TileSize;
+    const float maxDy = 2.0f * mParams.MaxClimb;
+
+    const std::vector<NavPoly>& polysA = mTiles[a].Polys;
+    const std::vector<NavPoly>& polysB = mTiles[b].Polys;
+    for (std::uint32_t i = 0; i < polysA.size(); ++i)
+    {
+        const NavPoly& pa = polysA[i];
+        if (std::fabs((side == 0 ? pa.MaxX : pa.MaxZ) - edge) > EdgeEpsilon)
+            continue;
+
+        for (std::uint32_t j = 0; j < polysB.size(); ++j)
+        {
+            const NavPoly& pb = polysB[j];
+            if (std::fabs((side == 0 ? pb.MinX : pb.MinZ) - edge) > EdgeEpsilon || std::fabs(pa.Y - pb.Y) > maxDy)
+                continue;
+
+            // 踦  ġ  
+            const float lo = side == 0 ? std::max(pa.MinZ, pb.MinZ) : std::max(pa.MinX, pb.MinX);
+            const float hi = side == 0 ? std::min(pa.MaxZ, pb.MaxZ) : std::min(pa.MaxX, pb.MaxX);
+            if (hi - lo <= EdgeEpsilon)
+                continue;
+
+            const NavPolyRef ra = ((NavPolyRef)a << NavPolyBits) | i;
+            const NavPolyRef rb = ((NavPolyRef)b << NavPolyBits) | j;
+            if (side == 0)
+            {
+                AddLink(ra, rb, edge, lo, edge, hi);
+                AddLink(rb, ra, edge, lo, edge, hi);
+            }
+            else
+            {
+                AddLink(ra, rb, lo, edge, hi, edge);
+                AddLink(rb, ra, lo, edge, hi, edge);
+            }
+        }
+    }
+}
+
+// tile  ￡ removed ŸϷ  ũ 
+void NavMesh::UnlinkFrom(std::int32_t tileIndex, std::int32_t removed)
+{
+    Tile& tile = mTiles[tileIndex];
+    for (NavPoly& poly : tile.Polys)
+    {
+        std::uint32_t* prev = &poly.FirstLink;
+        while (*prev != NullLink)
+        {
+            const std::uint32_t index = *prev;
+            NavLink& link = tile.Links[index];
+            if ((std::int32_t)(link.Neighbor >> NavPolyBits) == removed)
+            {
+                *prev = link.Next;
+                link.Neighbor = NullPoly;
+                link.Next = tile.FreeLink;
+                tile.FreeLink = index;
+            }
+            else
+            {
+                prev = &link.Next;
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------
+//   
+// ---------------------------------------------------------
+NavPolyRef NavMesh::FindNearestPoly(const float center[3], const float halfExtents[3], float outPoint[3])const
+{
+    const float inv = 1.0f / mParams.TileSize;
+    const std::int32_t x0 = (std::int32_t)std::floor((center[0] - halfExtents[0] - mParams.OriginX) * inv);
+    const std::int32_t x1 = (std::int32_t)std::floor((center[0] + halfExtents[0] - mParams.OriginX) * inv);
+    const std::int32_t z0 = (std::int32_t)std::floor((center[2] - halfExtents[2] - mParams.OriginZ) * inv);
+    const std::int32_t z1 = (std::int32_t)std::floor((center[2] + halfExtents[2] - mParams.OriginZ) * inv);
+
+    NavPolyRef best = NullPoly;
+    float bestSq = 0.0f;
+    for (std::int32_t z = std::max(z0, 0); z <= std::min(z1, mParams.TilesZ - 1); ++z)
+    {
+        for (std::int32_t x = std::max(x0, 0); x <= std::min(x1, mParams.TilesX - 1); ++x)
+        {
+            const std::int32_t index = TileIndex(x, z);
+            const Tile& tile = mTiles[index];
+            if (!tile.Valid)
+                continue;
+
+            for (std::uint32_t i = 0; i < tile.Polys.size(); ++i)
+            {
+                const NavPoly& poly = tile.Polys[i];
+                const float dy = poly.Y - center[1];
+                if (std::fabs(dy) > halfExtents[1])
+                    continue;
+
+                const float px = std::min(std::max(center[0], poly.MinX), poly.MaxX);
+                const float pz = std::min(std::max(center[2], poly.MinZ), poly.MaxZ);
+                const float dx = px - center[0], dz = pz - center[2];
+                if (std::fabs(dx) > halfExtents[0] || std::fabs(dz) > halfExtents[2])
+                    continue;
+
+                const float sq = dx * dx + dy * dy + dz * dz;
+                if (best == NullPoly || sq < bestSq)
+                {
+                    best = ((NavPolyRef)index << NavPolyBits) | i;
+                    bestSq = sq;
+                    outPoint[0] = px; outPoint[1] = poly.Y; outPoint[2] = pz;
+                }
+            }
+        }
+    }
+    return best;
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+// Ÿ ׺޽ (Ÿ)
+// - 带 TileSize 簢 ŸϷ . Ÿϸ   (NavMeshBuilder)  ְ   
+// -  =   ִ  ģ XZ 簢 () +  
+// - ũ = ̿  ´  (). Ÿ  ũ , Ÿ  ũ AddTile  ̾ 
+// -  ȣ NavPolyRef = Ÿ ĭ ȣ << NavPolyBits | Ÿ  ȣ
+//    (D3D ). AddTile/RemoveTile  ǰ   
+// ==========================================================
+
+using NavPolyRef = std::uint32_t;
+constexpr NavPolyRef NullPoly = 0xFFFFFFFFu;
+constexpr std::uint32_t NavPolyBits = 12;
+constexpr std::uint32_t MaxPolysPerTile = 1u << NavPolyBits;
+constexpr std::uint32_t NullLink = 0xFFFFFFFFu;
+
+struct NavPoly
+{
+    float MinX = 0.0f, MinZ = 0.0f, MaxX = 0.0f, MaxZ = 0.0f;
+    float Y = 0.0f;
+    std::uint32_t FirstLink = NullLink;   // Ÿ Links   Ʈ
+};
+
+// :   ´  (A, B  ǹ )
+struct NavLink
+{
+    NavPolyRef Neighbor = NullPoly;
+    float Ax = 0.0f, Az = 0.0f, Bx = 0.0f, Bz = 0.0f;
+    std::uint32_t Next = NullLink;
+};
+
+//   (Ÿ ϳ). Links  Neighbor   Ÿ  ȣ
+struct NavTileData
+{
+    std::int32_t X = 0, Z = 0;
+    std::vector<NavPoly> Polys;
+    std::vector<NavLink> Links;
+};
+
+struct NavMeshParams
+{
+    float OriginX = 0.0f, OriginZ = 0.0f;   // Ÿ (0, 0)  ּ 𼭸
+    float TileSize = 0.0f;                  //  
+    std::int32_t TilesX = 0, TilesZ = 0;
+    float MaxClimb = 0.0f;                  // Ÿ 踦 մ    (  ̶ 2 )
+};
+
+class NavMesh
+{
+public:
+    void Init(const NavMeshParams& params);
+
+    //  ĭ ִ Ÿ  . ̿ Ÿϰ  ũ ̾ 
+    void AddTile(const NavTileData& data);
+    void RemoveTile(std::int32_t x, std::int32_t z);
+
+    // center  halfExtents     . outPoint =     
+    NavPolyRef FindNearestPoly(const float center[3], const float halfExtents[3], float outPoint[3])const;
+
+    bool IsValid(NavPolyRef ref)const;
+    const NavPoly& GetPoly(NavPolyRef ref)const { return mTiles[ref >> NavPolyBits].Polys[ref & (MaxPolysPerTile - 1)]; }
+    const NavLink& GetLink(NavPolyRef ref, std::uint32_t link)const { return mTiles[ref >> NavPolyBits].Links[link]; }
+
+    // ü  : Ÿ ĭ t  i ° = (t << NavPolyBits) | i
+    std::uint32_t GetMaxTiles()const { return (std::uint32_t)mTiles.size(); }
+    std::uint32_t GetTilePolyCount(std::uint32_t tile)const { return mTiles[tile].Valid ? (std::uint32_t)mTiles[tile].Polys.size() : 0; }
+
+    const NavMeshParams& GetParams()const { return mParams; }
+    std::uint32_t GetTileCount()const { return mTileCount; }
+    std::uint32_t GetPolyCount()const { return mPolyCount; }
+
+    // Ÿ ٲ  ö ( ĳ ȿȭ)
+    std::uint32_t GetRevision()const { return mRevision; }
+
+private:
+    struct Tile
+    {
+        bool Valid = false;
+        std::vector<NavPoly> Polys;
+        std::vector<NavLink> Links;
+        std::uint32_t FreeLink = NullLink;
+    };
+
+    std::int32_t TileIndex(std::int32_t x, std::int32_t z)const;
+    std::uint32_t AllocateLink(Tile& tile);
+    void AddLink(NavPolyRef from, NavPolyRef to, float ax, float az, float bx, float bz);
+    void ConnectTiles(std::int32_t a, std::int32_t b, int side);
+    void UnlinkFrom(std::int32_t tile, std::int32_t removed);
+
+private:
+    NavMeshParams mParams;
+    std::vector<Tile> mTiles;     // TilesX * TilesZ
+    std::uint32_t mTileCount = 0;
+    std::uint32_t mPolyCount = 0;
+    std::uint32_t mRevision = 0;
+};
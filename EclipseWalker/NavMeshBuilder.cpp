@@ -0,0 +1,674 @@
+#include "NavMeshBuilder.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+    constexpr std::uint32_t NoIndex = 0xFFFFFFFFu;
+    constexpr std::uint16_t NoRect = 0xFFFF;
+    constexpr std::uint16_t OpenTop = 0xFFFF;   //    
+    constexpr int MaxClipVerts = 12;
+
+    // : 0 = -X, 1 = +Z, 2 = +X, 3 = -Z
+    constexpr int DirX[4] = { -1, 0, 1, 0 };
+    constexpr int DirZ[4] = { 0, 1, 0, -1 };
+
+    //  ٰ axis ǥ [lo, hi]  ڸ (Sutherland-Hodgman  )
+    int ClipPolygon(const float* in, int count, float* out, int axis, float lo, float hi)
+    {
+        float tmp[MaxClipVerts * 3];
+        auto clip = [axis](const float* src, int n, float* dst, float bound, float sign)
+        {
+            int m = 0;
+            for (int i = 0, j = n - 1; i < n; j = i, ++i)
+            {
+                const float* a = src + j * 3;
+                const float* b = src + i * 3;
+                const float da = (a[axis] - bound) * sign;
+                const float db = (b[axis] - bound) * sign;
+                if ((da >= 0.0f) != (db >= 0.0f))
+                {
+                    const float t = da / (da - db);
+                    dst[m * 3 + 0] = a[0] + (b[0] - a[0]) * t;
+                    dst[m * 3 + 1] = a[1] + (b[1] - a[1]) * t;
+                    dst[m * 3 + 2] = a[2] + (b[2] - a[2]) * t;
+                    ++m;
+                }
+                if (db >= 0.0f)
+                {
+                    dst[m * 3 + 0] = b[0]; dst[m * 3 + 1] = b[1]; dst[m * 3 + 2] = b[2];
+                    ++m;
+                }
+            }
+            return m;
+        };
+        const int n = clip(in, count, tmp, lo, 1.0f);
+        return n < 3 ? 0 : clip(tmp, n, out, hi, -1.0f);
+    }
+
+    // Ÿ ϳ    ӽ ڷ
+    struct Span
+    {
+        std::uint16_t Min = 0, Max = 0;
+        std::uint8_t Walkable = 0;
+        std::uint8_t Solid = 0;         // Ʒ   =   ޽ 
+        std::uint32_t Next = NoIndex;
+    };
+
+    struct OpenCell
+    {
+        std::uint16_t Y = 0;            //    (  )
+        std::uint16_t Top = OpenTop;    //   ٴ
+        std::uint32_t Column = 0;
+        std::uint32_t Conn[4] = { NoIndex, NoIndex, NoIndex, NoIndex };
+    };
+
+    struct PortalCell
+    {
+        std::uint16_t From = 0, To = 0;
+        std::uint8_t Dir = 0;
+        std::int32_t Along = 0;
+
+        bool operator<(const PortalCell& o)const
+        {
+            if (From != o.From) return From < o.From;
+            if (To != o.To) return To < o.To;
+            if (Dir != o.Dir) return Dir < o.Dir;
+            return Along < o.Along;
+        }
+    };
+}
+
+// ---------------------------------------------------------
+// Է Ʈ
+// ---------------------------------------------------------
+void NavInputGeometry::AddTriangles(const float* positions, std::uint32_t vertexCount, const std::uint32_t* indices, std::uint32_t triangleCount)
+{
+    const std::uint32_t base = (std::uint32_t)(mPositions.size() / 3);
+    mPositions.insert(mPositions.end(), positions, positions + (std::size_t)vertexCount * 3);
+    for (std::uint32_t i = 0; i < triangleCount * 3; ++i)
+        mIndices.push_back(base + indices[i]);
+}
+
+void NavInputGeometry::AddBox(const float world[16], float extentX, float extentY, float extentZ)
+{
+    // 1.  8 (bit0 = +X, bit1 = +Y, bit2 = +Z)
+    float corners[8 * 3];
+    for (int i = 0; i < 8; ++i)
+    {
+        const float lx = (i & 1) ? extentX : -extentX;
+        const float ly = (i & 2) ? extentY : -extentY;
+        const float lz = (i & 4) ? extentZ : -extentZ;
+        for (int k = 0; k < 3; ++k)
+            corners[i * 3 + k] = lx * world[0 * 4 + k] + ly * world[4 + k] + lz * world[8 + k] + world[12 + k];
+    }
+
+    // 2.  6 = ﰢ 12.   ٱ  
+    static const std::uint32_t faces[6][4] =
+    {
+        { 0, 2, 6, 4 }, { 1, 3, 7, 5 },   // -X, +X
+        { 0, 1, 5, 4 }, { 2, 3, 7, 6 },   // -Y, +Y
+        { 0, 1, 3, 2 }, { 4, 5, 7, 6 },   // -Z, +Z
+    };
+    const float center[3] = { world[12], world[13], world[14] };
+    const std::uint32_t base = (std::uint32_t)(mPositions.size() / 3);
+    mPositions.insert(mPositions.end(), corners, corners + 24);
+
+    for (const auto& f : faces)
+    {
+        const float* a = corners + f[0] * 3;
+        const float* b = corners + f[1] * 3;
+        const float* c = corners + f[2] * 3;
+        const float e0[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+        const float e1[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+        const float n[3] = { e0[1] * e1[2] - e0[2] * e1[1], e0[2] * e1[0] - e0[0] * e1[2], e0[0] * e1[1] - e0[1] * e1[0] };
+
+        float outward = 0.0f;
+        for (int k = 0; k < 3; ++k)
+        {
+            const float faceCenter = 0.5f * (a[k] + c[k]);
+            outward += n[k] * (faceCenter - center[k]);
+        }
+
+        const std::uint32_t q[4] = { base + f[0], base + f[1], base + f[2], base + f[3] };
+        if (outward >= 0.0f)
+            mIndices.insert(mIndices.end(), { q[0], q[1], q[2], q[0], q[2], q[3] });
+        else
+            mIndices.insert(mIndices.end(), { q[0], q[2], q[1], q[0], q[3], q[2] });
+    }
+}
+
+void NavInputGeometry::GetBounds(float outMin[3], float outMax[3])const
+{
+    for (int k = 0; k < 3; ++k)
+    {
+        outMin[k] = FLT_MAX;
+        outMax[k] = -FLT_MAX;
+    }
+    for (std::size_t i = 0; i < mPositions.size(); i += 3)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            outMin[k] = std::min(outMin[k], mPositions[i + k]);
+            outMax[k] = std::max(outMax[k], mPositions[i + k]);
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// غ: Ÿ  + ŸϺ ﰢ 
+// ---------------------------------------------------------
+NavMeshBuilder::NavMeshBuilder(const NavInputGeometry& geometry, const NavBuildSettings& settings)
+    : mGeometry(geometry)
+    , mSettings(settings)
+{
+    assert(settings.TileCells > 0 && settings.CellSize > 0.0f && settings.CellHeight > 0.0f);
+
+    float bmin[3], bmax[3];
+    geometry.GetBounds(bmin, bmax);
+    if (geometry.GetTriangleCount() == 0)
+    {
+        bmin[0] = bmin[1] = bmin[2] = 0.0f;
+        bmax[0] = bmax[1] = bmax[2] = 0.0f;
+    }
+
+    const float tileSize = settings.TileCells * settings.CellSize;
+    mParams.OriginX = bmin[0];
+    mParams.OriginZ = bmin[2];
+    mParams.TileSize = tileSize;
+    mParams.TilesX = std::max(1, (std::int32_t)std::ceil((bmax[0] - bmin[0]) / tileSize));
+    mParams.TilesZ = std::max(1, (std::int32_t)std::ceil((bmax[2] - bmin[2]) / tileSize));
+    mParams.MaxClimb = settings.AgentMaxClimb;
+
+    mMinY = bmin[1];
+    mMaxY = bmax[1] + settings.AgentHeight;
+    assert((mMaxY - mMinY) / settings.CellHeight < (float)OpenTop);
+    mBorderCells = (std::uint32_t)std::ceil(settings.AgentRadius / settings.CellSize) + 3;
+
+    // ﰢ XZ  (+ ׵θ)  ġ Ÿϸ  (    -> ä)
+    const std::uint32_t tileCount = (std::uint32_t)(mParams.TilesX * mParams.TilesZ);
+    const std::vector<float>& pos = geometry.GetPositions();
+    const std::vector<std::uint32_t>& idx = geometry.GetIndices();
+    const float border = mBorderCells * settings.CellSize;
+
+    auto tileRange = [&](std::uint32_t tri, std::int32_t& x0, std::int32_t& x1, std::int32_t& z0, std::int32_t& z1)
+    {
+        float minX = FLT_MAX, maxX = -FLT_MAX, minZ = FLT_MAX, maxZ = -FLT_MAX;
+        for (int v = 0; v < 3; ++v)
+        {
+            const float* p = &pos[(std::size_t)idx[tri * 3 + v] * 3];
+            minX = std::min(minX, p[0]); maxX = std::max(maxX, p[0]);
+            minZ = std::min(minZ, p[2]); maxZ = std::max(maxZ, p[2]);
+        }
+        x0 = std::max(0, (std::int32_t)std::floor((minX - border - mParams.OriginX) / tileSize));
+        x1 = std::min(mParams.TilesX - 1, (std::int32_t)std::floor((maxX + border - mParams.OriginX) / tileSize));
+        z0 = std::max(0, (std::int32_t)std::floor((minZ - border - mParams.OriginZ) / tileSize));
+        z1 = std::min(mParams.TilesZ - 1, (std::int32_t)std::floor((maxZ + border - mParams.OriginZ) / tileSize));
+    };
+
+    mTileTriangleStart.assign(tileCount + 1, 0);
+    for (std::uint32_t tri = 0; tri < geometry.GetTriangleCount(); ++tri)
+    {
+        std::int32_t x0, x1, z0, z1;
+        tileRange(tri, x0, x1, z0, z1);
+        for (std::int32_t z = z0; z <= z1; ++z)
+            for (std::int32_t x = x0; x <= x1; ++x)
+                ++mTileTriangleStart[z * mParams.TilesX + x + 1];
+    }
+    for (std::uint32_t i = 0; i < tileCount; ++i)
+        mTileTriangleStart[i + 1] += mTileTriangleStart[i];
+
+    mTileTriangles.resize(mTileTriangleStart[tileCount]);
+    std::vector<std::uint32_t> cursor(mTileTriangleStart.begin(), mTileTriangleStart.end() - 1);
+    for (std::uint32_t tri = 0; tri < geometry.GetTriangleCount(); ++tri)
+    {
+        std::int32_t x0, x1, z0, z1;
+        tileRange(tri, x0, x1, z0, z1);
+        for (std::int32_t z = z0; z <= z1; ++z)
+            for (std::int32_t x = x0; x <= x1; ++x)
+                mTileTriangles[cursor[z * mParams.TilesX + x]++] = tri;
+    }
+}
+
+// ---------------------------------------------------------
+// Ÿ ϳ
+// ---------------------------------------------------------
+bool NavMeshBuilder::BuildTile(std::int32_t tileX, std::int32_t tileZ, NavTileData& out, NavBuildStats* stats)const
+{
+    const float cs = mSettings.CellSize;
+    const float ch = mSettings.CellHeight;
+    const std::int32_t T = (std::int32_t)mSettings.TileCells;
+    const std::int32_t B = (std::int32_t)mBorderCells;
+    const std::int32_t W = T + 2 * B;
+
+    const std::int32_t cellX0 = tileX * T - B;  //  (0, 0)    ǥ
+    const std::int32_t cellZ0 = tileZ * T - B;
+    const float bminX = mParams.OriginX + cellX0 * cs;
+    const float bminZ = mParams.OriginZ + cellZ0 * cs;
+
+    const int heightCells = (int)std::ceil(mSettings.AgentHeight / ch);
+    const int climbCells = (int)std::floor(mSettings.AgentMaxClimb / ch);
+    const int rectClimbCells = climbCells / 2;
+    const int radiusCells = (int)std::ceil(mSettings.AgentRadius / cs);
+    const float minWalkableY = std::cos(mSettings.MaxSlopeDegrees * 3.14159265f / 180.0f);
+
+    out = NavTileData();
+    out.X = tileX;
+    out.Z = tileZ;
+
+    // 1. ȭ: ﰢ Z  -> X  ߶ [, ְ] 
+    std::vector<Span> spans;
+    std::vector<std::uint32_t> heads((std::size_t)W * W, NoIndex);
+
+    auto addSpan = [&](std::uint32_t column, std::uint16_t smin, std::uint16_t smax, std::uint8_t walkable, std::uint8_t solid)
+    {
+        // ġ  ħ.    (1 )   ִ  ̱
+        Span s{ smin, smax, walkable, solid, NoIndex };
+        std::uint32_t prev = NoIndex;
+        std::uint32_t cur = heads[column];
+        while (cur != NoIndex)
+        {
+            Span& c = spans[cur];
+            if (c.Min > s.Max)
+                break;
+            if (c.Max < s.Min)
+            {
+                prev = cur;
+                cur = c.Next;
+                continue;
+            }
+
+            s.Min = std::min(s.Min, c.Min);
+            s.Max = std::max(s.Max, c.Max);
+            if (std::abs((int)s.Max - (int)c.Max) <= 1)
+                s.Walkable = std::max(s.Walkable, c.Walkable);
+            s.Solid = std::max(s.Solid, c.Solid);
+
+            const std::uint32_t next = c.Next;
+            if (prev == NoIndex)
+                heads[column] = next;
+            else
+                spans[prev].Next = next;
+            cur = next;
+        }
+
+        s.Next = cur;
+        spans.push_back(s);
+        const std::uint32_t index = (std::uint32_t)spans.size() - 1;
+        if (prev == NoIndex)
+            heads[column] = index;
+        else
+            spans[prev].Next = index;
+    };
+
+    const std::vector<float>& positions = mGeometry.GetPositions();
+    const std::vector<std::uint32_t>& indices = mGeometry.GetIndices();
+    const std::uint32_t tileIndex = (std::uint32_t)(tileZ * mParams.TilesX + tileX);
+    const float maxSpan = (float)(OpenTop - 1);
+
+    for (std::uint32_t t = mTileTriangleStart[tileIndex]; t < mTileTriangleStart[tileIndex + 1]; ++t)
+    {
+        const std::uint32_t tri = mTileTriangles[t];
+        float verts[3 * 3];
+        for (int v = 0; v < 3; ++v)
+        {
+            const float* p = &positions[(std::size_t)indices[tri * 3 + v] * 3];
+            verts[v * 3 + 0] = p[0]; verts[v * 3 + 1] = p[1]; verts[v * 3 + 2] = p[2];
+        }
+
+        const float e0[3] = { verts[3] - verts[0], verts[4] - verts[1], verts[5] - verts[2] };
+        const float e1[3] = { verts[6] - verts[0], verts[7] - verts[1], verts[8] - verts[2] };
+        const float nx = e0[1] * e1[2] - e0[2] * e1[1];
+        const float ny = e0[2] * e1[0] - e0[0] * e1[2];
+        const float nz = e0[0] * e1[1] - e0[1] * e1[0];
+        const float len = std::sqrt(nx * nx + ny * ny + nz * nz);
+        const std::uint8_t walkable = len > 0.0f && ny / len >= minWalkableY ? 1 : 0;
+        const std::uint8_t solid = len > 0.0f && ny / len < -0.01f ? 1 : 0;
+
+        float minZ = std::min({ verts[2], verts[5], verts[8] });
+        float maxZ = std::max({ verts[2], verts[5], verts[8] });
+        const std::int32_t z0 = std::max(0, (std::int32_t)std::floor((minZ - bminZ) / cs));
+        const std::int32_t z1 = std::min(W - 1, (std::int32_t)std::floor((maxZ - bminZ) / cs));
+
+        for (std::int32_t z = z0; z <= z1; ++z)
+        {
+            float row[MaxClipVerts * 3];
+            const int rowCount = ClipPolygon(verts, 3, row, 2, bminZ + z * cs, bminZ + (z + 1) * cs);
+            if (rowCount < 3)
+                continue;
+
+            float minX = FLT_MAX, maxX = -FLT_MAX;
+            for (int v = 0; v < rowCount; ++v)
+            {
+                minX = std::min(minX, row[v * 3]);
+                maxX = std::max(maxX, row[v * 3]);
+            }
+            const std::int32_t x0 = std::max(0, (std::int32_t)std::floor((minX - bminX) / cs));
+            const std::int32_t x1 = std::min(W - 1, (std::int32_t)std::floor((maxX - bminX) / cs));
+
+            for (std::int32_t x = x0; x <= x1; ++x)
+            {
+                float cell[MaxClipVerts * 3];
+                const int cellCount = ClipPolygon(row, rowCount, cell, 0, bminX + x * cs, bminX + (x + 1) * cs);
+                if (cellCount < 3)
+                    continue;
+
+                float minY = FLT_MAX, maxY = -FLT_MAX;
+                for (int v = 0; v < cellCount; ++v)
+                {
+                    minY = std::min(minY, cell[v * 3 + 1]);
+                    maxY = std::max(maxY, cell[v * 3 + 1]);
+                }
+                //      ״ΰ ǵ Ʒ  ĭ
+                const float smax = std::clamp(std::ceil((maxY - mMinY) / ch), 1.0f, maxSpan);
+                const float smin = std::clamp(std::floor((minY - mMinY) / ch), 0.0f, smax - 1.0f);
+                addSpan((std::uint32_t)(z * W + x), (std::uint16_t)smin, (std::uint16_t)smax, walkable, solid);
+            }
+        }
+    }
+
+    // 1-1.  ޽  ä: Ʒ   ٷ   ( ޽ )   
+    //       ϸ ǹ ٴڸ       ִ  
+    for (std::uint32_t column = 0; column < (std::uint32_t)(W * W); ++column)
+    {
+        for (std::uint32_t s = heads[column]; s != NoIndex; s = spans[s].Next)
+        {
+            while (spans[s].Solid && spans[s].Next != NoIndex)
+            {
+                const Span up = spans[spans[s].Next];
+                spans[s].Max = up.Max;
+                spans[s].Walkable = up.Walkable;
+                spans[s].Solid = up.Solid;
+                spans[s].Next = up.Next;
+            }
+        }
+    }
+
+    // 2.  :   ִ    AgentHeight ŭ  
+    std::vector<OpenCell> cells;
+    std::vector<std::uint32_t> columnStart((std::size_t)W * W + 1, 0);
+    for (std::uint32_t column = 0; column < (std::uint32_t)(W * W); ++column)
+    {
+        columnStart[column] = (std::uint32_t)cells.size();
+        for (std::uint32_t s = heads[column]; s != NoIndex; s = spans[s].Next)
+        {
+            const Span& span = spans[s];
+            const std::uint16_t top = span.Next != NoIndex ? spans[span.Next].Min : OpenTop;
+            if (!span.Walkable || (int)top - (int)span.Max < heightCells)
+                continue;
+
+            OpenCell cell;
+            cell.Y = span.Max;
+            cell.Top = top;
+            cell.Column = column;
+            cells.push_back(cell);
+        }
+    }
+    columnStart[(std::size_t)W * W] = (std::uint32_t)cells.size();
+
+    if (stats)
+    {
+        stats->Spans += spans.size();
+        stats->OpenCells += cells.size();
+    }
+    if (cells.empty())
+        return false;
+
+    // 3. ̿ :   AgentHeight ̻,   AgentMaxClimb 
+    for (OpenCell& cell : cells)
+    {
+        const std::int32_t x = (std::int32_t)(cell.Column % W), z = (std::int32_t)(cell.Column / W);
+        for (int d = 0; d < 4; ++d)
+        {
+            const std::int32_t nx = x + DirX[d], nz = z + DirZ[d];
+            if (nx < 0 || nz < 0 || nx >= W || nz >= W)
+                continue;
+
+            const std::uint32_t nc = (std::uint32_t)(nz * W + nx);
+            for (std::uint32_t n = columnStart[nc]; n < columnStart[nc + 1]; ++n)
+            {
+                const OpenCell& other = cells[n];
+                const int bottom = std::max(cell.Y, other.Y);
+                const int top = std::min(cell.Top, other.Top);
+                if (top - bottom >= heightCells && std::abs((int)other.Y - (int)cell.Y) <= climbCells)
+                {
+                    cell.Conn[d] = n;
+                    break;
+                }
+            }
+        }
+    }
+
+    // 4. ڸ AgentRadius  : ( 4 ƴ)  Ÿ ( 2, 밢 3)
+    const std::uint32_t cellCount = (std::uint32_t)cells.size();
+    std::vector<std::uint8_t> dist(cellCount, 255);
+    for (std::uint32_t i = 0; i < cellCount; ++i)
+    {
+        const OpenCell& c = cells[i];
+        if (c.Conn[0] == NoIndex || c.Conn[1] == NoIndex || c.Conn[2] == NoIndex || c.Conn[3] == NoIndex)
+            dist[i] = 0;
+    }
+
+    auto relax = [&](std::uint32_t i, int d, int diagonal)
+    {
+        const std::uint32_t a = cells[i].Conn[d];
+        if (a == NoIndex)
+            return;
+        dist[i] = (std::uint8_t)std::min<int>(dist[i], dist[a] + 2);
+        const std::uint32_t aa = cells[a].Conn[diagonal];
+        if (aa != NoIndex)
+            dist[i] = (std::uint8_t)std::min<int>(dist[i], dist[aa] + 3);
+    };
+    for (std::uint32_t column = 0; column < (std::uint32_t)(W * W); ++column)
+    {
+        for (std::uint32_t i = columnStart[column]; i < columnStart[column + 1]; ++i)
+        {
+            relax(i, 0, 3);  // -X,  -Z
+            relax(i, 3, 2);  // -Z,  +X
+        }
+    }
+    for (std::uint32_t column = (std::uint32_t)(W * W); column-- > 0;)
+    {
+        for (std::uint32_t i = columnStart[column]; i < columnStart[column + 1]; ++i)
+        {
+            relax(i, 2, 1);  // +X,  +Z
+            relax(i, 1, 0);  // +Z,  -X
+        }
+    }
+
+    const int erode = radiusCells * 2;
+    auto inTile = [&](std::uint32_t i)
+    {
+        const std::int32_t x = (std::int32_t)(cells[i].Column % W), z = (std::int32_t)(cells[i].Column / W);
+        return x >= B && z >= B && x < B + T && z < B + T;
+    };
+    auto usable = [&](std::uint32_t i)
+    {
+        return i != NoIndex && dist[i] >= erode && inTile(i);
+    };
+
+    // 5. 簢 ġ:     +X  +Z  ׵, ٸ ̾ ŭ  ٿ 
+    //    ̰  ū (,  )   (񽺵    ¥  ɰ ʰ)
+    //     簢  ̴    AgentMaxClimb / 2 ̳ ( ̷ ᵵ  ۰)
+    std::vector<std::uint16_t> rect(cellCount, NoRect);
+    const std::uint32_t maxCells = std::max(1u, mSettings.MaxPolyCells);
+    std::vector<std::uint32_t> block((std::size_t)maxCells * maxCells);  // [ * maxCells + ĭ]
+
+    for (std::int32_t z = B; z < B + T; ++z)
+    {
+        for (std::int32_t x = B; x < B + T; ++x)
+        {
+            const std::uint32_t column = (std::uint32_t)(z * W + x);
+            for (std::uint32_t seed = columnStart[column]; seed < columnStart[column + 1]; ++seed)
+            {
+                if (!usable(seed) || rect[seed] != NoRect)
+                    continue;
+
+                const int seedY = cells[seed].Y;
+                auto fits = [&](std::uint32_t i)
+                {
+                    return usable(i) && rect[i] == NoRect && std::abs((int)cells[i].Y - seedY) <= rectClimbCells;
+                };
+
+                // ù 
+                std::uint32_t width = 1;
+                block[0] = seed;
+                while (width < maxCells && fits(cells[block[width - 1]].Conn[2]))
+                {
+                    block[width] = cells[block[width - 1]].Conn[2];
+                    ++width;
+                }
+                std::uint32_t bestWidth = width, bestRows = 1;
+
+                //  :  ĭ +Z ̿  +X  ̾ ŭ
+                for (std::uint32_t r = 1; r < maxCells; ++r)
+                {
+                    const std::uint32_t* above = &block[(r - 1) * maxCells];
+                    std::uint32_t* current = &block[r * maxCells];
+                    std::uint32_t run = 0;
+                    while (run < width)
+                    {
+                        const std::uint32_t n = cells[above[run]].Conn[1];
+                        if (!fits(n) || (run > 0 && cells[current[run - 1]].Conn[2] != n))
+                            break;
+                        current[run++] = n;
+                    }
+                    if (run == 0)
+                        break;
+
+                    width = run;
+                    if (width * (r + 1) > bestWidth * bestRows)
+                    {
+                        bestWidth = width;
+                        bestRows = r + 1;
+                    }
+                }
+
+                const std::uint16_t id = (std::uint16_t)out.Polys.size();
+                assert(out.Polys.size() < MaxPolysPerTile);
+                float sumY = 0.0f;
+                for (std::uint32_t r = 0; r < bestRows; ++r)
+                {
+                    for (std::uint32_t k = 0; k < bestWidth; ++k)
+                    {
+                        rect[block[r * maxCells + k]] = id;
+                        sumY += cells[block[r * maxCells + k]].Y;
+                    }
+                }
+
+                NavPoly poly;
+                poly.MinX = mParams.OriginX + (cellX0 + x) * cs;
+                poly.MinZ = mParams.OriginZ + (cellZ0 + z) * cs;
+                poly.MaxX = mParams.OriginX + (cellX0 + x + (std::int32_t)bestWidth) * cs;
+                poly.MaxZ = mParams.OriginZ + (cellZ0 + z + (std::int32_t)bestRows) * cs;
+                poly.Y = mMinY + sumY / (bestWidth * bestRows) * ch;
+                out.Polys.push_back(poly);
+            }
+        }
+    }
+
+    if (out.Polys.empty())
+        return false;
+
+    // 6. : ٸ 簢 ̾      ũ ϳ
+    std::vector<PortalCell> portalCells;
+    for (std::uint32_t i = 0; i < cellCount; ++i)
+    {
+        if (rect[i] == NoRect)
+            continue;
+        const std::int32_t x = (std::int32_t)(cells[i].Column % W), z = (std::int32_t)(cells[i].Column / W);
+        for (int d = 0; d < 4; ++d)
+        {
+            const std::uint32_t n = cells[i].Conn[d];
+            if (n == NoIndex || rect[n] == NoRect || rect[n] == rect[i])
+                continue;
+            portalCells.push_back({ rect[i], rect[n], (std::uint8_t)d, (d == 0 || d == 2) ? z : x });
+        }
+    }
+    std::sort(portalCells.begin(), portalCells.end());
+
+    for (std::size_t begin = 0; begin < portalCells.size();)
+    {
+        const PortalCell& first = portalCells[begin];
+        std::size_t end = begin + 1;
+        while (end < portalCells.size() && portalCells[end].From == first.From && portalCells[end].To == first.To &&
+            portalCells[end].Dir == first.Dir && portalCells[end].Along == portalCells[end - 1].Along + 1)
+            ++end;
+
+        const NavPoly& poly = out.Polys[first.From];
+        const std::int32_t lo = first.Along, hi = portalCells[end - 1].Along + 1;
+
+        NavLink link;
+        link.Neighbor = first.To;
+        if (first.Dir == 0 || first.Dir == 2)
+        {
+            link.Ax = link.Bx = first.Dir == 0 ? poly.MinX : poly.MaxX;
+            link.Az = bminZ + lo * cs;
+            link.Bz = bminZ + hi * cs;
+        }
+        else
+        {
+            link.Az = link.Bz = first.Dir == 3 ? poly.MinZ : poly.MaxZ;
+            link.Ax = bminX + lo * cs;
+            link.Bx = bminX + hi * cs;
+        }
+        link.Next = out.Polys[first.From].FirstLink;
+        out.Polys[first.From].FirstLink = (std::uint32_t)out.Links.size();
+        out.Links.push_back(link);
+
+        begin = end;
+    }
+
+    if (stats)
+    {
+        stats->Polys += (std::uint32_t)out.Polys.size();
+        stats->Links += (std::uint32_t)out.Links.size();
+    }
+    return true;
+}
+
+// ---------------------------------------------------------
+// ü
+// ---------------------------------------------------------
+NavBuildStats NavMeshBuilder::BuildAll(NavMesh& navMesh, bool parallel)const
+{
+    navMesh.Init(mParams);
+
+    const std::uint32_t tileCount = (std::uint32_t)(mParams.TilesX * mParams.TilesZ);
+    std::vector<NavTileData> tiles(tileCount);
+    std::vector<NavBuildStats> tileStats(tileCount);
+    std::vector<std::uint8_t> built(tileCount, 0);
+
+    auto build = [&](std::uint32_t begin, std::uint32_t end)
+    {
+        for (std::uint32_t i = begin; i < end; ++i)
+            built[i] = BuildTile((std::int32_t)(i % mParams.TilesX), (std::int32_t)(i / mParams.TilesX), tiles[i], &tileStats[i]) ? 1 : 0;
+    };
+    if (parallel)
+    {
+        JobSystem::GetInstance()->Initialize();
+        JobSystem::GetInstance()->ParallelFor(tileCount, 1, build);
+    }
+    else
+    {
+        build(0, tileCount);
+    }
+
+    // ̾ ̱  忡 (̿ Ÿ ũ ħ)
+    NavBuildStats stats;
+    for (std::uint32_t i = 0; i < tileCount; ++i)
+    {
+        stats.Spans += tileStats[i].Spans;
+        stats.OpenCells += tileStats[i].OpenCells;
+        if (!built[i])
+            continue;
+        navMesh.AddTile(tiles[i]);
+        ++stats.Tiles;
+        stats.Polys += tileStats[i].Polys;
+        stats.Links += tileStats[i].Links;
+    }
+    return stats;
+}
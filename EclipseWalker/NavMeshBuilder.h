@@ -0,0 +1,83 @@
+#pragma once
+#include "NavMesh.h"
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+//   ׺޽  (Recast   )
+// Ÿϸ (̿ Ÿϰ ġ ׵θ ):
+//   1. ﰢ   ߶  ()  ȭ.  MaxSlope  鸸   
+//       ޽  ä (Ʒ   ~   )
+//   2.  AgentHeight ŭ  ִ   =  .     AgentMaxClimb ϸ ̾
+//   3. ڸ AgentRadius   (Ÿ)
+//   4. ̾  簢  ,    ũ
+// Ÿϳ   Ƿ  ý ķ  NavMesh::AddTile  ̾ 
+// ==========================================================
+
+struct NavBuildSettings
+{
+    float CellSize = 0.3f;          // XZ  ũ
+    float CellHeight = 0.1f;        // Y  ũ
+    float AgentHeight = 2.0f;
+    float AgentRadius = 0.5f;
+    float AgentMaxClimb = 0.5f;
+    float MaxSlopeDegrees = 45.0f;
+    std::uint32_t TileCells = 48;   // Ÿ    
+    std::uint32_t MaxPolyCells = 16; // 簢   ִ   (ʹ ũ A*  Ȯ)
+};
+
+//  Ʈ (ﰢ ). (v1 - v0) x (v2 - v0)  ٱ() 
+//  ִ ü  ޽ (ٴڸ ־  ä)
+class NavInputGeometry
+{
+public:
+    void AddTriangles(const float* positions, std::uint32_t vertexCount, const std::uint32_t* indices, std::uint32_t triangleCount);
+
+    // world =  켱 4x4 (  Ծ),  ڴ [-extent, extent] (CollisionWorld::AddBox  )
+    void AddBox(const float world[16], float extentX, float extentY, float extentZ);
+
+    const std::vector<float>& GetPositions()const { return mPositions; }
+    const std::vector<std::uint32_t>& GetIndices()const { return mIndices; }
+    std::uint32_t GetTriangleCount()const { return (std::uint32_t)mIndices.size() / 3; }
+
+    void GetBounds(float outMin[3], float outMax[3])const;
+
+private:
+    std::vector<float> mPositions;
+    std::vector<std::uint32_t> mIndices;
+};
+
+struct NavBuildStats
+{
+    std::uint32_t Tiles = 0;
+    std::uint32_t Polys = 0;
+    std::uint32_t Links = 0;
+    std::uint64_t Spans = 0;
+    std::uint64_t OpenCells = 0;
+};
+
+class NavMeshBuilder
+{
+public:
+    NavMeshBuilder(const NavInputGeometry& geometry, const NavBuildSettings& settings);
+
+    const NavMeshParams& GetParams()const { return mParams; }
+
+    // Ÿ ϳ ( 忡 ÿ ҷ ).    false
+    bool BuildTile(std::int32_t tileX, std::int32_t tileZ, NavTileData& out, NavBuildStats* stats = nullptr)const;
+
+    // ü Ÿ  navMesh  Init + AddTile. parallel ̸ Ÿ   ýۿ
+    NavBuildStats BuildAll(NavMesh& navMesh, bool parallel = true)const;
+
+private:
+    const NavInputGeometry& mGeometry;
+    NavBuildSettings mSettings;
+    NavMeshParams mParams;
+
+    float mMinY = 0.0f, mMaxY = 0.0f;
+    std::uint32_t mBorderCells = 0;   // Ÿ   ȭϴ   ( Ⱑ 迡 µ)
+
+    // Ÿ -> ġ ﰢ (̸  )
+    std::vector<std::uint32_t> mTileTriangleStart;
+    std::vector<std::uint32_t> mTileTriangles;
+};
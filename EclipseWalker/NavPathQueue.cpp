@@ -0,0 +1,241 @@
+#include "NavPathQueue.h"
+#include <algorithm>
+#include <cassert>
+
+// ---------------------------------------------------------
+//  ĳ (LRU)
+// ---------------------------------------------------------
+NavPathCache::NavPathCache(std::uint32_t capacity)
+    : mCapacity(capacity)
+{
+    mEntries.reserve(capacity);
+    mLookup.reserve((std::size_t)capacity * 2);
+}
+
+void NavPathCache::Clear()
+{
+    mEntries.clear();
+    mLookup.clear();
+    mHead = mTail = NullEntry;
+}
+
+void NavPathCache::Sync(std::uint32_t revision)
+{
+    if (revision != mRevision)
+    {
+        Clear();
+        mRevision = revision;
+    }
+}
+
+void NavPathCache::Unlink(std::uint32_t index)
+{
+    Entry& e = mEntries[index];
+    if (e.Prev != NullEntry) mEntries[e.Prev].Next = e.Next; else mHead = e.Next;
+    if (e.Next != NullEntry) mEntries[e.Next].Prev = e.Prev; else mTail = e.Prev;
+    e.Prev = e.Next = NullEntry;
+}
+
+void NavPathCache::PushFront(std::uint32_t index)
+{
+    Entry& e = mEntries[index];
+    e.Prev = NullEntry;
+    e.Next = mHead;
+    if (mHead != NullEntry)
+        mEntries[mHead].Prev = index;
+    mHead = index;
+    if (mTail == NullEntry)
+        mTail = index;
+}
+
+bool NavPathCache::Find(NavPolyRef start, NavPolyRef end, std::uint32_t revision, std::vector<NavPolyRef>& outPath)
+{
+    Sync(revision);
+    auto it = mLookup.find(((std::uint64_t)start << 32) | end);
+    if (it == mLookup.end())
+        return false;
+
+    outPath = mEntries[it->second].Path;
+    Unlink(it->second);
+    PushFront(it->second);
+    return true;
+}
+
+void NavPathCache::Store(NavPolyRef start, NavPolyRef end, std::uint32_t revision, const std::vector<NavPolyRef>& path)
+{
+    if (mCapacity == 0)
+        return;
+    Sync(revision);
+
+    const std::uint64_t key = ((std::uint64_t)start << 32) | end;
+    std::uint32_t index;
+    auto it = mLookup.find(key);
+    if (it != mLookup.end())
+    {
+        index = it->second;
+        Unlink(index);
+    }
+    else if (mEntries.size() < mCapacity)
+    {
+        index = (std::uint32_t)mEntries.size();
+        mEntries.emplace_back();
+        mLookup.emplace(key, index);
+    }
+    else
+    {
+        //      
+        index = mTail;
+        Unlink(index);
+        mLookup.erase(mEntries[index].Key);
+        mLookup.emplace(key, index);
+    }
+
+    Entry& e = mEntries[index];
+    e.Key = key;
+    e.Path = path;
+    PushFront(index);
+}
+
+// ---------------------------------------------------------
+// û ť
+// ---------------------------------------------------------
+NavPathQueue::NavPathQueue(const NavMesh& navMesh, std::uint32_t maxRequests, std::uint32_t maxNodes, std::uint32_t cacheCapacity)
+    : mNavMesh(navMesh)
+    , mQuery(navMesh, maxNodes)
+    , mCache(cacheCapacity)
+    , mSlots(maxRequests)
+{
+    assert(maxRequests > 0 && maxRequests <= 0xFFFF);
+    mFreeSlots.reserve(maxRequests);
+    for (std::uint32_t i = maxRequests; i-- > 0;)
+        mFreeSlots.push_back(i);
+}
+
+NavPathQueue::Slot* NavPathQueue::FindSlot(NavPathHandle handle)
+{
+    const std::uint32_t index = handle & 0xFFFF;
+    if (handle == InvalidPathHandle || index >= mSlots.size() || mSlots[index].Handle != handle)
+        return nullptr;
+    return &mSlots[index];
+}
+
+const NavPathQueue::Slot* NavPathQueue::FindSlot(NavPathHandle handle)const
+{
+    return const_cast<NavPathQueue*>(this)->FindSlot(handle);
+}
+
+NavPathHandle NavPathQueue::Request(const float start[3], const float end[3])
+{
+    if (mFreeSlots.empty())
+        return InvalidPathHandle;
+
+    const std::uint32_t index = mFreeSlots.back();
+    mFreeSlots.pop_back();
+
+    // ȣ = Ϸùȣ (1 ~ 0xFFFF ݺ) << 16 | ڸ. ٽ  ڸ  ȣ  
+    mSerial = mSerial % 0xFFFF + 1;
+    Slot& slot = mSlots[index];
+    slot.Handle = (mSerial << 16) | index;
+    slot.Status = NavStatus::InProgress;
+    std::copy_n(start, 3, slot.Start);
+    std::copy_n(end, 3, slot.End);
+    slot.Points.clear();
+
+    mPending.push_back(index);
+    ++mStats.Requests;
+    return slot.Handle;
+}
+
+NavStatus NavPathQueue::GetStatus(NavPathHandle handle)const
+{
+    const Slot* slot = FindSlot(handle);
+    return slot ? slot->Status : NavStatus::Failed;
+}
+
+NavStatus NavPathQueue::TakePath(NavPathHandle handle, std::vector<float>& outPoints)
+{
+    Slot* slot = FindSlot(handle);
+    if (!slot)
+        return NavStatus::Failed;
+    if (slot->Status == NavStatus::InProgress)
+        return NavStatus::InProgress;
+
+    const NavStatus status = slot->Status;
+    outPoints.swap(slot->Points);
+    slot->Points.clear();
+    slot->Handle = InvalidPathHandle;
+    mFreeSlots.push_back(handle & 0xFFFF);
+    return status;
+}
+
+void NavPathQueue::Finish(Slot& slot, NavStatus status)
+{
+    slot.Status = status;
+    ++mStats.Completed;
+    if (status == NavStatus::Failed)
+        ++mStats.Failed;
+    else if (status == NavStatus::Partial)
+        ++mStats.Partial;
+}
+
+void NavPathQueue::Update(std::uint32_t maxIterations)
+{
+    std::uint32_t budget = maxIterations;
+    while (budget > 0)
+    {
+        // 1.  û :  ã -> ĳÿ  ٷ  (̰͵  1  ħ)
+        if (mCurrent == NullSlot)
+        {
+            if (mPending.empty())
+                return;
+
+            const std::uint32_t index = mPending.front();
+            mPending.pop_front();
+            Slot& slot = mSlots[index];
+            --budget;
+
+            float start[3], end[3];
+            const NavPolyRef startRef = mNavMesh.FindNearestPoly(slot.Start, mExtents, start);
+            const NavPolyRef endRef = mNavMesh.FindNearestPoly(slot.End, mExtents, end);
+            if (startRef == NullPoly || endRef == NullPoly)
+            {
+                Finish(slot, NavStatus::Failed);
+                continue;
+            }
+            std::copy_n(start, 3, slot.Start);
+            std::copy_n(end, 3, slot.End);
+
+            if (mCacheEnabled && mCache.Find(startRef, endRef, mNavMesh.GetRevision(), mCorridor))
+            {
+                ++mStats.CacheHits;
+                mQuery.FindStraightPath(slot.Start, slot.End, mCorridor, slot.Points);
+                Finish(slot, NavStatus::Succeeded);
+                continue;
+            }
+
+            mQuery.InitSlicedFindPath(startRef, endRef, slot.Start, slot.End);
+            mCurrentStartRef = startRef;
+            mCurrentEndRef = endRef;
+            mCurrent = index;
+        }
+
+        // 2.  길ŭ A*
+        std::uint32_t iterations = 0;
+        NavStatus status = mQuery.UpdateSlicedFindPath(budget, &iterations);
+        budget -= std::min(iterations, budget);
+        mStats.Iterations += iterations;
+        if (status == NavStatus::InProgress)
+            continue;
+
+        // 3. :  -> ĳ (  ͸) -> 򶧱
+        Slot& slot = mSlots[mCurrent];
+        status = mQuery.FinalizeSlicedFindPath(mCorridor);
+        if (status == NavStatus::Succeeded && mCacheEnabled)
+            mCache.Store(mCurrentStartRef, mCurrentEndRef, mNavMesh.GetRevision(), mCorridor);
+        if (status != NavStatus::Failed)
+            mQuery.FindStraightPath(slot.Start, slot.End, mCorridor, slot.Points);
+
+        Finish(slot, status);
+        mCurrent = NullSlot;
+    }
+}
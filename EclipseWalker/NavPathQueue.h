@@ -0,0 +1,115 @@
+#pragma once
+#include "NavQuery.h"
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+// ==========================================================
+//  û ť ( õ )
+// - Request()  ٷ ְ, Update(ݺ )  տ  A* (  길ŭ)
+// -  ĳ: ( ,  ) ->  .  ǥ(÷̾)  Ѵ  κ ĳ÷ 
+//   򶧱  /  ٽ ϹǷ  ζ ġ ´ ΰ 
+//   ׺޽ Revision  ٲ (Ÿ ü) ° 
+// ť ϳ = NavQuery ϳ =  ϳ.  忡   ť 帶 
+// ==========================================================
+
+class NavPathCache
+{
+public:
+    explicit NavPathCache(std::uint32_t capacity);
+
+    bool Find(NavPolyRef start, NavPolyRef end, std::uint32_t revision, std::vector<NavPolyRef>& outPath);
+    void Store(NavPolyRef start, NavPolyRef end, std::uint32_t revision, const std::vector<NavPolyRef>& path);
+    void Clear();
+
+private:
+    static constexpr std::uint32_t NullEntry = 0xFFFFFFFFu;
+
+    struct Entry
+    {
+        std::uint64_t Key = 0;
+        std::vector<NavPolyRef> Path;
+        std::uint32_t Prev = NullEntry, Next = NullEntry;   // ֱٿ   (Head = ֱ)
+    };
+
+    void Unlink(std::uint32_t entry);
+    void PushFront(std::uint32_t entry);
+    void Sync(std::uint32_t revision);
+
+private:
+    std::uint32_t mCapacity = 0;
+    std::uint32_t mRevision = 0;
+    std::vector<Entry> mEntries;
+    std::unordered_map<std::uint64_t, std::uint32_t> mLookup;
+    std::uint32_t mHead = NullEntry, mTail = NullEntry;
+};
+
+using NavPathHandle = std::uint32_t;
+constexpr NavPathHandle InvalidPathHandle = 0;
+
+struct NavPathQueueStats
+{
+    std::uint64_t Requests = 0;
+    std::uint64_t Completed = 0;
+    std::uint64_t CacheHits = 0;
+    std::uint64_t Failed = 0;       // / ó  
+    std::uint64_t Partial = 0;
+    std::uint64_t Iterations = 0;   // A*    
+};
+
+class NavPathQueue
+{
+public:
+    NavPathQueue(const NavMesh& navMesh, std::uint32_t maxRequests = 256, std::uint32_t maxNodes = 2048, std::uint32_t cacheCapacity = 256);
+
+    // ڸ  InvalidPathHandle
+    NavPathHandle Request(const float start[3], const float end[3]);
+
+    // ִ maxIterations  带   û տ ó
+    void Update(std::uint32_t maxIterations);
+
+    NavStatus GetStatus(NavPathHandle handle)const;
+
+    //  û  (̴  x, y, z ݺ)   ڸ .   InProgress
+    NavStatus TakePath(NavPathHandle handle, std::vector<float>& outPoints);
+
+    // /  ֺ  ã  ( ũ)
+    void SetSearchExtents(float x, float y, float z) { mExtents[0] = x; mExtents[1] = y; mExtents[2] = z; }
+    void SetCacheEnabled(bool enabled) { mCacheEnabled = enabled; }
+
+    std::uint32_t GetPendingCount()const { return (std::uint32_t)mPending.size() + (mCurrent != NullSlot ? 1u : 0u); }
+    const NavPathQueueStats& GetStats()const { return mStats; }
+
+private:
+    static constexpr std::uint32_t NullSlot = 0xFFFFFFFFu;
+
+    struct Slot
+    {
+        NavPathHandle Handle = InvalidPathHandle;
+        NavStatus Status = NavStatus::Failed;
+        float Start[3] = {}, End[3] = {};
+        std::vector<float> Points;
+    };
+
+    Slot* FindSlot(NavPathHandle handle);
+    const Slot* FindSlot(NavPathHandle handle)const;
+    void Finish(Slot& slot, NavStatus status);
+
+private:
+    const NavMesh& mNavMesh;
+    NavQuery mQuery;
+    NavPathCache mCache;
+    bool mCacheEnabled = true;
+    float mExtents[3] = { 2.0f, 4.0f, 2.0f };
+
+    std::vector<Slot> mSlots;
+    std::vector<std::uint32_t> mFreeSlots;
+    std::deque<std::uint32_t> mPending;
+    std::uint32_t mCurrent = NullSlot;          //  A*    û
+    NavPolyRef mCurrentStartRef = NullPoly, mCurrentEndRef = NullPoly;
+    std::uint32_t mSerial = 0;
+
+    std::vector<NavPolyRef> mCorridor;
+    NavPathQueueStats mStats;
+};
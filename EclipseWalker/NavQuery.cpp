@@ -0,0 +1,365 @@
+#include "NavQuery.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+    constexpr float HeuristicScale = 0.999f; //   γ ǥ  
+
+    float Distance(const float a[3], const float b[3])
+    {
+        const float dx = b[0] - a[0], dy = b[1] - a[1], dz = b[2] - a[2];
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    // XZ  ȣ ִ  x2 (򶧱⿡ / )
+    float TriArea2(const float a[3], const float b[3], const float c[3])
+    {
+        return (c[0] - a[0]) * (b[2] - a[2]) - (b[0] - a[0]) * (c[2] - a[2]);
+    }
+
+    bool SamePoint(const float a[3], const float b[3])
+    {
+        const float dx = b[0] - a[0], dz = b[2] - a[2];
+        return dx * dx + dz * dz < 1e-6f;
+    }
+
+    std::uint32_t NextPowerOfTwo(std::uint32_t v)
+    {
+        std::uint32_t p = 1;
+        while (p < v)
+            p <<= 1;
+        return p;
+    }
+}
+
+// ---------------------------------------------------------
+//  Ǯ
+// ---------------------------------------------------------
+NavNodePool::NavNodePool(std::uint32_t capacity)
+    : mNodes(capacity)
+    , mBuckets(NextPowerOfTwo(std::max(capacity, 1u)), NullNode)
+{
+}
+
+void NavNodePool::Clear()
+{
+    std::fill(mBuckets.begin(), mBuckets.end(), NullNode);
+    mCount = 0;
+}
+
+std::uint32_t NavNodePool::Find(NavPolyRef poly)const
+{
+    for (std::uint32_t i = mBuckets[Bucket(poly)]; i != NullNode; i = mNodes[i].HashNext)
+    {
+        if (mNodes[i].Poly == poly)
+            return i;
+    }
+    return NullNode;
+}
+
+std::uint32_t NavNodePool::Get(NavPolyRef poly)
+{
+    const std::uint32_t bucket = Bucket(poly);
+    for (std::uint32_t i = mBuckets[bucket]; i != NullNode; i = mNodes[i].HashNext)
+    {
+        if (mNodes[i].Poly == poly)
+            return i;
+    }
+    if (mCount >= mNodes.size())
+        return NullNode;
+
+    const std::uint32_t index = mCount++;
+    Node& node = mNodes[index];
+    node = Node();
+    node.Poly = poly;
+    node.HashNext = mBuckets[bucket];
+    mBuckets[bucket] = index;
+    return index;
+}
+
+// ---------------------------------------------------------
+// A*
+// ---------------------------------------------------------
+NavQuery::NavQuery(const NavMesh& navMesh, std::uint32_t maxNodes)
+    : mNavMesh(navMesh)
+    , mNodePool(maxNodes)
+{
+    mOpen.reserve(maxNodes);
+}
+
+void NavQuery::PushOpen(std::uint32_t node)
+{
+    mOpen.push_back({ mNodePool[node].Total, node });
+    std::push_heap(mOpen.begin(), mOpen.end(), [](const HeapEntry& a, const HeapEntry& b) { return a.Total > b.Total; });
+}
+
+NavStatus NavQuery::FindPath(NavPolyRef startRef, NavPolyRef endRef, const float startPos[3], const float endPos[3], std::vector<NavPolyRef>& outPath)
+{
+    if (InitSlicedFindPath(startRef, endRef, startPos, endPos) == NavStatus::InProgress)
+        UpdateSlicedFindPath(0xFFFFFFFFu);
+    return FinalizeSlicedFindPath(outPath);
+}
+
+NavStatus NavQuery::InitSlicedFindPath(NavPolyRef startRef, NavPolyRef endRef, const float startPos[3], const float endPos[3])
+{
+    mNodePool.Clear();
+    mOpen.clear();
+    mStartRef = startRef;
+    mEndRef = endRef;
+    for (int k = 0; k < 3; ++k)
+    {
+        mStartPos[k] = startPos[k];
+        mEndPos[k] = endPos[k];
+    }
+
+    if (!mNavMesh.IsValid(startRef) || !mNavMesh.IsValid(endRef))
+    {
+        mStatus = NavStatus::Failed;
+        return mStatus;
+    }
+
+    const std::uint32_t start = mNodePool.Get(startRef);
+    NavNodePool::Node& node = mNodePool[start];
+    node.Pos[0] = startPos[0]; node.Pos[1] = startPos[1]; node.Pos[2] = startPos[2];
+    node.Cost = 0.0f;
+    node.Total = Distance(startPos, endPos) * HeuristicScale;
+    node.Flags = NavNodePool::Open;
+    PushOpen(start);
+
+    mBestNode = start;
+    mBestHeuristic = node.Total;
+
+    mStatus = startRef == endRef ? NavStatus::Succeeded : NavStatus::InProgress;
+    return mStatus;
+}
+
+NavStatus NavQuery::UpdateSlicedFindPath(std::uint32_t maxIterations, std::uint32_t* outIterations)
+{
+    auto greater = [](const HeapEntry& a, const HeapEntry& b) { return a.Total > b.Total; };
+
+    std::uint32_t iterations = 0;
+    while (mStatus == NavStatus::InProgress && iterations < maxIterations)
+    {
+        if (mOpen.empty())
+        {
+            //  ôµ ǥ ￡  
+            mStatus = NavStatus::Partial;
+            break;
+        }
+
+        // 1.    (ŵǾ  ׸ )
+        std::pop_heap(mOpen.begin(), mOpen.end(), greater);
+        const HeapEntry entry = mOpen.back();
+        mOpen.pop_back();
+        NavNodePool::Node& best = mNodePool[entry.Node];
+        if ((best.Flags & NavNodePool::Closed) || entry.Total != best.Total)
+            continue;
+        ++iterations;
+
+        best.Flags = NavNodePool::Closed;
+        if (best.Poly == mEndRef)
+        {
+            mBestNode = entry.Node;
+            mStatus = NavStatus::Succeeded;
+            break;
+        }
+
+        // 2. ̿  (   ġ)
+        const NavPoly& poly = mNavMesh.GetPoly(best.Poly);
+        const NavPolyRef parentPoly = best.Parent != NavNodePool::NullNode ? mNodePool[best.Parent].Poly : NullPoly;
+        for (std::uint32_t l = poly.FirstLink; l != NullLink;)
+        {
+            const NavLink& link = mNavMesh.GetLink(best.Poly, l);
+            l = link.Next;
+            if (link.Neighbor == parentPoly)
+                continue;
+
+            // Ǯ      ->    Partial
+            const std::uint32_t index = mNodePool.Get(link.Neighbor);
+            if (index == NavNodePool::NullNode)
+                continue;
+
+            // Get  Ǯ  űǷ best  ״ ȿ
+            NavNodePool::Node& neighbor = mNodePool[index];
+            if (neighbor.Flags == 0)
+            {
+                neighbor.Pos[0] = 0.5f * (link.Ax + link.Bx);
+                neighbor.Pos[1] = 0.5f * (poly.Y + mNavMesh.GetPoly(link.Neighbor).Y);
+                neighbor.Pos[2] = 0.5f * (link.Az + link.Bz);
+            }
+
+            float cost = best.Cost + Distance(best.Pos, neighbor.Pos);
+            float heuristic = 0.0f;
+            if (link.Neighbor == mEndRef)
+                cost += Distance(neighbor.Pos, mEndPos);
+            else
+                heuristic = Distance(neighbor.Pos, mEndPos) * HeuristicScale;
+
+            const float total = cost + heuristic;
+            if (neighbor.Flags != 0 && total >= neighbor.Total)
+                continue;
+
+            neighbor.Parent = entry.Node;
+            neighbor.Cost = cost;
+            neighbor.Total = total;
+            neighbor.Flags = NavNodePool::Open;
+            PushOpen(index);
+
+            if (heuristic < mBestHeuristic)
+            {
+                mBestHeuristic = heuristic;
+                mBestNode = index;
+            }
+        }
+    }
+
+    if (outIterations)
+        *outIterations = iterations;
+    return mStatus;
+}
+
+NavStatus NavQuery::FinalizeSlicedFindPath(std::vector<NavPolyRef>& outPath)
+{
+    outPath.clear();
+    if (mStatus == NavStatus::Failed || mBestNode == NavNodePool::NullNode)
+        return NavStatus::Failed;
+
+    //    (߰ ) ݱ   
+    const NavStatus status = mStatus == NavStatus::InProgress ? NavStatus::Partial : mStatus;
+
+    for (std::uint32_t node = mBestNode; node != NavNodePool::NullNode; node = mNodePool[node].Parent)
+        outPath.push_back(mNodePool[node].Poly);
+    std::reverse(outPath.begin(), outPath.end());
+
+    mStatus = NavStatus::Failed; //   
+    return status;
+}
+
+// ---------------------------------------------------------
+// 򶧱 (simple stupid funnel algorithm, Mikko Mononen)
+// ---------------------------------------------------------
+void NavQuery::FindStraightPath(const float startPos[3], const float endPos[3], const std::vector<NavPolyRef>& path, std::vector<float>& outPoints)const
+{
+    outPoints.clear();
+    if (path.empty())
+        return;
+
+    // 1. :     (Partial ̸ ǥ ۿ )
+    const NavPoly& last = mNavMesh.GetPoly(path.back());
+    float end[3] = { endPos[0], endPos[1], endPos[2] };
+    if (end[0] < last.MinX || end[0] > last.MaxX || end[2] < last.MinZ || end[2] > last.MaxZ)
+    {
+        end[0] = std::min(std::max(end[0], last.MinX), last.MaxX);
+        end[2] = std::min(std::max(end[2], last.MinZ), last.MaxZ);
+        end[1] = last.Y;
+    }
+
+    // 2.  / (ó   ¥ )
+    const std::size_t count = path.size() + 1;
+    std::vector<float> left(count * 3), right(count * 3);
+    auto setPortal = [&](std::size_t i, const float* l, const float* r)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            left[i * 3 + k] = l[k];
+            right[i * 3 + k] = r[k];
+        }
+    };
+    setPortal(0, startPos, startPos);
+    setPortal(count - 1, end, end);
+
+    for (std::size_t i = 0; i + 1 < path.size(); ++i)
+    {
+        const NavPoly& poly = mNavMesh.GetPoly(path[i]);
+        const NavLink* portal = nullptr;
+        for (std::uint32_t l = poly.FirstLink; l != NullLink;)
+        {
+            const NavLink& link = mNavMesh.GetLink(path[i], l);
+            if (link.Neighbor == path[i + 1])
+            {
+                portal = &link;
+                break;
+            }
+            l = link.Next;
+        }
+        assert(portal);
+
+        const float y = 0.5f * (poly.Y + mNavMesh.GetPoly(path[i + 1]).Y);
+        const float a[3] = { portal->Ax, y, portal->Az };
+        const float b[3] = { portal->Bx, y, portal->Bz };
+
+        //   ->      (+90)  a 
+        const float mx = 0.5f * (a[0] + b[0]), mz = 0.5f * (a[2] + b[2]);
+        const float dx = mx - 0.5f * (poly.MinX + poly.MaxX), dz = mz - 0.5f * (poly.MinZ + poly.MaxZ);
+        const bool aIsLeft = dx * (a[2] - mz) - dz * (a[0] - mx) > 0.0f;
+        setPortal(i + 1, aIsLeft ? a : b, aIsLeft ? b : a);
+    }
+
+    // 3. 򶧱⸦    ݴ    ̴ 
+    auto emit = [&](const float* p)
+    {
+        const std::size_t n = outPoints.size();
+        if (n >= 3 && SamePoint(&outPoints[n - 3], p))
+            return;
+        outPoints.insert(outPoints.end(), p, p + 3);
+    };
+    emit(startPos);
+
+    float apex[3], portalLeft[3], portalRight[3];
+    std::copy_n(&left[0], 3, apex);
+    std::copy_n(&left[0], 3, portalLeft);
+    std::copy_n(&right[0], 3, portalRight);
+    std::size_t apexIndex = 0, leftIndex = 0, rightIndex = 0;
+
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        const float* l = &left[i * 3];
+        const float* r = &right[i * 3];
+
+        // 
+        if (TriArea2(apex, portalRight, r) <= 0.0f)
+        {
+            if (SamePoint(apex, portalRight) || TriArea2(apex, portalLeft, r) > 0.0f)
+            {
+                std::copy_n(r, 3, portalRight);
+                rightIndex = i;
+            }
+            else
+            {
+                std::copy_n(portalLeft, 3, apex);
+                apexIndex = leftIndex;
+                emit(apex);
+                std::copy_n(apex, 3, portalLeft);
+                std::copy_n(apex, 3, portalRight);
+                leftIndex = rightIndex = apexIndex;
+                i = apexIndex;
+                continue;
+            }
+        }
+
+        // 
+        if (TriArea2(apex, portalLeft, l) >= 0.0f)
+        {
+            if (SamePoint(apex, portalLeft) || TriArea2(apex, portalRight, l) < 0.0f)
+            {
+                std::copy_n(l, 3, portalLeft);
+                leftIndex = i;
+            }
+            else
+            {
+                std::copy_n(portalRight, 3, apex);
+                apexIndex = rightIndex;
+                emit(apex);
+                std::copy_n(apex, 3, portalLeft);
+                std::copy_n(apex, 3, portalRight);
+                leftIndex = rightIndex = apexIndex;
+                i = apexIndex;
+                continue;
+            }
+        }
+    }
+
+    emit(end);
+}
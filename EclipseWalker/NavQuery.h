@@ -0,0 +1,112 @@
+#pragma once
+#include "NavMesh.h"
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+// ׺޽  ã
+// - A*:  = ,  ġ = ó   ,  = ġ  Ÿ
+// -  ̸ Ƶ Ǯ (Ǹ Ҵ , ؽ÷  -> ). ڶ ǥ    (Partial)
+// -  : InitSliced -> UpdateSliced(ݺ )    -> FinalizeSliced
+// - FindStraightPath:   з 򶧱 ˰ (̴  )
+// 帶 NavQuery ϳ (NavMesh  б⸸ ϹǷ  )
+// ==========================================================
+
+enum class NavStatus : std::uint8_t
+{
+    Failed,
+    InProgress,
+    Succeeded,
+    Partial,        // ǥ   (ų  ) ->    
+};
+
+class NavNodePool
+{
+public:
+    static constexpr std::uint32_t NullNode = 0xFFFFFFFFu;
+
+    enum Flags : std::uint8_t
+    {
+        Open = 1,
+        Closed = 2,
+    };
+
+    struct Node
+    {
+        NavPolyRef Poly = NullPoly;
+        std::uint32_t Parent = NullNode;
+        std::uint32_t HashNext = NullNode;
+        float Cost = 0.0f;      // ۺ
+        float Total = 0.0f;     // Cost + ޸ƽ
+        float Pos[3] = {};
+        std::uint8_t Flags = 0;
+    };
+
+    explicit NavNodePool(std::uint32_t capacity);
+
+    void Clear();
+
+    //   . Ǯ  á NullNode
+    std::uint32_t Get(NavPolyRef poly);
+    std::uint32_t Find(NavPolyRef poly)const;
+
+    Node& operator[](std::uint32_t index) { return mNodes[index]; }
+    const Node& operator[](std::uint32_t index)const { return mNodes[index]; }
+
+    std::uint32_t GetCount()const { return mCount; }
+    std::uint32_t GetCapacity()const { return (std::uint32_t)mNodes.size(); }
+
+private:
+    std::uint32_t Bucket(NavPolyRef poly)const { return (poly * 2654435761u) & (std::uint32_t)(mBuckets.size() - 1); }
+
+private:
+    std::vector<Node> mNodes;
+    std::vector<std::uint32_t> mBuckets;  // 2 ŵ
+    std::uint32_t mCount = 0;
+};
+
+class NavQuery
+{
+public:
+    NavQuery(const NavMesh& navMesh, std::uint32_t maxNodes = 2048);
+
+    NavPolyRef FindNearestPoly(const float center[3], const float halfExtents[3], float outPoint[3])const
+    {
+        return mNavMesh.FindNearestPoly(center, halfExtents, outPoint);
+    }
+
+    //   
+    NavStatus FindPath(NavPolyRef startRef, NavPolyRef endRef, const float startPos[3], const float endPos[3], std::vector<NavPolyRef>& outPath);
+
+    // . Update  InProgress  ٽ θ
+    NavStatus InitSlicedFindPath(NavPolyRef startRef, NavPolyRef endRef, const float startPos[3], const float endPos[3]);
+    NavStatus UpdateSlicedFindPath(std::uint32_t maxIterations, std::uint32_t* outIterations = nullptr);
+    NavStatus FinalizeSlicedFindPath(std::vector<NavPolyRef>& outPath);
+
+    //   -> ̴  (x, y, z ݺ, ó startPos,  endPos      )
+    void FindStraightPath(const float startPos[3], const float endPos[3], const std::vector<NavPolyRef>& path, std::vector<float>& outPoints)const;
+
+    //  ǿ   
+    std::uint32_t GetVisitedNodes()const { return mNodePool.GetCount(); }
+
+private:
+    struct HeapEntry
+    {
+        float Total;
+        std::uint32_t Node;
+    };
+
+    void PushOpen(std::uint32_t node);
+
+private:
+    const NavMesh& mNavMesh;
+    NavNodePool mNodePool;
+    std::vector<HeapEntry> mOpen;   // ּ , ϸ  ְ  ׸   
+
+    //    
+    NavStatus mStatus = NavStatus::Failed;
+    NavPolyRef mStartRef = NullPoly, mEndRef = NullPoly;
+    float mStartPos[3] = {}, mEndPos[3] = {};
+    std::uint32_t mBestNode = NavNodePool::NullNode;  // ǥ    (Partial )
+    float mBestHeuristic = 0.0f;
+};
@@ -0,0 +1,694 @@
+#include "NavigationBenchmark.h"
+#include "JobSystem.h"
+#include "NavMeshBuilder.h"
+#include "NavPathQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float CellSize = 12.0f;               //   ĭ
+    constexpr std::uint32_t CitySide = 20;          // 240m x 240m
+    constexpr float PlatformTop = 1.2f;             // ö    (ηθ)
+    constexpr std::uint32_t PackSize = 16;          //  
+    constexpr std::uint32_t GoalCount = 8;          // Ѵ ÷̾ 
+    constexpr std::uint32_t FrameIterations = 4096; // ť   
+    constexpr std::uint32_t QueueNodes = 4096;
+    constexpr std::uint32_t CheckedPairs = 300;
+
+    // ڱ ˻ ֹ (Y  ȸ )
+    struct Obstacle
+    {
+        float X = 0.0f, Z = 0.0f;
+        float ExtentX = 0.0f, ExtentZ = 0.0f;
+        float Cos = 1.0f, Sin = 0.0f;
+        float Top = 0.0f;
+    };
+
+    struct Level
+    {
+        NavInputGeometry Geometry;
+        std::vector<Obstacle> Obstacles;
+    };
+
+    //  켱 4x4 ( =  x  1, ġ)
+    void BoxWorld(float cx, float cy, float cz, const float rows[9], float world[16])
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            world[i * 4 + 0] = rows[i * 3 + 0];
+            world[i * 4 + 1] = rows[i * 3 + 1];
+            world[i * 4 + 2] = rows[i * 3 + 2];
+            world[i * 4 + 3] = 0.0f;
+        }
+        world[12] = cx; world[13] = cy; world[14] = cz; world[15] = 1.0f;
+    }
+
+    // Y  ȸ . obstacle ̸ ڱ ˻翡  ( Ƶ )
+    void AddBox(Level& level, float cx, float cy, float cz, float ex, float ey, float ez, float yaw, bool obstacle)
+    {
+        const float c = std::cos(yaw), s = std::sin(yaw);
+        const float rows[9] = { c, 0, -s, 0, 1, 0, s, 0, c };
+        float m[16];
+        BoxWorld(cx, cy, cz, rows, m);
+        level.Geometry.AddBox(m, ex, ey, ez);
+        if (obstacle)
+            level.Obstacles.push_back({ cx, cz, ex, ez, c, s, cy + ey });
+    }
+
+    // +X  ö󰡴 :  (x0, 0, z)  ؼ  rise 
+    void AddRamp(Level& level, float x0, float z, float degrees, float rise, float ez)
+    {
+        const float a = degrees * 3.14159265f / 180.0f;
+        const float c = std::cos(a), s = std::sin(a);
+        const float ex = 0.5f * rise / s;
+        const float ey = 0.25f;
+        const float rows[9] = { c, s, 0, -s, c, 0, 0, 0, 1 };
+        float m[16];
+        BoxWorld(x0 + ex * c + ey * s, ex * s - ey * c, z, rows, m);
+        level.Geometry.AddBox(m, ex, ey, ez);
+    }
+
+    float RampRun(float degrees, float rise)
+    {
+        return rise / std::tan(degrees * 3.14159265f / 180.0f);
+    }
+
+    //  PlatformTop   (߽ x, z,  ũ e) +  (-X)  ö󰡴 15 
+    void AddPlatform(Level& level, float x, float z, float e, bool ramp)
+    {
+        AddBox(level, x, 0.5f * PlatformTop, z, e, 0.5f * PlatformTop, e, 0.0f, true);
+        if (ramp)
+            AddRamp(level, x - e - RampRun(15.0f, PlatformTop), z, 15.0f, PlatformTop, 1.2f);
+    }
+
+    void AddGround(Level& level, float halfSize)
+    {
+        AddBox(level, 0.0f, -0.5f, 0.0f, halfSize, 0.5f, halfSize, 0.0f, false);
+    }
+
+    void BuildCity(Level& level, std::uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> width(1.0f, 4.0f);
+        std::uniform_real_distribution<float> height(1.0f, 4.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 1.5f);
+        std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+        const float half = 0.5f * CitySide * CellSize;
+        AddGround(level, half + 4.0f);
+        for (std::uint32_t z = 0; z < CitySide; ++z)
+        {
+            for (std::uint32_t x = 0; x < CitySide; ++x)
+            {
+                const float cx = (x + 0.5f) * CellSize - half;
+                const float cz = (z + 0.5f) * CellSize - half;
+                if (chance(rng) < 0.15f)
+                {
+                    AddPlatform(level, cx + 1.0f, cz, 2.5f, true);
+                }
+                else
+                {
+                    const float ey = height(rng);
+                    AddBox(level, cx, ey, cz, width(rng), ey, width(rng), angle(rng), true);
+                }
+            }
+        }
+    }
+
+    // ---------------------------------------------------------
+    // ˻ 
+    // ---------------------------------------------------------
+    std::vector<NavPolyRef> AllPolys(const NavMesh& navMesh)
+    {
+        std::vector<NavPolyRef> refs;
+        refs.reserve(navMesh.GetPolyCount());
+        for (std::uint32_t t = 0; t < navMesh.GetMaxTiles(); ++t)
+        {
+            for (std::uint32_t i = 0; i < navMesh.GetTilePolyCount(t); ++i)
+                refs.push_back((t << NavPolyBits) | i);
+        }
+        return refs;
+    }
+
+    bool Linked(const NavMesh& navMesh, NavPolyRef from, NavPolyRef to)
+    {
+        for (std::uint32_t l = navMesh.GetPoly(from).FirstLink; l != NullLink; l = navMesh.GetLink(from, l).Next)
+        {
+            if (navMesh.GetLink(from, l).Neighbor == to)
+                return true;
+        }
+        return false;
+    }
+
+    // ̴  ̸ ߰    .   
+    std::uint32_t CountOffMesh(const NavMesh& navMesh, const std::vector<float>& points)
+    {
+        const float extents[3] = { 0.01f, 1.0f, 0.01f };
+        std::uint32_t off = 0;
+        for (std::size_t i = 3; i < points.size(); i += 3)
+        {
+            const float* a = &points[i - 3];
+            const float* b = &points[i];
+            const float dx = b[0] - a[0], dz = b[2] - a[2];
+            const std::uint32_t steps = std::max(1u, (std::uint32_t)std::ceil(std::sqrt(dx * dx + dz * dz) / 0.25f));
+            for (std::uint32_t s = 0; s <= steps; ++s)
+            {
+                const float t = (float)s / steps;
+                const float p[3] = { a[0] + (b[0] - a[0]) * t, a[1] + (b[1] - a[1]) * t, a[2] + (b[2] - a[2]) * t };
+                float nearest[3];
+                if (navMesh.FindNearestPoly(p, extents, nearest) == NullPoly)
+                    ++off;
+            }
+        }
+        return off;
+    }
+
+    //    
+    void RandomPoint(const NavMesh& navMesh, NavPolyRef ref, std::mt19937& rng, float out[3])
+    {
+        std::uniform_real_distribution<float> t(0.05f, 0.95f);
+        const NavPoly& poly = navMesh.GetPoly(ref);
+        out[0] = poly.MinX + (poly.MaxX - poly.MinX) * t(rng);
+        out[1] = poly.Y;
+        out[2] = poly.MinZ + (poly.MaxZ - poly.MinZ) * t(rng);
+    }
+
+    struct PathRequest
+    {
+        float Start[3];
+        float End[3];
+    };
+
+    // û ť ϳ   budget  
+    // paths / statuses (û  ũ)   û ȣ ڸ  . δ keepEvery °ٸ
+    void RunQueue(NavPathQueue& queue, const PathRequest* requests, std::uint32_t count, std::uint32_t budget,
+        std::uint32_t keepEvery, std::vector<std::vector<float>>* paths, std::vector<NavStatus>* statuses)
+    {
+        struct InFlight
+        {
+            NavPathHandle Handle;
+            std::uint32_t Request;
+        };
+        std::vector<InFlight> inFlight;
+        std::vector<float> points;
+
+        std::uint32_t next = 0, done = 0;
+        while (done < count)
+        {
+            while (next < count)
+            {
+                const NavPathHandle handle = queue.Request(requests[next].Start, requests[next].End);
+                if (handle == InvalidPathHandle)
+                    break;
+                inFlight.push_back({ handle, next++ });
+            }
+
+            queue.Update(budget);
+
+            for (std::size_t i = 0; i < inFlight.size();)
+            {
+                const NavStatus status = queue.TakePath(inFlight[i].Handle, points);
+                if (status == NavStatus::InProgress)
+                {
+                    ++i;
+                    continue;
+                }
+                if (statuses)
+                    (*statuses)[inFlight[i].Request] = status;
+                if (paths && inFlight[i].Request % keepEvery == 0)
+                    (*paths)[inFlight[i].Request].swap(points);
+                inFlight[i] = inFlight.back();
+                inFlight.pop_back();
+                ++done;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------
+    // 1. 麰 
+    // ---------------------------------------------------------
+    struct SceneMesh
+    {
+        Level World;
+        NavMesh Mesh;
+    };
+
+    void BuildScene(SceneMesh& scene)
+    {
+        NavMeshBuilder builder(scene.World.Geometry, NavBuildSettings());
+        builder.BuildAll(scene.Mesh, false);
+    }
+
+    NavStatus FindStraight(const NavMesh& navMesh, const float a[3], const float b[3], std::vector<float>& outPoints)
+    {
+        NavQuery query(navMesh);
+        const float extents[3] = { 2.0f, 4.0f, 2.0f };
+        float pa[3], pb[3];
+        const NavPolyRef ra = query.FindNearestPoly(a, extents, pa);
+        const NavPolyRef rb = query.FindNearestPoly(b, extents, pb);
+
+        std::vector<NavPolyRef> corridor;
+        const NavStatus status = query.FindPath(ra, rb, pa, pb, corridor);
+        outPoints.clear();
+        if (status != NavStatus::Failed)
+            query.FindStraightPath(pa, pb, corridor, outPoints);
+        return status;
+    }
+
+    std::uint32_t CheckScenarios()
+    {
+        const float r = NavBuildSettings().AgentRadius;
+        std::uint32_t failures = 0;
+        auto expect = [&failures](bool ok) { if (!ok) ++failures; };
+        std::vector<float> points;
+
+        //  (x = 0, z  -8 ~ 8)  ŭ  ư
+        {
+            SceneMesh scene;
+            AddGround(scene.World, 20.0f);
+            AddBox(scene.World, 0.0f, 1.5f, 0.0f, 0.5f, 1.5f, 8.0f, 0.0f, true);
+            BuildScene(scene);
+
+            const float a[3] = { -5.0f, 0.0f, 0.0f }, b[3] = { 5.0f, 0.0f, 0.0f };
+            expect(FindStraight(scene.Mesh, a, b, points) == NavStatus::Succeeded);
+            float farthest = 0.0f;
+            for (std::size_t i = 0; i < points.size(); i += 3)
+                farthest = std::max(farthest, std::fabs(points[i + 2]));
+            expect(farthest >= 8.0f + r - 0.05f && farthest < 8.0f + r + 1.0f);
+            expect(points.size() >= 9 && std::fabs(points[points.size() - 3] - b[0]) < 1e-3f);
+        }
+
+        //  : ΰ  ,  Partial
+        for (bool ramp : { true, false })
+        {
+            SceneMesh scene;
+            AddGround(scene.World, 20.0f);
+            AddPlatform(scene.World, 5.0f, 0.0f, 2.5f, ramp);
+            BuildScene(scene);
+
+            const float a[3] = { -8.0f, 0.0f, 6.0f }, b[3] = { 5.0f, PlatformTop, 0.0f };
+            const NavStatus status = FindStraight(scene.Mesh, a, b, points);
+            if (ramp)
+                expect(status == NavStatus::Succeeded && std::fabs(points[points.size() - 2] - PlatformTop) < 0.15f);
+            else
+                expect(status == NavStatus::Partial && points.size() >= 3 && points[points.size() - 2] < 0.15f);
+        }
+
+        // ĳ:  û ĳ÷, Ÿ  Failed, ٽ  (ĳ  ä)  
+        {
+            SceneMesh scene;
+            AddGround(scene.World, 20.0f);
+            AddBox(scene.World, 0.0f, 1.5f, 0.0f, 0.5f, 1.5f, 8.0f, 0.0f, true);
+            NavMeshBuilder builder(scene.World.Geometry, NavBuildSettings());
+            builder.BuildAll(scene.Mesh, false);
+
+            NavPathQueue queue(scene.Mesh, 4);
+            const PathRequest request = { { -5.0f, 0.0f, 0.0f }, { 5.0f, 0.0f, 0.0f } };
+            std::vector<std::vector<float>> paths;
+            auto run = [&]()
+            {
+                std::vector<std::vector<float>> path(1);
+                std::vector<NavStatus> status(1);
+                RunQueue(queue, &request, 1, FrameIterations, 1, &path, &status);
+                paths.push_back(path[0]);
+                return status[0];
+            };
+
+            expect(run() == NavStatus::Succeeded);
+            expect(run() == NavStatus::Succeeded && queue.GetStats().CacheHits == 1);
+
+            const NavMeshParams& params = scene.Mesh.GetParams();
+            const std::int32_t tx = (std::int32_t)std::floor((request.Start[0] - params.OriginX) / params.TileSize);
+            const std::int32_t tz = (std::int32_t)std::floor((request.Start[2] - params.OriginZ) / params.TileSize);
+            scene.Mesh.RemoveTile(tx, tz);
+            expect(run() == NavStatus::Failed);
+
+            NavTileData tile;
+            expect(builder.BuildTile(tx, tz, tile));
+            scene.Mesh.AddTile(tile);
+            expect(run() == NavStatus::Succeeded && queue.GetStats().CacheHits == 1);
+            expect(paths.size() == 4 && paths[0] == paths[1] && paths[0] == paths[3]);
+        }
+        return failures;
+    }
+
+    // ---------------------------------------------------------
+    // 2.  
+    // ---------------------------------------------------------
+    std::uint32_t CompareMeshes(const NavMesh& a, const NavMesh& b)
+    {
+        if (a.GetMaxTiles() != b.GetMaxTiles() || a.GetPolyCount() != b.GetPolyCount())
+            return 1;
+
+        std::uint32_t mismatches = 0;
+        for (NavPolyRef ref : AllPolys(a))
+        {
+            const NavPoly& pa = a.GetPoly(ref);
+            if (!b.IsValid(ref))
+            {
+                ++mismatches;
+                continue;
+            }
+            const NavPoly& pb = b.GetPoly(ref);
+            bool same = pa.MinX == pb.MinX && pa.MinZ == pb.MinZ && pa.MaxX == pb.MaxX && pa.MaxZ == pb.MaxZ && pa.Y == pb.Y;
+
+            std::uint32_t la = pa.FirstLink, lb = pb.FirstLink;
+            while (same && la != NullLink && lb != NullLink)
+            {
+                const NavLink& ka = a.GetLink(ref, la);
+                const NavLink& kb = b.GetLink(ref, lb);
+                same = ka.Neighbor == kb.Neighbor && ka.Ax == kb.Ax && ka.Az == kb.Az && ka.Bx == kb.Bx && ka.Bz == kb.Bz;
+                la = ka.Next;
+                lb = kb.Next;
+            }
+            if (!same || la != lb)
+                ++mismatches;
+        }
+        return mismatches;
+    }
+
+    // ֹ ڱ ( -  1.5  ŭ ) ȿ 麸      
+    std::uint32_t CountBlockedPolys(const NavMesh& navMesh, const Level& level, const NavBuildSettings& settings)
+    {
+        const float margin = std::max(0.0f, settings.AgentRadius - 1.5f * settings.CellSize);
+        std::uint32_t blocked = 0;
+        for (NavPolyRef ref : AllPolys(navMesh))
+        {
+            const NavPoly& poly = navMesh.GetPoly(ref);
+            const float inset = 1e-3f;
+            const float samples[5][2] =
+            {
+                { poly.MinX + inset, poly.MinZ + inset }, { poly.MaxX - inset, poly.MinZ + inset },
+                { poly.MinX + inset, poly.MaxZ - inset }, { poly.MaxX - inset, poly.MaxZ - inset },
+                { 0.5f * (poly.MinX + poly.MaxX), 0.5f * (poly.MinZ + poly.MaxZ) },
+            };
+
+            bool hit = false;
+            for (const Obstacle& o : level.Obstacles)
+            {
+                if (poly.Y > o.Top - settings.AgentMaxClimb)
+                    continue;
+                const float reach = o.ExtentX + o.ExtentZ + margin;
+                if (poly.MaxX < o.X - reach || poly.MinX > o.X + reach || poly.MaxZ < o.Z - reach || poly.MinZ > o.Z + reach)
+                    continue;
+
+                for (const auto& s : samples)
+                {
+                    const float dx = s[0] - o.X, dz = s[1] - o.Z;
+                    const float lx = dx * o.Cos - dz * o.Sin;
+                    const float lz = dx * o.Sin + dz * o.Cos;
+                    if (std::fabs(lx) < o.ExtentX + margin && std::fabs(lz) < o.ExtentZ + margin)
+                        hit = true;
+                }
+            }
+            if (hit)
+                ++blocked;
+        }
+        return blocked;
+    }
+
+    //  ׷   (Ÿ ĭ  ȣ   ȣ)
+    struct Components
+    {
+        std::vector<std::uint32_t> TileOffset;
+        std::vector<std::uint32_t> Label;
+
+        std::uint32_t Of(NavPolyRef ref)const { return Label[TileOffset[ref >> NavPolyBits] + (ref & (MaxPolysPerTile - 1))]; }
+    };
+
+    Components LabelComponents(const NavMesh& navMesh)
+    {
+        Components c;
+        c.TileOffset.resize(navMesh.GetMaxTiles() + 1, 0);
+        for (std::uint32_t t = 0; t < navMesh.GetMaxTiles(); ++t)
+            c.TileOffset[t + 1] = c.TileOffset[t] + navMesh.GetTilePolyCount(t);
+        c.Label.assign(c.TileOffset.back(), 0xFFFFFFFFu);
+
+        auto dense = [&c](NavPolyRef ref) { return c.TileOffset[ref >> NavPolyBits] + (ref & (MaxPolysPerTile - 1)); };
+        std::vector<NavPolyRef> stack;
+        std::uint32_t next = 0;
+        for (NavPolyRef seed : AllPolys(navMesh))
+        {
+            if (c.Label[dense(seed)] != 0xFFFFFFFFu)
+                continue;
+            c.Label[dense(seed)] = next;
+            stack.push_back(seed);
+            while (!stack.empty())
+            {
+                const NavPolyRef ref = stack.back();
+                stack.pop_back();
+                for (std::uint32_t l = navMesh.GetPoly(ref).FirstLink; l != NullLink; l = navMesh.GetLink(ref, l).Next)
+                {
+                    const NavPolyRef neighbor = navMesh.GetLink(ref, l).Neighbor;
+                    if (c.Label[dense(neighbor)] == 0xFFFFFFFFu)
+                    {
+                        c.Label[dense(neighbor)] = next;
+                        stack.push_back(neighbor);
+                    }
+                }
+            }
+            ++next;
+        }
+        return c;
+    }
+}
+
+namespace NavigationBenchmark
+{
+    NavigationBenchmarkResult Run(std::uint32_t agents, std::uint32_t seed)
+    {
+        NavigationBenchmarkResult result;
+        result.Agents = agents;
+        result.ScenarioFailures = CheckScenarios();
+
+        JobSystem* jobs = JobSystem::GetInstance();
+        jobs->Initialize();
+        result.Threads = jobs->GetThreadCount();
+
+        // 1. :   / Ÿ   ->   
+        Level city;
+        BuildCity(city, seed);
+        const NavBuildSettings settings;
+        NavMeshBuilder builder(city.Geometry, settings);
+
+        NavMesh serial, navMesh;
+        auto t0 = Clock::now();
+        builder.BuildAll(serial, false);
+        auto t1 = Clock::now();
+        const NavBuildStats stats = builder.BuildAll(navMesh, true);
+        auto t2 = Clock::now();
+
+        result.BuildMs = ElapsedMs(t0, t1);
+        result.BuildParallelMs = ElapsedMs(t1, t2);
+        result.Tiles = stats.Tiles;
+        result.Polys = stats.Polys;
+        result.Links = stats.Links;
+        result.BuildMismatches = CompareMeshes(serial, navMesh);
+        result.BlockedPolys = CountBlockedPolys(navMesh, city, settings);
+
+        const std::vector<NavPolyRef> polys = AllPolys(navMesh);
+        if (polys.empty())
+            return result;
+
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<std::size_t> pickPoly(0, polys.size() - 1);
+        const float extents[3] = { 2.0f, 4.0f, 2.0f };
+
+        // 2.   : ĳ     ð +   /  / ׺޽  ˻
+        //     Ǯ  ŭ̶   Partial  
+        std::vector<PathRequest> pairs(CheckedPairs);
+        for (PathRequest& pair : pairs)
+        {
+            RandomPoint(navMesh, polys[pickPoly(rng)], rng, pair.Start);
+            RandomPoint(navMesh, polys[pickPoly(rng)], rng, pair.End);
+        }
+
+        NavQuery query(navMesh, (std::uint32_t)polys.size() + 1);
+        std::vector<NavPolyRef> startRefs(CheckedPairs), endRefs(CheckedPairs);
+        std::vector<NavStatus> direct(CheckedPairs);
+        std::vector<std::vector<NavPolyRef>> corridors(CheckedPairs);
+        std::vector<std::vector<float>> straight(CheckedPairs);
+        double pathMs = 0.0, nodes = 0.0;
+        for (std::uint32_t i = 0; i < CheckedPairs; ++i)
+        {
+            float a[3], b[3];
+            auto q0 = Clock::now();
+            startRefs[i] = query.FindNearestPoly(pairs[i].Start, extents, a);
+            endRefs[i] = query.FindNearestPoly(pairs[i].End, extents, b);
+            direct[i] = query.FindPath(startRefs[i], endRefs[i], a, b, corridors[i]);
+            query.FindStraightPath(a, b, corridors[i], straight[i]);
+            auto q1 = Clock::now();
+            pathMs += ElapsedMs(q0, q1);
+            nodes += query.GetVisitedNodes();
+        }
+        result.PathUs = pathMs * 1000.0 / CheckedPairs;
+        result.Nodes = nodes / CheckedPairs;
+
+        const Components components = LabelComponents(navMesh);
+        for (std::uint32_t i = 0; i < CheckedPairs; ++i)
+        {
+            const bool reachable = components.Of(startRefs[i]) == components.Of(endRefs[i]);
+            if (reachable != (direct[i] == NavStatus::Succeeded) || direct[i] == NavStatus::Failed)
+                ++result.ReachMismatches;
+
+            const std::vector<NavPolyRef>& corridor = corridors[i];
+            bool broken = corridor.empty() || corridor.front() != startRefs[i] ||
+                (direct[i] == NavStatus::Succeeded && corridor.back() != endRefs[i]);
+            for (std::size_t k = 1; k < corridor.size() && !broken; ++k)
+                broken = !Linked(navMesh, corridor[k - 1], corridor[k]);
+            if (broken)
+                ++result.BrokenCorridors;
+
+            result.OffMeshPoints += CountOffMesh(navMesh, straight[i]);
+        }
+
+        // 3.   ť (ĳ ,   32) =   ã 
+        {
+            NavPathQueue sliced(navMesh, 64, (std::uint32_t)polys.size() + 1);
+            sliced.SetCacheEnabled(false);
+            std::vector<std::vector<float>> paths(CheckedPairs);
+            std::vector<NavStatus> status(CheckedPairs);
+            RunQueue(sliced, pairs.data(), CheckedPairs, 32, 1, &paths, &status);
+            for (std::uint32_t i = 0; i < CheckedPairs; ++i)
+            {
+                if (status[i] != direct[i] || paths[i] != straight[i])
+                    ++result.SliceMismatches;
+            }
+        }
+
+        // 4. : PackSize      ǥ (÷̾) . ť ϳ (ĳ )
+        //    Ϳ ǥ  ( ū  ) .   ö󰡴 
+        std::vector<std::uint32_t> componentSize;
+        for (NavPolyRef ref : polys)
+        {
+            const std::uint32_t label = components.Of(ref);
+            if (label >= componentSize.size())
+                componentSize.resize(label + 1, 0);
+            ++componentSize[label];
+        }
+        const std::uint32_t street = (std::uint32_t)(std::max_element(componentSize.begin(), componentSize.end()) - componentSize.begin());
+        std::vector<NavPolyRef> streetPolys;
+        for (NavPolyRef ref : polys)
+        {
+            if (components.Of(ref) == street)
+                streetPolys.push_back(ref);
+        }
+        std::uniform_int_distribution<std::size_t> pickStreet(0, streetPolys.size() - 1);
+
+        std::vector<PathRequest> requests(agents);
+        {
+            float goals[GoalCount][3];
+            for (auto& goal : goals)
+                RandomPoint(navMesh, streetPolys[pickStreet(rng)], rng, goal);
+
+            std::uniform_real_distribution<float> jitter(-2.0f, 2.0f);
+            float center[3] = {};
+            std::uint32_t goal = 0;
+            for (std::uint32_t i = 0; i < agents; ++i)
+            {
+                if (i % PackSize == 0)
+                {
+                    RandomPoint(navMesh, streetPolys[pickStreet(rng)], rng, center);
+                    float nearest = 0.0f;
+                    for (std::uint32_t g = 0; g < GoalCount; ++g)
+                    {
+                        const float dx = goals[g][0] - center[0], dz = goals[g][2] - center[2];
+                        if (g == 0 || dx * dx + dz * dz < nearest)
+                        {
+                            nearest = dx * dx + dz * dz;
+                            goal = g;
+                        }
+                    }
+                }
+                PathRequest& request = requests[i];
+                request.Start[0] = center[0] + jitter(rng);
+                request.Start[1] = center[1];
+                request.Start[2] = center[2] + jitter(rng);
+                std::copy_n(goals[goal], 3, request.End);
+            }
+        }
+
+        {
+            NavPathQueue queue(navMesh, 256, QueueNodes, 1024);
+            std::vector<std::vector<float>> kept(agents);
+            auto r0 = Clock::now();
+            RunQueue(queue, requests.data(), agents, FrameIterations, 16, &kept, nullptr);
+            auto r1 = Clock::now();
+
+            result.RequestsPerSec = agents / std::max(ElapsedMs(r0, r1) * 0.001, 1e-9);
+            result.CacheHitRate = (double)queue.GetStats().CacheHits / std::max<std::uint64_t>(queue.GetStats().Requests, 1);
+            result.Partial = (std::uint32_t)queue.GetStats().Partial;
+            for (const std::vector<float>& path : kept)
+                result.OffMeshPoints += CountOffMesh(navMesh, path);
+
+            NavPathQueue uncached(navMesh, 256, QueueNodes);
+            uncached.SetCacheEnabled(false);
+            auto u0 = Clock::now();
+            RunQueue(uncached, requests.data(), agents, FrameIterations, 1, nullptr, nullptr);
+            auto u1 = Clock::now();
+            result.RequestsPerSecNoCache = agents / std::max(ElapsedMs(u0, u1) * 0.001, 1e-9);
+        }
+
+        // 5. 帶 ť ϳ (   ̾  )
+        {
+            const std::uint32_t queueCount = result.Threads;
+            std::vector<NavPathQueue> queues;
+            queues.reserve(queueCount);
+            for (std::uint32_t q = 0; q < queueCount; ++q)
+                queues.emplace_back(navMesh, 256, QueueNodes, 1024);
+
+            auto p0 = Clock::now();
+            jobs->ParallelFor(queueCount, 1, [&](std::uint32_t begin, std::uint32_t end)
+            {
+                for (std::uint32_t q = begin; q < end; ++q)
+                {
+                    const std::uint32_t first = (std::uint32_t)((std::uint64_t)agents * q / queueCount);
+                    const std::uint32_t last = (std::uint32_t)((std::uint64_t)agents * (q + 1) / queueCount);
+                    RunQueue(queues[q], requests.data() + first, last - first, FrameIterations, 1, nullptr, nullptr);
+                }
+            });
+            auto p1 = Clock::now();
+            result.RequestsPerSecParallel = agents / std::max(ElapsedMs(p0, p1) * 0.001, 1e-9);
+        }
+
+        result.Valid = result.ScenarioFailures == 0 && result.BuildMismatches == 0 && result.BlockedPolys == 0 &&
+            result.ReachMismatches == 0 && result.BrokenCorridors == 0 && result.OffMeshPoints == 0 && result.SliceMismatches == 0;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[NavigationBenchmark]\n";
+        report += "  agents  tiles  polys  build(ms)  par(ms)  path(us)  nodes  req/s(nocache)    req/s  req/s(xN)  cache  partial  valid\n";
+
+        bool valid = true;
+        for (std::uint32_t count : { 1000u, 4000u, 10000u })
+        {
+            NavigationBenchmarkResult r = Run(count);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%8u %6u %6u %10.1f %8.1f %9.1f %6.0f %15.0f %8.0f %8.0fx%-2u %5.0f%% %8u  %s\n",
+                r.Agents, r.Tiles, r.Polys, r.BuildMs, r.BuildParallelMs, r.PathUs, r.Nodes,
+                r.RequestsPerSecNoCache, r.RequestsPerSec, r.RequestsPerSecParallel, r.Threads, r.CacheHitRate * 100.0, r.Partial,
+                r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ׺޽  +   û  (߿, 帮 -  )
+//  +   (ư ǹ, η ö󰡴 )  ,    agents 
+// ǥ   (÷̾)  θ ûϰ ؼ ʴ ó  
+//  Ȯ:
+//   1. 麰  ( ư, η  ,    Partial, Ÿ  ĳ ȿ)
+//   2.    =    , ǹ/ ڱ ȿ  
+//   3. A*   =  ׷  , ΰ ũ ̾, ̴  ̰ ׺޽ 
+//   4.   ť  =   ã 
+// ==========================================================
+
+struct NavigationBenchmarkResult
+{
+    std::uint32_t Agents = 0;
+    std::uint32_t Tiles = 0;
+    std::uint32_t Polys = 0;
+    std::uint32_t Links = 0;
+    std::uint32_t Threads = 0;
+
+    double BuildMs = 0.0;               //  
+    double BuildParallelMs = 0.0;       // Ÿ  
+    double PathUs = 0.0;                // ĳ  û ϳ (A* + 򶧱)
+    double Nodes = 0.0;                 // û ϳ   (Ǯ  )
+    double RequestsPerSec = 0.0;        // ť ϳ, ĳ 
+    double RequestsPerSecNoCache = 0.0; // ť ϳ, ĳ 
+    double RequestsPerSecParallel = 0.0;// 帶 ť
+    double CacheHitRate = 0.0;          // ť ϳ 
+    std::uint32_t Partial = 0;          // ť ϳ  ǥ   û
+
+    std::uint32_t ScenarioFailures = 0;
+    std::uint32_t BuildMismatches = 0;
+    std::uint32_t BlockedPolys = 0;     // ֹ ڱ  
+    std::uint32_t ReachMismatches = 0;
+    std::uint32_t BrokenCorridors = 0;
+    std::uint32_t OffMeshPoints = 0;
+    std::uint32_t SliceMismatches = 0;
+    bool Valid = false;
+};
+
+namespace NavigationBenchmark
+{
+    NavigationBenchmarkResult Run(std::uint32_t agents, std::uint32_t seed = 47);
+
+    // 1000 / 4000 / 10000 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,115 @@
+#include "NullRenderBackend.h"
+
+namespace
+{
+    constexpr std::uint64_t FnvOffset = 1469598103934665603ull;
+    constexpr std::uint64_t FnvPrime = 1099511628211ull;
+
+    void HashValue(std::uint64_t& hash, std::uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            hash ^= (value >> (i * 8)) & 0xFF;
+            hash *= FnvPrime;
+        }
+    }
+
+    // Ʈ      ( Ʈ ñ״ó   ְ)
+    constexpr std::uint32_t MaxRootSlots = 8;
+
+    struct BoundState
+    {
+        std::uint32_t Pipeline = UINT32_MAX;
+        std::uint64_t VertexBuffer = 0;
+        std::uint64_t IndexBuffer = 0;
+        std::uint64_t Root[MaxRootSlots] = {};
+    };
+}
+
+void NullRenderBackend::ResetStats()
+{
+    mStats = NullBackendStats();
+    mStats.DrawHash = FnvOffset;
+}
+
+void NullRenderBackend::Submit(const CommandStream* streams, std::uint32_t count)
+{
+    for (std::uint32_t s = 0; s < count; ++s)
+    {
+        // 1. Ʈ  ¿  ( Ʈ ϳ )
+        BoundState state;
+        ++mStats.Streams;
+
+        streams[s].ForEach([&](const RenderCommandHeader& header)
+        {
+            ++mStats.Commands;
+            if (header.Type >= RenderCommandType::Count)
+            {
+                ++mStats.Errors;
+                return;
+            }
+            ++mStats.CommandsByType[(std::size_t)header.Type];
+
+            switch (header.Type)
+            {
+            case RenderCommandType::SetPipeline:
+                state.Pipeline = CommandStream::As<CmdSetPipeline>(header).Pipeline;
+                break;
+
+            case RenderCommandType::SetVertexBuffer:
+                state.VertexBuffer = CommandStream::As<CmdSetVertexBuffer>(header).Address;
+                break;
+
+            case RenderCommandType::SetIndexBuffer:
+                state.IndexBuffer = CommandStream::As<CmdSetIndexBuffer>(header).Address;
+                break;
+
+            case RenderCommandType::SetRootConstant:
+            {
+                const CmdSetRootConstant& command = CommandStream::As<CmdSetRootConstant>(header);
+                if (command.Slot < MaxRootSlots)
+                    state.Root[command.Slot] = command.Value;
+                else
+                    ++mStats.Errors;
+                break;
+            }
+
+            case RenderCommandType::SetRootConstantBuffer:
+            case RenderCommandType::SetRootShaderResource:
+            {
+                const CmdSetRootBuffer& command = CommandStream::As<CmdSetRootBuffer>(header);
+                if (command.Slot < MaxRootSlots)
+                    state.Root[command.Slot] = command.Address;
+                else
+                    ++mStats.Errors;
+                break;
+            }
+
+            case RenderCommandType::DrawIndexed:
+            {
+                // 2. ο =   + ڸ ؽÿ
+                const CmdDrawIndexed& command = CommandStream::As<CmdDrawIndexed>(header);
+                if (state.Pipeline == UINT32_MAX || state.VertexBuffer == 0 || state.IndexBuffer == 0)
+                    ++mStats.Errors;
+
+                ++mStats.Draws;
+                mStats.Instances += command.InstanceCount;
+                mStats.Indices += (std::uint64_t)command.IndexCount * command.InstanceCount;
+
+                HashValue(mStats.DrawHash, state.Pipeline);
+                HashValue(mStats.DrawHash, state.VertexBuffer);
+                HashValue(mStats.DrawHash, state.IndexBuffer);
+                for (std::uint64_t value : state.Root)
+                    HashValue(mStats.DrawHash, value);
+                HashValue(mStats.DrawHash, ((std::uint64_t)command.IndexCount << 32) | command.InstanceCount);
+                HashValue(mStats.DrawHash, ((std::uint64_t)command.StartIndex << 32) | (std::uint32_t)command.BaseVertex);
+                HashValue(mStats.DrawHash, command.StartInstance);
+                break;
+            }
+
+            default:
+                break;
+            }
+        });
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "CommandStream.h"
+
+// ==========================================================
+// GPU   Ʈ ϴ 鿣 (/ġũ)
+// - Ʈ   D3D12 鿣  Ģ ¸ 
+//   (Ʈ  ʱȭ, //ε   ׸ )
+// - ο츶 (ε  + )  ؽÿ 
+//   -> Ʈ    ο ̸ ؽð 
+// ==========================================================
+
+struct NullBackendStats
+{
+    std::uint32_t Streams = 0;
+    std::uint64_t Commands = 0;
+    std::uint64_t CommandsByType[(std::size_t)RenderCommandType::Count] = {};
+    std::uint64_t Draws = 0;
+    std::uint64_t Instances = 0;
+    std::uint64_t Indices = 0;
+    std::uint64_t Errors = 0;  //   ׸ ο / 𸣴 
+    std::uint64_t DrawHash = 0;
+};
+
+class NullRenderBackend : public RenderBackend
+{
+public:
+    NullRenderBackend() { ResetStats(); }
+
+    void Submit(const CommandStream* streams, std::uint32_t count) override;
+
+    const NullBackendStats& GetStats()const { return mStats; }
+    void ResetStats();
+
+private:
+    NullBackendStats mStats;
+};
@@ -0,0 +1,350 @@
+#include "OcclusionBenchmark.h"
+#include "OcclusionCulling.h"
+#include "FrustumCulling.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float BlockSpacing = 16.0f;
+    constexpr std::uint32_t PropsPerBlock = 8;
+    constexpr float MinOccluderSize = 0.05f;
+    constexpr std::uint32_t MaxOccluders = 64;
+    constexpr std::uint32_t ReferenceFrames = 4; // Į  񱳴   Ӹ ()
+
+    //  ڿ  [-1, 1] ü,    (ո = ð )
+    OccluderMesh MakeUnitBox()
+    {
+        OccluderMesh mesh;
+        mesh.Positions =
+        {
+            -1, -1, -1,  -1, +1, -1,  +1, +1, -1,  +1, -1, -1,
+            -1, -1, +1,  -1, +1, +1,  +1, +1, +1,  +1, -1, +1
+        };
+        mesh.Indices =
+        {
+            0, 1, 2,  0, 2, 3,
+            4, 6, 5,  4, 7, 6,
+            4, 5, 1,  4, 1, 0,
+            3, 2, 6,  3, 6, 7,
+            1, 5, 6,  1, 6, 2,
+            4, 0, 3,  4, 3, 7
+        };
+        return mesh;
+    }
+
+    //   Ծ (DirectXMath  LookAtLH * PerspectiveFovLH   )
+    void MakeViewProj(float eyeX, float eyeY, float eyeZ, float yaw, float aspect, float* out)
+    {
+        const float fx = std::sin(yaw), fz = std::cos(yaw);   //  ()
+        const float rx = fz, rz = -fx;                          //  = up x 
+        //  = (0, 1, 0)
+
+        const float view[16] =
+        {
+            rx,   0.0f, fx,   0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            rz,   0.0f, fz,   0.0f,
+            -(rx * eyeX + rz * eyeZ), -eyeY, -(fx * eyeX + fz * eyeZ), 1.0f
+        };
+
+        const float nearZ = 0.5f, farZ = 500.0f;
+        const float yScale = 1.0f / std::tan(0.5f * 0.25f * 3.14159265f); // Ӱ  fovY = pi/4
+        const float xScale = yScale / aspect;
+        const float range = farZ / (farZ - nearZ);
+        const float proj[16] =
+        {
+            xScale, 0.0f,   0.0f,            0.0f,
+            0.0f,   yScale, 0.0f,            0.0f,
+            0.0f,   0.0f,   range,           1.0f,
+            0.0f,   0.0f,   -nearZ * range,  0.0f
+        };
+
+        for (int r = 0; r < 4; ++r)
+            for (int c = 0; c < 4; ++c)
+                out[r * 4 + c] = view[r * 4 + 0] * proj[0 * 4 + c] + view[r * 4 + 1] * proj[1 * 4 + c] +
+                    view[r * 4 + 2] * proj[2 * 4 + c] + view[r * 4 + 3] * proj[3 * 4 + c];
+    }
+
+    void MakeWorld(const AabbSoA& boxes, std::uint32_t i, float* out)
+    {
+        const float world[16] =
+        {
+            boxes.ExtentX[i], 0.0f, 0.0f, 0.0f,
+            0.0f, boxes.ExtentY[i], 0.0f, 0.0f,
+            0.0f, 0.0f, boxes.ExtentZ[i], 0.0f,
+            boxes.CenterX[i], boxes.CenterY[i], boxes.CenterZ[i], 1.0f
+        };
+        std::copy(world, world + 16, out);
+    }
+
+    // е Į  (OcclusionCuller   Ģ: ȼ ߽,  >= 0, ո鸸, /  )
+    void ReferenceRasterize(const OccluderMesh& mesh, const std::vector<std::array<float, 16>>& worlds, const float* viewProj,
+        std::uint32_t width, std::uint32_t height, std::vector<double>& depth)
+    {
+        depth.assign((std::size_t)width * height, 1.0);
+        for (const auto& world : worlds)
+        {
+            double m[16];
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c)
+                    m[r * 4 + c] = (double)world[r * 4 + 0] * viewProj[0 * 4 + c] + (double)world[r * 4 + 1] * viewProj[1 * 4 + c] +
+                        (double)world[r * 4 + 2] * viewProj[2 * 4 + c] + (double)world[r * 4 + 3] * viewProj[3 * 4 + c];
+
+            for (std::size_t t = 0; t + 2 < mesh.Indices.size(); t += 3)
+            {
+                double sx[3], sy[3], sz[3];
+                bool keep = true;
+                for (int k = 0; k < 3; ++k)
+                {
+                    const float* p = &mesh.Positions[mesh.Indices[t + k] * 3];
+                    const double x = p[0] * m[0] + p[1] * m[4] + p[2] * m[8] + m[12];
+                    const double y = p[0] * m[1] + p[1] * m[5] + p[2] * m[9] + m[13];
+                    const double z = p[0] * m[2] + p[1] * m[6] + p[2] * m[10] + m[14];
+                    const double w = p[0] * m[3] + p[1] * m[7] + p[2] * m[11] + m[15];
+                    keep = keep && w > 1e-6 && z >= 0.0;
+                    sx[k] = x / w * 0.5 * width + 0.5 * width;
+                    sy[k] = 0.5 * height - y / w * 0.5 * height;
+                    sz[k] = z / w;
+                    keep = keep && std::fabs(sx[k]) < 4096.0 && std::fabs(sy[k]) < 4096.0;
+                }
+
+                const double area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sx[2] - sx[0]) * (sy[1] - sy[0]);
+                if (!keep || area <= 0.0)
+                    continue;
+
+                const int x0 = std::max(0, (int)std::ceil(std::min({ sx[0], sx[1], sx[2] }) - 0.5));
+                const int x1 = std::min((int)width - 1, (int)std::floor(std::max({ sx[0], sx[1], sx[2] }) - 0.5));
+                const int y0 = std::max(0, (int)std::ceil(std::min({ sy[0], sy[1], sy[2] }) - 0.5));
+                const int y1 = std::min((int)height - 1, (int)std::floor(std::max({ sy[0], sy[1], sy[2] }) - 0.5));
+
+                for (int y = y0; y <= y1; ++y)
+                {
+                    for (int x = x0; x <= x1; ++x)
+                    {
+                        const double px = x + 0.5, py = y + 0.5;
+                        double b[3];
+                        for (int k = 0; k < 3; ++k)
+                        {
+                            const int n = (k + 1) % 3;
+                            b[k] = (sy[k] - sy[n]) * px + (sx[n] - sx[k]) * py + (sx[k] * sy[n] - sx[n] * sy[k]);
+                        }
+                        if (b[0] < 0.0 || b[1] < 0.0 || b[2] < 0.0)
+                            continue;
+
+                        //  ߽ ǥ  (b[1]  v0 , b[2]  v1 , b[0]  v2 )
+                        const double z = (b[1] * sz[0] + b[2] * sz[1] + b[0] * sz[2]) / area;
+                        double& d = depth[(std::size_t)y * width + x];
+                        d = std::min(d, z);
+                    }
+                }
+            }
+        }
+    }
+
+    // OcclusionCuller   Į  (  񱳿)
+    bool ProjectRect(const AabbSoA& boxes, std::uint32_t i, const float* m, std::uint32_t width, std::uint32_t height,
+        std::int32_t& x0, std::int32_t& y0, std::int32_t& x1, std::int32_t& y1, float& nearest)
+    {
+        float minX = INFINITY, maxX = -INFINITY, minY = INFINITY, maxY = -INFINITY;
+        nearest = INFINITY;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            const float px = boxes.CenterX[i] + ((corner & 1) ? boxes.ExtentX[i] : -boxes.ExtentX[i]);
+            const float py = boxes.CenterY[i] + ((corner & 2) ? boxes.ExtentY[i] : -boxes.ExtentY[i]);
+            const float pz = boxes.CenterZ[i] + ((corner & 4) ? boxes.ExtentZ[i] : -boxes.ExtentZ[i]);
+            const float x = px * m[0] + py * m[4] + pz * m[8] + m[12];
+            const float y = px * m[1] + py * m[5] + pz * m[9] + m[13];
+            const float z = px * m[2] + py * m[6] + pz * m[10] + m[14];
+            const float w = px * m[3] + py * m[7] + pz * m[11] + m[15];
+            if (z < 0.0f || w <= 1e-6f)
+                return false;
+
+            const float sx = x / w * 0.5f * width + 0.5f * width;
+            const float sy = 0.5f * height - y / w * 0.5f * height;
+            minX = std::min(minX, sx); maxX = std::max(maxX, sx);
+            minY = std::min(minY, sy); maxY = std::max(maxY, sy);
+            nearest = std::min(nearest, z / w);
+        }
+
+        x0 = std::max(0, (int)std::floor(std::max(minX, -1.0f)));
+        y0 = std::max(0, (int)std::floor(std::max(minY, -1.0f)));
+        x1 = std::min((int)width - 1, (int)std::floor(std::min(maxX, (float)width)));
+        y1 = std::min((int)height - 1, (int)std::floor(std::min(maxY, (float)height)));
+        return x0 <= x1 && y0 <= y1;
+    }
+}
+
+namespace OcclusionBenchmark
+{
+    OcclusionBenchmarkResult Run(std::uint32_t width, std::uint32_t height, std::uint32_t blocks, std::uint32_t frames)
+    {
+        OcclusionBenchmarkResult result;
+        result.Width = width;
+        result.Height = height;
+        result.Frames = frames;
+
+        // 1. : ϸ ǹ ϳ + ǰ (ǹ = Ŭ ĺ,   )
+        AabbSoA boxes;
+        const float half = 0.5f * BlockSpacing * (blocks - 1);
+        for (std::uint32_t bz = 0; bz < blocks; ++bz)
+        {
+            for (std::uint32_t bx = 0; bx < blocks; ++bx)
+            {
+                const float cx = bx * BlockSpacing - half;
+                const float cz = bz * BlockSpacing - half;
+                const std::uint32_t hash = bx * 73856093u ^ bz * 19349663u;
+                const float height = 3.0f + (float)(hash % 13);
+                boxes.Add(cx, height, cz, 3.0f + (hash % 3) * 0.5f, height, 3.0f + (hash / 3 % 3) * 0.5f);
+
+                for (std::uint32_t p = 0; p < PropsPerBlock; ++p)
+                {
+                    const float angle = p * (2.0f * 3.14159265f / PropsPerBlock);
+                    boxes.Add(cx + 5.5f * std::cos(angle), 0.4f, cz + 5.5f * std::sin(angle), 0.4f, 0.4f, 0.4f);
+                }
+            }
+        }
+        result.Objects = (std::uint32_t)boxes.Size();
+
+        const OccluderMesh unitBox = MakeUnitBox();
+        OcclusionCuller culler(width, height);
+
+        std::vector<std::uint32_t> frustumVisible, occluders, visible;
+        std::vector<std::array<float, 16>> worlds;
+        std::vector<double> reference;
+        std::uint64_t mismatchedPixels = 0, comparedPixels = 0;
+
+        // 2.    ɾ ¿ ݾ ѷ
+        for (std::uint32_t frame = 0; frame < frames; ++frame)
+        {
+            const float eyeX = (blocks % 2) != 0 ? 0.5f * BlockSpacing : 0.0f; //    Ѱ
+            const float eyeY = 1.7f;
+            const float eyeZ = -half + frame * 0.75f;
+            const float yaw = 0.35f * std::sin(frame * 0.15f);
+
+            float viewProj[16];
+            MakeViewProj(eyeX, eyeY, eyeZ, yaw, (float)width / height, viewProj);
+
+            Frustum frustum;
+            FrustumCulling::ExtractPlanes(viewProj, frustum);
+            FrustumCulling::CullAabbs(frustum, boxes, frustumVisible);
+
+            auto t0 = Clock::now();
+            OcclusionCuller::SelectOccluders(boxes, frustumVisible, eyeX, eyeY, eyeZ, MinOccluderSize, MaxOccluders, occluders);
+            culler.BeginFrame(viewProj);
+            worlds.resize(occluders.size());
+            for (std::size_t o = 0; o < occluders.size(); ++o)
+            {
+                MakeWorld(boxes, occluders[o], worlds[o].data());
+                culler.AddOccluder(unitBox, worlds[o].data());
+            }
+            auto t1 = Clock::now();
+            culler.Rasterize();
+            culler.CullAabbs(boxes, frustumVisible, visible);
+            auto t2 = Clock::now();
+
+            const OcclusionStats& stats = culler.GetStats();
+            result.SelectMs += ElapsedMs(t0, t1);
+            result.RasterMs += stats.RasterMs;
+            result.HierarchyMs += stats.HierarchyMs;
+            result.TestMs += stats.TestMs;
+            result.TotalMs += ElapsedMs(t0, t2);
+            result.Occluders += stats.Occluders;
+            result.Triangles += stats.TrianglesRasterized;
+            result.FrustumVisible += (double)frustumVisible.size();
+            result.Occluded += stats.Occluded;
+
+            // 3. :   (  )
+            if (frame < ReferenceFrames)
+            {
+                ReferenceRasterize(unitBox, worlds, viewProj, width, height, reference);
+                const float* depth = culler.GetDepth();
+                for (std::size_t p = 0; p < reference.size(); ++p)
+                {
+                    if (std::fabs(depth[p] - reference[p]) > 1e-4)
+                        ++mismatchedPixels;
+                }
+                comparedPixels += reference.size();
+            }
+
+            //   ==  0   ( 簢/̷), SIMD  == Į 
+            std::size_t cursor = 0;
+            for (std::uint32_t i : frustumVisible)
+            {
+                const bool simdVisible = cursor < visible.size() && visible[cursor] == i;
+                if (simdVisible)
+                    ++cursor;
+
+                const AabbSoA& b = boxes;
+                if (simdVisible != culler.IsAabbVisible(b.CenterX[i], b.CenterY[i], b.CenterZ[i], b.ExtentX[i], b.ExtentY[i], b.ExtentZ[i]))
+                    ++result.HierarchyErrors;
+
+                std::int32_t x0, y0, x1, y1;
+                float nearest;
+                if (!ProjectRect(boxes, i, viewProj, width, height, x0, y0, x1, y1, nearest))
+                    continue;
+
+                bool bruteVisible = false;
+                for (std::int32_t y = y0; y <= y1 && !bruteVisible; ++y)
+                    for (std::int32_t x = x0; x <= x1 && !bruteVisible; ++x)
+                        bruteVisible = nearest <= culler.GetDepth()[(std::size_t)y * width + x];
+
+                if (bruteVisible != culler.IsRectVisible(x0, y0, x1, y1, nearest))
+                    ++result.HierarchyErrors;
+            }
+        }
+
+        const double n = frames > 0 ? (double)frames : 1.0;
+        result.SelectMs /= n;
+        result.RasterMs /= n;
+        result.HierarchyMs /= n;
+        result.TestMs /= n;
+        result.TotalMs /= n;
+        result.Occluders /= n;
+        result.Triangles /= n;
+        result.CulledPercent = result.FrustumVisible > 0.0 ? 100.0 * result.Occluded / result.FrustumVisible : 0.0;
+        result.FrustumVisible /= n;
+        result.Occluded /= n;
+
+        //   ȼ ݿø ̷    
+        result.DepthMismatchPercent = comparedPixels > 0 ? 100.0 * mismatchedPixels / comparedPixels : 0.0;
+        result.Valid = result.HierarchyErrors == 0 && result.DepthMismatchPercent < 0.5;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[OcclusionBenchmark]\n";
+        report += "  buffer    objects occluders  tris  frustum  occluded  culled%  select(ms)  raster(ms)  hiz(ms)  test(ms)  total(ms)  mismatch%  valid\n";
+
+        const std::uint32_t sizes[][2] = { { 256, 128 }, { 512, 256 } };
+        bool valid = true;
+        for (const auto& size : sizes)
+        {
+            OcclusionBenchmarkResult r = Run(size[0], size[1], 48, 64);
+            valid = valid && r.Valid;
+
+            char line[256];
+            snprintf(line, sizeof(line), "%4ux%-4u %8u %9.1f %5.0f %8.0f %9.0f %7.1f %11.3f %11.3f %8.3f %9.3f %10.3f %10.3f  %s\n",
+                r.Width, r.Height, r.Objects, r.Occluders, r.Triangles, r.FrustumVisible, r.Occluded, r.CulledPercent,
+                r.SelectMs, r.RasterMs, r.HierarchyMs, r.TestMs, r.TotalMs, r.DepthMismatchPercent,
+                r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
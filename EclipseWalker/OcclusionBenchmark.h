@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// Ʈ Ŭ ø  (߿, GPU )
+//   (ϸ ǹ ϳ +  ǰ)     ī޶ ɾ
+// Ӹ ü ø -> Ŭ  ->  ->  ->  ð   
+//  Ȯ:
+//   1.  ۰ е Į Ϳ  (  ȼ ̸ )
+//   2.    0    (ٰ    Ʋ   )
+// ==========================================================
+
+struct OcclusionBenchmarkResult
+{
+    std::uint32_t Width = 0;
+    std::uint32_t Height = 0;
+    std::uint32_t Objects = 0;
+    std::uint32_t Frames = 0;
+
+    //   
+    double Occluders = 0.0;
+    double Triangles = 0.0;             // ¾   
+    double FrustumVisible = 0.0;
+    double Occluded = 0.0;
+    double CulledPercent = 0.0;         // ü     
+
+    double SelectMs = 0.0;
+    double RasterMs = 0.0;
+    double HierarchyMs = 0.0;
+    double TestMs = 0.0;
+    double TotalMs = 0.0;
+
+    double DepthMismatchPercent = 0.0;  // Į Ϳ ٸ ȼ
+    std::uint64_t HierarchyErrors = 0;  //   !=  
+    bool Valid = false;
+};
+
+namespace OcclusionBenchmark
+{
+    OcclusionBenchmarkResult Run(std::uint32_t width, std::uint32_t height, std::uint32_t blocks, std::uint32_t frames);
+
+    // 256x128 / 512x256, 48x48 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,702 @@
+#include "OcclusionCulling.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    // ̺ ָ Ǵ  ִ ﰢ  ׸ (  е,  )
+    constexpr float GuardBand = 4096.0f;
+    constexpr float MinClipW = 1e-6f;
+    constexpr std::uint32_t CullGrain = 256; // CullAabbs ۾ ϳ (8  )
+
+    // ---------------------------------------------------------
+    // 8 float (__AVX__  __m256 ϳ, ƴϸ __m128 )
+    //   Lane8 ( Ʈ 1 = )
+    // ---------------------------------------------------------
+#if defined(__AVX__)
+    struct Lane8
+    {
+        __m256 V;
+    };
+
+    inline Lane8 Set1(float f) { return { _mm256_set1_ps(f) }; }
+    inline Lane8 Load(const float* p) { return { _mm256_loadu_ps(p) }; }
+    inline void Store(float* p, Lane8 a) { _mm256_storeu_ps(p, a.V); }
+
+    inline Lane8 operator+(Lane8 a, Lane8 b) { return { _mm256_add_ps(a.V, b.V) }; }
+    inline Lane8 operator-(Lane8 a, Lane8 b) { return { _mm256_sub_ps(a.V, b.V) }; }
+    inline Lane8 operator*(Lane8 a, Lane8 b) { return { _mm256_mul_ps(a.V, b.V) }; }
+    inline Lane8 operator/(Lane8 a, Lane8 b) { return { _mm256_div_ps(a.V, b.V) }; }
+    inline Lane8 operator&(Lane8 a, Lane8 b) { return { _mm256_and_ps(a.V, b.V) }; }
+    inline Lane8 operator|(Lane8 a, Lane8 b) { return { _mm256_or_ps(a.V, b.V) }; }
+    inline Lane8 Min(Lane8 a, Lane8 b) { return { _mm256_min_ps(a.V, b.V) }; }
+    inline Lane8 Max(Lane8 a, Lane8 b) { return { _mm256_max_ps(a.V, b.V) }; }
+
+    inline Lane8 CmpGe(Lane8 a, Lane8 b) { return { _mm256_cmp_ps(a.V, b.V, _CMP_GE_OQ) }; }
+    inline Lane8 CmpGt(Lane8 a, Lane8 b) { return { _mm256_cmp_ps(a.V, b.V, _CMP_GT_OQ) }; }
+    inline Lane8 CmpLt(Lane8 a, Lane8 b) { return { _mm256_cmp_ps(a.V, b.V, _CMP_LT_OQ) }; }
+
+    // mask   a, ƴϸ b
+    inline Lane8 Select(Lane8 mask, Lane8 a, Lane8 b) { return { _mm256_blendv_ps(b.V, a.V, mask.V) }; }
+    inline unsigned int MoveMask(Lane8 a) { return (unsigned int)_mm256_movemask_ps(a.V); }
+#else
+    struct Lane8
+    {
+        __m128 Lo, Hi;
+    };
+
+    inline Lane8 Set1(float f) { __m128 v = _mm_set1_ps(f); return { v, v }; }
+    inline Lane8 Load(const float* p) { return { _mm_loadu_ps(p), _mm_loadu_ps(p + 4) }; }
+    inline void Store(float* p, Lane8 a) { _mm_storeu_ps(p, a.Lo); _mm_storeu_ps(p + 4, a.Hi); }
+
+    inline Lane8 operator+(Lane8 a, Lane8 b) { return { _mm_add_ps(a.Lo, b.Lo), _mm_add_ps(a.Hi, b.Hi) }; }
+    inline Lane8 operator-(Lane8 a, Lane8 b) { return { _mm_sub_ps(a.Lo, b.Lo), _mm_sub_ps(a.Hi, b.Hi) }; }
+    inline Lane8 operator*(Lane8 a, Lane8 b) { return { _mm_mul_ps(a.Lo, b.Lo), _mm_mul_ps(a.Hi, b.Hi) }; }
+    inline Lane8 operator/(Lane8 a, Lane8 b) { return { _mm_div_ps(a.Lo, b.Lo), _mm_div_ps(a.Hi, b.Hi) }; }
+    inline Lane8 operator&(Lane8 a, Lane8 b) { return { _mm_and_ps(a.Lo, b.Lo), _mm_and_ps(a.Hi, b.Hi) }; }
+    inline Lane8 operator|(Lane8 a, Lane8 b) { return { _mm_or_ps(a.Lo, b.Lo), _mm_or_ps(a.Hi, b.Hi) }; }
+    inline Lane8 Min(Lane8 a, Lane8 b) { return { _mm_min_ps(a.Lo, b.Lo), _mm_min_ps(a.Hi, b.Hi) }; }
+    inline Lane8 Max(Lane8 a, Lane8 b) { return { _mm_max_ps(a.Lo, b.Lo), _mm_max_ps(a.Hi, b.Hi) }; }
+
+    inline Lane8 CmpGe(Lane8 a, Lane8 b) { return { _mm_cmpge_ps(a.Lo, b.Lo), _mm_cmpge_ps(a.Hi, b.Hi) }; }
+    inline Lane8 CmpGt(Lane8 a, Lane8 b) { return { _mm_cmpgt_ps(a.Lo, b.Lo), _mm_cmpgt_ps(a.Hi, b.Hi) }; }
+    inline Lane8 CmpLt(Lane8 a, Lane8 b) { return { _mm_cmplt_ps(a.Lo, b.Lo), _mm_cmplt_ps(a.Hi, b.Hi) }; }
+
+    // SSE2  blendv  Ƿ and/andnot
+    inline Lane8 Select(Lane8 mask, Lane8 a, Lane8 b)
+    {
+        return { _mm_or_ps(_mm_and_ps(mask.Lo, a.Lo), _mm_andnot_ps(mask.Lo, b.Lo)),
+                 _mm_or_ps(_mm_and_ps(mask.Hi, a.Hi), _mm_andnot_ps(mask.Hi, b.Hi)) };
+    }
+    inline unsigned int MoveMask(Lane8 a) { return (unsigned int)_mm_movemask_ps(a.Lo) | ((unsigned int)_mm_movemask_ps(a.Hi) << 4); }
+#endif
+
+    inline int CountTrailingZeros(unsigned int v)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, v);
+        return (int)index;
+#else
+        return __builtin_ctz(v);
+#endif
+    }
+
+    //   Ծ: out = a * b
+    void Multiply(const float* a, const float* b, float* out)
+    {
+        for (int r = 0; r < 4; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                out[r * 4 + c] = a[r * 4 + 0] * b[0 * 4 + c] + a[r * 4 + 1] * b[1 * 4 + c] +
+                    a[r * 4 + 2] * b[2 * 4 + c] + a[r * 4 + 3] * b[3 * 4 + c];
+            }
+        }
+    }
+
+    // ȭ ǥ  -> ġ ȼ (). ȭ ̸ false
+    bool BoundsToRect(float minX, float maxX, float minY, float maxY, std::uint32_t width, std::uint32_t height,
+        std::int32_t& x0, std::int32_t& y0, std::int32_t& x1, std::int32_t& y1)
+    {
+        const float w = (float)width;
+        const float h = (float)height;
+        x0 = (std::int32_t)std::floor(std::clamp(minX, -1.0f, w));
+        x1 = (std::int32_t)std::floor(std::clamp(maxX, -1.0f, w));
+        y0 = (std::int32_t)std::floor(std::clamp(minY, -1.0f, h));
+        y1 = (std::int32_t)std::floor(std::clamp(maxY, -1.0f, h));
+
+        if (x1 < 0 || y1 < 0 || x0 >= (std::int32_t)width || y0 >= (std::int32_t)height)
+            return false;
+
+        x0 = std::max(x0, 0);
+        y0 = std::max(y0, 0);
+        x1 = std::min(x1, (std::int32_t)width - 1);
+        y1 = std::min(y1, (std::int32_t)height - 1);
+        return true;
+    }
+}
+
+OcclusionCuller::OcclusionCuller(std::uint32_t width, std::uint32_t height)
+    : mWidth(width), mHeight(height)
+{
+    assert(width > 0 && height > 0 && width % TileSize == 0 && height % TileSize == 0);
+
+    mTilesX = width / TileSize;
+    mTilesY = height / TileSize;
+    mDepth.assign((std::size_t)width * height, 1.0f);
+
+    // 2x2  ٿ 1x1  (Ȧ ø)
+    mLevels.emplace_back();
+    mLevels[0].Width = width;
+    mLevels[0].Height = height;
+    while (mLevels.back().Width > 1 || mLevels.back().Height > 1)
+    {
+        Level level;
+        level.Width = (mLevels.back().Width + 1) / 2;
+        level.Height = (mLevels.back().Height + 1) / 2;
+        level.Min.resize((std::size_t)level.Width * level.Height);
+        level.Max.resize((std::size_t)level.Width * level.Height);
+        mLevels.push_back(std::move(level));
+    }
+}
+
+void OcclusionCuller::BeginFrame(const float* viewProj)
+{
+    std::copy(viewProj, viewProj + 16, mViewProj);
+    std::fill(mDepth.begin(), mDepth.end(), 1.0f);
+    mOccluders.clear();
+    mStats = OcclusionStats();
+}
+
+void OcclusionCuller::AddOccluder(const OccluderMesh& mesh, const float* world)
+{
+    if (mesh.IsEmpty())
+        return;
+
+    Occluder occluder;
+    occluder.Mesh = &mesh;
+    std::copy(world, world + 16, occluder.World);
+    mOccluders.push_back(occluder);
+}
+
+void OcclusionCuller::Rasterize()
+{
+    PROFILE_SCOPE("OcclusionCuller::Rasterize");
+    auto t0 = Clock::now();
+
+    const std::uint32_t occluderCount = (std::uint32_t)mOccluders.size();
+    if (mWork.size() < occluderCount)
+        mWork.resize(occluderCount);
+
+    JobSystem* jobs = JobSystem::GetInstance();
+
+    // 1. Ŭ ȯ + ¾ + Ÿ й
+    jobs->ParallelFor(occluderCount, 1, [this](std::uint32_t begin, std::uint32_t end)
+    {
+        for (std::uint32_t o = begin; o < end; ++o)
+            SetupOccluder(mOccluders[o], mWork[o]);
+    });
+
+    // 2. Ÿϸ  (Ŭ )
+    if (occluderCount > 0)
+    {
+        jobs->ParallelFor(mTilesX * mTilesY, 1, [this](std::uint32_t begin, std::uint32_t end)
+        {
+            for (std::uint32_t tile = begin; tile < end; ++tile)
+                RasterizeTile(tile);
+        });
+    }
+    auto t1 = Clock::now();
+
+    // 3. 
+    BuildHierarchy();
+    auto t2 = Clock::now();
+
+    mStats.Occluders = occluderCount;
+    for (std::uint32_t o = 0; o < occluderCount; ++o)
+    {
+        mStats.Triangles += (std::uint32_t)mOccluders[o].Mesh->Indices.size() / 3;
+        mStats.TrianglesRasterized += (std::uint32_t)mWork[o].Triangles.size();
+    }
+    mStats.RasterMs = ElapsedMs(t0, t1);
+    mStats.HierarchyMs = ElapsedMs(t1, t2);
+}
+
+void OcclusionCuller::SetupOccluder(const Occluder& occluder, OccluderWork& work)const
+{
+    const OccluderMesh& mesh = *occluder.Mesh;
+    const std::uint32_t vertexCount = mesh.GetVertexCount();
+    const std::uint32_t paddedCount = (vertexCount + 7) & ~7u;
+
+    float m[16];
+    Multiply(occluder.World, mViewProj, m);
+
+    // 1.  -> Ŭ  (8)
+    work.ClipX.resize(paddedCount);
+    work.ClipY.resize(paddedCount);
+    work.ClipZ.resize(paddedCount);
+    work.ClipW.resize(paddedCount);
+
+    const float* positions = mesh.Positions.data();
+    for (std::uint32_t v = 0; v < paddedCount; v += 8)
+    {
+        alignas(32) float px[8], py[8], pz[8];
+        for (std::uint32_t lane = 0; lane < 8; ++lane)
+        {
+            const std::uint32_t i = std::min(v + lane, vertexCount - 1);
+            px[lane] = positions[i * 3 + 0];
+            py[lane] = positions[i * 3 + 1];
+            pz[lane] = positions[i * 3 + 2];
+        }
+
+        const Lane8 x = Load(px), y = Load(py), z = Load(pz);
+        Store(&work.ClipX[v], x * Set1(m[0]) + y * Set1(m[4]) + z * Set1(m[8]) + Set1(m[12]));
+        Store(&work.ClipY[v], x * Set1(m[1]) + y * Set1(m[5]) + z * Set1(m[9]) + Set1(m[13]));
+        Store(&work.ClipZ[v], x * Set1(m[2]) + y * Set1(m[6]) + z * Set1(m[10]) + Set1(m[14]));
+        Store(&work.ClipW[v], x * Set1(m[3]) + y * Set1(m[7]) + z * Set1(m[11]) + Set1(m[15]));
+    }
+
+    // 2. ﰢ 8 ¾
+    const Lane8 zero = Set1(0.0f);
+    const Lane8 one = Set1(1.0f);
+    const Lane8 halfWidth = Set1(0.5f * mWidth);
+    const Lane8 halfHeight = Set1(0.5f * mHeight);
+    const Lane8 guard = Set1(GuardBand);
+    const Lane8 negGuard = Set1(-GuardBand);
+    const Lane8 minW = Set1(MinClipW);
+
+    const std::uint32_t* indices = mesh.Indices.data();
+    const std::uint32_t triangleCount = (std::uint32_t)mesh.Indices.size() / 3;
+    work.Triangles.clear();
+
+    for (std::uint32_t t = 0; t < triangleCount; t += 8)
+    {
+        // 2-1.  (  w = 0 -> Ʒ )
+        alignas(32) float cx[3][8], cy[3][8], cz[3][8], cw[3][8];
+        for (std::uint32_t lane = 0; lane < 8; ++lane)
+        {
+            const std::uint32_t tri = t + lane;
+            for (int k = 0; k < 3; ++k)
+            {
+                if (tri < triangleCount)
+                {
+                    const std::uint32_t i = indices[tri * 3 + k];
+                    cx[k][lane] = work.ClipX[i];
+                    cy[k][lane] = work.ClipY[i];
+                    cz[k][lane] = work.ClipZ[i];
+                    cw[k][lane] = work.ClipW[i];
+                }
+                else
+                {
+                    cx[k][lane] = cy[k][lane] = cz[k][lane] = cw[k][lane] = 0.0f;
+                }
+            }
+        }
+
+        // 2-2. ȭ  (    ̾ )
+        Lane8 sx[3], sy[3], sz[3];
+        Lane8 keep = CmpGe(zero, zero);
+        for (int k = 0; k < 3; ++k)
+        {
+            const Lane8 w = Load(cw[k]);
+            const Lane8 z = Load(cz[k]);
+            keep = keep & CmpGt(w, minW) & CmpGe(z, zero);
+
+            const Lane8 invW = one / Max(w, minW);
+            sx[k] = Load(cx[k]) * invW * halfWidth + halfWidth;
+            sy[k] = halfHeight - Load(cy[k]) * invW * halfHeight;
+            sz[k] = z * invW;
+        }
+
+        const Lane8 minX = Min(Min(sx[0], sx[1]), sx[2]);
+        const Lane8 maxX = Max(Max(sx[0], sx[1]), sx[2]);
+        const Lane8 minY = Min(Min(sy[0], sy[1]), sy[2]);
+        const Lane8 maxY = Max(Max(sy[0], sy[1]), sy[2]);
+        keep = keep & CmpGt(minX, negGuard) & CmpLt(maxX, guard) & CmpGt(minY, negGuard) & CmpLt(maxY, guard);
+
+        // 2-3.  (y  Ʒ -> ȭ鿡 ð  = ո = ). ޸/ȭ 
+        const Lane8 e10x = sx[1] - sx[0], e10y = sy[1] - sy[0];
+        const Lane8 e20x = sx[2] - sx[0], e20y = sy[2] - sy[0];
+        const Lane8 area = e10x * e20y - e20x * e10y;
+        keep = keep & CmpGt(area, zero);
+
+        unsigned int mask = MoveMask(keep);
+        if (mask == 0)
+            continue;
+
+        // 2-4.  (v0->v1, v1->v2, v2->v0)   
+        alignas(32) float a[3][8], b[3][8], c[3][8];
+        for (int k = 0; k < 3; ++k)
+        {
+            const int n = (k + 1) % 3;
+            Store(a[k], sy[k] - sy[n]);
+            Store(b[k], sx[n] - sx[k]);
+            Store(c[k], sx[k] * sy[n] - sx[n] * sy[k]);
+        }
+
+        const Lane8 invArea = one / Select(keep, area, one);
+        const Lane8 dz10 = sz[1] - sz[0], dz20 = sz[2] - sz[0];
+        const Lane8 dzdx = (dz10 * e20y - dz20 * e10y) * invArea;
+        const Lane8 dzdy = (dz20 * e10x - dz10 * e20x) * invArea;
+
+        alignas(32) float z0[8], zx[8], zy[8], bx0[8], bx1[8], by0[8], by1[8];
+        Store(z0, sz[0] - dzdx * sx[0] - dzdy * sy[0]);
+        Store(zx, dzdx);
+        Store(zy, dzdy);
+        Store(bx0, minX);
+        Store(bx1, maxX);
+        Store(by0, minY);
+        Store(by1, maxY);
+
+        // 2-5.  θ ȼ  (߽ ȿ  ȼ  )
+        while (mask != 0)
+        {
+            const unsigned int lane = (unsigned int)CountTrailingZeros(mask);
+            mask &= mask - 1;
+
+            Triangle tri;
+            tri.MinX = (std::int32_t)std::ceil(std::max(bx0[lane] - 0.5f, 0.0f));
+            tri.MaxX = (std::int32_t)std::floor(std::min(bx1[lane] - 0.5f, (float)mWidth - 1.0f));
+            tri.MinY = (std::int32_t)std::ceil(std::max(by0[lane] - 0.5f, 0.0f));
+            tri.MaxY = (std::int32_t)std::floor(std::min(by1[lane] - 0.5f, (float)mHeight - 1.0f));
+            if (tri.MinX > tri.MaxX || tri.MinY > tri.MaxY)
+                continue;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                tri.A[k] = a[k][lane];
+                tri.B[k] = b[k][lane];
+                tri.C[k] = c[k][lane];
+            }
+            tri.Z0 = z0[lane];
+            tri.Dzdx = zx[lane];
+            tri.Dzdy = zy[lane];
+            work.Triangles.push_back(tri);
+        }
+    }
+
+    // 3. Ÿ й (CSR:  ->  -> ä, ä鼭   ġ  ĭ ǵ)
+    const std::uint32_t tileCount = mTilesX * mTilesY;
+    work.TileStart.assign(tileCount + 1, 0);
+    for (const Triangle& tri : work.Triangles)
+    {
+        for (std::int32_t ty = tri.MinY / (std::int32_t)TileSize; ty <= tri.MaxY / (std::int32_t)TileSize; ++ty)
+            for (std::int32_t tx = tri.MinX / (std::int32_t)TileSize; tx <= tri.MaxX / (std::int32_t)TileSize; ++tx)
+                ++work.TileStart[ty * mTilesX + tx + 1];
+    }
+    for (std::uint32_t tile = 0; tile < tileCount; ++tile)
+        work.TileStart[tile + 1] += work.TileStart[tile];
+
+    work.TileTriangles.resize(work.TileStart[tileCount]);
+    for (std::uint32_t i = 0; i < (std::uint32_t)work.Triangles.size(); ++i)
+    {
+        const Triangle& tri = work.Triangles[i];
+        for (std::int32_t ty = tri.MinY / (std::int32_t)TileSize; ty <= tri.MaxY / (std::int32_t)TileSize; ++ty)
+            for (std::int32_t tx = tri.MinX / (std::int32_t)TileSize; tx <= tri.MaxX / (std::int32_t)TileSize; ++tx)
+                work.TileTriangles[work.TileStart[ty * mTilesX + tx]++] = i;
+    }
+    for (std::uint32_t tile = tileCount; tile > 0; --tile)
+        work.TileStart[tile] = work.TileStart[tile - 1];
+    work.TileStart[0] = 0;
+}
+
+void OcclusionCuller::RasterizeTile(std::uint32_t tile)
+{
+    const std::int32_t tileX0 = (std::int32_t)((tile % mTilesX) * TileSize);
+    const std::int32_t tileY0 = (std::int32_t)((tile / mTilesX) * TileSize);
+    const std::int32_t tileX1 = tileX0 + (std::int32_t)TileSize - 1;
+    const std::int32_t tileY1 = tileY0 + (std::int32_t)TileSize - 1;
+
+    alignas(32) const float offsets[8] = { 0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f };
+    const Lane8 laneCenters = Load(offsets);
+    const Lane8 zero = Set1(0.0f);
+
+    for (std::uint32_t o = 0; o < (std::uint32_t)mOccluders.size(); ++o)
+    {
+        const OccluderWork& work = mWork[o];
+        for (std::uint32_t k = work.TileStart[tile]; k < work.TileStart[tile + 1]; ++k)
+        {
+            const Triangle& tri = work.Triangles[work.TileTriangles[k]];
+            const std::int32_t x0 = std::max(tri.MinX, tileX0);
+            const std::int32_t x1 = std::min(tri.MaxX, tileX1);
+            const std::int32_t y0 = std::max(tri.MinY, tileY0);
+            const std::int32_t y1 = std::min(tri.MaxY, tileY1);
+
+            const Lane8 a0 = Set1(tri.A[0]), a1 = Set1(tri.A[1]), a2 = Set1(tri.A[2]);
+            const Lane8 dzdx = Set1(tri.Dzdx);
+            const Lane8 columnMin = Set1((float)x0);
+            const Lane8 columnMax = Set1((float)x1 + 1.0f);
+
+            //  ȿ 8 ȼ (Ÿ/ȭ  8   ġ )
+            const std::int32_t xStart = x0 & ~7;
+            for (std::int32_t y = y0; y <= y1; ++y)
+            {
+                const float py = (float)y + 0.5f;
+                const Lane8 row0 = Set1(tri.B[0] * py + tri.C[0]);
+                const Lane8 row1 = Set1(tri.B[1] * py + tri.C[1]);
+                const Lane8 row2 = Set1(tri.B[2] * py + tri.C[2]);
+                const Lane8 rowZ = Set1(tri.Z0 + tri.Dzdy * py);
+                float* depthRow = &mDepth[(std::size_t)y * mWidth];
+
+                for (std::int32_t x = xStart; x <= x1; x += 8)
+                {
+                    const Lane8 px = Set1((float)x) + laneCenters;
+                    const Lane8 inside = CmpGe(a0 * px + row0, zero) & CmpGe(a1 * px + row1, zero) &
+                        CmpGe(a2 * px + row2, zero) & CmpGt(px, columnMin) & CmpLt(px, columnMax);
+                    if (MoveMask(inside) == 0)
+                        continue;
+
+                    const Lane8 z = dzdx * px + rowZ;
+                    const Lane8 depth = Load(depthRow + x);
+                    Store(depthRow + x, Select(inside, Min(depth, z), depth));
+                }
+            }
+        }
+    }
+}
+
+void OcclusionCuller::BuildHierarchy()
+{
+    //  0    ü (ּ = ִ)
+    const float* prevMin = mDepth.data();
+    const float* prevMax = mDepth.data();
+    std::uint32_t prevWidth = mWidth;
+    std::uint32_t prevHeight = mHeight;
+
+    for (std::size_t l = 1; l < mLevels.size(); ++l)
+    {
+        Level& level = mLevels[l];
+        for (std::uint32_t y = 0; y < level.Height; ++y)
+        {
+            const std::uint32_t y0 = y * 2;
+            const std::uint32_t y1 = std::min(y0 + 1, prevHeight - 1);
+            for (std::uint32_t x = 0; x < level.Width; ++x)
+            {
+                const std::uint32_t x0 = x * 2;
+                const std::uint32_t x1 = std::min(x0 + 1, prevWidth - 1);
+
+                const std::size_t i00 = (std::size_t)y0 * prevWidth + x0, i01 = (std::size_t)y0 * prevWidth + x1;
+                const std::size_t i10 = (std::size_t)y1 * prevWidth + x0, i11 = (std::size_t)y1 * prevWidth + x1;
+                level.Min[(std::size_t)y * level.Width + x] = std::min(std::min(prevMin[i00], prevMin[i01]), std::min(prevMin[i10], prevMin[i11]));
+                level.Max[(std::size_t)y * level.Width + x] = std::max(std::max(prevMax[i00], prevMax[i01]), std::max(prevMax[i10], prevMax[i11]));
+            }
+        }
+
+        prevMin = level.Min.data();
+        prevMax = level.Max.data();
+        prevWidth = level.Width;
+        prevHeight = level.Height;
+    }
+}
+
+bool OcclusionCuller::IsRectVisible(std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1, float nearestDepth)const
+{
+    // ȭ  ⼭   (ü ø )
+    if (x1 < 0 || y1 < 0 || x0 >= (std::int32_t)mWidth || y0 >= (std::int32_t)mHeight || x0 > x1 || y0 > y1)
+        return true;
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, (std::int32_t)mWidth - 1);
+    y1 = std::min(y1, (std::int32_t)mHeight - 1);
+
+    // 簢 2x2 ĭ ȿ    
+    std::uint32_t level = 0;
+    while (level + 1 < (std::uint32_t)mLevels.size() &&
+        ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1))
+        ++level;
+
+    for (std::int32_t ty = y0 >> level; ty <= (y1 >> level); ++ty)
+        for (std::int32_t tx = x0 >> level; tx <= (x1 >> level); ++tx)
+            if (IsTexelVisible(level, tx, ty, x0, y0, x1, y1, nearestDepth))
+                return true;
+    return false;
+}
+
+bool OcclusionCuller::IsTexelVisible(std::uint32_t level, std::int32_t tx, std::int32_t ty,
+    std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1, float nearestDepth)const
+{
+    const std::size_t index = (std::size_t)ty * mLevels[level].Width + tx;
+    const float maxDepth = level == 0 ? mDepth[index] : mLevels[level].Max[index];
+    const float minDepth = level == 0 ? mDepth[index] : mLevels[level].Min[index];
+
+    // ĭ ü   Ŭ  ->  ĭ  κ  
+    if (nearestDepth > maxDepth)
+        return false;
+    // ĭ ü   Ŭ  -> 
+    if (nearestDepth <= minDepth)
+        return true;
+
+    // ָϸ 簢 ġ ڽ ĭ
+    const std::uint32_t child = level - 1;
+    const std::int32_t cy0 = std::max(ty * 2, y0 >> child), cy1 = std::min(ty * 2 + 1, y1 >> child);
+    const std::int32_t cx0 = std::max(tx * 2, x0 >> child), cx1 = std::min(tx * 2 + 1, x1 >> child);
+    for (std::int32_t cy = cy0; cy <= cy1; ++cy)
+        for (std::int32_t cx = cx0; cx <= cx1; ++cx)
+            if (IsTexelVisible(child, cx, cy, x0, y0, x1, y1, nearestDepth))
+                return true;
+    return false;
+}
+
+bool OcclusionCuller::ProjectAabb(float cx, float cy, float cz, float ex, float ey, float ez,
+    std::int32_t& x0, std::int32_t& y0, std::int32_t& x1, std::int32_t& y1, float& nearestDepth)const
+{
+    const float* m = mViewProj;
+    const float halfWidth = 0.5f * mWidth;
+    const float halfHeight = 0.5f * mHeight;
+
+    float minX = INFINITY, maxX = -INFINITY, minY = INFINITY, maxY = -INFINITY;
+    nearestDepth = INFINITY;
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        const float px = cx + ((corner & 1) ? ex : -ex);
+        const float py = cy + ((corner & 2) ? ey : -ey);
+        const float pz = cz + ((corner & 4) ? ez : -ez);
+
+        const float x = px * m[0] + py * m[4] + pz * m[8] + m[12];
+        const float y = px * m[1] + py * m[5] + pz * m[9] + m[13];
+        const float z = px * m[2] + py * m[6] + pz * m[10] + m[14];
+        const float w = px * m[3] + py * m[7] + pz * m[11] + m[15];
+        if (z < 0.0f || w <= MinClipW)
+            return false;
+
+        const float invW = 1.0f / w;
+        const float sx = x * invW * halfWidth + halfWidth;
+        const float sy = halfHeight - y * invW * halfHeight;
+        minX = std::min(minX, sx); maxX = std::max(maxX, sx);
+        minY = std::min(minY, sy); maxY = std::max(maxY, sy);
+        nearestDepth = std::min(nearestDepth, z * invW);
+    }
+
+    if (!BoundsToRect(minX, maxX, minY, maxY, mWidth, mHeight, x0, y0, x1, y1))
+    {
+        // ȭ  ->  簢 (IsRectVisible  ̴ )
+        x0 = y0 = 0;
+        x1 = y1 = -1;
+    }
+    return true;
+}
+
+bool OcclusionCuller::IsAabbVisible(float cx, float cy, float cz, float ex, float ey, float ez)const
+{
+    std::int32_t x0, y0, x1, y1;
+    float nearestDepth;
+    if (!ProjectAabb(cx, cy, cz, ex, ey, ez, x0, y0, x1, y1, nearestDepth))
+        return true;
+    return IsRectVisible(x0, y0, x1, y1, nearestDepth);
+}
+
+std::size_t OcclusionCuller::CullAabbs(const AabbSoA& boxes, const std::vector<std::uint32_t>& candidates, std::vector<std::uint32_t>& outVisible)
+{
+    PROFILE_SCOPE("OcclusionCuller::CullAabbs");
+    assert(&candidates != &outVisible);
+    auto t0 = Clock::now();
+
+    const std::uint32_t count = (std::uint32_t)candidates.size();
+    mVisibleFlags.resize(count);
+
+    // 1. 8   (SIMD) -> ڸ  
+    JobSystem::GetInstance()->ParallelFor(count, CullGrain, [&](std::uint32_t begin, std::uint32_t end)
+    {
+        const float* m = mViewProj;
+        const Lane8 zero = Set1(0.0f);
+        const Lane8 one = Set1(1.0f);
+        const Lane8 minW = Set1(MinClipW);
+        const Lane8 halfWidth = Set1(0.5f * mWidth);
+        const Lane8 halfHeight = Set1(0.5f * mHeight);
+
+        for (std::uint32_t i = begin; i < end; i += 8)
+        {
+            const std::uint32_t n = std::min(8u, end - i);
+
+            alignas(32) float c[3][8], e[3][8];
+            for (std::uint32_t lane = 0; lane < 8; ++lane)
+            {
+                const std::uint32_t box = candidates[i + std::min(lane, n - 1)];
+                c[0][lane] = boxes.CenterX[box]; c[1][lane] = boxes.CenterY[box]; c[2][lane] = boxes.CenterZ[box];
+                e[0][lane] = boxes.ExtentX[box]; e[1][lane] = boxes.ExtentY[box]; e[2][lane] = boxes.ExtentZ[box];
+            }
+
+            const Lane8 cx = Load(c[0]), cy = Load(c[1]), cz = Load(c[2]);
+            const Lane8 ex = Load(e[0]), ey = Load(e[1]), ez = Load(e[2]);
+
+            Lane8 minX = Set1(INFINITY), maxX = Set1(-INFINITY);
+            Lane8 minY = Set1(INFINITY), maxY = Set1(-INFINITY);
+            Lane8 nearest = Set1(INFINITY);
+            Lane8 crossesNear = CmpLt(one, zero);
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                const Lane8 px = (corner & 1) ? cx + ex : cx - ex;
+                const Lane8 py = (corner & 2) ? cy + ey : cy - ey;
+                const Lane8 pz = (corner & 4) ? cz + ez : cz - ez;
+
+                const Lane8 x = px * Set1(m[0]) + py * Set1(m[4]) + pz * Set1(m[8]) + Set1(m[12]);
+                const Lane8 y = px * Set1(m[1]) + py * Set1(m[5]) + pz * Set1(m[9]) + Set1(m[13]);
+                const Lane8 z = px * Set1(m[2]) + py * Set1(m[6]) + pz * Set1(m[10]) + Set1(m[14]);
+                const Lane8 w = px * Set1(m[3]) + py * Set1(m[7]) + pz * Set1(m[11]) + Set1(m[15]);
+                crossesNear = crossesNear | CmpLt(z, zero) | CmpLt(w, minW);
+
+                const Lane8 invW = one / Max(w, minW);
+                const Lane8 sx = x * invW * halfWidth + halfWidth;
+                const Lane8 sy = halfHeight - y * invW * halfHeight;
+                minX = Min(minX, sx); maxX = Max(maxX, sx);
+                minY = Min(minY, sy); maxY = Max(maxY, sy);
+                nearest = Min(nearest, z * invW);
+            }
+
+            alignas(32) float bx0[8], bx1[8], by0[8], by1[8], bz[8];
+            Store(bx0, minX); Store(bx1, maxX);
+            Store(by0, minY); Store(by1, maxY);
+            Store(bz, nearest);
+            const unsigned int nearMask = MoveMask(crossesNear);
+
+            for (std::uint32_t lane = 0; lane < n; ++lane)
+            {
+                std::int32_t x0, y0, x1, y1;
+                const bool visible = (nearMask & (1u << lane)) != 0 ||
+                    !BoundsToRect(bx0[lane], bx1[lane], by0[lane], by1[lane], mWidth, mHeight, x0, y0, x1, y1) ||
+                    IsRectVisible(x0, y0, x1, y1, bz[lane]);
+                mVisibleFlags[i + lane] = visible ? 1 : 0;
+            }
+        }
+    });
+
+    // 2.  
+    outVisible.clear();
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        if (mVisibleFlags[i] != 0)
+            outVisible.push_back(candidates[i]);
+    }
+
+    mStats.Tested += count;
+    mStats.Occluded += count - (std::uint32_t)outVisible.size();
+    mStats.TestMs += ElapsedMs(t0, Clock::now());
+    return outVisible.size();
+}
+
+void OcclusionCuller::SelectOccluders(const AabbSoA& boxes, const std::vector<std::uint32_t>& candidates,
+    float eyeX, float eyeY, float eyeZ, float minScreenSize, std::uint32_t maxCount, std::vector<std::uint32_t>& outOccluders)
+{
+    // (ũ, ε)  Ƽ ū  maxCount  κ 
+    std::vector<std::pair<float, std::uint32_t>> ranked;
+    ranked.reserve(candidates.size());
+    for (std::uint32_t i : candidates)
+    {
+        const float dx = boxes.CenterX[i] - eyeX;
+        const float dy = boxes.CenterY[i] - eyeY;
+        const float dz = boxes.CenterZ[i] - eyeZ;
+        const float ex = boxes.ExtentX[i], ey = boxes.ExtentY[i], ez = boxes.ExtentZ[i];
+        if (std::fabs(dx) <= ex && std::fabs(dy) <= ey && std::fabs(dz) <= ez)
+            continue;
+
+        const float radius = std::sqrt(ex * ex + ey * ey + ez * ez);
+        const float screenSize = radius / std::sqrt(dx * dx + dy * dy + dz * dz);
+        if (screenSize >= minScreenSize)
+            ranked.emplace_back(screenSize, i);
+    }
+
+    const std::size_t count = std::min<std::size_t>(maxCount, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(),
+        [](const auto& a, const auto& b) { return a.first > b.first || (a.first == b.first && a.second < b.second); });
+
+    outOccluders.clear();
+    for (std::size_t i = 0; i < count; ++i)
+        outOccluders.push_back(ranked[i].second);
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include "FrustumCulling.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+// CPU Ʈ Ŭ ø
+// -  Ŭ ޽ ػ(⺻ 256x128)  ۿ ׸ -> ּ/ִ   -> AABB 
+// - ȭ (Rasterize):
+//   1. Ŭ Ŀ ϳ:  ȯ, ﰢ 8 SIMD ¾ (/޸// ),
+//      ȭ Ÿ(32x32) ﰢ  й
+//   2. Ÿϸ Ŀ ϳ:  Ÿ  Ŭ ,  ٿ ȼ 8 SIMD  ּ 
+//      (Ÿϳ ȼ  ġǷ  ,  ̶  ׻ )
+//   3. 2x2  ٿ  (ּ, ִ)  
+// - : AABB 8   簢   ̸  ģ 
+//     >  ĭ ִ -> , <= ּ -> ,  ̸   Ʒ
+// - : 鿡 ģ Ŭ ﰢ  ׸, 鿡 ģ AABB  
+//   Ŭ  ޽ (ո = ð , D3D ⺻ ø ) ̰   ̾ 
+// - SIMD: __AVX__  AVX 8, ƴϸ SSE 4 x 2 (FrustumCulling   )
+// ̴ D3D Ŭ  z/w (0 = , 1 = ). D3D   
+// ==========================================================
+
+// Ŭ CPU ޽ ( ,   ޽ ܼ )
+struct OccluderMesh
+{
+    std::vector<float> Positions;           // xyz 
+    std::vector<std::uint32_t> Indices;     // ﰢ Ʈ
+
+    std::uint32_t GetVertexCount()const { return (std::uint32_t)(Positions.size() / 3); }
+    bool IsEmpty()const { return Indices.empty(); }
+};
+
+struct OcclusionStats
+{
+    std::uint32_t Occluders = 0;
+    std::uint32_t Triangles = 0;            // Ѱܹ ﰢ
+    std::uint32_t TrianglesRasterized = 0;  // ޸//ȭ    
+    std::uint32_t Tested = 0;               // CullAabbs   AABB
+    std::uint32_t Occluded = 0;
+
+    double RasterMs = 0.0;                  // ȯ + ¾ + й + 
+    double HierarchyMs = 0.0;
+    double TestMs = 0.0;
+};
+
+class OcclusionCuller
+{
+public:
+    static constexpr std::uint32_t TileSize = 32;
+
+    // /δ TileSize  
+    explicit OcclusionCuller(std::uint32_t width = 256, std::uint32_t height = 128);
+
+    // 1.  ۸  . viewProj =   Ծ  켱 16 (Camera::GetViewProj   )
+    void BeginFrame(const float* viewProj);
+
+    // 2. Ŭ ߰ (mesh  Rasterize     ־ ). world =  켱 4x4
+    void AddOccluder(const OccluderMesh& mesh, const float* world);
+
+    // 3. ׸  
+    void Rasterize();
+
+    // 4.  ( false)
+    bool IsAabbVisible(float cx, float cy, float cz, float ex, float ey, float ez)const;
+
+    // candidates    ͸ outVisible  ( ). candidates  outVisible  ٸ 
+    std::size_t CullAabbs(const AabbSoA& boxes, const std::vector<std::uint32_t>& candidates, std::vector<std::uint32_t>& outVisible);
+
+    std::uint32_t GetWidth()const { return mWidth; }
+    std::uint32_t GetHeight()const { return mHeight; }
+    const float* GetDepth()const { return mDepth.data(); }  //  켱 ( ǥ/)
+    const OcclusionStats& GetStats()const { return mStats; }
+
+    // candidates  ȭ鿡 ū  (AABB  /  Ÿ >= minScreenSize)  ū  ִ maxCount 
+    //  ū ü   Ƿ Ŭ ĺ ( ȿ ִ AABB  )
+    static void SelectOccluders(const AabbSoA& boxes, const std::vector<std::uint32_t>& candidates,
+        float eyeX, float eyeY, float eyeZ, float minScreenSize, std::uint32_t maxCount, std::vector<std::uint32_t>& outOccluders);
+
+    //    (ȭ ȼ 簢 [x0, x1] x [y0, y1],   )
+    bool IsRectVisible(std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1, float nearestDepth)const;
+
+private:
+    struct Occluder
+    {
+        const OccluderMesh* Mesh = nullptr;
+        float World[16];
+    };
+
+    // ȭ  ﰢ ( E(p) = A*px + B*py + C >= 0 ̸ ,  z = Z0 + Dzdx*px + Dzdy*py)
+    struct Triangle
+    {
+        float A[3], B[3], C[3];
+        float Z0, Dzdx, Dzdy;
+        std::int32_t MinX, MaxX, MinY, MaxY;    // ȼ ()
+    };
+
+    // Ŭ (Ŀ ϳ ä,  ̿ 뷮 )
+    struct OccluderWork
+    {
+        std::vector<float> ClipX, ClipY, ClipZ, ClipW;  // 8   е
+        std::vector<Triangle> Triangles;
+        std::vector<std::uint32_t> TileStart;           // Ÿϸ TileTriangles  (CSR)
+        std::vector<std::uint32_t> TileTriangles;
+    };
+
+    struct Level
+    {
+        std::uint32_t Width = 0;
+        std::uint32_t Height = 0;
+        std::vector<float> Min;
+        std::vector<float> Max;
+    };
+
+    void SetupOccluder(const Occluder& occluder, OccluderWork& work)const;
+    void RasterizeTile(std::uint32_t tile);
+    void BuildHierarchy();
+    bool IsTexelVisible(std::uint32_t level, std::int32_t tx, std::int32_t ty,
+        std::int32_t x0, std::int32_t y0, std::int32_t x1, std::int32_t y1, float nearestDepth)const;
+
+    // 簢 +    (鿡 ġ false =  Ұ, ̴ )
+    bool ProjectAabb(float cx, float cy, float cz, float ex, float ey, float ez,
+        std::int32_t& x0, std::int32_t& y0, std::int32_t& x1, std::int32_t& y1, float& nearestDepth)const;
+
+private:
+    std::uint32_t mWidth = 0;
+    std::uint32_t mHeight = 0;
+    std::uint32_t mTilesX = 0;
+    std::uint32_t mTilesY = 0;
+
+    float mViewProj[16] = {};
+    std::vector<Occluder> mOccluders;
+    std::vector<OccluderWork> mWork;
+
+    std::vector<float> mDepth;          //  0 (ּ = ִ)
+    std::vector<Level> mLevels;         // [0]  ũ⸸ (ʹ mDepth)
+    std::vector<std::uint8_t> mVisibleFlags; // CullAabbs  ĺ
+
+    OcclusionStats mStats;
+};
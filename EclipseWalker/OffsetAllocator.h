@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+
+// ==========================================================
+//  Ҵ ̽
+//  ޸𸮴 ǵ帮 ʰ [0, capacity)  ¸ 
+// -> GPU   Ҵ翡 , D3D  ¡/ġũ 
+// ==========================================================
+
+struct OffsetAllocation
+{
+    static constexpr std::uint32_t InvalidHandle = 0xFFFFFFFFu;
+
+    std::uint64_t Offset = 0;
+    std::uint64_t Size = 0; //   ũ (û Ŭ  )
+    std::uint64_t Alignment = 0; // û  (  ű   ķ ٽ )
+    std::uint32_t Handle = InvalidHandle;
+
+    bool IsValid()const { return Handle != InvalidHandle; }
+};
+
+class OffsetAllocator
+{
+public:
+    virtual ~OffsetAllocator() = default;
+
+    // alignment  2 ŵ.   IsValid() == false
+    virtual OffsetAllocation Allocate(std::uint64_t size, std::uint64_t alignment) = 0;
+    virtual void Free(std::uint32_t handle) = 0;
+
+    virtual std::uint64_t GetCapacity()const = 0;
+    virtual std::uint64_t GetUsedBytes()const = 0;
+    virtual std::uint64_t GetLargestFreeBlock()const = 0;
+    virtual std::uint32_t GetAllocationCount()const = 0;
+
+    //  :  ִ Ҵ   
+    virtual void ForEachAllocation(const std::function<void(const OffsetAllocation&)>& func)const = 0;
+};
@@ -0,0 +1,235 @@
+#include "OffsetAllocatorBenchmark.h"
+#include "TlsfAllocator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr std::uint64_t Alignments[] = { 256, 4096, 65536 };
+    constexpr std::uint32_t ListCheckInterval = 4096; // ForEachAllocation ü  ֱ ( )
+
+    struct Operation
+    {
+        bool Allocate;
+        std::uint64_t Size;
+        std::uint64_t Alignment;
+        std::uint32_t Pick; // :  ִ    ġ (% )
+    };
+
+    std::vector<Operation> MakeOperations(std::uint32_t count, std::uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> sizeLog2(0.0, 22.0);
+        std::uniform_int_distribution<std::uint32_t> percent(0, 99);
+        std::uniform_int_distribution<std::uint32_t> alignment(0, 2);
+
+        std::vector<Operation> ops(count);
+        for (Operation& op : ops)
+        {
+            op.Allocate = percent(rng) < 55; // ¦ Ҵ  (  ±  )
+            op.Size = std::max<std::uint64_t>(1, (std::uint64_t)std::exp2(sizeLog2(rng)));
+            op.Alignment = Alignments[alignment(rng)];
+            op.Pick = rng();
+        }
+        return ops;
+    }
+
+    //  ڵ  Ͽ  (   Ͱ ٲ㼭)
+    std::uint32_t TakeHandle(std::vector<std::uint32_t>& handles, std::uint32_t pick)
+    {
+        const std::size_t i = pick % handles.size();
+        const std::uint32_t handle = handles[i];
+        handles[i] = handles.back();
+        handles.pop_back();
+        return handle;
+    }
+}
+
+namespace OffsetAllocatorBenchmark
+{
+    OffsetAllocatorBenchmarkResult Run(std::uint64_t capacity, std::uint32_t operations, std::uint32_t seed)
+    {
+        OffsetAllocatorBenchmarkResult result;
+        result.Operations = operations;
+
+        const std::vector<Operation> ops = MakeOperations(operations, seed);
+
+        // 1. ¡: ̽θ θ ׸  ( -> ũ)  
+        {
+            TlsfAllocator tlsf(capacity);
+            OffsetAllocator& allocator = tlsf;
+            result.Capacity = allocator.GetCapacity();
+
+            std::map<std::uint64_t, std::uint64_t> live;
+            std::vector<std::uint32_t> handles;
+            std::map<std::uint32_t, std::uint64_t> handleOffsets;
+            std::map<std::uint64_t, std::uint64_t> alignments; //  -> û 
+            std::uint64_t liveBytes = 0;
+            std::uint64_t peakBytes = 0;
+
+            auto release = [&](std::uint32_t handle)
+            {
+                auto found = handleOffsets.find(handle);
+                if (found == handleOffsets.end())
+                {
+                    ++result.Errors;
+                    return;
+                }
+
+                liveBytes -= live[found->second];
+                live.erase(found->second);
+                alignments.erase(found->second);
+                handleOffsets.erase(found);
+                allocator.Free(handle);
+                ++result.Frees;
+            };
+
+            for (std::uint32_t i = 0; i < operations; ++i)
+            {
+                const Operation& op = ops[i];
+                if (op.Allocate || handles.empty())
+                {
+                    OffsetAllocation a = allocator.Allocate(op.Size, op.Alignment);
+                    if (!a.IsValid())
+                    {
+                        ++result.Failures;
+                        continue;
+                    }
+
+                    // 1-1.  / ũ / 
+                    if (a.Offset % op.Alignment != 0 || a.Size < op.Size || a.Offset + a.Size > result.Capacity)
+                        ++result.Errors;
+                    if (a.Alignment != op.Alignment)
+                        ++result.Errors;
+
+                    // 1-2.   ٷ  /   ġ
+                    auto next = live.lower_bound(a.Offset);
+                    if (next != live.end() && next->first < a.Offset + a.Size)
+                        ++result.Errors;
+                    if (next != live.begin() && std::prev(next)->first + std::prev(next)->second > a.Offset)
+                        ++result.Errors;
+
+                    if (!live.emplace(a.Offset, a.Size).second || !handleOffsets.emplace(a.Handle, a.Offset).second)
+                    {
+                        ++result.Errors;
+                        continue;
+                    }
+
+                    handles.push_back(a.Handle);
+                    alignments[a.Offset] = op.Alignment;
+                    liveBytes += a.Size;
+                    peakBytes = std::max(peakBytes, liveBytes);
+                    ++result.Allocations;
+                }
+                else
+                {
+                    release(TakeHandle(handles, op.Pick));
+                }
+
+                // 1-3. 뷮 (Ź),  ִ  ü ()
+                if (allocator.GetUsedBytes() != liveBytes || allocator.GetAllocationCount() != live.size())
+                    ++result.Errors;
+
+                if (i % ListCheckInterval == 0)
+                {
+                    auto expected = live.begin();
+                    allocator.ForEachAllocation([&](const OffsetAllocation& a)
+                    {
+                        if (expected == live.end() || expected->first != a.Offset || expected->second != a.Size ||
+                            alignments[a.Offset] != a.Alignment)
+                            ++result.Errors;
+                        else
+                            ++expected;
+                    });
+                    if (expected != live.end())
+                        ++result.Errors;
+                }
+            }
+
+            // 1-4.      ϸ   ϳ ƿ; 
+            std::mt19937 rng(seed + 1);
+            while (!handles.empty())
+                release(TakeHandle(handles, rng()));
+
+            if (allocator.GetUsedBytes() != 0 || allocator.GetAllocationCount() != 0)
+                ++result.Errors;
+
+            result.Coalesced = allocator.GetLargestFreeBlock() == result.Capacity;
+            result.PeakUsed = result.Capacity > 0 ? (double)peakBytes / (double)result.Capacity : 0.0;
+        }
+
+        // 2. :    Ȯ 
+        {
+            TlsfAllocator tlsf(capacity);
+            OffsetAllocator& allocator = tlsf;
+
+            std::vector<std::uint32_t> handles;
+            handles.reserve(operations);
+
+            Clock::time_point t0 = Clock::now();
+            for (const Operation& op : ops)
+            {
+                if (op.Allocate || handles.empty())
+                {
+                    OffsetAllocation a = allocator.Allocate(op.Size, op.Alignment);
+                    if (a.IsValid())
+                        handles.push_back(a.Handle);
+                }
+                else
+                {
+                    allocator.Free(TakeHandle(handles, op.Pick));
+                }
+            }
+            Clock::time_point t1 = Clock::now();
+
+            result.NsPerOperation = operations > 0 ? ElapsedMs(t0, t1) * 1e6 / operations : 0.0;
+
+            for (std::uint32_t handle : handles)
+                allocator.Free(handle);
+        }
+
+        result.Valid = result.Errors == 0 && result.Coalesced && result.Allocations > 0;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[OffsetAllocatorBenchmark]\n";
+        report += "  capacity(MB)      ops   allocs    frees  failed  peak(%)  ns/op  coalesced  valid\n";
+
+        const struct { std::uint64_t Capacity; std::uint32_t Operations; } cases[] =
+        {
+            { 16ull << 20, 100000 }, { 64ull << 20, 1000000 }, { 256ull << 20, 1000000 },
+        };
+
+        bool valid = true;
+        for (const auto& c : cases)
+        {
+            OffsetAllocatorBenchmarkResult r = Run(c.Capacity, c.Operations);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%14llu %8u %8u %8u %7u %8.1f %6.1f %10s  %s\n",
+                (unsigned long long)(r.Capacity >> 20), r.Operations, r.Allocations, r.Frees, r.Failures,
+                r.PeakUsed * 100.0, r.NsPerOperation, r.Coalesced ? "yes" : "NO", r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
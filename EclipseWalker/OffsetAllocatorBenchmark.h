@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+//  Ҵ ¡ /  (߿, 帮, GPU )
+// OffsetAllocator ̽ ( TlsfAllocator)  Ҵ /   operations   θ
+// (ũ 1 B ~ 4 MB α յ,  256 B / 4 KB / 64 KB,   ִ   ƹų)
+//  Ȯ ( ִ      ִ ׸ 𵨰 ):
+//   1.    ° û ũ ̻, 뷮 ,  ִ ٸ  ġ 
+//   2. GetUsedBytes / GetAllocationCount / ForEachAllocation  𵨰  (û  )
+//   3.  ϸ   ٽ 뷮 ü  ϳ 
+// ð    Ȯ  ٽ  
+// ==========================================================
+
+struct OffsetAllocatorBenchmarkResult
+{
+    std::uint64_t Capacity = 0;
+    std::uint32_t Operations = 0;
+
+    std::uint32_t Allocations = 0;
+    std::uint32_t Frees = 0;
+    std::uint32_t Failures = 0;         //   ( ƴ)
+    double PeakUsed = 0.0;              // 뷮 
+
+    double NsPerOperation = 0.0;        // Ҵ +  
+
+    std::uint32_t Errors = 0;           // ħ, , 뷮 ġ 
+    bool Coalesced = false;             //     ū   = 뷮
+    bool Valid = false;
+};
+
+namespace OffsetAllocatorBenchmark
+{
+    OffsetAllocatorBenchmarkResult Run(std::uint64_t capacity, std::uint32_t operations, std::uint32_t seed = 34);
+
+    // 16 MB x 10  , 64 MB / 256 MB x 100  
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
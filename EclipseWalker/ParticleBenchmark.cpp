@@ -0,0 +1,329 @@
+#include "ParticleBenchmark.h"
+#include "ParticleSystem.h"
+#include "JobSystem.h"
+#include "UploadRingAllocator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float Dt = 1.0f / 60.0f;
+    constexpr float WarmupTime = 2.0f;                  //  ִ밪 ̻ (   º )
+    constexpr std::uint32_t ParticlesPerEmitter = 16384;
+    constexpr std::uint32_t FramesInFlight = 3;
+    constexpr std::uint64_t UploadAlignment = 256;
+
+    std::uint64_t AlignUp(std::uint64_t v, std::uint64_t alignment)
+    {
+        return (v + alignment - 1) & ~(alignment - 1);
+    }
+
+    // мó  հ  .  1 ~ 2 ʿ ʴ ִġŭ ѷ Ǯ  
+    ParticleEmitterSettings MakeFountain(std::uint32_t index, std::uint32_t maxParticles, std::uint32_t seed)
+    {
+        ParticleEmitterSettings s;
+        s.Position[0] = (float)(index % 8) * 4.0f;
+        s.Position[2] = (float)(index / 8) * 4.0f;
+        s.Direction[0] = 0.1f * (float)(index % 3);
+        s.Spread = 0.35f;
+        s.SpeedMin = 4.0f;
+        s.SpeedMax = 7.0f;
+        s.LifetimeMin = 1.0f;
+        s.LifetimeMax = 2.0f;
+        s.Rate = (float)maxParticles;
+        s.Drag = 0.2f;
+        s.StartSize = 0.05f;
+        s.EndSize = 0.2f;
+        s.StartColor[0] = 1.0f; s.StartColor[1] = 0.8f; s.StartColor[2] = 0.3f; s.StartColor[3] = 1.0f;
+        s.EndColor[0] = 0.6f; s.EndColor[1] = 0.1f; s.EndColor[2] = 0.0f; s.EndColor[3] = 0.0f;
+        s.MaxParticles = maxParticles;
+        s.Seed = seed + index;
+        return s;
+    }
+
+    // Simulate + Compact  ƼŬ ϳ б ( ִ ͸ ڿ )
+    void ReferenceUpdate(ParticlePool& pool, const ParticleEmitterSettings& s, float dt)
+    {
+        const float gravityDt = s.Gravity * dt;
+        const float drag = std::max(0.0f, 1.0f - s.Drag * dt);
+
+        std::uint32_t alive = 0;
+        for (std::uint32_t i = 0; i < pool.Count; ++i)
+        {
+            const float vx = pool.VelX[i] * drag;
+            const float vy = (pool.VelY[i] - gravityDt) * drag;
+            const float vz = pool.VelZ[i] * drag;
+            const float age = pool.Age[i] + dt;
+            const float t = age * pool.InvLifetime[i];
+            if (t >= 1.0f)
+                continue;
+
+            std::uint32_t color = 0;
+            for (int c = 0; c < 4; ++c)
+            {
+                const float start = s.StartColor[c] * 255.0f;
+                const float delta = (s.EndColor[c] - s.StartColor[c]) * 255.0f;
+                color |= (std::uint32_t)std::lrint(start + delta * t) << (8 * c);
+            }
+
+            pool.PosX[alive] = pool.PosX[i] + vx * dt;
+            pool.PosY[alive] = pool.PosY[i] + vy * dt;
+            pool.PosZ[alive] = pool.PosZ[i] + vz * dt;
+            pool.VelX[alive] = vx;
+            pool.VelY[alive] = vy;
+            pool.VelZ[alive] = vz;
+            pool.Age[alive] = age;
+            pool.InvLifetime[alive] = pool.InvLifetime[i];
+            pool.Size[alive] = s.StartSize + (s.EndSize - s.StartSize) * t;
+            pool.Color[alive] = color;
+            ++alive;
+        }
+        pool.Count = alive;
+    }
+
+    bool ColorClose(std::uint32_t a, std::uint32_t b)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            const int ca = (int)((a >> (8 * c)) & 0xFF);
+            const int cb = (int)((b >> (8 * c)) & 0xFF);
+            if (std::abs(ca - cb) > 1)
+                return false;
+        }
+        return true;
+    }
+
+    //  پ ̹   (    ũ, ,  )  Į  
+    //     ƾ ϰ ڿ   ̹ ӿ  Ѹ 
+    std::uint32_t CheckReference(std::uint32_t seed)
+    {
+        ParticleSystem system;
+        std::vector<ParticleEmitterId> emitters;
+        for (std::uint32_t e = 0; e < 4; ++e)
+        {
+            ParticleEmitterSettings s = MakeFountain(e, 2999 + e, seed);
+            s.LifetimeMin = 0.3f;
+            s.Rate = 800.0f;
+            s.Drag = 0.5f * (float)e;
+            emitters.push_back(system.AddEmitter(s));
+            system.Burst(emitters.back(), 1000);
+        }
+
+        std::uint32_t mismatches = 0;
+        for (std::uint32_t frame = 0; frame < 150; ++frame)
+        {
+            std::vector<ParticlePool> expected;
+            for (ParticleEmitterId e : emitters)
+                expected.push_back(system.GetPool(e));
+
+            system.Update(Dt, false);
+
+            for (std::uint32_t k = 0; k < emitters.size(); ++k)
+            {
+                ParticlePool& ref = expected[k];
+                ReferenceUpdate(ref, system.GetSettings(emitters[k]), Dt);
+
+                const ParticlePool& pool = system.GetPool(emitters[k]);
+                if (pool.Count < ref.Count)
+                {
+                    ++mismatches;
+                    continue;
+                }
+
+                for (std::uint32_t i = 0; i < pool.Count; ++i)
+                {
+                    //  ִ   t < 1
+                    if (!(pool.Age[i] * pool.InvLifetime[i] < 1.0f))
+                        ++mismatches;
+                    if (i >= ref.Count)
+                        continue;
+
+                    const bool same = pool.PosX[i] == ref.PosX[i] && pool.PosY[i] == ref.PosY[i] && pool.PosZ[i] == ref.PosZ[i] &&
+                        pool.VelX[i] == ref.VelX[i] && pool.VelY[i] == ref.VelY[i] && pool.VelZ[i] == ref.VelZ[i] &&
+                        pool.Age[i] == ref.Age[i] && pool.InvLifetime[i] == ref.InvLifetime[i] &&
+                        std::fabs(pool.Size[i] - ref.Size[i]) <= 1e-6f && ColorClose(pool.Color[i], ref.Color[i]);
+                    if (!same)
+                        ++mismatches;
+                }
+            }
+        }
+        return mismatches;
+    }
+
+    //  0, ӵ/  Ʈ: n    = n dt v0 - g dt^2 n (n + 1) / 2
+    float CheckBallistic(bool& outExpired)
+    {
+        constexpr float Speed = 5.0f;
+        constexpr float Gravity = 9.8f;
+        constexpr std::uint32_t Count = 1001;
+
+        ParticleEmitterSettings s;
+        s.Spread = 0.0f;
+        s.SpeedMin = s.SpeedMax = Speed;
+        s.LifetimeMin = s.LifetimeMax = 1.0f;
+        s.Rate = 0.0f;
+        s.Gravity = Gravity;
+        s.MaxParticles = Count;
+
+        ParticleSystem system;
+        const ParticleEmitterId emitter = system.AddEmitter(s);
+        system.Burst(emitter, Count);
+        system.Update(Dt, false);   // Ѹ⸸ ( 0)
+
+        float error = 0.0f;
+        std::uint32_t frame = 0;
+        for (; frame < 55; ++frame)
+        {
+            system.Update(Dt, false);
+
+            const float n = (float)(frame + 1);
+            const float expected = n * Dt * Speed - Gravity * Dt * Dt * n * (n + 1.0f) * 0.5f;
+            const ParticlePool& pool = system.GetPool(emitter);
+            if (pool.Count != Count)
+                return 1e9f;
+
+            for (std::uint32_t i = 0; i < pool.Count; ++i)
+            {
+                error = std::max(error, std::fabs(pool.PosY[i] - expected));
+                error = std::max(error, std::fabs(pool.PosX[i]) + std::fabs(pool.PosZ[i]));
+            }
+        }
+
+        //  1  = 60  (̸        )
+        for (; frame < 62; ++frame)
+            system.Update(Dt, false);
+        outExpired = system.GetParticleCount() == 0 && system.GetStats().Died == Count;
+        return error;
+    }
+}
+
+namespace ParticleBenchmark
+{
+    ParticleBenchmarkResult Run(std::uint32_t particles, std::uint32_t frames, std::uint32_t seed)
+    {
+        ParticleBenchmarkResult result;
+        result.Emitters = std::max(1u, (particles + ParticlesPerEmitter - 1) / ParticlesPerEmitter);
+        result.Frames = frames;
+
+        JobSystem* jobs = JobSystem::GetInstance();
+        jobs->Initialize();
+        result.Threads = jobs->GetThreadCount();
+
+        // 1.   ý  (  /  ý)
+        ParticleSystem serial;
+        ParticleSystem parallel;
+        for (std::uint32_t e = 0; e < result.Emitters; ++e)
+        {
+            const std::uint32_t maxParticles = particles / result.Emitters + (e < particles % result.Emitters ? 1 : 0);
+            serial.AddEmitter(MakeFountain(e, maxParticles, seed));
+            parallel.AddEmitter(MakeFountain(e, maxParticles, seed));
+        }
+
+        for (float t = 0.0f; t < WarmupTime; t += Dt)
+        {
+            serial.Update(Dt, false);
+            parallel.Update(Dt, true);
+        }
+
+        // 2. ε :  FramesInFlight  з. GPU    ڿ ´ٰ 
+        const std::uint64_t frameBytes = AlignUp((std::uint64_t)particles * sizeof(ParticleVertex), UploadAlignment);
+        UploadRingAllocator ring(frameBytes * FramesInFlight);
+        std::vector<std::uint8_t> uploadMemory((size_t)ring.GetCapacity());
+        std::vector<ParticleVertex> serialVertices(particles);
+
+        double updateMs = 0.0, writeMs = 0.0, updateMsParallel = 0.0, writeMsParallel = 0.0;
+        std::uint64_t particleFrames = 0, uploadBytes = 0;
+        for (std::uint32_t frame = 0; frame < frames; ++frame)
+        {
+            Clock::time_point t0 = Clock::now();
+            serial.Update(Dt, false);
+            Clock::time_point t1 = Clock::now();
+            const std::uint32_t serialCount = serial.WriteVertices(serialVertices.data(), particles, false);
+            Clock::time_point t2 = Clock::now();
+            updateMs += ElapsedMs(t0, t1);
+            writeMs += ElapsedMs(t1, t2);
+
+            t0 = Clock::now();
+            parallel.Update(Dt, true);
+            t1 = Clock::now();
+
+            if (frame >= FramesInFlight - 1)
+                ring.Retire(frame + 1 - (FramesInFlight - 1));
+            const std::uint64_t bytes = (std::uint64_t)parallel.GetParticleCount() * sizeof(ParticleVertex);
+            const std::uint64_t offset = ring.Allocate(bytes, UploadAlignment);
+            if (offset == UploadRingAllocator::InvalidOffset)
+            {
+                ++result.UploadFailures;
+                ring.FinishFrame(frame + 1);
+                continue;
+            }
+
+            ParticleVertex* mapped = (ParticleVertex*)(uploadMemory.data() + offset);
+            const std::uint32_t count = parallel.WriteVertices(mapped, particles, true);
+            t2 = Clock::now();
+            ring.FinishFrame(frame + 1);
+            updateMsParallel += ElapsedMs(t0, t1);
+            writeMsParallel += ElapsedMs(t1, t2);
+
+            particleFrames += count;
+            uploadBytes += bytes;
+            if (count != serialCount || std::memcmp(mapped, serialVertices.data(), count * sizeof(ParticleVertex)) != 0)
+                ++result.ParallelMismatches;
+        }
+
+        const double frameCount = std::max(1u, frames);
+        result.Particles = (std::uint32_t)(particleFrames / std::max(1u, frames));
+        result.UpdateMs = updateMs / frameCount;
+        result.WriteMs = writeMs / frameCount;
+        result.UpdateMsParallel = updateMsParallel / frameCount;
+        result.WriteMsParallel = writeMsParallel / frameCount;
+        result.ParticlesPerMs = (updateMs + writeMs) > 0.0 ? (double)particleFrames / (updateMs + writeMs) : 0.0;
+        result.UploadMB = (double)uploadBytes / frameCount / (1024.0 * 1024.0);
+
+        result.CountsMatch =
+            serial.GetStats().Spawned - serial.GetStats().Died == serial.GetParticleCount() &&
+            parallel.GetStats().Spawned - parallel.GetStats().Died == parallel.GetParticleCount();
+
+        // 3. Ȯ
+        result.ReferenceMismatches = CheckReference(seed);
+        result.BallisticError = CheckBallistic(result.BallisticExpired);
+
+        result.Valid = result.ParallelMismatches == 0 && result.ReferenceMismatches == 0 && result.UploadFailures == 0 &&
+            result.CountsMatch && result.BallisticExpired && result.BallisticError < 1e-3f;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[ParticleBenchmark]\n";
+        report += "  particles emitters  update(ms)  write(ms)  update(xN)  write(xN)  particles/ms  upload(MB)  ballistic(mm)  valid\n";
+
+        bool valid = true;
+        for (std::uint32_t count : { 250000u, 500000u, 1000000u })
+        {
+            ParticleBenchmarkResult r = Run(count, 30);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%11u %8u %11.2f %10.2f %11.2f %10.2f %13.0f %11.1f %14.3f  %s\n",
+                r.Particles, r.Emitters, r.UpdateMs, r.WriteMs, r.UpdateMsParallel, r.WriteMsParallel,
+                r.ParticlesPerMs, r.UploadMB, r.BallisticError * 1000.0f, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
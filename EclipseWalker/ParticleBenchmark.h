@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ƼŬ  (߿, 帮)
+// ̹   (ϳ ִ 16384 )  particles   ä ¿ 60 Hz  frames 
+// (ùķ̼ +  + , ׸   ε  (UploadRingAllocator + CPU ޸)  )
+//   / ̹   ýۿ      
+//  Ȯ:
+//   1.  ý  =    ( Ʈ )
+//   2. SIMD Ʈ + б   = Į  (    ,    t < 1)
+//   3. ź:  0,   Ʈ   ġ ְ    
+//   4.  - Ҹ =  , ε  Ҵ  0
+// ==========================================================
+
+struct ParticleBenchmarkResult
+{
+    std::uint32_t Particles = 0;        //   
+    std::uint32_t Emitters = 0;
+    std::uint32_t Frames = 0;
+    std::uint32_t Threads = 0;
+
+    double UpdateMs = 0.0;              //  , Ӵ
+    double WriteMs = 0.0;
+    double UpdateMsParallel = 0.0;
+    double WriteMsParallel = 0.0;
+    double ParticlesPerMs = 0.0;        //  ھ (Ʈ + )
+
+    double UploadMB = 0.0;              // Ӵ
+    std::uint32_t UploadFailures = 0;
+
+    std::uint32_t ParallelMismatches = 0;
+    std::uint32_t ReferenceMismatches = 0;
+    float BallisticError = 0.0f;        // m
+    bool BallisticExpired = false;
+    bool CountsMatch = false;
+    bool Valid = false;
+};
+
+namespace ParticleBenchmark
+{
+    ParticleBenchmarkResult Run(std::uint32_t particles, std::uint32_t frames, std::uint32_t seed = 50);
+
+    // 25  / 50  / 100   x 30 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
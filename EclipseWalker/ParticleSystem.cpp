@@ -0,0 +1,425 @@
+#include "ParticleSystem.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// WriteEmitter  Position + Size  16 Ʈ   
+static_assert(sizeof(ParticleVertex) == 20 && offsetof(ParticleVertex, Size) == 12, "ParticleVertex layout");
+
+namespace
+{
+    constexpr std::uint32_t ParallelThreshold = 16384;     // ƼŬ  (̺   )
+    constexpr std::uint32_t ParallelGrain = 1;             // ̹ 
+    constexpr float TwoPi = 6.28318531f;
+
+    // 4 Ʈ ũ ->  Ʈ 
+    constexpr std::uint32_t BitCount[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+    std::uint32_t RoundUp4(std::uint32_t v)
+    {
+        return (v + 3) & ~3u;
+    }
+
+    std::uint32_t NextRandom(std::uint32_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    // [0, 1)
+    float RandomUnit(std::uint32_t& state)
+    {
+        return (float)(NextRandom(state) >> 8) * (1.0f / 16777216.0f);
+    }
+
+    std::uint32_t PackColor(const float* rgba)
+    {
+        std::uint32_t packed = 0;
+        for (int c = 0; c < 4; ++c)
+            packed |= (std::uint32_t)std::lrint(rgba[c] * 255.0f) << (8 * c);
+        return packed;
+    }
+}
+
+// ---------------------------------------------------------
+// ̹
+// ---------------------------------------------------------
+ParticleEmitterId ParticleSystem::AddEmitter(const ParticleEmitterSettings& settings)
+{
+    assert(settings.MaxParticles > 0);
+    assert(settings.LifetimeMin > 0.0f && settings.LifetimeMin <= settings.LifetimeMax);
+    assert(settings.SpeedMin <= settings.SpeedMax && settings.Drag >= 0.0f);
+
+    ParticleEmitterId emitter;
+    if (!mFreeEmitters.empty())
+    {
+        emitter = mFreeEmitters.back();
+        mFreeEmitters.pop_back();
+    }
+    else
+    {
+        emitter = (ParticleEmitterId)mEmitters.size();
+        mEmitters.emplace_back();
+    }
+
+    Emitter& e = mEmitters[emitter];
+    e = Emitter();
+    e.Settings = settings;
+    e.Alive = true;
+
+    //  0 ~ 1 (RGBA8    ġ ʰ)
+    for (int c = 0; c < 4; ++c)
+    {
+        e.Settings.StartColor[c] = std::clamp(settings.StartColor[c], 0.0f, 1.0f);
+        e.Settings.EndColor[c] = std::clamp(settings.EndColor[c], 0.0f, 1.0f);
+    }
+
+    //   ͷ (0 ̸ )
+    const float* d = settings.Direction;
+    const float length = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    if (length > 1e-6f)
+    {
+        for (int k = 0; k < 3; ++k)
+            e.Settings.Direction[k] = d[k] / length;
+    }
+    else
+    {
+        e.Settings.Direction[0] = 0.0f;
+        e.Settings.Direction[1] = 1.0f;
+        e.Settings.Direction[2] = 0.0f;
+    }
+
+    // ° 0 ̸ xorshift  
+    e.Random = settings.Seed * 0x9E3779B9u + emitter * 0x85EBCA6Bu;
+    if (e.Random == 0)
+        e.Random = 1;
+
+    // 迭 4   (  SIMD  ° а )
+    const std::uint32_t capacity = RoundUp4(settings.MaxParticles);
+    ParticlePool& pool = e.Pool;
+    for (std::vector<float>* v : { &pool.PosX, &pool.PosY, &pool.PosZ, &pool.VelX, &pool.VelY, &pool.VelZ,
+                                   &pool.Age, &pool.InvLifetime, &pool.Size })
+        v->assign(capacity, 0.0f);
+    pool.Color.assign(capacity, 0);
+
+    return emitter;
+}
+
+void ParticleSystem::RemoveEmitter(ParticleEmitterId emitter)
+{
+    assert(IsAlive(emitter));
+
+    Emitter& e = mEmitters[emitter];
+    mParticleCount -= e.Pool.Count;
+    e.Pool = ParticlePool();
+    e.Alive = false;
+    mFreeEmitters.push_back(emitter);
+}
+
+bool ParticleSystem::IsAlive(ParticleEmitterId emitter)const
+{
+    return emitter < mEmitters.size() && mEmitters[emitter].Alive;
+}
+
+void ParticleSystem::SetEmitterPosition(ParticleEmitterId emitter, float x, float y, float z)
+{
+    assert(IsAlive(emitter));
+
+    float* position = mEmitters[emitter].Settings.Position;
+    position[0] = x;
+    position[1] = y;
+    position[2] = z;
+}
+
+void ParticleSystem::SetEmitterRate(ParticleEmitterId emitter, float rate)
+{
+    assert(IsAlive(emitter) && rate >= 0.0f);
+    mEmitters[emitter].Settings.Rate = rate;
+}
+
+void ParticleSystem::Burst(ParticleEmitterId emitter, std::uint32_t count)
+{
+    assert(IsAlive(emitter));
+    mEmitters[emitter].PendingBurst += count;
+}
+
+// ---------------------------------------------------------
+// Ʈ
+// ---------------------------------------------------------
+void ParticleSystem::Update(float dt, bool parallel)
+{
+    PROFILE_SCOPE("ParticleSystem::Update");
+
+    // ̹ͳ ƹ͵   (Ǯ, , 谡  ڱ )
+    const std::uint32_t emitterCount = (std::uint32_t)mEmitters.size();
+    auto updateRange = [this, dt](std::uint32_t begin, std::uint32_t end)
+    {
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            if (mEmitters[i].Alive)
+                UpdateEmitter(mEmitters[i], dt);
+        }
+    };
+
+    if (parallel && emitterCount > 1 && mParticleCount >= ParallelThreshold)
+        JobSystem::GetInstance()->ParallelFor(emitterCount, ParallelGrain, updateRange);
+    else
+        updateRange(0, emitterCount);
+
+    mParticleCount = 0;
+    for (const Emitter& e : mEmitters)
+    {
+        if (!e.Alive)
+            continue;
+
+        mParticleCount += e.Pool.Count;
+        mStats.Spawned += e.Spawned;
+        mStats.Died += e.Died;
+    }
+}
+
+void ParticleSystem::UpdateEmitter(Emitter& emitter, float dt)
+{
+    ParticlePool& pool = emitter.Pool;
+
+    // 1. ùķ̼ +  
+    std::uint32_t firstDead = pool.Count;
+    emitter.Died = Simulate(pool, emitter.Settings, dt, firstDead);
+
+    // 2.  (   ǳʶ)
+    if (emitter.Died > 0)
+        Compact(pool, firstDead);
+
+    // 3.  Ѹ
+    emitter.SpawnAccumulator += emitter.Settings.Rate * dt;
+    const std::uint32_t rate = (std::uint32_t)emitter.SpawnAccumulator;
+    emitter.SpawnAccumulator -= (float)rate;
+
+    const std::uint32_t wanted = rate + emitter.PendingBurst;
+    emitter.PendingBurst = 0;
+    emitter.Spawned = std::min(wanted, emitter.Settings.MaxParticles - pool.Count);
+    Spawn(emitter, emitter.Spawned);
+}
+
+std::uint32_t ParticleSystem::Simulate(ParticlePool& pool, const ParticleEmitterSettings& settings, float dt, std::uint32_t& outFirstDead)
+{
+    const std::uint32_t count = pool.Count;
+
+    const __m128 dtv = _mm_set1_ps(dt);
+    const __m128 gravityDt = _mm_set1_ps(settings.Gravity * dt);
+    const __m128 drag = _mm_set1_ps(std::max(0.0f, 1.0f - settings.Drag * dt));
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    const __m128 size0 = _mm_set1_ps(settings.StartSize);
+    const __m128 sizeDelta = _mm_set1_ps(settings.EndSize - settings.StartSize);
+
+    // äθ 255  ̸  
+    __m128 color0[4], colorDelta[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        color0[c] = _mm_set1_ps(settings.StartColor[c] * 255.0f);
+        colorDelta[c] = _mm_set1_ps((settings.EndColor[c] - settings.StartColor[c]) * 255.0f);
+    }
+
+    std::uint32_t dead = 0;
+    for (std::uint32_t i = 0; i < count; i += 4)
+    {
+        // 1. ӵ (߷, ) -> ġ (semi-implicit Euler)
+        __m128 vx = _mm_loadu_ps(&pool.VelX[i]);
+        __m128 vy = _mm_loadu_ps(&pool.VelY[i]);
+        __m128 vz = _mm_loadu_ps(&pool.VelZ[i]);
+        vx = _mm_mul_ps(vx, drag);
+        vy = _mm_mul_ps(_mm_sub_ps(vy, gravityDt), drag);
+        vz = _mm_mul_ps(vz, drag);
+        _mm_storeu_ps(&pool.VelX[i], vx);
+        _mm_storeu_ps(&pool.VelY[i], vy);
+        _mm_storeu_ps(&pool.VelZ[i], vz);
+
+        _mm_storeu_ps(&pool.PosX[i], _mm_add_ps(_mm_loadu_ps(&pool.PosX[i]), _mm_mul_ps(vx, dtv)));
+        _mm_storeu_ps(&pool.PosY[i], _mm_add_ps(_mm_loadu_ps(&pool.PosY[i]), _mm_mul_ps(vy, dtv)));
+        _mm_storeu_ps(&pool.PosZ[i], _mm_add_ps(_mm_loadu_ps(&pool.PosZ[i]), _mm_mul_ps(vz, dtv)));
+
+        // 2.  ->   t (1 ̸̻ )
+        const __m128 age = _mm_add_ps(_mm_loadu_ps(&pool.Age[i]), dtv);
+        _mm_storeu_ps(&pool.Age[i], age);
+        const __m128 t = _mm_mul_ps(age, _mm_loadu_ps(&pool.InvLifetime[i]));
+
+        //    ĭ  
+        const std::uint32_t lanes = std::min(count - i, 4u);
+        const std::uint32_t deadMask = (std::uint32_t)_mm_movemask_ps(_mm_cmpge_ps(t, one)) & ((1u << lanes) - 1);
+        if (deadMask != 0 && outFirstDead == count)
+        {
+#if defined(_MSC_VER)
+            unsigned long lane;
+            _BitScanForward(&lane, deadMask);
+#else
+            const unsigned int lane = (unsigned int)__builtin_ctz(deadMask);
+#endif
+            outFirstDead = i + lane;
+        }
+        dead += BitCount[deadMask];
+
+        // 3. ũ,  (t  1  ڸ)
+        const __m128 tc = _mm_min_ps(t, one);
+        _mm_storeu_ps(&pool.Size[i], _mm_add_ps(size0, _mm_mul_ps(sizeDelta, tc)));
+
+        __m128i packed = _mm_cvtps_epi32(_mm_add_ps(color0[0], _mm_mul_ps(colorDelta[0], tc)));
+        for (int c = 1; c < 4; ++c)
+        {
+            const __m128i channel = _mm_cvtps_epi32(_mm_add_ps(color0[c], _mm_mul_ps(colorDelta[c], tc)));
+            packed = _mm_or_si128(packed, _mm_slli_epi32(channel, 8 * c));
+        }
+        _mm_storeu_si128((__m128i*)&pool.Color[i], packed);
+    }
+
+    return dead;
+}
+
+void ParticleSystem::Compact(ParticlePool& pool, std::uint32_t firstDead)
+{
+    //  w  ,   w   ĭ (Simulate   ̶  )
+    // w <= i  б      ִ  ״
+    std::uint32_t w = firstDead;
+    for (std::uint32_t i = firstDead; i < pool.Count; ++i)
+    {
+        const float age = pool.Age[i];
+        const float invLifetime = pool.InvLifetime[i];
+        const std::uint32_t alive = (age * invLifetime < 1.0f) ? 1u : 0u;
+
+        pool.PosX[w] = pool.PosX[i];
+        pool.PosY[w] = pool.PosY[i];
+        pool.PosZ[w] = pool.PosZ[i];
+        pool.VelX[w] = pool.VelX[i];
+        pool.VelY[w] = pool.VelY[i];
+        pool.VelZ[w] = pool.VelZ[i];
+        pool.Age[w] = age;
+        pool.InvLifetime[w] = invLifetime;
+        pool.Size[w] = pool.Size[i];
+        pool.Color[w] = pool.Color[i];
+        w += alive;
+    }
+    pool.Count = w;
+}
+
+void ParticleSystem::Spawn(Emitter& emitter, std::uint32_t count)
+{
+    if (count == 0)
+        return;
+
+    const ParticleEmitterSettings& s = emitter.Settings;
+    ParticlePool& pool = emitter.Pool;
+    assert(pool.Count + count <= s.MaxParticles);
+
+    //  d     (u, w)
+    const float* d = s.Direction;
+    const float helper[3] = { std::fabs(d[1]) < 0.99f ? 0.0f : 1.0f, std::fabs(d[1]) < 0.99f ? 1.0f : 0.0f, 0.0f };
+    float u[3] = { helper[1] * d[2] - helper[2] * d[1], helper[2] * d[0] - helper[0] * d[2], helper[0] * d[1] - helper[1] * d[0] };
+    const float uLength = std::sqrt(u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+    for (float& v : u)
+        v /= uLength;
+    const float w[3] = { d[1] * u[2] - d[2] * u[1], d[2] * u[0] - d[0] * u[2], d[0] * u[1] - d[1] * u[0] };
+
+    const float cosSpread = std::cos(s.Spread);
+    const std::uint32_t color = PackColor(s.StartColor);
+    std::uint32_t& random = emitter.Random;
+
+    for (std::uint32_t n = 0; n < count; ++n)
+    {
+        //  ȿ  (cos  [cosSpread, 1]  )
+        const float cosTheta = 1.0f - RandomUnit(random) * (1.0f - cosSpread);
+        const float sinTheta = std::sqrt(std::max(0.0f, 1.0f - cosTheta * cosTheta));
+        const float phi = TwoPi * RandomUnit(random);
+        const float a = std::cos(phi) * sinTheta;
+        const float b = std::sin(phi) * sinTheta;
+        const float speed = s.SpeedMin + (s.SpeedMax - s.SpeedMin) * RandomUnit(random);
+        const float lifetime = s.LifetimeMin + (s.LifetimeMax - s.LifetimeMin) * RandomUnit(random);
+
+        const std::uint32_t i = pool.Count++;
+        pool.PosX[i] = s.Position[0];
+        pool.PosY[i] = s.Position[1];
+        pool.PosZ[i] = s.Position[2];
+        pool.VelX[i] = (d[0] * cosTheta + u[0] * a + w[0] * b) * speed;
+        pool.VelY[i] = (d[1] * cosTheta + u[1] * a + w[1] * b) * speed;
+        pool.VelZ[i] = (d[2] * cosTheta + u[2] * a + w[2] * b) * speed;
+        pool.Age[i] = 0.0f;
+        pool.InvLifetime[i] = 1.0f / lifetime;
+        pool.Size[i] = s.StartSize;
+        pool.Color[i] = color;
+    }
+}
+
+// ---------------------------------------------------------
+// 
+// ---------------------------------------------------------
+std::uint32_t ParticleSystem::WriteVertices(ParticleVertex* out, std::uint32_t capacity, bool parallel)const
+{
+    PROFILE_SCOPE("ParticleSystem::WriteVertices");
+
+    // 1. ̹ͺ  ġ (capacity  ߸)
+    const std::uint32_t emitterCount = (std::uint32_t)mEmitters.size();
+    mWriteOffsets.resize(emitterCount + 1);
+    mWriteOffsets[0] = 0;
+    for (std::uint32_t i = 0; i < emitterCount; ++i)
+    {
+        const std::uint32_t count = mEmitters[i].Alive ? mEmitters[i].Pool.Count : 0;
+        mWriteOffsets[i + 1] = mWriteOffsets[i] + std::min(count, capacity - mWriteOffsets[i]);
+    }
+
+    // 2. ̹͸ ڱ  
+    auto writeRange = [this, out](std::uint32_t begin, std::uint32_t end)
+    {
+        for (std::uint32_t i = begin; i < end; ++i)
+            WriteEmitter(mEmitters[i].Pool, mWriteOffsets[i + 1] - mWriteOffsets[i], out + mWriteOffsets[i]);
+    };
+
+    const std::uint32_t total = mWriteOffsets[emitterCount];
+    if (parallel && emitterCount > 1 && total >= ParallelThreshold)
+        JobSystem::GetInstance()->ParallelFor(emitterCount, ParallelGrain, writeRange);
+    else
+        writeRange(0, emitterCount);
+
+    return total;
+}
+
+void ParticleSystem::WriteEmitter(const ParticlePool& pool, std::uint32_t count, ParticleVertex* out)
+{
+    // (x, y, z, size)   ġϸ   16 Ʈ   
+    //  out տ ƴ  (write-combined ε ޸)
+    std::uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&pool.PosX[i]);
+        __m128 y = _mm_loadu_ps(&pool.PosY[i]);
+        __m128 z = _mm_loadu_ps(&pool.PosZ[i]);
+        __m128 size = _mm_loadu_ps(&pool.Size[i]);
+        _MM_TRANSPOSE4_PS(x, y, z, size);
+
+        _mm_storeu_ps(out[i + 0].Position, x);
+        out[i + 0].Color = pool.Color[i + 0];
+        _mm_storeu_ps(out[i + 1].Position, y);
+        out[i + 1].Color = pool.Color[i + 1];
+        _mm_storeu_ps(out[i + 2].Position, z);
+        out[i + 2].Color = pool.Color[i + 2];
+        _mm_storeu_ps(out[i + 3].Position, size);
+        out[i + 3].Color = pool.Color[i + 3];
+    }
+
+    for (; i < count; ++i)
+    {
+        out[i].Position[0] = pool.PosX[i];
+        out[i].Position[1] = pool.PosY[i];
+        out[i].Position[2] = pool.PosZ[i];
+        out[i].Size = pool.Size[i];
+        out[i].Color = pool.Color[i];
+    }
+}
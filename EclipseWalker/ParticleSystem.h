@@ -0,0 +1,113 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+// CPU ƼŬ (Ʈ)
+// - ̹͸  ũ Ǯ (SoA: ġ, ӵ, , 1/, ũ,  RGBA8)
+// - Update(dt)   ̹͸:
+//   1. ùķ̼: 4  SSE  ߷/ -> ġ,  -> ũ/ ( ->  lerp,  ٷ RGBA8  )
+//          ó  ڸ movemask  
+//   2.    : ó  ڸ " w    w + 1" (б ,  )
+//   3.  Ѹ (ʴ Rate + Burst).  ̹͸ ζ     
+//   ̹ͳ ̶ ƼŬ  ̹   ýۿ 
+// - WriteVertices: ̹ͺ  ġ տ  ΰ SoA ->   (ParticleVertex) 
+//    . ε  ε ޸𸮿 ٷ  뵵 (⸸, տ )
+// ׸  4  (SV_VertexID  𼭸) x ƼŬ  νϽ (particle.hlsl)
+// ==========================================================
+
+using ParticleEmitterId = std::uint32_t;
+constexpr ParticleEmitterId InvalidParticleEmitter = 0xFFFFFFFFu;
+
+//  ϳ (ȭ , particle.hlsl  ParticleVertex   ġ)
+struct ParticleVertex
+{
+    float Position[3];
+    float Size;                 //  ũ (m)
+    std::uint32_t Color;        // RGBA8 (R   Ʈ)
+};
+
+struct ParticleEmitterSettings
+{
+    float Position[3] = { 0.0f, 0.0f, 0.0f };
+    float Direction[3] = { 0.0f, 1.0f, 0.0f };  //  
+    float Spread = 0.3f;                        //  ݰ ()
+    float SpeedMin = 2.0f, SpeedMax = 4.0f;
+    float LifetimeMin = 1.0f, LifetimeMax = 2.0f;
+    float Rate = 100.0f;                        // ʴ
+    float Gravity = 9.8f;                       // -Y (m/s^2)
+    float Drag = 0.0f;                          // ʴ ӵ  
+    float StartSize = 0.1f, EndSize = 0.3f;
+    float StartColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    float EndColor[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
+    std::uint32_t MaxParticles = 4096;
+    std::uint32_t Seed = 1;
+};
+
+// ̹ ϳ Ǯ. 迭 ̴ MaxParticles  4   ø  ( Count   )
+struct ParticlePool
+{
+    std::uint32_t Count = 0;
+    std::vector<float> PosX, PosY, PosZ;
+    std::vector<float> VelX, VelY, VelZ;
+    std::vector<float> Age, InvLifetime;
+    std::vector<float> Size;
+    std::vector<std::uint32_t> Color;
+};
+
+struct ParticleStats
+{
+    std::uint64_t Spawned = 0;
+    std::uint64_t Died = 0;
+};
+
+class ParticleSystem
+{
+public:
+    ParticleEmitterId AddEmitter(const ParticleEmitterSettings& settings);
+    void RemoveEmitter(ParticleEmitterId emitter);
+    bool IsAlive(ParticleEmitterId emitter)const;
+
+    void SetEmitterPosition(ParticleEmitterId emitter, float x, float y, float z);
+    void SetEmitterRate(ParticleEmitterId emitter, float rate);
+
+    //  Update  count  Ѳ (Ǯ   ŭ)
+    void Burst(ParticleEmitterId emitter, std::uint32_t count);
+
+    void Update(float dt, bool parallel = true);
+
+    std::uint32_t GetParticleCount()const { return mParticleCount; }
+
+    // out   ִ ƼŬ ̹ . capacity  Ѵ  .   
+    std::uint32_t WriteVertices(ParticleVertex* out, std::uint32_t capacity, bool parallel = true)const;
+
+    const ParticlePool& GetPool(ParticleEmitterId emitter)const { return mEmitters[emitter].Pool; }
+    const ParticleEmitterSettings& GetSettings(ParticleEmitterId emitter)const { return mEmitters[emitter].Settings; }
+    const ParticleStats& GetStats()const { return mStats; }
+
+private:
+    struct Emitter
+    {
+        ParticleEmitterSettings Settings;
+        ParticlePool Pool;
+        float SpawnAccumulator = 0.0f;
+        std::uint32_t PendingBurst = 0;
+        std::uint32_t Random = 1;               // xorshift32 
+        std::uint32_t Spawned = 0, Died = 0;    //  Update
+        bool Alive = false;
+    };
+
+    static void UpdateEmitter(Emitter& emitter, float dt);
+    static std::uint32_t Simulate(ParticlePool& pool, const ParticleEmitterSettings& settings, float dt, std::uint32_t& outFirstDead);
+    static void Compact(ParticlePool& pool, std::uint32_t firstDead);
+    static void Spawn(Emitter& emitter, std::uint32_t count);
+    static void WriteEmitter(const ParticlePool& pool, std::uint32_t count, ParticleVertex* out);
+
+private:
+    std::vector<Emitter> mEmitters;
+    std::vector<ParticleEmitterId> mFreeEmitters;
+    std::uint32_t mParticleCount = 0;
+    ParticleStats mStats;
+
+    mutable std::vector<std::uint32_t> mWriteOffsets;   // WriteVertices  (̹ + 1)
+};
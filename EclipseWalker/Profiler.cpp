@@ -0,0 +1,298 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define EW_PROFILER_HAS_TSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define EW_PROFILER_HAS_TSC 0
+#endif
+
+namespace
+{
+    thread_local Profiler::ThreadBuffer* tLocalBuffer = nullptr;
+
+    std::int64_t NowNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // JSON ڿ ȿ    ڸ ̽
+    void WriteJsonString(std::ofstream& out, const char* str)
+    {
+        out << '"';
+        for (const char* c = str; *c; ++c)
+        {
+            switch (*c)
+            {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if ((unsigned char)*c < 0x20) out << ' ';
+                else out << *c;
+                break;
+            }
+        }
+        out << '"';
+    }
+}
+
+Profiler::Profiler()
+{
+    mCalibTick = ReadTicks();
+    mCalibNanoseconds = NowNanoseconds();
+}
+
+Profiler::~Profiler()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    for (ThreadBuffer* buffer : mThreads)
+        delete buffer;
+    mThreads.clear();
+}
+
+std::uint64_t Profiler::ReadTicks()
+{
+#if EW_PROFILER_HAS_TSC
+    return __rdtsc();
+#else
+    return (std::uint64_t)NowNanoseconds();
+#endif
+}
+
+// 尡 ó     ۸  
+// 尡  ۴ ܵ (ĸó   о ϹǷ)
+Profiler::ThreadBuffer* Profiler::LocalBuffer()
+{
+    if (tLocalBuffer == nullptr)
+    {
+        ThreadBuffer* buffer = new ThreadBuffer();
+
+        Profiler* profiler = GetInstance();
+        std::lock_guard<std::mutex> lock(profiler->mLock);
+        buffer->ThreadId = (std::uint32_t)profiler->mThreads.size() + 1;
+        snprintf(buffer->Name, sizeof(buffer->Name), "Thread %u", buffer->ThreadId);
+        profiler->mThreads.push_back(buffer);
+
+        tLocalBuffer = buffer;
+    }
+    return tLocalBuffer;
+}
+
+void Profiler::EnterScope()
+{
+    LocalBuffer()->Depth++;
+}
+
+void Profiler::LeaveScope(const char* name, std::uint64_t begin)
+{
+    std::uint64_t end = ReadTicks();
+
+    ThreadBuffer* buffer = tLocalBuffer;
+    buffer->Depth--;
+
+    // ĸó  ƴϸ ̸ 
+    if (!GetInstance()->mRecording.load(std::memory_order_acquire))
+        return;
+
+    //   ڱ ڽŻ̶ relaxed а, ̺Ʈ ä  release 
+    std::uint64_t index = buffer->WriteCount.load(std::memory_order_relaxed);
+    ProfileEvent& e = buffer->Events[index & (ThreadBuffer::Capacity - 1)];
+    e.Name = name;
+    e.Begin = begin;
+    e.End = end;
+    e.Depth = buffer->Depth;
+    e.Frame = GetInstance()->mFrameIndex.load(std::memory_order_relaxed);
+
+    buffer->WriteCount.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+    ThreadBuffer* buffer = LocalBuffer();
+
+    std::lock_guard<std::mutex> lock(mLock);
+    snprintf(buffer->Name, sizeof(buffer->Name), "%s", name);
+}
+
+// ĸó    (/ƽ ) 
+void Profiler::BeginFrame()
+{
+    std::uint64_t now = ReadTicks();
+    mFrameIndex.fetch_add(1, std::memory_order_relaxed);
+
+    switch (mCaptureState)
+    {
+    case CaptureState::Idle:
+        break;
+
+    case CaptureState::Pending:
+        //      (TSC  ⼭  )
+        mCaptureBeginTick = now;
+        mCaptureTicksPerUs = TicksPerMicrosecond();
+        mFrameTicks.clear();
+        mFrameTicks.push_back(now);
+        mRecording.store(true, std::memory_order_release);
+        mCaptureState = CaptureState::Recording;
+        break;
+
+    case CaptureState::Recording:
+        mFrameTicks.push_back(now);
+        if (--mCaptureFramesLeft <= 0)
+        {
+            // 1.  ߰  (   )
+            std::shared_ptr<CaptureSnapshot> snapshot = std::make_shared<CaptureSnapshot>();
+            snapshot->Path = mCapturePath;
+            snapshot->BeginTick = mCaptureBeginTick;
+            snapshot->EndTick = now;
+            snapshot->TicksPerUs = mCaptureTicksPerUs;
+            snapshot->FrameTicks.swap(mFrameTicks);
+            TakeSnapshot(*snapshot);
+            mCaptureState = CaptureState::Idle;
+
+            // 2.   Ŀ (  IsCapturing  true)
+            JobSystem::GetInstance()->Run(mExportCounter, [snapshot]()
+            {
+                PROFILE_SCOPE("Profiler::WriteChromeTrace");
+                WriteChromeTrace(*snapshot);
+            });
+        }
+        break;
+    }
+}
+
+void Profiler::RequestCapture(int frameCount, const std::string& path)
+{
+    if (IsCapturing() || frameCount <= 0)
+        return;
+
+    mCaptureFramesLeft = frameCount;
+    mCapturePath = path;
+    mCaptureState = CaptureState::Pending;
+}
+
+double Profiler::TicksPerMicrosecond()const
+{
+#if EW_PROFILER_HAS_TSC
+    //     TSC/steady_clock  (ĸó     θ ٸ )
+    std::uint64_t tick = ReadTicks();
+    std::int64_t elapsedNs = std::max<std::int64_t>(NowNanoseconds() - mCalibNanoseconds, 1);
+
+    return (double)(tick - mCalibTick) / ((double)elapsedNs / 1000.0);
+#else
+    return 1000.0; // ReadTicks ʸ ״ ִ 
+#endif
+}
+
+void Profiler::TakeSnapshot(CaptureSnapshot& snapshot)
+{
+    //  ڿ LeaveScope   尡 ̺Ʈ ϳ    
+    //  ĭ (WriteCount ġ)  ġ ʰ    ĭ  
+    mRecording.store(false, std::memory_order_release);
+
+    std::vector<ThreadBuffer*> threads;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        threads = mThreads;
+
+        snapshot.Threads.resize(threads.size());
+        for (std::size_t t = 0; t < threads.size(); ++t)
+        {
+            snapshot.Threads[t].ThreadId = threads[t]->ThreadId;
+            memcpy(snapshot.Threads[t].Name, threads[t]->Name, sizeof(threads[t]->Name));
+        }
+    }
+
+    const std::uint64_t window = ThreadBuffer::Capacity - 1;
+    for (std::size_t t = 0; t < threads.size(); ++t)
+    {
+        ThreadBuffer* buffer = threads[t];
+        std::vector<ProfileEvent>& events = snapshot.Threads[t].Events;
+
+        std::uint64_t count = buffer->WriteCount.load(std::memory_order_acquire);
+        std::uint64_t start = count > window ? count - window : 0;
+
+        for (std::uint64_t i = start; i < count; ++i)
+            events.push_back(buffer->Events[i & (ThreadBuffer::Capacity - 1)]);
+
+        // ׷ ϴ ̿       ִ պκ 
+        std::uint64_t countAfter = buffer->WriteCount.load(std::memory_order_acquire);
+        std::uint64_t safeStart = countAfter > window ? countAfter - window : 0;
+        std::size_t skip = (std::size_t)std::min<std::uint64_t>(safeStart > start ? safeStart - start : 0, events.size());
+        events.erase(events.begin(), events.begin() + skip);
+
+        // ĸó  ġ ͸
+        events.erase(std::remove_if(events.begin(), events.end(), [&snapshot](const ProfileEvent& e)
+            { return e.End < snapshot.BeginTick || e.Begin > snapshot.EndTick; }), events.end());
+    }
+}
+
+bool Profiler::WriteChromeTrace(const CaptureSnapshot& snapshot)
+{
+    std::ofstream out(snapshot.Path, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
+        return false;
+
+    const double ticksPerUs = snapshot.TicksPerUs;
+    const std::uint64_t beginTick = snapshot.BeginTick;
+
+    char line[512];
+    bool first = true;
+
+    auto beginEntry = [&]()
+    {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    for (const CaptureThread& thread : snapshot.Threads)
+    {
+        // 1.  ̸ Ÿ
+        beginEntry();
+        snprintf(line, sizeof(line), "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":", thread.ThreadId);
+        out << line;
+        WriteJsonString(out, thread.Name);
+        out << "}}";
+
+        // 2. ĸó  ġ ̺Ʈ "X"(complete) ̺Ʈ  (  ̹ ɷ)
+        for (const ProfileEvent& e : thread.Events)
+        {
+            double ts = ((double)e.Begin - (double)beginTick) / ticksPerUs;
+            double dur = (double)(e.End - e.Begin) / ticksPerUs;
+
+            beginEntry();
+            out << "{\"ph\":\"X\",\"pid\":1,";
+            snprintf(line, sizeof(line), "\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%u,\"depth\":%u},\"name\":",
+                thread.ThreadId, ts, dur, e.Frame, e.Depth);
+            out << line;
+            WriteJsonString(out, e.Name);
+            out << "}";
+        }
+    }
+
+    // 3.    instant ̺Ʈ ǥ
+    for (std::size_t i = 0; i < snapshot.FrameTicks.size(); ++i)
+    {
+        beginEntry();
+        snprintf(line, sizeof(line), "{\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"name\":\"Frame %zu\"}",
+            ((double)snapshot.FrameTicks[i] - (double)beginTick) / ticksPerUs, i);
+        out << line;
+    }
+
+    out << "\n]}\n";
+    return out.good();
+}
@@ -0,0 +1,174 @@
+#pragma once
+#include "JobSystem.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ==========================================================
+//  CPU  Ϸ
+// - PROFILE_SCOPE("UpdateCamera")  RAII     ̺Ʈ 1 ϵ
+// - ̺Ʈ  ũ(32Ʈ)̰ 帶  ִ  ۿ Ƿ  
+// - ð TSC(__rdtsc) , ĸó     steady_clock   (ٸ )
+// - RequestCapture(N) ϸ  Ӻ N  ȸ ϰ Chrome trace / Perfetto JSON Ϸ 
+//      ߰ ̺Ʈ    JSON   ý Ŀ ( Ƣ ʰ)
+// - EW_RELEASE_MIN (Ǵ EW_PROFILER_DISABLED)   ũΰ  
+// Ŭ̾Ʈ   Ƿ Windows/D3D   
+// ==========================================================
+
+#if defined(EW_RELEASE_MIN) || defined(EW_PROFILER_DISABLED)
+#define EW_PROFILER_ENABLED 0
+#else
+#define EW_PROFILER_ENABLED 1
+#endif
+
+//  ۿ  ̺Ʈ ϳ (Chrome trace "X" ̺Ʈ)
+struct ProfileEvent
+{
+    const char* Name;    // ڿ ͷ  (͸ )
+    std::uint64_t Begin; // TSC ƽ
+    std::uint64_t End;
+    std::uint32_t Depth; //  ø 
+    std::uint32_t Frame; //    ȣ
+};
+
+class Profiler
+{
+public:
+    //  ϳ ϴ ̺Ʈ  (  ش  ϳ)
+    struct ThreadBuffer
+    {
+        static constexpr std::uint32_t Capacity = 1 << 16; // 2 ŵ
+
+        ProfileEvent Events[Capacity];
+        std::atomic<std::uint64_t> WriteCount{ 0 };
+        std::uint32_t ThreadId = 0;
+        std::uint32_t Depth = 0;
+        char Name[32] = {};
+    };
+
+    static Profiler* GetInstance()
+    {
+        static Profiler instance;
+        return &instance;
+    }
+
+    static std::uint64_t ReadTicks();
+
+    //  / (ProfileScope ȣ)
+    static void EnterScope();
+    static void LeaveScope(const char* name, std::uint64_t begin);
+
+    void SetThreadName(const char* name);
+
+    //  (Ŭ  /  ƽ) ۸   ȣ
+    void BeginFrame();
+
+    // N  ĸóؼ path JSON 
+    void RequestCapture(int frameCount, const std::string& path);
+    //  ̰ų    
+    bool IsCapturing()const { return mCaptureState != CaptureState::Idle || !mExportCounter.IsDone(); }
+
+private:
+    Profiler();
+    ~Profiler();
+
+    // ĸó   纻 (Ŀ ̰͸ а JSON  )
+    struct CaptureThread
+    {
+        std::uint32_t ThreadId = 0;
+        char Name[32] = {};
+        std::vector<ProfileEvent> Events;
+    };
+
+    struct CaptureSnapshot
+    {
+        std::string Path;
+        std::uint64_t BeginTick = 0;
+        std::uint64_t EndTick = 0;
+        double TicksPerUs = 1000.0;
+        std::vector<std::uint64_t> FrameTicks;
+        std::vector<CaptureThread> Threads;
+    };
+
+    static ThreadBuffer* LocalBuffer();
+    double TicksPerMicrosecond()const;
+
+    //  ߰ [BeginTick, EndTick] ̺Ʈ 帶 
+    void TakeSnapshot(CaptureSnapshot& snapshot);
+    static bool WriteChromeTrace(const CaptureSnapshot& snapshot);
+
+private:
+    enum class CaptureState { Idle, Pending, Recording };
+
+    std::mutex mLock; //  /  ( ο  )
+    std::vector<ThreadBuffer*> mThreads;
+
+    std::atomic<std::uint32_t> mFrameIndex{ 0 };
+    std::atomic<bool> mRecording{ false }; // ĸó ߿ ̺Ʈ  
+
+    CaptureState mCaptureState = CaptureState::Idle;
+    int mCaptureFramesLeft = 0;
+    std::string mCapturePath;
+    std::uint64_t mCaptureBeginTick = 0;
+    double mCaptureTicksPerUs = 1000.0;
+    std::vector<std::uint64_t> mFrameTicks; // ĸó   
+
+    JobCounter mExportCounter; // JSON  ۾ (ĸó ϳ ϳ)
+
+    // TSC  
+    std::uint64_t mCalibTick = 0;
+    std::int64_t mCalibNanoseconds = 0;
+};
+
+// RAII 
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name)
+        : mName(name)
+    {
+        Profiler::EnterScope();
+        mBegin = Profiler::ReadTicks();
+    }
+
+    ~ProfileScope()
+    {
+        Profiler::LeaveScope(mName, mBegin);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* mName;
+    std::uint64_t mBegin = 0;
+};
+
+// ==========================================================
+//   ũ
+// ==========================================================
+#if EW_PROFILER_ENABLED
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+// : PROFILE_SCOPE("UpdateCamera");
+#define PROFILE_SCOPE(name)    ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_FUNCTION()     PROFILE_SCOPE(__FUNCTION__)
+
+// : PROFILE_FRAME(); (Run   ƽ  տ)
+#define PROFILE_FRAME()        Profiler::GetInstance()->BeginFrame()
+
+// : PROFILE_THREAD("Worker 0");
+#define PROFILE_THREAD(name)   Profiler::GetInstance()->SetThreadName(name)
+
+#else
+
+#define PROFILE_SCOPE(name)    ((void)0)
+#define PROFILE_FUNCTION()     ((void)0)
+#define PROFILE_FRAME()        ((void)0)
+#define PROFILE_THREAD(name)   ((void)0)
+
+#endif
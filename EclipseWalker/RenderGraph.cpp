@@ -0,0 +1,417 @@
+#include "RenderGraph.h"
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+    // ӽ ҽ      
+    constexpr std::uint32_t UndefinedState = ~0u;
+    constexpr std::uint32_t NoPass = ~0u;
+
+    std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    bool Overlaps(std::uint64_t beginA, std::uint64_t endA, std::uint64_t beginB, std::uint64_t endB)
+    {
+        return beginA < endB && beginB < endA;
+    }
+}
+
+void RenderGraph::Reset()
+{
+    mResources.clear();
+    mPasses.clear();
+    mAccesses.clear();
+    mCompiledPasses.clear();
+    mBarriers.clear();
+    mFinalBarrierBegin = 0;
+    mStats = RenderGraphStats();
+}
+
+RgResource RenderGraph::ImportResource(const char* name, std::uint32_t initialState, std::uint32_t finalState)
+{
+    Resource resource;
+    resource.Name = name;
+    resource.Imported = true;
+    resource.InitialState = initialState;
+    resource.FinalState = finalState;
+    mResources.push_back(resource);
+    return (RgResource)mResources.size() - 1;
+}
+
+RgResource RenderGraph::CreateTransient(const char* name, std::uint64_t byteSize, std::uint64_t alignment)
+{
+    assert(byteSize > 0 && alignment > 0);
+
+    Resource resource;
+    resource.Name = name;
+    resource.ByteSize = byteSize;
+    resource.Alignment = alignment;
+    mResources.push_back(resource);
+    return (RgResource)mResources.size() - 1;
+}
+
+std::uint32_t RenderGraph::AddPass(const char* name, ExecuteFunc execute, bool sideEffects)
+{
+    Pass pass;
+    pass.Name = name;
+    pass.Execute = std::move(execute);
+    pass.SideEffects = sideEffects;
+    pass.AccessBegin = (std::uint32_t)mAccesses.size();
+    mPasses.push_back(std::move(pass));
+    return (std::uint32_t)mPasses.size() - 1;
+}
+
+void RenderGraph::Read(RgResource resource, std::uint32_t state)
+{
+    AddAccess(resource, state, false);
+}
+
+void RenderGraph::Write(RgResource resource, std::uint32_t state)
+{
+    AddAccess(resource, state, true);
+}
+
+void RenderGraph::AddAccess(RgResource resource, std::uint32_t state, bool write)
+{
+    assert(!mPasses.empty() && "AddPass before Read/Write");
+    assert(resource < mResources.size());
+
+    Access access;
+    access.Pass = (std::uint32_t)mPasses.size() - 1;
+    access.Resource = resource;
+    access.State = state;
+    access.Write = write;
+    mAccesses.push_back(access);
+    ++mPasses.back().AccessCount;
+}
+
+void RenderGraph::Compile()
+{
+    mCompiledPasses.clear();
+    mBarriers.clear();
+    mStats = RenderGraphStats();
+    mStats.Passes = (std::uint32_t)mPasses.size();
+
+    CullPasses();
+    ComputeLifetimes();
+    AllocateTransients();
+    BuildBarriers();
+}
+
+void RenderGraph::CullPasses()
+{
+    mPassAlive.assign(mPasses.size(), 0);
+    mResourceNeeded.assign(mResources.size(), 0);
+
+    // ڿ: μ ȿ ְų, ܺ/ʿ ҽ  н 츲
+    // Ƴ н д ҽ ʿ -> װ   н Ƴ
+    // (Ⱑ Ϻθ     ⵵   )
+    for (std::uint32_t p = (std::uint32_t)mPasses.size(); p-- > 0;)
+    {
+        const Pass& pass = mPasses[p];
+        bool alive = pass.SideEffects;
+        for (std::uint32_t a = pass.AccessBegin; !alive && a < pass.AccessBegin + pass.AccessCount; ++a)
+        {
+            const Access& access = mAccesses[a];
+            alive = access.Write && (mResources[access.Resource].Imported || mResourceNeeded[access.Resource] != 0);
+        }
+
+        if (!alive)
+        {
+            ++mStats.CulledPasses;
+            continue;
+        }
+
+        mPassAlive[p] = 1;
+        for (std::uint32_t a = pass.AccessBegin; a < pass.AccessBegin + pass.AccessCount; ++a)
+        {
+            if (!mAccesses[a].Write)
+                mResourceNeeded[mAccesses[a].Resource] = 1;
+        }
+    }
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+    const std::size_t resourceCount = mResources.size();
+    mFirstPass.assign(resourceCount, NoPass);
+    mLastPass.assign(resourceCount, NoPass);
+
+    // 1.  ִ н ٸ ҽ   CSR  (н  )
+    mResourceAccessBegin.assign(resourceCount + 1, 0);
+    for (const Access& access : mAccesses)
+    {
+        if (mPassAlive[access.Pass] == 0)
+            continue;
+
+        ++mResourceAccessBegin[access.Resource + 1];
+        if (mFirstPass[access.Resource] == NoPass)
+            mFirstPass[access.Resource] = access.Pass;
+        mLastPass[access.Resource] = access.Pass;
+    }
+    for (std::size_t r = 0; r < resourceCount; ++r)
+        mResourceAccessBegin[r + 1] += mResourceAccessBegin[r];
+
+    mResourceAccesses.resize(mResourceAccessBegin[resourceCount]);
+    mOrder.assign(mResourceAccessBegin.begin(), mResourceAccessBegin.end() - 1); // ä ġ (ӽ)
+    for (std::uint32_t a = 0; a < (std::uint32_t)mAccesses.size(); ++a)
+    {
+        if (mPassAlive[mAccesses[a].Pass] != 0)
+            mResourceAccesses[mOrder[mAccesses[a].Resource]++] = a;
+    }
+}
+
+void RenderGraph::AllocateTransients()
+{
+    const std::uint32_t resourceCount = (std::uint32_t)mResources.size();
+    mAllocations.assign(resourceCount, RgAllocation());
+    mAliasPredecessor.assign(resourceCount, InvalidRgResource);
+    mAliased.assign(resourceCount, 0);
+
+    // 1.  ִ ӽ ҽ ū ͺ (   ͺ)
+    mOrder.clear();
+    for (RgResource r = 0; r < resourceCount; ++r)
+    {
+        if (!mResources[r].Imported && mFirstPass[r] != NoPass)
+        {
+            mOrder.push_back(r);
+            mStats.TransientBytes += AlignUp(mResources[r].ByteSize, mResources[r].Alignment);
+        }
+    }
+    std::sort(mOrder.begin(), mOrder.end(), [this](RgResource a, RgResource b)
+    {
+        if (mResources[a].ByteSize != mResources[b].ByteSize)
+            return mResources[a].ByteSize > mResources[b].ByteSize;
+        return mFirstPass[a] < mFirstPass[b];
+    });
+
+    // 2.  ġ (̹ ġ) ҽ ޸𸮰  ĥ   о ø
+    for (std::size_t i = 0; i < mOrder.size(); ++i)
+    {
+        const RgResource r = mOrder[i];
+        const Resource& resource = mResources[r];
+        const std::uint64_t size = AlignUp(resource.ByteSize, resource.Alignment);
+
+        std::uint64_t offset = 0;
+        bool moved = true;
+        while (moved)
+        {
+            moved = false;
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                const RgResource q = mOrder[j];
+                const bool lifetimeOverlaps = mFirstPass[r] <= mLastPass[q] && mFirstPass[q] <= mLastPass[r];
+                const RgAllocation& other = mAllocations[q];
+                if (lifetimeOverlaps && Overlaps(offset, offset + size, other.Offset, other.Offset + other.Size))
+                {
+                    offset = AlignUp(other.Offset + other.Size, resource.Alignment);
+                    moved = true;
+                }
+            }
+        }
+
+        mAllocations[r].Offset = offset;
+        mAllocations[r].Size = size;
+        mStats.HeapBytes = std::max(mStats.HeapBytes, offset + size);
+    }
+
+    // 3. ޸𸮸 ޴ ҽ: ġ   (ϳ װ, ̸ Before   = "ƹų")
+    for (RgResource r : mOrder)
+    {
+        std::uint32_t predecessors = 0;
+        for (RgResource q : mOrder)
+        {
+            if (q == r || mLastPass[q] >= mFirstPass[r])
+                continue;
+
+            const RgAllocation& a = mAllocations[r];
+            const RgAllocation& b = mAllocations[q];
+            if (Overlaps(a.Offset, a.Offset + a.Size, b.Offset, b.Offset + b.Size))
+            {
+                mAliasPredecessor[r] = q;
+                ++predecessors;
+            }
+        }
+
+        mAliased[r] = predecessors > 0 ? 1 : 0;
+        if (predecessors > 1)
+            mAliasPredecessor[r] = InvalidRgResource;
+    }
+}
+
+void RenderGraph::BuildBarriers()
+{
+    const std::uint32_t resourceCount = (std::uint32_t)mResources.size();
+    mCurrentState.resize(resourceCount);
+    mCursor.assign(mResourceAccessBegin.begin(), mResourceAccessBegin.end() - 1);
+    mPassMark.assign(resourceCount, NoPass);
+    mUavPending.assign(resourceCount, 0);
+
+    for (RgResource r = 0; r < resourceCount; ++r)
+        mCurrentState[r] = mResources[r].Imported ? mResources[r].InitialState : UndefinedState;
+
+    for (std::uint32_t p = 0; p < (std::uint32_t)mPasses.size(); ++p)
+    {
+        if (mPassAlive[p] == 0)
+            continue;
+
+        RgCompiledPass compiled;
+        compiled.Pass = p;
+        compiled.BarrierBegin = (std::uint32_t)mBarriers.size();
+
+        const Pass& pass = mPasses[p];
+        for (std::uint32_t a = pass.AccessBegin; a < pass.AccessBegin + pass.AccessCount; ++a)
+        {
+            const RgResource r = mAccesses[a].Resource;
+            if (mPassMark[r] == p)
+                continue; //  н ̹ ó ( ҽ  Ʒ   ħ)
+            mPassMark[r] = p;
+
+            // 1.  н  ҽ  ħ (Ⱑ   , ƴϸ б  OR)
+            std::uint32_t readState = 0;
+            std::uint32_t writeState = UndefinedState;
+            std::uint32_t cursor = mCursor[r];
+            const std::uint32_t end = mResourceAccessBegin[r + 1];
+            for (; cursor < end && mAccesses[mResourceAccesses[cursor]].Pass == p; ++cursor)
+            {
+                const Access& access = mAccesses[mResourceAccesses[cursor]];
+                if (access.Write)
+                {
+                    assert((writeState == UndefinedState || writeState == access.State) && "one write state per pass");
+                    writeState = access.State;
+                }
+                else
+                {
+                    readState |= access.State;
+                }
+            }
+            mCursor[r] = cursor;
+
+            const bool write = writeState != UndefinedState;
+            std::uint32_t target = write ? writeState : readState;
+
+            // 2. б⸸̸     ¸ ̸ ħ (߰ н  ʵ)
+            if (!write && RgState::IsReadOnly(target))
+            {
+                for (std::uint32_t next = cursor; next < end; ++next)
+                {
+                    const Access& access = mAccesses[mResourceAccesses[next]];
+                    if (access.Write || !RgState::IsReadOnly(access.State))
+                        break;
+                    target |= access.State;
+                }
+            }
+
+            const std::uint32_t current = mCurrentState[r];
+            const bool uavPending = mUavPending[r] != 0;
+            mUavPending[r] = write && target == RgState::UnorderedAccess ? 1 : 0;
+
+            // 3. ӽ ҽ ù :   (ʿϸ) Ī 踮, ù · ٰ 
+            if (current == UndefinedState)
+            {
+                if (mAliased[r] != 0)
+                {
+                    RgBarrier barrier;
+                    barrier.Type = RgBarrierType::Aliasing;
+                    barrier.Resource = r;
+                    barrier.Before = mAliasPredecessor[r];
+                    mBarriers.push_back(barrier);
+                    ++mStats.AliasingBarriers;
+                }
+                mCurrentState[r] = target;
+                continue;
+            }
+
+            // 4. ̹ ʿ б ¸    ״
+            if (!write && RgState::IsReadOnly(current) && (current & target) == target)
+                continue;
+
+            if (current == target)
+            {
+                //  н UAV    ٽ UAV  ϸ  Ⱑ  
+                if (uavPending && target == RgState::UnorderedAccess)
+                {
+                    RgBarrier barrier;
+                    barrier.Type = RgBarrierType::UnorderedAccess;
+                    barrier.Resource = r;
+                    mBarriers.push_back(barrier);
+                    ++mStats.UavBarriers;
+                }
+                continue;
+            }
+
+            RgBarrier barrier;
+            barrier.Type = RgBarrierType::Transition;
+            barrier.Resource = r;
+            barrier.StateBefore = current;
+            barrier.StateAfter = target;
+            mBarriers.push_back(barrier);
+            ++mStats.Transitions;
+            mCurrentState[r] = target;
+        }
+
+        compiled.BarrierCount = (std::uint32_t)mBarriers.size() - compiled.BarrierBegin;
+        if (compiled.BarrierCount > 0)
+            ++mStats.BarrierBatches;
+        mCompiledPasses.push_back(compiled);
+    }
+
+    // 5. ܺ ҽ  ·  (  ϳ)
+    mFinalBarrierBegin = (std::uint32_t)mBarriers.size();
+    for (RgResource r = 0; r < resourceCount; ++r)
+    {
+        if (!mResources[r].Imported || mCurrentState[r] == mResources[r].FinalState)
+            continue;
+
+        RgBarrier barrier;
+        barrier.Type = RgBarrierType::Transition;
+        barrier.Resource = r;
+        barrier.StateBefore = mCurrentState[r];
+        barrier.StateAfter = mResources[r].FinalState;
+        mBarriers.push_back(barrier);
+        ++mStats.Transitions;
+    }
+    if (GetFinalBarrierCount() > 0)
+        ++mStats.BarrierBatches;
+}
+
+void RenderGraph::Execute(const BarrierFunc& recordBarriers)const
+{
+    for (const RgCompiledPass& compiled : mCompiledPasses)
+    {
+        if (compiled.BarrierCount > 0)
+            recordBarriers(mBarriers.data() + compiled.BarrierBegin, compiled.BarrierCount);
+
+        const Pass& pass = mPasses[compiled.Pass];
+        if (pass.Execute)
+            pass.Execute();
+    }
+
+    if (GetFinalBarrierCount() > 0)
+        recordBarriers(mBarriers.data() + mFinalBarrierBegin, GetFinalBarrierCount());
+}
+
+bool RenderGraph::ValidateAliasing()const
+{
+    for (RgResource a = 0; a < (RgResource)mResources.size(); ++a)
+    {
+        if (mResources[a].Imported || mFirstPass[a] == NoPass)
+            continue;
+
+        for (RgResource b = a + 1; b < (RgResource)mResources.size(); ++b)
+        {
+            if (mResources[b].Imported || mFirstPass[b] == NoPass)
+                continue;
+
+            const bool lifetimeOverlaps = mFirstPass[a] <= mLastPass[b] && mFirstPass[b] <= mLastPass[a];
+            const RgAllocation& x = mAllocations[a];
+            const RgAllocation& y = mAllocations[b];
+            if (lifetimeOverlaps && Overlaps(x.Offset, x.Offset + x.Size, y.Offset, y.Offset + y.Size))
+                return false;
+        }
+    }
+    return true;
+}
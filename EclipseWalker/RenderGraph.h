@@ -0,0 +1,182 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// ==========================================================
+//  ׷ (Ӹ ٽ  Compile)
+// - н   . ҽ  · д/ 
+// - Compile():
+//   1. ø: μ ȿ ִ н ܺ ҽ  н Ųٷ 󰡸
+//       ƹ  д н 
+//   2. 踮: н ʿ ̸   (ResourceBarrier  )
+//      б ´     ¸ ̸ ļ   
+//       н UAV   ҽ ٽ UAV  ϸ UAV 踮
+//   3. Ī: ӽ ҽ (ó ~   н)   ġ   ޸𸮸  
+//      ū ͺ ġ ʴ   ¿ ġ, ޸𸮸 ޴ ù н Ī 踮
+// - ӽ ҽ ù  · ٰ  (Ī  ù н Clear/Discard ؾ )
+// D3D    (´ D3D12_RESOURCE_STATES    Ʈ ÷)
+// ==========================================================
+
+using RgResource = std::uint32_t;
+constexpr RgResource InvalidRgResource = ~0u;
+
+namespace RgState
+{
+    constexpr std::uint32_t Common = 0;
+    constexpr std::uint32_t Present = 0; // D3D12   Common   
+    constexpr std::uint32_t RenderTarget = 1u << 0;
+    constexpr std::uint32_t DepthWrite = 1u << 1;
+    constexpr std::uint32_t DepthRead = 1u << 2;
+    constexpr std::uint32_t ShaderResource = 1u << 3;
+    constexpr std::uint32_t UnorderedAccess = 1u << 4;
+    constexpr std::uint32_t CopySource = 1u << 5;
+    constexpr std::uint32_t CopyDest = 1u << 6;
+
+    //  µ鳢 OR  ļ      
+    constexpr std::uint32_t ReadOnlyMask = DepthRead | ShaderResource | CopySource;
+
+    constexpr bool IsReadOnly(std::uint32_t state) { return state != Common && (state & ~ReadOnlyMask) == 0; }
+}
+
+enum class RgBarrierType : std::uint8_t
+{
+    Transition,
+    Aliasing,       // Before ҽ  ޸𸮸 Resource   (Before  Invalid  "ƹų")
+    UnorderedAccess
+};
+
+struct RgBarrier
+{
+    RgBarrierType Type = RgBarrierType::Transition;
+    RgResource Resource = InvalidRgResource;
+    RgResource Before = InvalidRgResource; // Aliasing 
+    std::uint32_t StateBefore = RgState::Common;
+    std::uint32_t StateAfter = RgState::Common;
+};
+
+// Ƴ н ϳ ( ) = 踮  + н ü
+struct RgCompiledPass
+{
+    std::uint32_t Pass = 0;
+    std::uint32_t BarrierBegin = 0;
+    std::uint32_t BarrierCount = 0;
+};
+
+// ӽ ҽ   ġ (  Size = 0)
+struct RgAllocation
+{
+    std::uint64_t Offset = 0;
+    std::uint64_t Size = 0;
+};
+
+struct RenderGraphStats
+{
+    std::uint32_t Passes = 0;
+    std::uint32_t CulledPasses = 0;
+    std::uint32_t Transitions = 0;
+    std::uint32_t AliasingBarriers = 0;
+    std::uint32_t UavBarriers = 0;
+    std::uint32_t BarrierBatches = 0;   //     (   )
+    std::uint64_t TransientBytes = 0;   // Ī    
+    std::uint64_t HeapBytes = 0;        // Ī   ũ
+};
+
+class RenderGraph
+{
+public:
+    using ExecuteFunc = std::function<void()>;
+    using BarrierFunc = std::function<void(const RgBarrier* barriers, std::uint32_t count)>;
+
+    void Reset();
+
+    // ܺ ҽ (  ):    /   
+    RgResource ImportResource(const char* name, std::uint32_t initialState, std::uint32_t finalState);
+    // ӽ ҽ: ׷  ȿ ڸ  
+    RgResource CreateTransient(const char* name, std::uint64_t byteSize, std::uint64_t alignment = 64 * 1024);
+
+    //  Read/Write   ߰ н 
+    // sideEffects = ׷ ۿ   н (ø  )
+    std::uint32_t AddPass(const char* name, ExecuteFunc execute = nullptr, bool sideEffects = false);
+    void Read(RgResource resource, std::uint32_t state);
+    void Write(RgResource resource, std::uint32_t state);
+
+    void Compile();
+
+    // н recordBarriers() -> н ü,    
+    void Execute(const BarrierFunc& recordBarriers)const;
+
+    const std::vector<RgCompiledPass>& GetCompiledPasses()const { return mCompiledPasses; }
+    const std::vector<RgBarrier>& GetBarriers()const { return mBarriers; }
+    std::uint32_t GetFinalBarrierBegin()const { return mFinalBarrierBegin; }
+    std::uint32_t GetFinalBarrierCount()const { return (std::uint32_t)mBarriers.size() - mFinalBarrierBegin; }
+    const RgAllocation& GetAllocation(RgResource resource)const { return mAllocations[resource]; }
+    const RenderGraphStats& GetStats()const { return mStats; }
+
+    std::uint32_t GetPassCount()const { return (std::uint32_t)mPasses.size(); }
+    std::uint32_t GetResourceCount()const { return (std::uint32_t)mResources.size(); }
+    const char* GetPassName(std::uint32_t pass)const { return mPasses[pass].Name; }
+    const char* GetResourceName(RgResource resource)const { return mResources[resource].Name; }
+    bool IsPassAlive(std::uint32_t pass)const { return mPassAlive[pass] != 0; }
+
+    //  ġ ӽ ҽ ޸𸮰  ġ (߿ ˻)
+    bool ValidateAliasing()const;
+
+private:
+    struct Resource
+    {
+        const char* Name = nullptr;
+        bool Imported = false;
+        std::uint32_t InitialState = RgState::Common;
+        std::uint32_t FinalState = RgState::Common;
+        std::uint64_t ByteSize = 0;
+        std::uint64_t Alignment = 1;
+    };
+
+    struct Pass
+    {
+        const char* Name = nullptr;
+        ExecuteFunc Execute;
+        bool SideEffects = false;
+        std::uint32_t AccessBegin = 0;
+        std::uint32_t AccessCount = 0;
+    };
+
+    struct Access
+    {
+        std::uint32_t Pass = 0;
+        RgResource Resource = InvalidRgResource;
+        std::uint32_t State = RgState::Common;
+        bool Write = false;
+    };
+
+    void AddAccess(RgResource resource, std::uint32_t state, bool write);
+    void CullPasses();
+    void ComputeLifetimes();
+    void AllocateTransients();
+    void BuildBarriers();
+
+private:
+    std::vector<Resource> mResources;
+    std::vector<Pass> mPasses;
+    std::vector<Access> mAccesses;
+
+    // --- Compile  ( ̿ 뷮 ) ---
+    std::vector<std::uint8_t> mPassAlive;
+    std::vector<std::uint8_t> mResourceNeeded;
+    std::vector<std::uint32_t> mFirstPass, mLastPass;    //  ִ н   ( UINT32_MAX)
+    std::vector<std::uint32_t> mResourceAccessBegin;     // ҽ   (н , CSR)
+    std::vector<std::uint32_t> mResourceAccesses;        // mAccesses ε
+    std::vector<RgAllocation> mAllocations;
+    std::vector<RgResource> mAliasPredecessor;           // Ī 踮 Before
+    std::vector<std::uint8_t> mAliased;                  //   ִ ޸𸮸 
+    std::vector<std::uint32_t> mCurrentState;            // BuildBarriers  ҽ 
+    std::vector<std::uint32_t> mCursor;                  // BuildBarriers  ҽ   ġ
+    std::vector<std::uint32_t> mPassMark;                //  н ̹ ó ҽ
+    std::vector<std::uint8_t> mUavPending;               //   UAV  ( UAV   踮)
+    std::vector<std::uint32_t> mOrder;                   // ġ  (ӽ)
+    std::vector<RgCompiledPass> mCompiledPasses;
+    std::vector<RgBarrier> mBarriers;
+    std::uint32_t mFinalBarrierBegin = 0;
+    RenderGraphStats mStats;
+};
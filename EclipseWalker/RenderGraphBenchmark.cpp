@@ -0,0 +1,203 @@
+#include "RenderGraphBenchmark.h"
+#include "RenderGraph.h"
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr std::uint64_t ScreenBytes = 1920ull * 1080 * 4;   // RGBA8 / D32
+    constexpr std::uint64_t HdrBytes = 1920ull * 1080 * 8;      // RGBA16F
+    constexpr std::uint64_t ShadowBytes = 2048ull * 2048 * 4;
+    constexpr std::uint32_t ShadowCascades = 4;
+    constexpr std::uint32_t BloomLevels = 6;
+    constexpr std::uint32_t DebugPassesPerView = 2;
+
+    //  ϳ з ۵  ( 丸  ۿ UI ռ)
+    void DeclareView(RenderGraph& graph, RgResource backBuffer, bool composite)
+    {
+        // 1. ׸
+        RgResource shadows[ShadowCascades];
+        for (std::uint32_t i = 0; i < ShadowCascades; ++i)
+        {
+            shadows[i] = graph.CreateTransient("ShadowMap", ShadowBytes);
+            graph.AddPass("Shadow");
+            graph.Write(shadows[i], RgState::DepthWrite);
+        }
+
+        // 2.  н + G
+        const RgResource depth = graph.CreateTransient("Depth", ScreenBytes);
+        graph.AddPass("DepthPrepass");
+        graph.Write(depth, RgState::DepthWrite);
+
+        const RgResource gbuffer[3] = {
+            graph.CreateTransient("GBufferAlbedo", ScreenBytes),
+            graph.CreateTransient("GBufferNormal", ScreenBytes),
+            graph.CreateTransient("GBufferMaterial", ScreenBytes) };
+        graph.AddPass("GBuffer");
+        for (RgResource target : gbuffer)
+            graph.Write(target, RgState::RenderTarget);
+        graph.Write(depth, RgState::DepthWrite);
+
+        // 3. SSAO (UAV    / )
+        const RgResource ao = graph.CreateTransient("SSAO", ScreenBytes / 4);
+        const RgResource aoTemp = graph.CreateTransient("SSAOTemp", ScreenBytes / 4);
+        graph.AddPass("SSAO");
+        graph.Read(depth, RgState::ShaderResource);
+        graph.Read(gbuffer[1], RgState::ShaderResource);
+        graph.Write(ao, RgState::UnorderedAccess);
+
+        graph.AddPass("SSAOBlurH");
+        graph.Read(ao, RgState::ShaderResource);
+        graph.Write(aoTemp, RgState::UnorderedAccess);
+
+        graph.AddPass("SSAOBlurV");
+        graph.Read(aoTemp, RgState::ShaderResource);
+        graph.Write(ao, RgState::UnorderedAccess);
+
+        // 4.  ->  (̴ б   )
+        const RgResource hdr = graph.CreateTransient("HDR", HdrBytes);
+        graph.AddPass("Lighting");
+        for (RgResource target : gbuffer)
+            graph.Read(target, RgState::ShaderResource);
+        graph.Read(depth, RgState::ShaderResource);
+        graph.Read(ao, RgState::ShaderResource);
+        for (RgResource shadow : shadows)
+            graph.Read(shadow, RgState::ShaderResource);
+        graph.Write(hdr, RgState::RenderTarget);
+
+        graph.AddPass("Transparent");
+        graph.Read(depth, RgState::DepthRead);
+        graph.Write(hdr, RgState::RenderTarget);
+
+        // 5.  ( , ö ħ)
+        RgResource bloom[BloomLevels];
+        RgResource source = hdr;
+        std::uint64_t bytes = HdrBytes / 4;
+        for (std::uint32_t i = 0; i < BloomLevels; ++i, bytes /= 4)
+        {
+            bloom[i] = graph.CreateTransient("BloomDown", bytes);
+            graph.AddPass("BloomDownsample");
+            graph.Read(source, RgState::ShaderResource);
+            graph.Write(bloom[i], RgState::RenderTarget);
+            source = bloom[i];
+        }
+        for (std::uint32_t i = BloomLevels - 1; i > 0; --i)
+        {
+            graph.AddPass("BloomUpsample");
+            graph.Read(bloom[i], RgState::ShaderResource);
+            graph.Write(bloom[i - 1], RgState::RenderTarget);
+        }
+
+        // 6. 
+        const RgResource ldr = graph.CreateTransient("LDR", ScreenBytes);
+        graph.AddPass("Tonemap");
+        graph.Read(hdr, RgState::ShaderResource);
+        graph.Read(bloom[0], RgState::ShaderResource);
+        graph.Write(ldr, RgState::RenderTarget);
+
+        // 7.  (ƹ   -> ø )
+        const RgResource debugView = graph.CreateTransient("DebugGBuffer", ScreenBytes);
+        graph.AddPass("DebugGBuffer");
+        graph.Read(gbuffer[0], RgState::ShaderResource);
+        graph.Read(gbuffer[1], RgState::ShaderResource);
+        graph.Write(debugView, RgState::RenderTarget);
+
+        graph.AddPass("DebugOverlay");
+        graph.Read(debugView, RgState::ShaderResource);
+        graph.Write(debugView, RgState::RenderTarget);
+
+        // 8. UI ռ (ٸ   䰡 ؽó д´ٰ  μ ȿ ǥ)
+        if (composite)
+        {
+            graph.AddPass("Composite");
+            graph.Read(ldr, RgState::ShaderResource);
+            graph.Write(backBuffer, RgState::RenderTarget);
+        }
+        else
+        {
+            graph.AddPass("ViewReadback", nullptr, true);
+            graph.Read(ldr, RgState::CopySource);
+        }
+    }
+}
+
+namespace RenderGraphBenchmark
+{
+    RenderGraphBenchmarkResult Run(std::uint32_t viewCount)
+    {
+        RenderGraphBenchmarkResult result;
+        result.Views = viewCount;
+
+        RenderGraph graph;
+        auto declare = [&graph, viewCount]()
+        {
+            graph.Reset();
+            const RgResource backBuffer = graph.ImportResource("BackBuffer", RgState::Present, RgState::Present);
+            for (std::uint32_t v = 0; v < viewCount; ++v)
+                DeclareView(graph, backBuffer, v + 1 == viewCount);
+        };
+
+        // 1.    뷮 
+        declare();
+        graph.Compile();
+
+        // 2.  ó ݺ
+        const int iterations = 256;
+        for (int it = 0; it < iterations; ++it)
+        {
+            auto t0 = Clock::now();
+            declare();
+            auto t1 = Clock::now();
+            graph.Compile();
+            auto t2 = Clock::now();
+
+            result.BuildMs += ElapsedMs(t0, t1);
+            result.CompileMs += ElapsedMs(t1, t2);
+        }
+        result.BuildMs /= iterations;
+        result.CompileMs /= iterations;
+
+        const RenderGraphStats& stats = graph.GetStats();
+        result.Passes = stats.Passes;
+        result.CulledPasses = stats.CulledPasses;
+        result.Transitions = stats.Transitions;
+        result.AliasingBarriers = stats.AliasingBarriers;
+        result.UavBarriers = stats.UavBarriers;
+        result.BarrierBatches = stats.BarrierBatches;
+        result.TransientMB = stats.TransientBytes / (1024.0 * 1024.0);
+        result.HeapMB = stats.HeapBytes / (1024.0 * 1024.0);
+        result.Valid = graph.ValidateAliasing() && stats.CulledPasses == viewCount * DebugPassesPerView;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[RenderGraphBenchmark]\n";
+        report += "  views  passes  culled  transitions  aliasing  uav  batches  transient(MB)  heap(MB)  build(ms)  compile(ms)  valid\n";
+
+        const std::uint32_t views[] = { 1, 4, 16 };
+        bool valid = true;
+        for (std::uint32_t viewCount : views)
+        {
+            RenderGraphBenchmarkResult r = Run(viewCount);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%7u %7u %7u %12u %9u %4u %8u %14.1f %9.1f %10.4f %12.4f  %s\n",
+                r.Views, r.Passes, r.CulledPasses, r.Transitions, r.AliasingBarriers, r.UavBarriers, r.BarrierBatches,
+                r.TransientMB, r.HeapMB, r.BuildMs, r.CompileMs, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+//  ׷    (߿, GPU )
+// ۵  ϳ (׸ 4, G, SSAO, ,  ü, , UI
+// + ƹ  д  н 2)   N ŭ ׾Ƽ
+//   Reset ->  -> Compile ϴ ð 
+// Ī ġ  ġ ҽ  ġ,  н øƴ Ȯ
+// ==========================================================
+
+struct RenderGraphBenchmarkResult
+{
+    std::uint32_t Views = 0;
+    std::uint32_t Passes = 0;
+    std::uint32_t CulledPasses = 0;
+    std::uint32_t Transitions = 0;
+    std::uint32_t AliasingBarriers = 0;
+    std::uint32_t UavBarriers = 0;
+    std::uint32_t BarrierBatches = 0;
+
+    double TransientMB = 0.0; // Ī 
+    double HeapMB = 0.0;      // Ī 
+
+    double BuildMs = 0.0;     //  (  )
+    double CompileMs = 0.0;
+
+    bool Valid = false;       // Ī ˻ + ø 
+};
+
+namespace RenderGraphBenchmark
+{
+    RenderGraphBenchmarkResult Run(std::uint32_t viewCount);
+
+    //  1 / 4 / 16
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
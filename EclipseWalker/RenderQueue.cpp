@@ -0,0 +1,146 @@
+#include "RenderQueue.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cstring>
+
+void RenderQueue::Clear()
+{
+    for (auto& chunk : mChunkItems)
+        chunk.clear();
+    mItems.clear();
+    mBatches.clear();
+}
+
+void RenderQueue::Gather(std::uint32_t count, const EmitFunc& emit)
+{
+    PROFILE_SCOPE("RenderQueue::Gather");
+
+    Clear();
+    if (count == 0)
+        return;
+
+    // 1.  ڱ ۿ  ( ȣ = begin / grain)
+    if (count >= ParallelThreshold)
+    {
+        const std::uint32_t chunkCount = (count + ParallelGrain - 1) / ParallelGrain;
+        if (mChunkItems.size() < chunkCount)
+            mChunkItems.resize(chunkCount);
+
+        JobSystem::GetInstance()->ParallelFor(count, ParallelGrain,
+            [this, &emit](std::uint32_t begin, std::uint32_t end)
+            {
+                // Ŀ  ParallelFor  °   θǷ ⼭ grain  ٽ 
+                for (std::uint32_t chunkBegin = begin; chunkBegin < end; chunkBegin += ParallelGrain)
+                {
+                    const std::uint32_t chunkEnd = std::min(chunkBegin + ParallelGrain, end);
+                    emit(chunkBegin, chunkEnd, mChunkItems[chunkBegin / ParallelGrain]);
+                }
+            });
+
+        // 2.   ̾ 
+        std::size_t total = 0;
+        for (std::uint32_t c = 0; c < chunkCount; ++c)
+            total += mChunkItems[c].size();
+
+        mItems.resize(total);
+        std::size_t offset = 0;
+        for (std::uint32_t c = 0; c < chunkCount; ++c)
+        {
+            if (!mChunkItems[c].empty())
+                memcpy(mItems.data() + offset, mChunkItems[c].data(), mChunkItems[c].size() * sizeof(DrawItem));
+            offset += mChunkItems[c].size();
+        }
+    }
+    else
+    {
+        emit(0, count, mItems);
+    }
+}
+
+void RenderQueue::Sort()
+{
+    PROFILE_SCOPE("RenderQueue::Sort");
+    RadixSort(mItems, mScratch);
+}
+
+void RenderQueue::BuildBatches()
+{
+    PROFILE_SCOPE("RenderQueue::BuildBatches");
+
+    mBatches.clear();
+    const std::uint32_t count = (std::uint32_t)mItems.size();
+
+    std::uint32_t i = 0;
+    while (i < count)
+    {
+        // °    ϳ = ο ϳ
+        const std::uint64_t state = DrawKey::GetState(mItems[i].Key);
+        std::uint32_t end = i + 1;
+        while (end < count && DrawKey::GetState(mItems[end].Key) == state)
+            ++end;
+
+        DrawBatch batch;
+        batch.Key = mItems[i].Key;
+        batch.FirstInstance = i;
+        batch.InstanceCount = end - i;
+        mBatches.push_back(batch);
+
+        i = end;
+    }
+}
+
+void RenderQueue::RadixSort(std::vector<DrawItem>& items, std::vector<DrawItem>& scratch)
+{
+    const std::size_t count = items.size();
+    if (count <= 1)
+        return;
+
+    constexpr std::uint32_t DigitCount = 8;
+    constexpr std::uint32_t BucketCount = 256;
+
+    // 1. ڸ ׷  
+    std::uint32_t histograms[DigitCount][BucketCount] = {};
+    for (const DrawItem& item : items)
+    {
+        std::uint64_t key = item.Key;
+        for (std::uint32_t d = 0; d < DigitCount; ++d)
+        {
+            ++histograms[d][key & 0xFF];
+            key >>= 8;
+        }
+    }
+
+    scratch.resize(count);
+    DrawItem* src = items.data();
+    DrawItem* dst = scratch.data();
+    bool swapped = false;
+
+    // 2.  ڸ  Ѹ
+    //     Ű  ڸ  (н/PSO ó κ   Ʈ) ǳʶ
+    for (std::uint32_t d = 0; d < DigitCount; ++d)
+    {
+        const std::uint32_t shift = d * 8;
+        std::uint32_t* histogram = histograms[d];
+        if (histogram[(src[0].Key >> shift) & 0xFF] == count)
+            continue;
+
+        std::uint32_t offsets[BucketCount];
+        std::uint32_t sum = 0;
+        for (std::uint32_t b = 0; b < BucketCount; ++b)
+        {
+            offsets[b] = sum;
+            sum += histogram[b];
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+            dst[offsets[(src[i].Key >> shift) & 0xFF]++] = src[i];
+
+        std::swap(src, dst);
+        swapped = !swapped;
+    }
+
+    // 3.  scratch ʿ  ͸ ¹ٲ ( )
+    if (swapped)
+        items.swap(scratch);
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// ==========================================================
+//  ť ( Ű + νϽ ġ)
+// - ̴ Ʈ ޽ DrawItem(64Ʈ Ű + Ʈ ε) 
+//   Gather()  ߶ JobSystem  ְ,  ڱ ۿ  ( )
+// - Sort(): Ű  LSD   (8Ʈ x 8ȸ,  Ű  ڸ ǳʶ)
+// - BuildBatches(): ̸ ٸ   ϳ νϽ ο 
+//   νϽ ȣ = ĵ   (νϽ ͵   ä)
+// D3D    (帮 ġũ ״ )
+// ==========================================================
+
+enum class DrawPass : std::uint8_t
+{
+    Opaque = 0, // н ȣ  ׸ (ִ 16)
+    Count
+};
+
+// Ű ġ ( Ʈ,  ³ ٰ  ȿ տ ڷ)
+//   н 4 | PSO 6 |  12 | ޽ 16 | LOD 3 | ޽ 7 |  16
+namespace DrawKey
+{
+    constexpr std::uint32_t DepthBits = 16;
+    constexpr std::uint32_t SubmeshBits = 7;
+    constexpr std::uint32_t LodBits = 3;
+    constexpr std::uint32_t MeshBits = 16;
+    constexpr std::uint32_t MaterialBits = 12;
+    constexpr std::uint32_t PipelineBits = 6;
+    constexpr std::uint32_t PassBits = 4;
+    static_assert(DepthBits + SubmeshBits + LodBits + MeshBits + MaterialBits + PipelineBits + PassBits == 64, "DrawKey must fill 64 bits");
+
+    constexpr std::uint32_t DepthShift = 0;
+    constexpr std::uint32_t SubmeshShift = DepthShift + DepthBits;
+    constexpr std::uint32_t LodShift = SubmeshShift + SubmeshBits;
+    constexpr std::uint32_t MeshShift = LodShift + LodBits;
+    constexpr std::uint32_t MaterialShift = MeshShift + MeshBits;
+    constexpr std::uint32_t PipelineShift = MaterialShift + MaterialBits;
+    constexpr std::uint32_t PassShift = PipelineShift + PipelineBits;
+
+    constexpr std::uint32_t Field(std::uint64_t key, std::uint32_t shift, std::uint32_t bits)
+    {
+        return (std::uint32_t)((key >> shift) & ((1ull << bits) - 1));
+    }
+
+    // depth  [0, 1] (0 = ī޶ ٷ ), 16Ʈ ȭ
+    inline std::uint64_t Make(DrawPass pass, std::uint32_t pipeline, std::uint32_t material,
+        std::uint32_t mesh, std::uint32_t lod, std::uint32_t submesh, float depth)
+    {
+        assert((std::uint32_t)pass < (1u << PassBits) && pipeline < (1u << PipelineBits));
+        assert(material < (1u << MaterialBits) && mesh < (1u << MeshBits));
+        assert(lod < (1u << LodBits) && submesh < (1u << SubmeshBits));
+
+        const float clamped = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+        const std::uint64_t quantizedDepth = (std::uint64_t)(clamped * 65535.0f + 0.5f);
+
+        return ((std::uint64_t)pass << PassShift) | ((std::uint64_t)pipeline << PipelineShift) |
+            ((std::uint64_t)material << MaterialShift) | ((std::uint64_t)mesh << MeshShift) |
+            ((std::uint64_t)lod << LodShift) | ((std::uint64_t)submesh << SubmeshShift) |
+            (quantizedDepth << DepthShift);
+    }
+
+    constexpr DrawPass GetPass(std::uint64_t key) { return (DrawPass)Field(key, PassShift, PassBits); }
+    constexpr std::uint32_t GetPipeline(std::uint64_t key) { return Field(key, PipelineShift, PipelineBits); }
+    constexpr std::uint32_t GetMaterial(std::uint64_t key) { return Field(key, MaterialShift, MaterialBits); }
+    constexpr std::uint32_t GetMesh(std::uint64_t key) { return Field(key, MeshShift, MeshBits); }
+    constexpr std::uint32_t GetLod(std::uint64_t key) { return Field(key, LodShift, LodBits); }
+    constexpr std::uint32_t GetSubmesh(std::uint64_t key) { return Field(key, SubmeshShift, SubmeshBits); }
+    constexpr std::uint32_t GetDepth(std::uint64_t key) { return Field(key, DepthShift, DepthBits); }
+
+    // ̸   κ (  ο   )
+    constexpr std::uint64_t GetState(std::uint64_t key) { return key >> SubmeshShift; }
+}
+
+struct DrawItem
+{
+    std::uint64_t Key = 0;
+    std::uint32_t Object = 0; // TransformStorage  ε
+    std::uint32_t Reserved = 0;
+};
+static_assert(sizeof(DrawItem) == 16, "DrawItem should stay 16 bytes");
+
+// νϽ ο ϳ = ĵ  [FirstInstance, FirstInstance + InstanceCount)
+struct DrawBatch
+{
+    std::uint64_t Key = 0; // ù  Ű ( κ  ü )
+    std::uint32_t FirstInstance = 0;
+    std::uint32_t InstanceCount = 0;
+};
+
+class RenderQueue
+{
+public:
+    //    ȣ 忡   
+    static constexpr std::uint32_t ParallelThreshold = 4096;
+    static constexpr std::uint32_t ParallelGrain = 1024;
+
+    using EmitFunc = std::function<void(std::uint32_t begin, std::uint32_t end, std::vector<DrawItem>& out)>;
+
+    void Clear();
+
+    // emit(begin, end, out)  [0, count)    ( 忡 ÿ Ҹ)
+    //   ̾ ̹Ƿ     
+    void Gather(std::uint32_t count, const EmitFunc& emit);
+
+    void Sort();
+    void BuildBatches();
+
+    const std::vector<DrawItem>& GetItems()const { return mItems; }
+    const std::vector<DrawBatch>& GetBatches()const { return mBatches; }
+
+    // ĸ  (ġũ/ܺ ۿ), scratch  ӽ 
+    static void RadixSort(std::vector<DrawItem>& items, std::vector<DrawItem>& scratch);
+
+private:
+    std::vector<std::vector<DrawItem>> mChunkItems; //  ( ̿ 뷮 )
+    std::vector<DrawItem> mItems;
+    std::vector<DrawItem> mScratch;
+    std::vector<DrawBatch> mBatches;
+};
@@ -0,0 +1,133 @@
+#include "RenderQueueBenchmark.h"
+#include "RenderQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    // ġũ Ʈ (ӿ TransformStorage + MeshGeometry  д )
+    struct SyntheticObject
+    {
+        std::uint32_t Mesh;
+        std::uint32_t Material;
+        std::uint32_t Lod;
+        float Depth;
+    };
+}
+
+namespace RenderQueueBenchmark
+{
+    RenderQueueBenchmarkResult Run(std::uint32_t itemCount, std::uint32_t meshCount, std::uint32_t materialCount)
+    {
+        RenderQueueBenchmarkResult result;
+        result.Items = itemCount;
+        result.Meshes = meshCount;
+        result.Materials = materialCount;
+
+        // 1.   (PSO 2, ޽  ϳ  )
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<std::uint32_t> meshDist(0, meshCount - 1);
+        std::uniform_int_distribution<std::uint32_t> lodDist(0, 3);
+        std::uniform_real_distribution<float> depthDist(0.0f, 1.0f);
+
+        std::vector<SyntheticObject> objects(itemCount);
+        for (SyntheticObject& object : objects)
+        {
+            object.Mesh = meshDist(rng);
+            object.Material = object.Mesh % materialCount;
+            object.Lod = lodDist(rng);
+            object.Depth = depthDist(rng);
+        }
+
+        auto emit = [&objects](std::uint32_t begin, std::uint32_t end, std::vector<DrawItem>& out)
+        {
+            for (std::uint32_t i = begin; i < end; ++i)
+            {
+                const SyntheticObject& object = objects[i];
+                DrawItem item;
+                item.Key = DrawKey::Make(DrawPass::Opaque, object.Mesh & 1, object.Material,
+                    object.Mesh, object.Lod, 0, object.Depth);
+                item.Object = i;
+                out.push_back(item);
+            }
+        };
+
+        // 2.     (ù °  뷮 )
+        RenderQueue queue;
+        queue.Gather(itemCount, emit);
+
+        const int iterations = 16;
+        std::vector<DrawItem> reference;
+        for (int it = 0; it < iterations; ++it)
+        {
+            auto t0 = Clock::now();
+            queue.Gather(itemCount, emit);
+            auto t1 = Clock::now();
+
+            if (it == 0)
+                reference = queue.GetItems();
+
+            auto t2 = Clock::now();
+            queue.Sort();
+            auto t3 = Clock::now();
+            queue.BuildBatches();
+            auto t4 = Clock::now();
+
+            result.GatherMs += ElapsedMs(t0, t1);
+            result.RadixSortMs += ElapsedMs(t2, t3);
+            result.BatchMs += ElapsedMs(t3, t4);
+        }
+        result.GatherMs /= iterations;
+        result.RadixSortMs /= iterations;
+        result.BatchMs /= iterations;
+        result.Batches = (std::uint32_t)queue.GetBatches().size();
+
+        // 3. std::sort  ( Ű  ; )
+        auto t0 = Clock::now();
+        std::sort(reference.begin(), reference.end(),
+            [](const DrawItem& a, const DrawItem& b) { return a.Key < b.Key; });
+        auto t1 = Clock::now();
+        result.StdSortMs = ElapsedMs(t0, t1);
+
+        const std::vector<DrawItem>& sorted = queue.GetItems();
+        result.SortMatches = sorted.size() == reference.size() &&
+            std::equal(sorted.begin(), sorted.end(), reference.begin(),
+                [](const DrawItem& a, const DrawItem& b) { return a.Key == b.Key; });
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[RenderQueueBenchmark]\n";
+        report += "     items  meshes  mats  gather(ms)  radix(ms)  std::sort(ms)  batch(ms)  draws  match\n";
+
+        struct Case { std::uint32_t Meshes, Materials; };
+        const Case cases[] = { { 16, 4 }, { 256, 32 }, { 4096, 256 } };
+        bool valid = true;
+        for (const Case& c : cases)
+        {
+            RenderQueueBenchmarkResult r = Run(100000, c.Meshes, c.Materials);
+            valid = valid && r.SortMatches;
+
+            char line[160];
+            snprintf(line, sizeof(line), "%10u %7u %5u %11.3f %10.3f %14.3f %10.3f %6u  %s\n",
+                r.Items, r.Meshes, r.Materials, r.GatherMs, r.RadixSortMs, r.StdSortMs, r.BatchMs,
+                r.Batches, r.SortMatches ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+//  ť /ġ  (߿, GPU )
+// Ʈ N  ޽//LOD   ְ
+// Gather(Ű ) ->   -> ġ  ð 
+// std::sort  (Ű )   Ȯ
+// ==========================================================
+
+struct RenderQueueBenchmarkResult
+{
+    std::uint32_t Items = 0;
+    std::uint32_t Meshes = 0;
+    std::uint32_t Materials = 0;
+
+    double GatherMs = 0.0;   //   ()
+    double RadixSortMs = 0.0;
+    double StdSortMs = 0.0;  //  Է std::sort  (񱳿)
+    double BatchMs = 0.0;
+
+    std::uint32_t Batches = 0; // ο  (νϽ  Items  )
+    bool SortMatches = false;
+};
+
+namespace RenderQueueBenchmark
+{
+    RenderQueueBenchmarkResult Run(std::uint32_t itemCount, std::uint32_t meshCount, std::uint32_t materialCount);
+
+    // 100k , ޽/  ٲ㰡
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,715 @@
+#include "SceneBVH.h"
+#include "JobSystem.h"
+#include "SweepTests.h"
+#include <algorithm>
+#include <cmath>
+#include <immintrin.h>
+
+namespace
+{
+    constexpr std::uint32_t MaxBins = 32;
+    constexpr int StackSize = 32; //  1M 鵵 20 ĭ , ġ  ġģ Ʈ
+
+    // ȸ :   迭 , SAH    ڸ  Ʈ  ħ
+    // (ģ   Ƿ   ״ LIFO, ڽ  )
+    template<typename T>
+    class TraversalStack
+    {
+    public:
+        void Push(const T& value)
+        {
+            if (mTop < StackSize)
+                mInline[mTop++] = value;
+            else
+                mSpill.push_back(value);
+        }
+
+        T Pop()
+        {
+            if (!mSpill.empty())
+            {
+                T value = mSpill.back();
+                mSpill.pop_back();
+                return value;
+            }
+            return mInline[--mTop];
+        }
+
+        bool IsEmpty()const { return mTop == 0; }
+
+    private:
+        T mInline[StackSize];
+        int mTop = 0;
+        std::vector<T> mSpill; // mInline   á  
+    };
+
+    void ClearSlot(BvhNode4& node, int i)
+    {
+        node.MinX[i] = node.MinY[i] = node.MinZ[i] = FLT_MAX;
+        node.MaxX[i] = node.MaxY[i] = node.MaxZ[i] = -FLT_MAX;
+        node.Child[i] = -1;
+        node.Count[i] = 0;
+    }
+
+    void SetSlotBounds(BvhNode4& node, int i, const Aabb& b)
+    {
+        node.MinX[i] = b.MinX; node.MinY[i] = b.MinY; node.MinZ[i] = b.MinZ;
+        node.MaxX[i] = b.MaxX; node.MaxY[i] = b.MaxY; node.MaxZ[i] = b.MaxZ;
+    }
+
+    Aabb NodeBounds(const BvhNode4& node)
+    {
+        Aabb b;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (node.Child[i] < 0)
+                continue;
+            b.MinX = std::min(b.MinX, node.MinX[i]); b.MinY = std::min(b.MinY, node.MinY[i]); b.MinZ = std::min(b.MinZ, node.MinZ[i]);
+            b.MaxX = std::max(b.MaxX, node.MaxX[i]); b.MaxY = std::max(b.MaxY, node.MaxY[i]); b.MaxZ = std::max(b.MaxZ, node.MaxZ[i]);
+        }
+        return b;
+    }
+
+    //  ĭ Ʈ 0
+    unsigned int ValidMask(const BvhNode4& node)
+    {
+        return (node.Child[0] >= 0 ? 1u : 0u) | (node.Child[1] >= 0 ? 2u : 0u) |
+            (node.Child[2] >= 0 ? 4u : 0u) | (node.Child[3] >= 0 ? 8u : 0u);
+    }
+
+    float BoundsMin(const Aabb& b, int axis) { return axis == 0 ? b.MinX : (axis == 1 ? b.MinY : b.MinZ); }
+    float BoundsMax(const Aabb& b, int axis) { return axis == 0 ? b.MaxX : (axis == 1 ? b.MaxY : b.MaxZ); }
+}
+
+// ---------------------------------------------------------
+// 
+// ---------------------------------------------------------
+void SceneBVH::Clear()
+{
+    mPrimBounds.clear();
+    mPrimIndices.clear();
+    mNodes.clear();
+}
+
+void SceneBVH::Build(const Aabb* primBounds, std::uint32_t count, const BuildSettings& settings)
+{
+    Clear();
+    if (count == 0)
+        return;
+
+    mPrimBounds.assign(primBounds, primBounds + count);
+    mPrimIndices.resize(count);
+    mBuildPrims.resize(count);
+
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        BuildPrim& p = mBuildPrims[i];
+        p.Bounds = primBounds[i];
+        p.Centroid[0] = primBounds[i].CenterX();
+        p.Centroid[1] = primBounds[i].CenterY();
+        p.Centroid[2] = primBounds[i].CenterZ();
+        p.Index = i;
+    }
+
+    // 1.  Ʈ (  ִ 2N - 1, ̸ Ƶΰ    )
+    mBuildNodes.resize((std::size_t)count * 2);
+    mBuildNodeCount.store(1, std::memory_order_relaxed);
+
+    BuildSettings s = settings;
+    s.BinCount = std::clamp(s.BinCount, 2u, MaxBins);
+    s.MaxLeafSize = std::max(s.MaxLeafSize, 1u);
+    if (s.Parallel)
+        JobSystem::GetInstance()->Initialize();
+
+    Subdivide(0, 0, count, s);
+
+    for (std::uint32_t i = 0; i < count; ++i)
+        mPrimIndices[i] = mBuildPrims[i].Index;
+
+    // 2. 4   (  -> θ ׻ ڽĺ )
+    mNodes.reserve(count / 2 + 1);
+    Collapse(0);
+
+    mBuildNodes.clear();
+    mBuildNodes.shrink_to_fit();
+    mBuildPrims.clear();
+    mBuildPrims.shrink_to_fit();
+}
+
+void SceneBVH::Subdivide(std::uint32_t nodeIndex, std::uint32_t first, std::uint32_t count, const BuildSettings& settings)
+{
+    Aabb bounds;
+    for (std::uint32_t i = first; i < first + count; ++i)
+        bounds.Grow(mBuildPrims[i].Bounds);
+
+    BuildNode& node = mBuildNodes[nodeIndex];
+    node.Bounds = bounds;
+    node.First = first;
+    node.Count = count;
+
+    if (count <= settings.MaxLeafSize)
+        return;
+
+    std::uint32_t leftCount = FindSplit(first, count, bounds, settings);
+    if (leftCount == 0)
+        return; // ɰ   -> 
+
+    std::uint32_t left = mBuildNodeCount.fetch_add(2, std::memory_order_relaxed);
+    node.Left = left;
+    node.Count = 0;
+
+    std::uint32_t rightFirst = first + leftCount;
+    std::uint32_t rightCount = count - leftCount;
+
+    if (settings.Parallel && count >= settings.ParallelThreshold)
+    {
+        JobCounter counter;
+        JobSystem::GetInstance()->Run(counter, [this, left, first, leftCount, &settings]()
+            {
+                Subdivide(left, first, leftCount, settings);
+            });
+        Subdivide(left + 1, rightFirst, rightCount, settings);
+        JobSystem::GetInstance()->Wait(counter);
+    }
+    else
+    {
+        Subdivide(left, first, leftCount, settings);
+        Subdivide(left + 1, rightFirst, rightCount, settings);
+    }
+}
+
+//   Ƽ   (0̸  δ  )
+//   [first, first + count)  ׿ ° ġ
+std::uint32_t SceneBVH::FindSplit(std::uint32_t first, std::uint32_t count, const Aabb& bounds, const BuildSettings& settings)
+{
+    BuildPrim* prims = mBuildPrims.data() + first;
+    const std::uint32_t binCount = settings.BinCount;
+
+    Aabb centroidBounds;
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        const float* c = prims[i].Centroid;
+        centroidBounds.Grow(c[0], c[1], c[2]);
+    }
+
+    float bestCost = FLT_MAX;
+    int bestAxis = -1;
+    std::uint32_t bestBin = 0;
+
+    //   Ŷ   ä (Ƽ긶 ٿ带   е)
+    Aabb binBounds[3][MaxBins];
+    std::uint32_t binCounts[3][MaxBins] = {};
+    float axisLo[3], axisScale[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        axisLo[axis] = BoundsMin(centroidBounds, axis);
+        float extent = BoundsMax(centroidBounds, axis) - axisLo[axis];
+        axisScale[axis] = extent > 1e-6f ? binCount / extent : 0.0f;
+    }
+
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        const BuildPrim& p = prims[i];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            std::uint32_t b = std::min(binCount - 1, (std::uint32_t)((p.Centroid[axis] - axisLo[axis]) * axisScale[axis]));
+            binCounts[axis][b]++;
+            binBounds[axis][b].Grow(p.Bounds);
+        }
+    }
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (axisScale[axis] == 0.0f)
+            continue;
+
+        // ʿ  
+        float rightArea[MaxBins];
+        std::uint32_t rightCounts[MaxBins];
+        Aabb acc;
+        std::uint32_t accCount = 0;
+        for (std::uint32_t b = binCount - 1; b > 0; --b)
+        {
+            acc.Grow(binBounds[axis][b]);
+            accCount += binCounts[axis][b];
+            rightArea[b] = acc.SurfaceArea();
+            rightCounts[b] = accCount;
+        }
+
+        //  ϸ鼭  = A(L) * N(L) + A(R) * N(R)
+        acc = Aabb();
+        accCount = 0;
+        for (std::uint32_t b = 0; b < binCount - 1; ++b)
+        {
+            acc.Grow(binBounds[axis][b]);
+            accCount += binCounts[axis][b];
+            if (accCount == 0 || rightCounts[b + 1] == 0)
+                continue;
+
+            float cost = acc.SurfaceArea() * accCount + rightArea[b + 1] * rightCounts[b + 1];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = b;
+            }
+        }
+    }
+
+    //  ߽     SAHδ   ->  ʹ ũ  ڸ
+    if (bestAxis < 0)
+    {
+        if (count <= settings.MaxLeafSize * 4)
+            return 0;
+        return count / 2;
+    }
+
+    // ɰ ʴ  (  = 1, Ž  = 1   )
+    float leafCost = bounds.SurfaceArea() * count;
+    float splitCost = bounds.SurfaceArea() + bestCost;
+    if (splitCost >= leafCost && count <= settings.MaxLeafSize * 4)
+        return 0;
+
+    float lo = axisLo[bestAxis];
+    float scale = axisScale[bestAxis];
+
+    BuildPrim* mid = std::partition(prims, prims + count, [&](const BuildPrim& p)
+        {
+            std::uint32_t b = std::min(binCount - 1, (std::uint32_t)((p.Centroid[bestAxis] - lo) * scale));
+            return b <= bestBin;
+        });
+
+    std::uint32_t leftCount = (std::uint32_t)(mid - prims);
+    if (leftCount == 0 || leftCount == count)
+        return count / 2;
+
+    return leftCount;
+}
+
+//  带 4 : ڽ   ū  带  ļ ִ 4ĭ ä
+std::int32_t SceneBVH::Collapse(std::uint32_t buildIndex)
+{
+    const std::int32_t nodeIndex = (std::int32_t)mNodes.size();
+    mNodes.emplace_back();
+    for (int i = 0; i < 4; ++i)
+        ClearSlot(mNodes[nodeIndex], i);
+
+    std::uint32_t slots[4];
+    int slotCount = 0;
+
+    const BuildNode& root = mBuildNodes[buildIndex];
+    if (root.Count > 0)
+    {
+        // Ƽ갡   Ʈ:  ϳ¥ Ʈ
+        slots[slotCount++] = buildIndex;
+    }
+    else
+    {
+        slots[slotCount++] = root.Left;
+        slots[slotCount++] = root.Left + 1;
+
+        while (slotCount < 4)
+        {
+            int best = -1;
+            float bestArea = -1.0f;
+            for (int i = 0; i < slotCount; ++i)
+            {
+                const BuildNode& n = mBuildNodes[slots[i]];
+                if (n.Count == 0 && n.Bounds.SurfaceArea() > bestArea)
+                {
+                    best = i;
+                    bestArea = n.Bounds.SurfaceArea();
+                }
+            }
+            if (best < 0)
+                break;
+
+            std::uint32_t open = slots[best];
+            slots[best] = mBuildNodes[open].Left;
+            slots[slotCount++] = mBuildNodes[open].Left + 1;
+        }
+    }
+
+    for (int i = 0; i < slotCount; ++i)
+    {
+        const BuildNode& child = mBuildNodes[slots[i]];
+
+        std::int32_t childValue;
+        std::uint32_t childCount;
+        if (child.Count > 0)
+        {
+            childValue = (std::int32_t)child.First;
+            childCount = child.Count;
+        }
+        else
+        {
+            childValue = Collapse(slots[i]); // mNodes ٽ Ҵ      
+            childCount = 0;
+        }
+
+        BvhNode4& node = mNodes[nodeIndex];
+        SetSlotBounds(node, i, child.Bounds);
+        node.Child[i] = childValue;
+        node.Count[i] = childCount;
+    }
+
+    return nodeIndex;
+}
+
+// ڽ ׻ ڿ Ƿ ڿ    
+void SceneBVH::Refit()
+{
+    for (std::size_t n = mNodes.size(); n-- > 0;)
+    {
+        BvhNode4& node = mNodes[n];
+        for (int i = 0; i < 4; ++i)
+        {
+            if (node.Child[i] < 0)
+                continue;
+
+            Aabb b;
+            if (node.Count[i] > 0)
+            {
+                for (std::uint32_t k = 0; k < node.Count[i]; ++k)
+                    b.Grow(mPrimBounds[mPrimIndices[node.Child[i] + k]]);
+            }
+            else
+            {
+                b = NodeBounds(mNodes[node.Child[i]]);
+            }
+            SetSlotBounds(node, i, b);
+        }
+    }
+}
+
+Aabb SceneBVH::GetBounds()const
+{
+    return mNodes.empty() ? Aabb() : NodeBounds(mNodes[0]);
+}
+
+std::uint32_t SceneBVH::GetDepth()const
+{
+    if (mNodes.empty())
+        return 0;
+
+    // θ ׻ ̹Ƿ տ  
+    std::vector<std::uint32_t> depth(mNodes.size(), 0);
+    depth[0] = 1;
+    std::uint32_t maxDepth = 1;
+    for (std::size_t n = 0; n < mNodes.size(); ++n)
+    {
+        const BvhNode4& node = mNodes[n];
+        for (int i = 0; i < 4; ++i)
+        {
+            if (node.Child[i] >= 0 && node.Count[i] == 0)
+            {
+                depth[node.Child[i]] = depth[n] + 1;
+                maxDepth = std::max(maxDepth, depth[n] + 1);
+            }
+        }
+    }
+    return maxDepth;
+}
+
+// ---------------------------------------------------------
+// 
+// ---------------------------------------------------------
+void SceneBVH::CollectLeaf(std::uint32_t first, std::uint32_t count, std::vector<std::uint32_t>& out)const
+{
+    out.insert(out.end(), mPrimIndices.begin() + first, mPrimIndices.begin() + first + count);
+}
+
+void SceneBVH::CollectSubtree(std::int32_t nodeIndex, std::vector<std::uint32_t>& out)const
+{
+    //    ( Ʈ ȣ  ġ ʰ)
+    TraversalStack<std::int32_t> stack;
+    stack.Push(nodeIndex);
+
+    while (!stack.IsEmpty())
+    {
+        const BvhNode4& node = mNodes[stack.Pop()];
+        for (int i = 0; i < 4; ++i)
+        {
+            if (node.Child[i] < 0)
+                continue;
+            if (node.Count[i] > 0)
+                CollectLeaf(node.Child[i], node.Count[i], out);
+            else
+                stack.Push(node.Child[i]);
+        }
+    }
+}
+
+void SceneBVH::QueryFrustum(const Frustum& frustum, std::vector<std::uint32_t>& out)const
+{
+    if (mNodes.empty())
+        return;
+
+    __m128 nx[Frustum::Count], ny[Frustum::Count], nz[Frustum::Count], nd[Frustum::Count];
+    __m128 ax[Frustum::Count], ay[Frustum::Count], az[Frustum::Count];
+    for (int p = 0; p < Frustum::Count; ++p)
+    {
+        const FrustumPlane& pl = frustum.Planes[p];
+        nx[p] = _mm_set1_ps(pl.Nx); ny[p] = _mm_set1_ps(pl.Ny); nz[p] = _mm_set1_ps(pl.Nz); nd[p] = _mm_set1_ps(pl.D);
+        ax[p] = _mm_set1_ps(std::fabs(pl.Nx)); ay[p] = _mm_set1_ps(std::fabs(pl.Ny)); az[p] = _mm_set1_ps(std::fabs(pl.Nz));
+    }
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 zero = _mm_setzero_ps();
+
+    TraversalStack<std::int32_t> stack;
+    stack.Push(0);
+
+    while (!stack.IsEmpty())
+    {
+        const BvhNode4& node = mNodes[stack.Pop()];
+
+        __m128 minX = _mm_load_ps(node.MinX), maxX = _mm_load_ps(node.MaxX);
+        __m128 minY = _mm_load_ps(node.MinY), maxY = _mm_load_ps(node.MaxY);
+        __m128 minZ = _mm_load_ps(node.MinZ), maxZ = _mm_load_ps(node.MaxZ);
+        __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half), ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+        __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half), ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+        __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half), ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+        __m128 outside = zero;
+        __m128 intersecting = zero; // 鿡  ִ ĭ
+        for (int p = 0; p < Frustum::Count; ++p)
+        {
+            __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[p], cx), _mm_mul_ps(ny[p], cy)), _mm_add_ps(_mm_mul_ps(nz[p], cz), nd[p]));
+            __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax[p], ex), _mm_mul_ps(ay[p], ey)), _mm_mul_ps(az[p], ez));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, radius), zero));
+            intersecting = _mm_or_ps(intersecting, _mm_cmplt_ps(_mm_sub_ps(dist, radius), zero));
+        }
+
+        unsigned int valid = ValidMask(node);
+        unsigned int visible = ~(unsigned int)_mm_movemask_ps(outside) & valid;
+        unsigned int partial = (unsigned int)_mm_movemask_ps(intersecting);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            if (!(visible & (1u << i)))
+                continue;
+
+            if (!(partial & (1u << i)))
+            {
+                //  ̸   ʿ  ° ߰
+                if (node.Count[i] > 0)
+                    CollectLeaf(node.Child[i], node.Count[i], out);
+                else
+                    CollectSubtree(node.Child[i], out);
+            }
+            else if (node.Count[i] > 0)
+            {
+                // 鿡 ģ  Ƽ긦 ϳ ٽ Ȯ
+                for (std::uint32_t k = 0; k < node.Count[i]; ++k)
+                {
+                    std::uint32_t prim = mPrimIndices[node.Child[i] + k];
+                    const Aabb& b = mPrimBounds[prim];
+                    if (FrustumCulling::TestAabb(frustum, b.CenterX(), b.CenterY(), b.CenterZ(),
+                        0.5f * (b.MaxX - b.MinX), 0.5f * (b.MaxY - b.MinY), 0.5f * (b.MaxZ - b.MinZ)))
+                    {
+                        out.push_back(prim);
+                    }
+                }
+            }
+            else
+            {
+                stack.Push(node.Child[i]);
+            }
+        }
+    }
+}
+
+void SceneBVH::QueryOverlap(const Aabb& box, std::vector<std::uint32_t>& out)const
+{
+    if (mNodes.empty())
+        return;
+
+    const __m128 qMinX = _mm_set1_ps(box.MinX), qMaxX = _mm_set1_ps(box.MaxX);
+    const __m128 qMinY = _mm_set1_ps(box.MinY), qMaxY = _mm_set1_ps(box.MaxY);
+    const __m128 qMinZ = _mm_set1_ps(box.MinZ), qMaxZ = _mm_set1_ps(box.MaxZ);
+
+    TraversalStack<std::int32_t> stack;
+    stack.Push(0);
+
+    while (!stack.IsEmpty())
+    {
+        const BvhNode4& node = mNodes[stack.Pop()];
+
+        __m128 hit = _mm_and_ps(
+            _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.MinX), qMaxX), _mm_cmpge_ps(_mm_load_ps(node.MaxX), qMinX)),
+            _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.MinY), qMaxY), _mm_cmpge_ps(_mm_load_ps(node.MaxY), qMinY)));
+        hit = _mm_and_ps(hit,
+            _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.MinZ), qMaxZ), _mm_cmpge_ps(_mm_load_ps(node.MaxZ), qMinZ)));
+
+        unsigned int mask = (unsigned int)_mm_movemask_ps(hit) & ValidMask(node);
+        for (int i = 0; i < 4; ++i)
+        {
+            if (!(mask & (1u << i)))
+                continue;
+
+            if (node.Count[i] > 0)
+            {
+                //   Ƽ ϳ ٽ Ȯ
+                for (std::uint32_t k = 0; k < node.Count[i]; ++k)
+                {
+                    std::uint32_t prim = mPrimIndices[node.Child[i] + k];
+                    if (mPrimBounds[prim].Overlaps(box))
+                        out.push_back(prim);
+                }
+            }
+            else
+            {
+                stack.Push(node.Child[i]);
+            }
+        }
+    }
+}
+
+bool SceneBVH::RayCast(const Ray& ray, float tMax, std::uint32_t& outPrim, float& outT)const
+{
+    // Ƽ AABB  ( ׽Ʈ)
+    return RayCast(ray, tMax, [this](std::uint32_t prim, const Ray& r, float limit) -> float
+        {
+            const Aabb& b = mPrimBounds[prim];
+            float tmin = 0.0f, tmax = limit;
+            const float o[3] = { r.OriginX, r.OriginY, r.OriginZ };
+            const float d[3] = { r.DirX, r.DirY, r.DirZ };
+            const float lo[3] = { b.MinX, b.MinY, b.MinZ };
+            const float hi[3] = { b.MaxX, b.MaxY, b.MaxZ };
+            for (int a = 0; a < 3; ++a)
+            {
+                if (std::fabs(d[a]) < 1e-20f)
+                {
+                    if (o[a] < lo[a] || o[a] > hi[a])
+                        return -1.0f;
+                    continue;
+                }
+                float inv = 1.0f / d[a];
+                float t0 = (lo[a] - o[a]) * inv;
+                float t1 = (hi[a] - o[a]) * inv;
+                if (t0 > t1) std::swap(t0, t1);
+                tmin = std::max(tmin, t0);
+                tmax = std::min(tmax, t1);
+                if (tmin > tmax)
+                    return -1.0f;
+            }
+            return tmin;
+        }, outPrim, outT);
+}
+
+bool SceneBVH::RayCast(const Ray& ray, float tMax, const RayPrimitiveTest& test, std::uint32_t& outPrim, float& outT)const
+{
+    return Cast(ray, 0.0f, tMax, test, outPrim, outT);
+}
+
+bool SceneBVH::SphereCast(const Ray& ray, float radius, float tMax, std::uint32_t& outPrim, float& outT)const
+{
+    return Cast(ray, radius, tMax, [this, radius](std::uint32_t prim, const Ray& r, float limit) -> float
+        {
+            return SweepTests::SphereAabb(r, radius, mPrimBounds[prim], limit);
+        }, outPrim, outT);
+}
+
+bool SceneBVH::SphereCast(const Ray& ray, float radius, float tMax, const RayPrimitiveTest& test, std::uint32_t& outPrim, float& outT)const
+{
+    return Cast(ray, radius, tMax, test, outPrim, outT);
+}
+
+bool SceneBVH::Cast(const Ray& ray, float radius, float tMax, const RayPrimitiveTest& test, std::uint32_t& outPrim, float& outT)const
+{
+    if (mNodes.empty())
+        return false;
+
+    //   0̸  Ѵ ->    ٲ㼭 NaN 
+    auto safeInv = [](float d)
+    {
+        const float eps = 1e-20f;
+        if (std::fabs(d) < eps)
+            d = d < 0.0f ? -eps : eps;
+        return 1.0f / d;
+    };
+
+    const __m128 ox = _mm_set1_ps(ray.OriginX), oy = _mm_set1_ps(ray.OriginY), oz = _mm_set1_ps(ray.OriginZ);
+    const __m128 ix = _mm_set1_ps(safeInv(ray.DirX)), iy = _mm_set1_ps(safeInv(ray.DirY)), iz = _mm_set1_ps(safeInv(ray.DirZ));
+    const __m128 r = _mm_set1_ps(radius); //  ̸ ڽ AABB  ŭ Ű (̸ 0)
+
+    float best = tMax;
+    bool found = false;
+
+    struct Entry { std::int32_t Node; float TEnter; };
+    TraversalStack<Entry> stack;
+    stack.Push({ 0, 0.0f });
+
+    while (!stack.IsEmpty())
+    {
+        Entry e = stack.Pop();
+        if (e.TEnter > best)
+            continue;
+
+        const BvhNode4& node = mNodes[e.Node];
+
+        __m128 t0x = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(_mm_load_ps(node.MinX), r), ox), ix);
+        __m128 t1x = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_load_ps(node.MaxX), r), ox), ix);
+        __m128 t0y = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(_mm_load_ps(node.MinY), r), oy), iy);
+        __m128 t1y = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_load_ps(node.MaxY), r), oy), iy);
+        __m128 t0z = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(_mm_load_ps(node.MinZ), r), oz), iz);
+        __m128 t1z = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_load_ps(node.MaxZ), r), oz), iz);
+
+        __m128 tEnter = _mm_max_ps(_mm_max_ps(_mm_min_ps(t0x, t1x), _mm_min_ps(t0y, t1y)),
+            _mm_max_ps(_mm_min_ps(t0z, t1z), _mm_setzero_ps()));
+        __m128 tExit = _mm_min_ps(_mm_min_ps(_mm_max_ps(t0x, t1x), _mm_max_ps(t0y, t1y)),
+            _mm_min_ps(_mm_max_ps(t0z, t1z), _mm_set1_ps(best)));
+
+        unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_cmple_ps(tEnter, tExit)) & ValidMask(node);
+        if (mask == 0)
+            continue;
+
+        alignas(16) float enter[4];
+        _mm_store_ps(enter, tEnter);
+
+        //  ڽĺ 湮ϵ  ͺ ÿ  (ִ 4  )
+        int order[4];
+        int n = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (!(mask & (1u << i)))
+                continue;
+
+            int k = n++;
+            while (k > 0 && enter[order[k - 1]] < enter[i])
+            {
+                order[k] = order[k - 1];
+                --k;
+            }
+            order[k] = i;
+        }
+
+        for (int k = 0; k < n; ++k)
+        {
+            int i = order[k];
+            if (node.Count[i] > 0)
+            {
+                //  ٷ ó (   ʿ )
+                for (std::uint32_t p = 0; p < node.Count[i]; ++p)
+                {
+                    std::uint32_t prim = mPrimIndices[node.Child[i] + p];
+                    float t = test(prim, ray, best);
+                    if (t >= 0.0f && t <= best)
+                    {
+                        best = t;
+                        outPrim = prim;
+                        found = true;
+                    }
+                }
+            }
+            else
+            {
+                stack.Push({ node.Child[i], enter[i] });
+            }
+        }
+    }
+
+    if (found)
+        outT = best;
+    return found;
+}
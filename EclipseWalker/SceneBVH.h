@@ -0,0 +1,105 @@
+#pragma once
+#include "Bounds.h"
+#include "FrustumCulling.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// ==========================================================
+//  BVH (AABB )
+// - : binned SAH  Ʈ -> 4   źȭ
+//   Ƽ갡    JobSystem Ŀ鿡  
+// -  ڽ 4 AABB SoA  ־ SSE   4 
+// -  Ʈ UpdatePrimitive()  Refit() ( ״, ٿ常 )
+// - : ü /  /   / AABB ħ
+// ==========================================================
+
+struct alignas(64) BvhNode4
+{
+    float MinX[4], MinY[4], MinZ[4];
+    float MaxX[4], MaxY[4], MaxZ[4];
+
+    //  : ڽ  ε, Count = 0
+    //     : Ƽ ε 迭  ġ, Count = 
+    //  ĭ   : Child = -1
+    std::int32_t Child[4];
+    std::uint32_t Count[4];
+};
+
+class SceneBVH
+{
+public:
+    struct BuildSettings
+    {
+        std::uint32_t MaxLeafSize = 4;
+        std::uint32_t BinCount = 16;            // ึ SAH Ŷ  (ִ 32)
+        std::uint32_t ParallelThreshold = 16384; // ̺ ū  ڽ 带 ķ
+        bool Parallel = true;
+    };
+
+    //  ǿ: Ƽ  ϸ t, ƴϸ  ִ Լ
+    using RayPrimitiveTest = std::function<float(std::uint32_t prim, const Ray& ray, float tMax)>;
+
+    void Build(const Aabb* primBounds, std::uint32_t count, const BuildSettings& settings);
+    void Build(const std::vector<Aabb>& primBounds) { Build(primBounds.data(), (std::uint32_t)primBounds.size(), BuildSettings()); }
+    void Clear();
+
+    //  Ʈ
+    void UpdatePrimitive(std::uint32_t prim, const Aabb& bounds) { mPrimBounds[prim] = bounds; }
+    void Refit();
+
+    //  ( out ڿ )
+    void QueryFrustum(const Frustum& frustum, std::vector<std::uint32_t>& out)const;
+    void QueryOverlap(const Aabb& box, std::vector<std::uint32_t>& out)const;
+
+    //    ã (test  Ƽ AABB ü )
+    bool RayCast(const Ray& ray, float tMax, std::uint32_t& outPrim, float& outT)const;
+    bool RayCast(const Ray& ray, float tMax, const RayPrimitiveTest& test, std::uint32_t& outPrim, float& outT)const;
+
+    //  radius      ó   ( radius ŭ Ű )
+    // test   Ƽ AABB  Ȯ ձ   (SweepTests::SphereAabb)
+    bool SphereCast(const Ray& ray, float radius, float tMax, std::uint32_t& outPrim, float& outT)const;
+    bool SphereCast(const Ray& ray, float radius, float tMax, const RayPrimitiveTest& test, std::uint32_t& outPrim, float& outT)const;
+
+    std::uint32_t GetPrimitiveCount()const { return (std::uint32_t)mPrimBounds.size(); }
+    std::uint32_t GetNodeCount()const { return (std::uint32_t)mNodes.size(); }
+    std::uint32_t GetDepth()const; // 4  ܰ  (Ʈ  1)
+    const Aabb& GetPrimitiveBounds(std::uint32_t prim)const { return mPrimBounds[prim]; }
+    Aabb GetBounds()const;
+
+private:
+    //  ߿  Ƽ 纻 (  ° ġؼ  ٵǰ )
+    struct BuildPrim
+    {
+        Aabb Bounds;
+        float Centroid[3];
+        std::uint32_t Index;
+    };
+
+    //  ߿   
+    struct BuildNode
+    {
+        Aabb Bounds;
+        std::uint32_t Left = 0;  // ڽ Left, Left + 1
+        std::uint32_t First = 0;
+        std::uint32_t Count = 0; // > 0 ̸ 
+    };
+
+    void Subdivide(std::uint32_t nodeIndex, std::uint32_t first, std::uint32_t count, const BuildSettings& settings);
+    std::uint32_t FindSplit(std::uint32_t first, std::uint32_t count, const Aabb& bounds, const BuildSettings& settings);
+    std::int32_t Collapse(std::uint32_t buildIndex);
+    void CollectSubtree(std::int32_t nodeIndex, std::vector<std::uint32_t>& out)const;
+    void CollectLeaf(std::uint32_t first, std::uint32_t count, std::vector<std::uint32_t>& out)const;
+    bool Cast(const Ray& ray, float radius, float tMax, const RayPrimitiveTest& test, std::uint32_t& outPrim, float& outT)const;
+
+private:
+    std::vector<Aabb> mPrimBounds;
+    std::vector<std::uint32_t> mPrimIndices; //  Ű Ƽ ȣ
+    std::vector<BvhNode4> mNodes;            // [0] Ʈ, θ ׻ ڽĺ տ 
+
+    //  ӽ 
+    std::vector<BuildPrim> mBuildPrims;
+    std::vector<BuildNode> mBuildNodes;
+    std::atomic<std::uint32_t> mBuildNodeCount{ 0 };
+};
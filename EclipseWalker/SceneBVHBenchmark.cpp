@@ -0,0 +1,327 @@
+#include "SceneBVHBenchmark.h"
+#include "SceneBVH.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    //  ˻   ( ϳ Ƽ )
+    constexpr int CheckedRays = 64;
+
+    //  Ʈ: 2^-40 ~ 2^120  161  (float  ġ ʴ ),  20 
+    constexpr int DeepTreeMinExponent = -40;
+    constexpr int DeepTreeMaxExponent = 120;
+    constexpr std::uint32_t DeepTreeCopies = 20;
+
+    //  +Z  45   (  Ծ, D3D  )
+    Frustum MakeTestFrustum()
+    {
+        const float fovY = 0.785f, aspect = 16.0f / 9.0f, zn = 1.0f, zf = 1000.0f;
+        const float h = 1.0f / std::tan(0.5f * fovY);
+        const float w = h / aspect;
+        const float q = zf / (zf - zn);
+
+        const float viewProj[16] =
+        {
+            w,    0.0f, 0.0f,     0.0f,
+            0.0f, h,    0.0f,     0.0f,
+            0.0f, 0.0f, q,        1.0f,
+            0.0f, 0.0f, -zn * q,  0.0f,
+        };
+
+        Frustum frustum;
+        FrustumCulling::ExtractPlanes(viewProj, frustum);
+        return frustum;
+    }
+
+    //   Ʈ 翡 Ƿ ؼ 
+    bool SameSet(std::vector<std::uint32_t> a, std::vector<std::uint32_t> b)
+    {
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        return a == b;
+    }
+
+    // SceneBVH::QueryFrustum     
+    std::vector<std::uint32_t> BruteFrustum(const std::vector<Aabb>& prims, const Frustum& frustum)
+    {
+        std::vector<std::uint32_t> out;
+        for (std::uint32_t i = 0; i < (std::uint32_t)prims.size(); ++i)
+        {
+            const Aabb& b = prims[i];
+            if (FrustumCulling::TestAabb(frustum, b.CenterX(), b.CenterY(), b.CenterZ(),
+                0.5f * (b.MaxX - b.MinX), 0.5f * (b.MaxY - b.MinY), 0.5f * (b.MaxZ - b.MinZ)))
+            {
+                out.push_back(i);
+            }
+        }
+        return out;
+    }
+
+    std::vector<std::uint32_t> BruteOverlap(const std::vector<Aabb>& prims, const Aabb& box)
+    {
+        std::vector<std::uint32_t> out;
+        for (std::uint32_t i = 0; i < (std::uint32_t)prims.size(); ++i)
+        {
+            if (prims[i].Overlaps(box))
+                out.push_back(i);
+        }
+        return out;
+    }
+
+    // SceneBVH::RayCast ⺻  ( ׽Ʈ)   ,   t ( )
+    float BruteRay(const std::vector<Aabb>& prims, const Ray& r)
+    {
+        float best = -1.0f;
+        const float o[3] = { r.OriginX, r.OriginY, r.OriginZ };
+        const float d[3] = { r.DirX, r.DirY, r.DirZ };
+        for (const Aabb& b : prims)
+        {
+            float tmin = 0.0f, tmax = FLT_MAX;
+            const float lo[3] = { b.MinX, b.MinY, b.MinZ };
+            const float hi[3] = { b.MaxX, b.MaxY, b.MaxZ };
+            bool hit = true;
+            for (int a = 0; a < 3 && hit; ++a)
+            {
+                if (std::fabs(d[a]) < 1e-20f)
+                {
+                    hit = o[a] >= lo[a] && o[a] <= hi[a];
+                    continue;
+                }
+                float inv = 1.0f / d[a];
+                float t0 = (lo[a] - o[a]) * inv;
+                float t1 = (hi[a] - o[a]) * inv;
+                if (t0 > t1) std::swap(t0, t1);
+                tmin = std::max(tmin, t0);
+                tmax = std::min(tmax, t1);
+                hit = tmin <= tmax;
+            }
+            if (hit && (best < 0.0f || tmin < best))
+                best = tmin;
+        }
+        return best;
+    }
+
+    bool RayMatches(const SceneBVH& bvh, const std::vector<Aabb>& prims, const Ray& ray)
+    {
+        std::uint32_t prim = 0;
+        float t = 0.0f;
+        const bool found = bvh.RayCast(ray, FLT_MAX, prim, t);
+        const float expected = BruteRay(prims, ray);
+        return found ? (expected >= 0.0f && t == expected) : expected < 0.0f;
+    }
+}
+
+namespace SceneBVHBenchmark
+{
+    SceneBVHBenchmarkResult Run(std::uint32_t primitiveCount, std::uint32_t seed)
+    {
+        SceneBVHBenchmarkResult result;
+        result.PrimitiveCount = primitiveCount;
+
+        // 1. 2km x 200m x 2km ȿ ũ 0.2 ~ 6m ¥ ڽ Ѹ
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+        std::uniform_real_distribution<float> extent(0.1f, 3.0f);
+
+        std::vector<Aabb> prims(primitiveCount);
+        for (Aabb& b : prims)
+        {
+            float x = position(rng), y = position(rng) * 0.1f, z = position(rng);
+            b = Aabb::FromCenterExtent(x, y, z, extent(rng), extent(rng), extent(rng));
+        }
+
+        // 2. 
+        SceneBVH bvh;
+        SceneBVH::BuildSettings settings;
+
+        settings.Parallel = false;
+        Clock::time_point t0 = Clock::now();
+        bvh.Build(prims.data(), primitiveCount, settings);
+        Clock::time_point t1 = Clock::now();
+        result.BuildMs = ElapsedMs(t0, t1);
+
+        settings.Parallel = true;
+        t0 = Clock::now();
+        bvh.Build(prims.data(), primitiveCount, settings);
+        t1 = Clock::now();
+        result.ParallelBuildMs = ElapsedMs(t0, t1);
+        result.NodeCount = bvh.GetNodeCount();
+
+        // 3. ü
+        std::vector<std::uint32_t> hits;
+        hits.reserve(primitiveCount);
+        const Frustum frustum = MakeTestFrustum();
+
+        t0 = Clock::now();
+        bvh.QueryFrustum(frustum, hits);
+        t1 = Clock::now();
+        result.FrustumQueryMs = ElapsedMs(t0, t1);
+        result.FrustumHits = (std::uint32_t)hits.size();
+        if (!SameSet(hits, BruteFrustum(prims, frustum)))
+            ++result.FrustumMismatches;
+
+        // 4. ħ (ݰ 50m ), ð    Ǹ  ˻ 
+        const int overlapQueries = 256;
+        std::vector<Aabb> boxes(overlapQueries);
+        for (Aabb& box : boxes)
+            box = Aabb::FromCenterExtent(position(rng), 0.0f, position(rng), 50.0f, 50.0f, 50.0f);
+
+        t0 = Clock::now();
+        for (const Aabb& box : boxes)
+        {
+            hits.clear();
+            bvh.QueryOverlap(box, hits);
+        }
+        t1 = Clock::now();
+        result.OverlapQueryUs = ElapsedMs(t0, t1) * 1000.0 / overlapQueries;
+
+        for (const Aabb& box : boxes)
+        {
+            hits.clear();
+            bvh.QueryOverlap(box, hits);
+            if (!SameSet(hits, BruteOverlap(prims, box)))
+                ++result.OverlapMismatches;
+        }
+
+        // 5.  Ʒ   (ŷ  ),     ˻
+        const int rayCount = 10000;
+        std::vector<Ray> rays(rayCount);
+        for (Ray& ray : rays)
+        {
+            ray.OriginX = position(rng); ray.OriginY = 200.0f; ray.OriginZ = position(rng);
+            ray.DirX = position(rng) * 0.001f; ray.DirY = -1.0f; ray.DirZ = position(rng) * 0.001f;
+        }
+
+        std::uint32_t prim = 0;
+        float t = 0.0f;
+        t0 = Clock::now();
+        for (const Ray& ray : rays)
+            bvh.RayCast(ray, FLT_MAX, prim, t);
+        t1 = Clock::now();
+        result.RayCastUs = ElapsedMs(t0, t1) * 1000.0 / rayCount;
+
+        for (int i = 0; i < CheckedRays; ++i)
+        {
+            if (!RayMatches(bvh, prims, rays[i]))
+                ++result.RayMismatches;
+        }
+
+        // 6.  1m ű  -> ü ٿ ħ ǰ ű ġ ̾ 
+        Aabb movedBounds;
+        for (std::uint32_t i = 0; i < primitiveCount; ++i)
+        {
+            prims[i].MinX += 1.0f; prims[i].MaxX += 1.0f;
+            bvh.UpdatePrimitive(i, prims[i]);
+            movedBounds.Grow(prims[i]);
+        }
+        t0 = Clock::now();
+        bvh.Refit();
+        t1 = Clock::now();
+        result.RefitMs = ElapsedMs(t0, t1);
+
+        const Aabb refitBounds = bvh.GetBounds();
+        if (refitBounds.MinX != movedBounds.MinX || refitBounds.MaxX != movedBounds.MaxX ||
+            refitBounds.MinY != movedBounds.MinY || refitBounds.MaxY != movedBounds.MaxY ||
+            refitBounds.MinZ != movedBounds.MinZ || refitBounds.MaxZ != movedBounds.MaxZ)
+        {
+            ++result.RefitMismatches;
+        }
+        for (int i = 0; i < 32; ++i)
+        {
+            hits.clear();
+            bvh.QueryOverlap(boxes[i], hits);
+            if (!SameSet(hits, BruteOverlap(prims, boxes[i])))
+                ++result.RefitMismatches;
+        }
+
+        result.Valid = result.FrustumMismatches == 0 && result.OverlapMismatches == 0 &&
+            result.RayMismatches == 0 && result.RefitMismatches == 0;
+        return result;
+    }
+
+    SceneBVHDeepTreeResult RunDeepTree()
+    {
+        // 1. x = -2^k    DeepTreeCopies :    ù Ŷ  SAH   ܰ迡   
+        //    (     ÿ  ä 罽  )
+        std::vector<Aabb> prims;
+        for (int k = DeepTreeMinExponent; k <= DeepTreeMaxExponent; ++k)
+        {
+            for (std::uint32_t c = 0; c < DeepTreeCopies; ++c)
+                prims.push_back(Aabb::FromCenterExtent(-std::ldexp(1.0f, k), 0.0f, 10.0f, 1e-6f, 1e-6f, 1e-6f));
+        }
+
+        SceneBVHDeepTreeResult result;
+        result.PrimitiveCount = (std::uint32_t)prims.size();
+
+        SceneBVH bvh;
+        SceneBVH::BuildSettings settings;
+        settings.Parallel = false;
+        settings.MaxLeafSize = 1;
+        bvh.Build(prims.data(), result.PrimitiveCount, settings);
+        result.Depth = bvh.GetDepth();
+
+        // 2.   ħ /  ü /   (  ) ڸ  
+        std::vector<std::uint32_t> hits;
+        const Aabb all = bvh.GetBounds();
+        bvh.QueryOverlap(all, hits);
+        if (!SameSet(hits, BruteOverlap(prims, all)))
+            ++result.Mismatches;
+
+        hits.clear();
+        const Frustum frustum = MakeTestFrustum();
+        bvh.QueryFrustum(frustum, hits);
+        if (!SameSet(hits, BruteFrustum(prims, frustum)))
+            ++result.Mismatches;
+
+        Ray ray;
+        ray.OriginX = 10.0f; ray.OriginY = 0.0f; ray.OriginZ = 10.0f;
+        ray.DirX = -1.0f; ray.DirY = 0.0f; ray.DirZ = 0.0f;
+        if (!RayMatches(bvh, prims, ray))
+            ++result.Mismatches;
+
+        result.Valid = result.Mismatches == 0;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[SceneBVH] prims | nodes | build ms | par build ms | refit ms | frustum ms (hits) | overlap us | ray us | valid\n";
+
+        bool valid = true;
+        for (std::uint32_t count : { 10000u, 100000u, 1000000u })
+        {
+            SceneBVHBenchmarkResult r = Run(count);
+            valid = valid && r.Valid;
+
+            char line[256];
+            snprintf(line, sizeof(line), "%8u | %7u | %8.2f | %8.2f | %7.2f | %7.3f (%u) | %7.2f | %6.3f | %s\n",
+                r.PrimitiveCount, r.NodeCount, r.BuildMs, r.ParallelBuildMs, r.RefitMs,
+                r.FrustumQueryMs, r.FrustumHits, r.OverlapQueryUs, r.RayCastUs, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        SceneBVHDeepTreeResult deep = RunDeepTree();
+        valid = valid && deep.Valid;
+
+        char line[256];
+        snprintf(line, sizeof(line), "[SceneBVH] deep tree: %u prims, depth %u | valid %s\n",
+            deep.PrimitiveCount, deep.Depth, deep.Valid ? "yes" : "NO");
+        report += line;
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
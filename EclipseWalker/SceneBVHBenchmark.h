@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// SceneBVH /   (߿)
+//  AABB count  , , ü/ħ/  ð .
+//  Ȯ ( Ƽ긦 ϳ   ˻ ):
+//   1. ü / ħ  ,    t
+//   2.   ü ٿ ħ 
+//   3. SAH    ڸ  Ʈ (ȸ   迭 Ѿ  ĵ   )
+// ==========================================================
+
+struct SceneBVHBenchmarkResult
+{
+    std::uint32_t PrimitiveCount = 0;
+    std::uint32_t NodeCount = 0;
+
+    double BuildMs = 0.0;         //  
+    double ParallelBuildMs = 0.0; // JobSystem 
+    double RefitMs = 0.0;
+
+    double FrustumQueryMs = 0.0;
+    std::uint32_t FrustumHits = 0;
+    double OverlapQueryUs = 0.0;  //  1ȸ 
+    double RayCastUs = 0.0;       //  1 
+
+    //  ˻ ٸ  
+    std::uint32_t FrustumMismatches = 0;
+    std::uint32_t OverlapMismatches = 0;
+    std::uint32_t RayMismatches = 0;
+    std::uint32_t RefitMismatches = 0;
+    bool Valid = false;
+};
+
+struct SceneBVHDeepTreeResult
+{
+    std::uint32_t PrimitiveCount = 0;
+    std::uint32_t Depth = 0;            // 4  
+    std::uint32_t Mismatches = 0;       // ħ / ü /    ˻ ٸ 
+    bool Valid = false;
+};
+
+namespace SceneBVHBenchmark
+{
+    SceneBVHBenchmarkResult Run(std::uint32_t primitiveCount, std::uint32_t seed = 1);
+
+    // ߽ x   2 辿    (SAH     Ʈ )
+    SceneBVHDeepTreeResult RunDeepTree();
+
+    // 10k / 100k / 1M  ʷ  ǥ  ڿ 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,194 @@
+#include "ShaderArchive.h"
+#include "ShaderKey.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+using namespace ShaderArchiveFormat;
+
+namespace
+{
+    inline bool EntryLess(const Entry& entry, std::uint64_t key, EntryKind kind)
+    {
+        return entry.Key != key ? entry.Key < key : (std::uint32_t)entry.Kind < (std::uint32_t)kind;
+    }
+}
+
+bool ShaderArchive::Open(const std::string& path)
+{
+    Close();
+
+    if (!mFile.Open(path))
+        return false;
+
+    if (!Open(mFile.GetData(), mFile.GetSize()))
+    {
+        mFile.Close();
+        return false;
+    }
+    return true;
+}
+
+bool ShaderArchive::Open(const void* data, std::size_t size)
+{
+    mHeader = Validate(data, size);
+    if (mHeader == nullptr)
+    {
+        mEntries = nullptr;
+        mBase = nullptr;
+        return false;
+    }
+
+    mBase = static_cast<const std::uint8_t*>(data);
+    mEntries = reinterpret_cast<const Entry*>(mBase + mHeader->TableOffset);
+    return true;
+}
+
+void ShaderArchive::Close()
+{
+    mHeader = nullptr;
+    mEntries = nullptr;
+    mBase = nullptr;
+    mFile.Close();
+}
+
+ShaderLookup ShaderArchive::Find(std::uint64_t key, EntryKind kind, const void*& data, std::size_t& size)const
+{
+    data = nullptr;
+    size = 0;
+    if (mHeader == nullptr)
+        return ShaderLookup::Missing;
+
+    const Entry* end = mEntries + mHeader->EntryCount;
+    const Entry* entry = std::lower_bound(mEntries, end, key,
+        [kind](const Entry& e, std::uint64_t k) { return EntryLess(e, k, kind); });
+
+    if (entry == end || entry->Key != key || entry->Kind != kind)
+        return ShaderLookup::Missing;
+
+    const std::uint8_t* blob = mBase + entry->Offset;
+    if (ShaderHash::Hash(blob, entry->Size) != entry->ContentHash)
+        return ShaderLookup::Corrupt;
+
+    data = blob;
+    size = entry->Size;
+    return ShaderLookup::Found;
+}
+
+const Header* ShaderArchive::Validate(const void* data, std::size_t size)
+{
+    if (data == nullptr || size < sizeof(Header) || ((std::uintptr_t)data & (Alignment - 1)) != 0)
+        return nullptr;
+
+    const Header* header = static_cast<const Header*>(data);
+    if (header->Magic != Magic || header->Version != Version || header->FileSize != size)
+        return nullptr;
+
+    const std::uint64_t tableBytes = (std::uint64_t)header->EntryCount * sizeof(Entry);
+    if ((header->TableOffset & (Alignment - 1)) != 0 || header->TableOffset < sizeof(Header) ||
+        header->TableOffset > size || tableBytes > size - header->TableOffset)
+        return nullptr;
+
+    //  ̺ ,  ȿ ְ ̺ (Key, Kind)  ĵ ִ
+    const std::uint64_t dataBegin = header->TableOffset + tableBytes;
+    const Entry* entries = reinterpret_cast<const Entry*>(static_cast<const std::uint8_t*>(data) + header->TableOffset);
+    for (std::uint32_t i = 0; i < header->EntryCount; ++i)
+    {
+        const Entry& entry = entries[i];
+        if ((std::uint32_t)entry.Kind > (std::uint32_t)EntryKind::Pipeline ||
+            (entry.Offset & (Alignment - 1)) != 0 || entry.Offset < dataBegin ||
+            entry.Offset > size || entry.Size > size - entry.Offset)
+            return nullptr;
+
+        if (i > 0 && !EntryLess(entries[i - 1], entry.Key, entry.Kind))
+            return nullptr;
+    }
+
+    return header;
+}
+
+void ShaderArchiveWriter::Add(std::uint64_t key, EntryKind kind, const void* data, std::size_t size)
+{
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    mEntries[EntryId(key, (std::uint32_t)kind)].assign(bytes, bytes + size);
+}
+
+bool ShaderArchiveWriter::Contains(std::uint64_t key, EntryKind kind)const
+{
+    return mEntries.find(EntryId(key, (std::uint32_t)kind)) != mEntries.end();
+}
+
+std::vector<std::uint8_t> ShaderArchiveWriter::Build()const
+{
+    // 1. ġ (map  = ̺  )
+    Header header = {};
+    header.Magic = Magic;
+    header.Version = Version;
+    header.EntryCount = (std::uint32_t)mEntries.size();
+    header.TableOffset = AlignUp(sizeof(Header));
+
+    std::vector<Entry> entries;
+    entries.reserve(mEntries.size());
+
+    std::uint64_t offset = AlignUp(header.TableOffset + (std::uint64_t)mEntries.size() * sizeof(Entry));
+    for (const auto& [id, blob] : mEntries)
+    {
+        Entry entry = {};
+        entry.Key = id.first;
+        entry.Kind = (EntryKind)id.second;
+        entry.ContentHash = ShaderHash::Hash(blob.data(), blob.size());
+        entry.Offset = offset;
+        entry.Size = (std::uint32_t)blob.size();
+        entries.push_back(entry);
+
+        offset = AlignUp(offset + blob.size());
+    }
+    header.FileSize = offset;
+
+    // 2.  (  0)
+    std::vector<std::uint8_t> bytes((std::size_t)header.FileSize, 0);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    if (!entries.empty())
+        std::memcpy(bytes.data() + header.TableOffset, entries.data(), entries.size() * sizeof(Entry));
+
+    std::size_t index = 0;
+    for (const auto& entry : mEntries)
+    {
+        const std::vector<std::uint8_t>& blob = entry.second;
+        if (!blob.empty())
+            std::memcpy(bytes.data() + entries[index].Offset, blob.data(), blob.size());
+        ++index;
+    }
+    return bytes;
+}
+
+bool ShaderArchiveWriter::Write(const std::string& path, std::string* error)const
+{
+    const std::vector<std::uint8_t> bytes = Build();
+    const std::string tempPath = path + ".tmp";
+
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (file)
+            file.write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+        if (!file)
+        {
+            if (error != nullptr)
+                *error = "cannot write " + tempPath;
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        if (error != nullptr)
+            *error = "cannot replace " + path;
+        return false;
+    }
+    return true;
+}
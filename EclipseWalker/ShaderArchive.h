@@ -0,0 +1,120 @@
+#pragma once
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ==========================================================
+// ̴/PSO ĳ ī̺ (.ewsc,  1)
+// [Header][Entry ̺ (Key, Kind  )][ӵ]    16 Ʈ 
+// - ׸ = (Ű, ) -> . ̴ Ʈڵ,  ̹ ĳõ PSO 
+// - ޸ ؼ ̺ ̺ Ž (Ľ/ )
+// - Open  /̺  Ȯ,   ؽô Find   ׸ Ȯ
+//   (  ׸  ǵ帮 ). ؽð     
+// Ʋ  .  ٲ Version  ø (  ° õǰ ٽ ä)
+// D3D   
+// ==========================================================
+
+namespace ShaderArchiveFormat
+{
+    constexpr std::uint32_t Magic = 0x43535745; // "EWSC"
+    constexpr std::uint32_t Version = 1;
+    constexpr std::uint64_t Alignment = 16;
+
+    enum class EntryKind : std::uint32_t
+    {
+        Shader = 0,     // ϵ Ʈڵ (Ű = ShaderSourceKey::Key)
+        Pipeline = 1    // ID3D12PipelineState::GetCachedBlob (Ű = PSO  ؽ)
+    };
+
+    struct Header
+    {
+        std::uint32_t Magic;
+        std::uint32_t Version;
+        std::uint32_t EntryCount;
+        std::uint32_t Reserved;
+        std::uint64_t TableOffset;
+        std::uint64_t FileSize;
+    };
+
+    struct Entry
+    {
+        std::uint64_t Key;
+        std::uint64_t ContentHash;  // ShaderHash::Hash()
+        std::uint64_t Offset;       //  ó
+        std::uint32_t Size;
+        EntryKind Kind;
+    };
+
+    static_assert(sizeof(Header) == 32, "ShaderArchiveFormat::Header layout");
+    static_assert(sizeof(Entry) == 32, "ShaderArchiveFormat::Entry layout");
+
+    inline std::uint64_t AlignUp(std::uint64_t value)
+    {
+        return (value + Alignment - 1) & ~(Alignment - 1);
+    }
+}
+
+enum class ShaderLookup
+{
+    Missing,
+    Found,
+    Corrupt     // ׸ ִµ  ؽð ٸ
+};
+
+class ShaderArchive
+{
+public:
+    ShaderArchive() = default;
+    ShaderArchive(const ShaderArchive& rhs) = delete;
+    ShaderArchive& operator=(const ShaderArchive& rhs) = delete;
+
+    //  ų Validate  ϸ false ( ī̺ó )
+    bool Open(const std::string& path);
+    // ̹ ޸𸮿 ִ ī̺ (16 Ʈ ,  ȣϴ )
+    bool Open(const void* data, std::size_t size);
+    void Close();
+
+    bool IsOpen()const { return mHeader != nullptr; }
+
+    //  忡 ÿ ҷ 
+    ShaderLookup Find(std::uint64_t key, ShaderArchiveFormat::EntryKind kind, const void*& data, std::size_t& size)const;
+
+    std::uint32_t GetEntryCount()const { return mHeader != nullptr ? mHeader->EntryCount : 0; }
+    const ShaderArchiveFormat::Entry& GetEntry(std::uint32_t index)const { return mEntries[index]; }
+    const void* GetBlob(std::uint32_t index)const { return mBase + mEntries[index].Offset; }
+
+    // , ̺ /,   ( ؽô  )
+    static const ShaderArchiveFormat::Header* Validate(const void* data, std::size_t size);
+
+private:
+    MappedFile mFile;
+    const ShaderArchiveFormat::Header* mHeader = nullptr;
+    const ShaderArchiveFormat::Entry* mEntries = nullptr;
+    const std::uint8_t* mBase = nullptr;
+};
+
+// ī̺  (޸𸮿 Ҵٰ   )
+class ShaderArchiveWriter
+{
+public:
+    //  (Ű, )   
+    void Add(std::uint64_t key, ShaderArchiveFormat::EntryKind kind, const void* data, std::size_t size);
+    bool Contains(std::uint64_t key, ShaderArchiveFormat::EntryKind kind)const;
+    void Clear() { mEntries.clear(); }
+
+    std::uint32_t GetEntryCount()const { return (std::uint32_t)mEntries.size(); }
+
+    std::vector<std::uint8_t> Build()const;
+
+    // path + ".tmp"   ٲġ (ٰ ׾   )
+    // Windows      ٲٹǷ   ShaderArchive   Close ؾ 
+    bool Write(const std::string& path, std::string* error = nullptr)const;
+
+private:
+    using EntryId = std::pair<std::uint64_t, std::uint32_t>; // (Key, Kind) = ̺  
+    std::map<EntryId, std::vector<std::uint8_t>> mEntries;
+};
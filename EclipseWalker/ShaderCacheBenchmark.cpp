@@ -0,0 +1,207 @@
+#include "ShaderCacheBenchmark.h"
+#include "ShaderArchive.h"
+#include "ShaderKey.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using ShaderArchiveFormat::EntryKind;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    // ũ  ޸  (Ŭ嵵 ReadFunc )
+    using VirtualFiles = std::unordered_map<std::string, std::string>;
+
+    void BuildSources(std::uint32_t shaderCount, VirtualFiles& files)
+    {
+        files["shaders/common.hlsli"] =
+            "#pragma once\n"
+            "cbuffer cbPass : register(b1) { float4x4 gViewProj; };\n";
+        files["shaders/lighting.hlsli"] =
+            "#pragma once\n"
+            "#include \"common.hlsli\"\n"
+            "float3 Lambert(float3 n, float3 l) { return saturate(dot(n, l)); }\n";
+
+        for (std::uint32_t i = 0; i < shaderCount; ++i)
+        {
+            char body[256];
+            snprintf(body, sizeof(body),
+                "#include \"common.hlsli\"\n"
+                "  #  include \"lighting.hlsli\"\n"
+                "float4 PS%u(float4 p : SV_Position) : SV_Target { return float4(Lambert(p.xyz, %u.0), 1); }\n",
+                i, i);
+            files["shaders/s" + std::to_string(i) + ".hlsl"] = body;
+        }
+    }
+
+    ShaderSourceDesc MakeDesc(std::uint32_t index)
+    {
+        ShaderSourceDesc desc;
+        desc.Path = "shaders/s" + std::to_string(index) + ".hlsl";
+        desc.EntryPoint = "PS" + std::to_string(index);
+        desc.Target = "ps_5_0";
+        desc.Defines.push_back({ "USE_FOG", "1" });
+        return desc;
+    }
+
+    bool ComputeKeys(std::uint32_t shaderCount, const ShaderKey::ReadFunc& read, std::vector<std::uint64_t>& keys)
+    {
+        keys.resize(shaderCount);
+        ShaderSourceKey source;
+        for (std::uint32_t i = 0; i < shaderCount; ++i)
+        {
+            // Ŭ    󰬴 (lighting  common   )
+            if (!ShaderKey::Compute(MakeDesc(i), read, source) || source.Includes.size() != 2)
+                return false;
+            keys[i] = source.Key;
+        }
+        return true;
+    }
+}
+
+namespace ShaderCacheBenchmark
+{
+    ShaderCacheBenchmarkResult Run(std::uint32_t shaderCount, std::uint32_t blobBytes)
+    {
+        ShaderCacheBenchmarkResult result;
+        result.Shaders = shaderCount;
+        result.BlobBytes = blobBytes;
+        bool valid = true;
+
+        // 1. Ű (  ؼ )
+        VirtualFiles files;
+        BuildSources(shaderCount, files);
+        auto read = [&files](const std::string& path, std::string& contents)
+        {
+            auto it = files.find(path);
+            if (it == files.end())
+                return false;
+            contents = it->second;
+            return true;
+        };
+
+        std::vector<std::uint64_t> keys;
+        std::vector<std::uint64_t> again;
+        auto t0 = Clock::now();
+        valid &= ComputeKeys(shaderCount, read, keys);
+        auto t1 = Clock::now();
+        result.KeyUs = ElapsedMs(t0, t1) * 1000.0 / shaderCount;
+
+        valid &= ComputeKeys(shaderCount, read, again) && again == keys;
+
+        // Ŭ (common) ٲ㵵  ٲ 
+        files["shaders/common.hlsli"] += "// changed\n";
+        valid &= ComputeKeys(shaderCount, read, again);
+        for (std::uint32_t i = 0; i < shaderCount && valid; ++i)
+            valid &= again[i] != keys[i];
+
+        // 2. ¥ Ʈڵ ī̺ 
+        std::mt19937 rng(43);
+        std::vector<std::vector<std::uint8_t>> blobs(shaderCount);
+        for (std::uint32_t i = 0; i < shaderCount; ++i)
+        {
+            blobs[i].resize(blobBytes + (i % 7)); // ̰    
+            for (std::uint8_t& byte : blobs[i])
+                byte = (std::uint8_t)rng();
+        }
+
+        const std::string path = (std::filesystem::temp_directory_path() / "ShaderCacheBenchmark.ewsc").string();
+
+        t0 = Clock::now();
+        ShaderArchiveWriter writer;
+        for (std::uint32_t i = 0; i < shaderCount; ++i)
+            writer.Add(keys[i], EntryKind::Shader, blobs[i].data(), blobs[i].size());
+        valid &= writer.Write(path);
+        t1 = Clock::now();
+        result.WriteMs = ElapsedMs(t0, t1);
+
+        // 3. ؼ  +  ã
+        ShaderArchive archive;
+        t0 = Clock::now();
+        valid &= archive.Open(path);
+        t1 = Clock::now();
+        result.OpenMs = ElapsedMs(t0, t1);
+        valid &= archive.GetEntryCount() == shaderCount;
+
+        std::uint32_t found = 0;
+        t0 = Clock::now();
+        for (std::uint32_t i = 0; i < shaderCount; ++i)
+        {
+            const void* data = nullptr;
+            std::size_t size = 0;
+            if (archive.Find(keys[i], EntryKind::Shader, data, size) == ShaderLookup::Found &&
+                size == blobs[i].size() && std::memcmp(data, blobs[i].data(), size) == 0)
+                ++found;
+        }
+        t1 = Clock::now();
+        result.LookupUs = ElapsedMs(t0, t1) * 1000.0 / shaderCount;
+        valid &= found == shaderCount;
+
+        //  Ű,  ٸ Ű
+        {
+            const void* data = nullptr;
+            std::size_t size = 0;
+            valid &= archive.Find(again[0], EntryKind::Shader, data, size) == ShaderLookup::Missing;
+            valid &= archive.Find(keys[0], EntryKind::Pipeline, data, size) == ShaderLookup::Missing;
+        }
+        archive.Close();
+
+        // 4.  
+        std::vector<std::uint8_t> bytes = writer.Build();
+        result.ArchiveMB = bytes.size() / (1024.0 * 1024.0);
+        ShaderArchive damaged;
+        valid &= damaged.Open(bytes.data(), bytes.size());
+        if (damaged.IsOpen())
+        {
+            //  ׸   Ʈ
+            const ShaderArchiveFormat::Entry entry = damaged.GetEntry(damaged.GetEntryCount() / 2);
+            bytes[(std::size_t)entry.Offset + entry.Size / 2] ^= 0x01;
+
+            const void* data = nullptr;
+            std::size_t size = 0;
+            valid &= damaged.Find(entry.Key, entry.Kind, data, size) == ShaderLookup::Corrupt;
+        }
+        valid &= ShaderArchive::Validate(bytes.data(), bytes.size() - 16) == nullptr;
+
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+
+        result.Valid = valid;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[ShaderCacheBenchmark]\n";
+        report += "   shaders  blob(B)  key(us)  write(ms)  open(ms)  lookup(us)  archive(MB)  valid\n";
+
+        const std::uint32_t counts[] = { 64, 1024, 8192 };
+        bool valid = true;
+        for (std::uint32_t count : counts)
+        {
+            ShaderCacheBenchmarkResult r = Run(count, 4096);
+            valid = valid && r.Valid;
+
+            char line[160];
+            snprintf(line, sizeof(line), "%10u %8u %8.2f %10.3f %9.3f %11.3f %12.2f  %s\n",
+                r.Shaders, r.BlobBytes, r.KeyUs, r.WriteMs, r.OpenMs, r.LookupUs, r.ArchiveMB,
+                r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ̴ ĳ Ű/ī̺  (߿, D3D )
+// ̴ N  ( Ŭ    )  Ű  -> ¥ Ʈڵ ī̺ 
+// -> ޸   ->  ã ( ؽ Ȯ ) ð 
+//  Ȯ: Ű Ź , Ŭ常 ٲ㵵 Ű ٲ,
+//   Ʈ ٲٸ Corrupt , ߸  źϴ
+// ==========================================================
+
+struct ShaderCacheBenchmarkResult
+{
+    std::uint32_t Shaders = 0;
+    std::uint32_t BlobBytes = 0;       // ̴ ϳ
+
+    double KeyUs = 0.0;                // Ű ϳ (ҽ + Ŭ б/ؽ)
+    double WriteMs = 0.0;              // ī̺  
+    double OpenMs = 0.0;               //  + Validate
+    double LookupUs = 0.0;             // Find ϳ ( ؽ Ȯ )
+    double ArchiveMB = 0.0;
+
+    bool Valid = false;                // Ʒ ˻ 
+};
+
+namespace ShaderCacheBenchmark
+{
+    ShaderCacheBenchmarkResult Run(std::uint32_t shaderCount, std::uint32_t blobBytes);
+
+    // ̴ 64 / 1k / 8k ( 4KB)
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
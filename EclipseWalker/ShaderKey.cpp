@@ -0,0 +1,209 @@
+#include "ShaderKey.h"
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+namespace
+{
+    constexpr std::uint64_t Prime1 = 0x9E3779B185EBCA87ull;
+    constexpr std::uint64_t Prime2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr std::uint64_t Prime3 = 0x165667B19E3779F9ull;
+
+    inline std::uint64_t Rotl(std::uint64_t x, int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    inline std::uint64_t Round(std::uint64_t hash, std::uint64_t word)
+    {
+        word *= Prime2;
+        word = Rotl(word, 31);
+        word *= Prime1;
+        hash ^= word;
+        return Rotl(hash, 27) * Prime1 + Prime3;
+    }
+
+    inline std::uint64_t FinalMix(std::uint64_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    //   ( ) #include 
+    bool ParseIncludeLine(const char* begin, const char* end, std::string& include)
+    {
+        const char* p = begin;
+        auto skipSpace = [&p, end]() { while (p < end && (*p == ' ' || *p == '\t')) ++p; };
+
+        skipSpace();
+        if (p == end || *p != '#')
+            return false;
+        ++p;
+        skipSpace();
+
+        const std::size_t keywordLength = 7;
+        if ((std::size_t)(end - p) < keywordLength || std::memcmp(p, "include", keywordLength) != 0)
+            return false;
+        p += keywordLength;
+        skipSpace();
+
+        if (p == end || (*p != '"' && *p != '<'))
+            return false;
+        const char close = *p == '"' ? '"' : '>';
+        const char* nameBegin = ++p;
+        while (p < end && *p != close)
+            ++p;
+        if (p == end || p == nameBegin)
+            return false;
+
+        include.assign(nameBegin, p);
+        return true;
+    }
+}
+
+namespace ShaderHash
+{
+    std::uint64_t Hash(const void* data, std::size_t size, std::uint64_t seed)
+    {
+        const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+        std::uint64_t hash = seed ^ ((std::uint64_t)size * Prime1);
+
+        std::size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + i, 8);
+            hash = Round(hash, word);
+        }
+
+        if (i < size)
+        {
+            std::uint64_t word = 0;
+            std::memcpy(&word, bytes + i, size - i);
+            hash = Round(hash, word);
+        }
+
+        return FinalMix(hash);
+    }
+}
+
+namespace ShaderKey
+{
+    bool ReadFile(const std::string& path, std::string& contents)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+
+        std::ostringstream stream;
+        stream << file.rdbuf();
+        contents = stream.str();
+        return true;
+    }
+
+    bool Compute(const ShaderSourceDesc& desc, ShaderSourceKey& out, std::string* error)
+    {
+        return Compute(desc, ReadFile, out, error);
+    }
+
+    bool Compute(const ShaderSourceDesc& desc, const ReadFunc& read, ShaderSourceKey& out, std::string* error)
+    {
+        out.Key = 0;
+        out.Includes.clear();
+
+        if (!read(desc.Path, out.Source))
+        {
+            if (error != nullptr)
+                *error = "cannot read " + desc.Path;
+            return false;
+        }
+
+        // 1.  ɼ
+        ShaderKeyBuilder key;
+        key.Add(desc.EntryPoint);
+        key.Add(desc.Target);
+        key.Add((std::uint64_t)desc.Flags);
+        key.Add((std::uint64_t)desc.Defines.size());
+        for (const ShaderDefine& define : desc.Defines)
+        {
+            key.Add(define.Name);
+            key.Add(define.Value);
+        }
+
+        // 2.   + Ŭ (ʺ 켱,     = #pragma once / ȯ Ŭ)
+        key.Add(out.Source);
+
+        struct Pending
+        {
+            std::string Includer;
+            std::string Name;
+        };
+        std::vector<Pending> pending;
+        std::vector<std::string> names;
+
+        ParseIncludes(out.Source, names);
+        for (std::string& name : names)
+            pending.push_back({ desc.Path, std::move(name) });
+
+        std::unordered_set<std::string> visited;
+        std::string contents;
+        for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+            const std::string path = ResolveInclude(pending[i].Includer, pending[i].Name);
+            if (!visited.insert(path).second)
+                continue;
+
+            // Ŭ ̸(ҽ  ״)   
+            key.Add(pending[i].Name);
+            if (!read(path, contents))
+            {
+                key.Add((std::uint64_t)~0ull);
+                continue;
+            }
+            key.Add(contents);
+            out.Includes.push_back(path);
+
+            names.clear();
+            ParseIncludes(contents, names);
+            for (std::string& name : names)
+                pending.push_back({ path, std::move(name) });
+        }
+
+        out.Key = key.GetKey();
+        return true;
+    }
+
+    void ParseIncludes(const std::string& source, std::vector<std::string>& includes)
+    {
+        const char* p = source.data();
+        const char* end = p + source.size();
+        std::string include;
+
+        while (p < end)
+        {
+            const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', (std::size_t)(end - p)));
+            if (lineEnd == nullptr)
+                lineEnd = end;
+
+            if (ParseIncludeLine(p, lineEnd, include))
+                includes.push_back(include);
+
+            if (lineEnd == end)
+                break;
+            p = lineEnd + 1;
+        }
+    }
+
+    std::string ResolveInclude(const std::string& includerPath, const std::string& include)
+    {
+        const std::size_t slash = includerPath.find_last_of("/\\");
+        if (slash == std::string::npos)
+            return include;
+        return includerPath.substr(0, slash + 1) + include;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// ==========================================================
+// ̴ ĳ Ű ( )
+// Ű = ؽ(ҽ,   #include  , ũ, , Ÿ,  ÷)
+// -  ̸/ ð   ->    ο ص  Ű
+// - #include  ּ/Ǻ   ʰ ̴    (Ű   ٲ  Ʋ )
+//    ã Ŭ ""   (¥  Ϸ ˷)
+// D3D   
+// ==========================================================
+
+namespace ShaderHash
+{
+    // 64Ʈ ȣ ؽ (8Ʈ,  fmix64). ̵ 
+    std::uint64_t Hash(const void* data, std::size_t size, std::uint64_t seed = 0);
+}
+
+//    ( ̰ ̹Ƿ "ab" + "c"  "a" + "bc"  ٸ Ű)
+class ShaderKeyBuilder
+{
+public:
+    void Add(const void* data, std::size_t size) { mHash = ShaderHash::Hash(data, size, mHash); }
+    void Add(const std::string& text) { Add(text.data(), text.size()); }
+    void Add(std::uint64_t value) { Add(&value, sizeof(value)); }
+
+    std::uint64_t GetKey()const { return mHash; }
+
+private:
+    std::uint64_t mHash = 0x45575348u; // "EWSH"
+};
+
+struct ShaderDefine
+{
+    std::string Name;
+    std::string Value;
+};
+
+struct ShaderSourceDesc
+{
+    std::string Path;
+    std::vector<ShaderDefine> Defines;  //  Ű  (Ϸ ѱ  ״)
+    std::string EntryPoint;
+    std::string Target;
+    std::uint32_t Flags = 0;            // D3DCOMPILE_*
+};
+
+struct ShaderSourceKey
+{
+    std::uint64_t Key = 0;
+    std::string Source;                  //    (̰ ״ ؾ Ű )
+    std::vector<std::string> Includes;   //  Ŭ  (ó  )
+};
+
+namespace ShaderKey
+{
+    // path -> contents.   false
+    using ReadFunc = std::function<bool(const std::string& path, std::string& contents)>;
+
+    bool ReadFile(const std::string& path, std::string& contents);
+
+    //     false
+    bool Compute(const ShaderSourceDesc& desc, ShaderSourceKey& out, std::string* error = nullptr);
+    bool Compute(const ShaderSourceDesc& desc, const ReadFunc& read, ShaderSourceKey& out, std::string* error = nullptr);
+
+    // #include "x" / <x>  x  ( )
+    void ParseIncludes(const std::string& source, std::vector<std::string>& includes);
+
+    // Ŭ δ   θ  ͸  (D3D_COMPILE_STANDARD_FILE_INCLUDE  )
+    std::string ResolveInclude(const std::string& includerPath, const std::string& include);
+}
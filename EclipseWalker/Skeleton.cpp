@@ -0,0 +1,59 @@
+#include "Skeleton.h"
+#include <cassert>
+
+namespace
+{
+    //   (  0, 0, 0, 1)  .  3x3  μ, ̵ -t * inv3x3
+    Float4x4A InverseAffine(const Float4x4A& m)
+    {
+        const float* a = m.M;
+        const float c00 = a[5] * a[10] - a[6] * a[9];
+        const float c01 = a[6] * a[8] - a[4] * a[10];
+        const float c02 = a[4] * a[9] - a[5] * a[8];
+        const float det = a[0] * c00 + a[1] * c01 + a[2] * c02;
+        assert(det != 0.0f);
+        const float invDet = 1.0f / det;
+
+        Float4x4A out = Float4x4A::Identity();
+        float* r = out.M;
+        r[0] = c00 * invDet;
+        r[1] = (a[2] * a[9] - a[1] * a[10]) * invDet;
+        r[2] = (a[1] * a[6] - a[2] * a[5]) * invDet;
+        r[4] = c01 * invDet;
+        r[5] = (a[0] * a[10] - a[2] * a[8]) * invDet;
+        r[6] = (a[2] * a[4] - a[0] * a[6]) * invDet;
+        r[8] = c02 * invDet;
+        r[9] = (a[1] * a[8] - a[0] * a[9]) * invDet;
+        r[10] = (a[0] * a[5] - a[1] * a[4]) * invDet;
+
+        for (int c = 0; c < 3; ++c)
+            r[12 + c] = -(a[12] * r[c] + a[13] * r[4 + c] + a[14] * r[8 + c]);
+        return out;
+    }
+}
+
+std::uint32_t Skeleton::AddJoint(std::uint32_t parent, const JointTransform& bindLocal)
+{
+    assert(parent == NoParent || parent < GetJointCount());
+    assert(GetJointCount() < NoParent);
+
+    mParents.push_back((std::uint16_t)parent);
+    mBindLocal.push_back(bindLocal);
+    return GetJointCount() - 1;
+}
+
+void Skeleton::Finalize()
+{
+    // 1. SoA ε  (  ׵)
+    mBindPose.assign(GetSoaCount(), SoaTransform::Identity());
+    for (std::uint32_t j = 0; j < GetJointCount(); ++j)
+        AnimationPose::SetJoint(mBindPose.data(), j, mBindLocal[j]);
+
+    // 2.   ε  -> 
+    std::vector<Float4x4A> model(GetJointCount());
+    AnimationPose::LocalToModel(*this, mBindPose.data(), model.data());
+
+    mInverseBind.resize(GetJointCount());
+    for (std::uint32_t j = 0; j < GetJointCount(); ++j)
+        mInverseBind[j] = InverseAffine(model[j]);
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "AnimationPose.h"
+#include <vector>
+
+// ==========================================================
+// ̷ (  + ε )
+// -  θ ׻ տ  ߰ (LocalToModel    Ⱦ )
+// - Finalize()  ε  SoA     ε   
+//   Ű ȷƮ = ε *    -> ε  ׵
+// ==========================================================
+
+class Skeleton
+{
+public:
+    static constexpr std::uint16_t NoParent = 0xFFFF;
+
+    std::uint32_t AddJoint(std::uint32_t parent, const JointTransform& bindLocal);
+    void Finalize();
+
+    std::uint32_t GetJointCount()const { return (std::uint32_t)mParents.size(); }
+    std::uint32_t GetSoaCount()const { return AnimationPose::GetSoaCount(GetJointCount()); }
+    std::uint16_t GetParent(std::uint32_t joint)const { return mParents[joint]; }
+
+    const JointTransform& GetBindLocal(std::uint32_t joint)const { return mBindLocal[joint]; }
+    const SoaTransform* GetBindPose()const { return mBindPose.data(); }
+    const Float4x4A& GetInverseBind(std::uint32_t joint)const { return mInverseBind[joint]; }
+
+private:
+    std::vector<std::uint16_t> mParents;
+    std::vector<JointTransform> mBindLocal;
+
+    // Finalize() 
+    std::vector<SoaTransform> mBindPose;
+    std::vector<Float4x4A> mInverseBind;
+};
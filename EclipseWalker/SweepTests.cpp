@@ -0,0 +1,209 @@
+#include "SweepTests.h"
+#include <cmath>
+
+namespace
+{
+    float Dot(const float a[3], const float b[3])
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    //  vs AABB  ׽Ʈ ([0, tMax] ȿ  t,  ã )
+    float RayAabb(const Ray& ray, const Aabb& box, float tMax)
+    {
+        const float o[3] = { ray.OriginX, ray.OriginY, ray.OriginZ };
+        const float d[3] = { ray.DirX, ray.DirY, ray.DirZ };
+        const float lo[3] = { box.MinX, box.MinY, box.MinZ };
+        const float hi[3] = { box.MaxX, box.MaxY, box.MaxZ };
+
+        float tmin = 0.0f, tmax = tMax;
+        for (int a = 0; a < 3; ++a)
+        {
+            if (std::fabs(d[a]) < 1e-20f)
+            {
+                if (o[a] < lo[a] || o[a] > hi[a])
+                    return -1.0f;
+                continue;
+            }
+            float inv = 1.0f / d[a];
+            float t0 = (lo[a] - o[a]) * inv;
+            float t1 = (hi[a] - o[a]) * inv;
+            if (t0 > t1) std::swap(t0, t1);
+            tmin = std::max(tmin, t0);
+            tmax = std::min(tmax, t1);
+            if (tmin > tmax)
+                return -1.0f;
+        }
+        return tmin;
+    }
+
+    // Ʈ i     i  Max, ƴϸ Min
+    void Corner(const Aabb& box, unsigned int bits, float out[3])
+    {
+        out[0] = (bits & 1) ? box.MaxX : box.MinX;
+        out[1] = (bits & 2) ? box.MaxY : box.MinY;
+        out[2] = (bits & 4) ? box.MaxZ : box.MinZ;
+    }
+
+    // ( ã)   
+    float Nearest(float a, float b)
+    {
+        if (a < 0.0f) return b;
+        if (b < 0.0f) return a;
+        return std::min(a, b);
+    }
+}
+
+namespace SweepTests
+{
+    float RaySphere(const Ray& ray, const float c[3], float r, float tMax)
+    {
+        const float m[3] = { ray.OriginX - c[0], ray.OriginY - c[1], ray.OriginZ - c[2] };
+        const float d[3] = { ray.DirX, ray.DirY, ray.DirZ };
+
+        const float cc = Dot(m, m) - r * r;
+        if (cc <= 0.0f)
+            return 0.0f; // ̹ 
+
+        const float b = Dot(m, d);
+        if (b >= 0.0f)
+            return -1.0f; // ־ 
+
+        const float a = Dot(d, d);
+        const float disc = b * b - a * cc;
+        if (disc < 0.0f)
+            return -1.0f;
+
+        const float t = (-b - std::sqrt(disc)) / a;
+        return t <= tMax ? t : -1.0f;
+    }
+
+    float RayCapsule(const Ray& ray, const float a[3], const float b[3], float r, float tMax)
+    {
+        const float ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+        const float ao[3] = { ray.OriginX - a[0], ray.OriginY - a[1], ray.OriginZ - a[2] };
+        const float d[3] = { ray.DirX, ray.DirY, ray.DirZ };
+
+        const float dd = Dot(ab, ab);
+        if (dd < 1e-12f)
+            return RaySphere(ray, a, r, tMax);
+
+        // 1.   ( ab)  : A t^2 + 2B t + C = 0
+        const float m = Dot(ao, ab);
+        const float n = Dot(d, ab);
+        const float dlen = Dot(d, d);
+        const float A = dd * dlen - n * n;
+        const float B = dd * Dot(ao, d) - n * m;
+        const float C = dd * (Dot(ao, ao) - r * r) - m * m;
+
+        // 2.   ̰ų   ̸      
+        if (C <= 0.0f || A <= 1e-6f * dd * dlen)
+        {
+            if (C <= 0.0f && m >= 0.0f && m <= dd)
+                return 0.0f; // ĸ  (ȣϴ ʿ ɷ  ϰ)
+            return Nearest(RaySphere(ray, a, r, tMax), RaySphere(ray, b, r, tMax));
+        }
+
+        const float disc = B * B - A * C;
+        if (disc < 0.0f)
+            return -1.0f;
+
+        const float t = (-B - std::sqrt(disc)) / A;
+
+        // 3.    ̸    (   ̶  ġ  ħ)
+        const float s = m + t * n;
+        if (s < 0.0f)
+            return RaySphere(ray, a, r, tMax);
+        if (s > dd)
+            return RaySphere(ray, b, r, tMax);
+
+        return (t >= 0.0f && t <= tMax) ? t : -1.0f;
+    }
+
+    float SphereAabb(const Ray& ray, float radius, const Aabb& box, float tMax)
+    {
+        // 1. ó ħ
+        if (DistanceSq(box, ray.OriginX, ray.OriginY, ray.OriginZ) <= radius * radius)
+            return 0.0f;
+
+        // 2. radius ŭ Ű ڿ  (ձ ں ũų    )
+        const float t = RayAabb(ray, box.Expanded(radius), tMax);
+        if (t < 0.0f)
+            return -1.0f;
+
+        // 3.        (u = Min  , v = Max  ŭ)
+        const float px = ray.OriginX + ray.DirX * t;
+        const float py = ray.OriginY + ray.DirY * t;
+        const float pz = ray.OriginZ + ray.DirZ * t;
+
+        unsigned int u = 0, v = 0;
+        if (px < box.MinX) u |= 1;
+        if (px > box.MaxX) v |= 1;
+        if (py < box.MinY) u |= 2;
+        if (py > box.MaxY) v |= 2;
+        if (pz < box.MinZ) u |= 4;
+        if (pz > box.MaxZ) v |= 4;
+
+        const unsigned int mask = u | v;
+        const unsigned int outside = (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1);
+
+        //  : Ű ڿ 
+        if (outside <= 1)
+            return t;
+
+        float c[3];
+        Corner(box, v, c);
+
+        // 𼭸 :  𼭸 ĸ
+        if (outside == 2)
+        {
+            const unsigned int freeAxis = ~mask & 7;
+            float e[3];
+            Corner(box, v | freeAxis, e);
+            return RayCapsule(ray, c, e, radius, tMax);
+        }
+
+        //  :    𼭸 ĸ 3    
+        float best = -1.0f;
+        for (unsigned int axis = 1; axis <= 4; axis <<= 1)
+        {
+            float e[3];
+            Corner(box, v ^ axis, e);
+            best = Nearest(best, RayCapsule(ray, c, e, radius, tMax));
+        }
+        return best;
+    }
+
+    float SphereBox(const Ray& ray, float radius, const float world[16],
+        float extentX, float extentY, float extentZ, float tMax)
+    {
+        //    (   )   ű     ũ⿡
+        const float extent[3] = { extentX, extentY, extentZ };
+        const float rel[3] = { ray.OriginX - world[12], ray.OriginY - world[13], ray.OriginZ - world[14] };
+        const float dir[3] = { ray.DirX, ray.DirY, ray.DirZ };
+
+        float o[3], d[3], h[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const float* axis = world + i * 4;
+            const float len = std::sqrt(Dot(axis, axis));
+            const float inv = len > 0.0f ? 1.0f / len : 0.0f;
+            o[i] = Dot(rel, axis) * inv;
+            d[i] = Dot(dir, axis) * inv;
+            h[i] = extent[i] * len;
+        }
+
+        Ray local;
+        local.OriginX = o[0]; local.OriginY = o[1]; local.OriginZ = o[2];
+        local.DirX = d[0]; local.DirY = d[1]; local.DirZ = d[2];
+        return SphereAabb(local, radius, Aabb::FromCenterExtent(0.0f, 0.0f, 0.0f, h[0], h[1], h[2]), tMax);
+    }
+
+    float DistanceSq(const Aabb& box, float x, float y, float z)
+    {
+        const float dx = std::max(std::max(box.MinX - x, x - box.MaxX), 0.0f);
+        const float dy = std::max(std::max(box.MinY - y, y - box.MaxY), 0.0f);
+        const float dz = std::max(std::max(box.MinZ - z, z - box.MaxZ), 0.0f);
+        return dx * dx + dy * dy + dz * dz;
+    }
+}
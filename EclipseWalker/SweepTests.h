@@ -0,0 +1,30 @@
+#pragma once
+#include "Bounds.h"
+
+// ==========================================================
+//  (̴ )  
+// -   : ߽ Origin + Dir * t  ̴  radius  ó  t
+//   (Dir  ȭ  ص , t  Dir  .  ã )
+// - ۺ   0
+// -  vs AABB  Ȯ ձ  (AABB  radius ŭ Ű ڿ 𼭸/ ĸ ٽ)
+// SceneBVH  SphereCast, ī޶ 浹 
+// ==========================================================
+
+namespace SweepTests
+{
+    // () vs  (߽ c,  r)
+    float RaySphere(const Ray& ray, const float c[3], float r, float tMax);
+
+    // () vs ĸ ( a-b,  r).   ĸ ̾ 
+    float RayCapsule(const Ray& ray, const float a[3], const float b[3], float r, float tMax);
+
+    //  vs AABB
+    float SphereAabb(const Ray& ray, float radius, const Aabb& box, float tMax);
+
+    //  vs ȸ  (world =  켱 4x4,   Ծ,  .  ڴ [-extent, extent])
+    float SphereBox(const Ray& ray, float radius, const float world[16],
+        float extentX, float extentY, float extentZ, float tMax);
+
+    //  AABB  Ÿ  (̸ 0)
+    float DistanceSq(const Aabb& box, float x, float y, float z);
+}
@@ -0,0 +1,328 @@
+#include "TlsfAllocator.h"
+#include <algorithm>
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+    inline std::uint32_t BitScanForward32(std::uint32_t v)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, v);
+        return (std::uint32_t)index;
+#else
+        return (std::uint32_t)__builtin_ctz(v);
+#endif
+    }
+
+    inline std::uint32_t BitScanForward64(std::uint64_t v)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, v);
+        return (std::uint32_t)index;
+#else
+        return (std::uint32_t)__builtin_ctzll(v);
+#endif
+    }
+
+    inline std::uint32_t BitScanReverse32(std::uint32_t v)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse(&index, v);
+        return (std::uint32_t)index;
+#else
+        return 31u - (std::uint32_t)__builtin_clz(v);
+#endif
+    }
+
+    inline std::uint32_t BitScanReverse64(std::uint64_t v)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, v);
+        return (std::uint32_t)index;
+#else
+        return 63u - (std::uint32_t)__builtin_clzll(v);
+#endif
+    }
+}
+
+TlsfAllocator::TlsfAllocator(std::uint64_t capacity, std::uint64_t granularity)
+    : mGranularity(granularity)
+{
+    assert(granularity != 0 && (granularity & (granularity - 1)) == 0);
+
+    for (std::uint32_t fl = 0; fl < FlCount; ++fl)
+        for (std::uint32_t sl = 0; sl < SlCount; ++sl)
+            mFreeHeads[fl][sl] = Null;
+
+    // 뷮 granularity  
+    const std::uint64_t units = capacity / granularity;
+    mCapacity = units * granularity;
+    if (units == 0)
+        return;
+
+    mFirstBlock = NewBlock();
+    mBlocks[mFirstBlock].Offset = 0;
+    mBlocks[mFirstBlock].Size = units;
+    InsertFree(mFirstBlock);
+}
+
+// ---------------------------------------------------------
+// ũ 
+// ---------------------------------------------------------
+void TlsfAllocator::Mapping(std::uint64_t units, std::uint32_t& fl, std::uint32_t& sl)
+{
+    if (units < SlCount)
+    {
+        fl = 0;
+        sl = (std::uint32_t)units;
+        return;
+    }
+
+    const std::uint32_t log2 = BitScanReverse64(units);
+    fl = log2 - SlLog2 + 1;
+    sl = (std::uint32_t)(units >> (log2 - SlLog2)) - SlCount;
+}
+
+bool TlsfAllocator::FindFreeBlock(std::uint64_t units, std::uint32_t& fl, std::uint32_t& sl)const
+{
+    //  Ʒ 谡 ƴϸ   ø (׷    ̵ )
+    if (units >= SlCount)
+        units += (1ull << (BitScanReverse64(units) - SlLog2)) - 1;
+
+    Mapping(units, fl, sl);
+    if (fl >= FlCount)
+        return false;
+
+    std::uint32_t slMap = mSlBitmap[fl] & (~0u << sl);
+    if (slMap == 0)
+    {
+        const std::uint64_t flMap = (fl + 1 < 64) ? (mFlBitmap & (~0ull << (fl + 1))) : 0;
+        if (flMap == 0)
+            return false;
+
+        fl = BitScanForward64(flMap);
+        slMap = mSlBitmap[fl];
+    }
+
+    sl = BitScanForward32(slMap);
+    return true;
+}
+
+// ---------------------------------------------------------
+//  
+// ---------------------------------------------------------
+std::uint32_t TlsfAllocator::NewBlock()
+{
+    std::uint32_t index;
+    if (!mUnusedBlocks.empty())
+    {
+        index = mUnusedBlocks.back();
+        mUnusedBlocks.pop_back();
+        mBlocks[index] = Block();
+    }
+    else
+    {
+        index = (std::uint32_t)mBlocks.size();
+        mBlocks.emplace_back();
+    }
+
+    mBlocks[index].Used = true;
+    return index;
+}
+
+void TlsfAllocator::DeleteBlock(std::uint32_t index)
+{
+    mBlocks[index].Used = false;
+    mUnusedBlocks.push_back(index);
+}
+
+void TlsfAllocator::InsertFree(std::uint32_t index)
+{
+    Block& b = mBlocks[index];
+    std::uint32_t fl, sl;
+    Mapping(b.Size, fl, sl);
+
+    b.Free = true;
+    b.PrevFree = Null;
+    b.NextFree = mFreeHeads[fl][sl];
+    if (b.NextFree != Null)
+        mBlocks[b.NextFree].PrevFree = index;
+    mFreeHeads[fl][sl] = index;
+
+    mFlBitmap |= 1ull << fl;
+    mSlBitmap[fl] |= 1u << sl;
+}
+
+void TlsfAllocator::RemoveFree(std::uint32_t index)
+{
+    Block& b = mBlocks[index];
+    std::uint32_t fl, sl;
+    Mapping(b.Size, fl, sl);
+
+    if (b.PrevFree != Null)
+        mBlocks[b.PrevFree].NextFree = b.NextFree;
+    else
+        mFreeHeads[fl][sl] = b.NextFree;
+
+    if (b.NextFree != Null)
+        mBlocks[b.NextFree].PrevFree = b.PrevFree;
+
+    if (mFreeHeads[fl][sl] == Null)
+    {
+        mSlBitmap[fl] &= ~(1u << sl);
+        if (mSlBitmap[fl] == 0)
+            mFlBitmap &= ~(1ull << fl);
+    }
+
+    b.Free = false;
+    b.PrevFree = b.NextFree = Null;
+}
+
+std::uint32_t TlsfAllocator::Split(std::uint32_t index, std::uint64_t units)
+{
+    const std::uint32_t rest = NewBlock(); // mBlocks  ٽ      
+
+    Block& b = mBlocks[index];
+    Block& r = mBlocks[rest];
+    assert(units < b.Size);
+
+    r.Offset = b.Offset + units;
+    r.Size = b.Size - units;
+    r.PrevPhys = index;
+    r.NextPhys = b.NextPhys;
+    if (r.NextPhys != Null)
+        mBlocks[r.NextPhys].PrevPhys = rest;
+
+    b.Size = units;
+    b.NextPhys = rest;
+    return rest;
+}
+
+// ---------------------------------------------------------
+// Ҵ / 
+// ---------------------------------------------------------
+OffsetAllocation TlsfAllocator::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    OffsetAllocation result;
+    if (size == 0)
+        return result;
+
+    const std::uint64_t units = (size + mGranularity - 1) / mGranularity;
+    const std::uint64_t alignUnits = std::max<std::uint64_t>(1, alignment / mGranularity);
+
+    // 1.       ã
+    std::uint32_t fl, sl;
+    if (!FindFreeBlock(units + alignUnits - 1, fl, sl))
+        return result;
+
+    std::uint32_t index = mFreeHeads[fl][sl];
+    RemoveFree(index);
+
+    // 2.      
+    const std::uint64_t offset = mBlocks[index].Offset;
+    const std::uint64_t padding = (offset + alignUnits - 1) / alignUnits * alignUnits - offset;
+    if (padding > 0)
+    {
+        std::uint32_t aligned = Split(index, padding);
+        InsertFree(index);
+        index = aligned;
+    }
+
+    // 3. ڿ  κе  
+    if (mBlocks[index].Size > units)
+    {
+        std::uint32_t rest = Split(index, units);
+        InsertFree(rest);
+    }
+
+    mBlocks[index].Alignment = alignment;
+    mUsed += mBlocks[index].Size * mGranularity;
+    ++mAllocationCount;
+
+    result.Offset = mBlocks[index].Offset * mGranularity;
+    result.Size = mBlocks[index].Size * mGranularity;
+    result.Alignment = alignment;
+    result.Handle = index;
+    return result;
+}
+
+void TlsfAllocator::Free(std::uint32_t handle)
+{
+    assert(handle < mBlocks.size() && mBlocks[handle].Used && !mBlocks[handle].Free);
+
+    std::uint32_t index = handle;
+    mUsed -= mBlocks[index].Size * mGranularity;
+    --mAllocationCount;
+
+    // 1.   ϰ ħ
+    const std::uint32_t prev = mBlocks[index].PrevPhys;
+    if (prev != Null && mBlocks[prev].Free)
+    {
+        RemoveFree(prev);
+        mBlocks[prev].Size += mBlocks[index].Size;
+        mBlocks[prev].NextPhys = mBlocks[index].NextPhys;
+        if (mBlocks[index].NextPhys != Null)
+            mBlocks[mBlocks[index].NextPhys].PrevPhys = prev;
+
+        DeleteBlock(index);
+        index = prev;
+    }
+
+    // 2.   ϰ ħ
+    const std::uint32_t next = mBlocks[index].NextPhys;
+    if (next != Null && mBlocks[next].Free)
+    {
+        RemoveFree(next);
+        mBlocks[index].Size += mBlocks[next].Size;
+        mBlocks[index].NextPhys = mBlocks[next].NextPhys;
+        if (mBlocks[next].NextPhys != Null)
+            mBlocks[mBlocks[next].NextPhys].PrevPhys = index;
+
+        DeleteBlock(next);
+    }
+
+    InsertFree(index);
+}
+
+std::uint64_t TlsfAllocator::GetLargestFreeBlock()const
+{
+    if (mFlBitmap == 0)
+        return 0;
+
+    //     ȿ ִ ( ̶ ũⰡ ݾ ٸ)
+    const std::uint32_t fl = BitScanReverse64(mFlBitmap);
+    const std::uint32_t sl = BitScanReverse32(mSlBitmap[fl]);
+
+    std::uint64_t largest = 0;
+    for (std::uint32_t i = mFreeHeads[fl][sl]; i != Null; i = mBlocks[i].NextFree)
+        largest = std::max(largest, mBlocks[i].Size);
+
+    return largest * mGranularity;
+}
+
+void TlsfAllocator::ForEachAllocation(const std::function<void(const OffsetAllocation&)>& func)const
+{
+    for (std::uint32_t i = mFirstBlock; i != Null; i = mBlocks[i].NextPhys)
+    {
+        const Block& b = mBlocks[i];
+        if (b.Free)
+            continue;
+
+        OffsetAllocation allocation;
+        allocation.Offset = b.Offset * mGranularity;
+        allocation.Size = b.Size * mGranularity;
+        allocation.Alignment = b.Alignment;
+        allocation.Handle = i;
+        func(allocation);
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "OffsetAllocator.h"
+#include <vector>
+
+// ==========================================================
+// TLSF (Two-Level Segregated Fit)  Ҵ
+// -   ũ (1ܰ: 2 ŵ, 2ܰ:   16) Ͽ 
+// - Ʈ  ܰ "û ū     " O(1) ã
+// - ϸ  پ ִ  ϰ ٷ ħ
+//  ũ/ granularity  (⺻ 256 Ʈ)
+// ==========================================================
+
+class TlsfAllocator : public OffsetAllocator
+{
+public:
+    explicit TlsfAllocator(std::uint64_t capacity, std::uint64_t granularity = 256);
+
+    OffsetAllocation Allocate(std::uint64_t size, std::uint64_t alignment) override;
+    void Free(std::uint32_t handle) override;
+
+    std::uint64_t GetCapacity()const override { return mCapacity; }
+    std::uint64_t GetUsedBytes()const override { return mUsed; }
+    std::uint64_t GetLargestFreeBlock()const override;
+    std::uint32_t GetAllocationCount()const override { return mAllocationCount; }
+
+    void ForEachAllocation(const std::function<void(const OffsetAllocation&)>& func)const override;
+
+private:
+    static constexpr std::uint32_t SlLog2 = 4;
+    static constexpr std::uint32_t SlCount = 1u << SlLog2;
+    static constexpr std::uint32_t FlCount = 40;
+    static constexpr std::uint32_t Null = 0xFFFFFFFFu;
+
+    struct Block
+    {
+        std::uint64_t Offset = 0; // granularity 
+        std::uint64_t Size = 0;   // granularity 
+        std::uint64_t Alignment = 0; // Ʈ, Ҵ ϸ
+        std::uint32_t PrevPhys = Null, NextPhys = Null;
+        std::uint32_t PrevFree = Null, NextFree = Null;
+        bool Free = false;
+        bool Used = false; //  Ǯ  
+    };
+
+    static void Mapping(std::uint64_t units, std::uint32_t& fl, std::uint32_t& sl);
+    bool FindFreeBlock(std::uint64_t units, std::uint32_t& fl, std::uint32_t& sl)const;
+
+    std::uint32_t NewBlock();
+    void DeleteBlock(std::uint32_t index);
+    void InsertFree(std::uint32_t index);
+    void RemoveFree(std::uint32_t index);
+    std::uint32_t Split(std::uint32_t index, std::uint64_t units); //  units ŭ  ڸ   
+
+private:
+    std::uint64_t mCapacity = 0;
+    std::uint64_t mGranularity = 256;
+    std::uint64_t mUsed = 0;
+    std::uint32_t mAllocationCount = 0;
+
+    std::uint64_t mFlBitmap = 0;
+    std::uint32_t mSlBitmap[FlCount] = {};
+    std::uint32_t mFreeHeads[FlCount][SlCount];
+
+    std::vector<Block> mBlocks;
+    std::vector<std::uint32_t> mUnusedBlocks;
+    std::uint32_t mFirstBlock = Null;
+};
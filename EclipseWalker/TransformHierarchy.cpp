@@ -0,0 +1,389 @@
+#include "TransformHierarchy.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <immintrin.h>
+
+namespace
+{
+    constexpr std::uint32_t InvalidSlot = 0xFFFFFFFFu;
+
+    //   ̺ ũ Ŀ 
+    constexpr std::uint32_t ParallelThreshold = 8192;
+    constexpr std::uint32_t ParallelGrain = 2048;
+
+    // out = local * parent (  Ծ̹Ƿ ڽ  )
+    inline void MultiplyAffine(const Float4x4A& local, const Float4x4A& parent, Float4x4A& out)
+    {
+        const __m128 p0 = _mm_load_ps(parent.M + 0);
+        const __m128 p1 = _mm_load_ps(parent.M + 4);
+        const __m128 p2 = _mm_load_ps(parent.M + 8);
+        const __m128 p3 = _mm_load_ps(parent.M + 12);
+
+        for (int r = 0; r < 4; ++r)
+        {
+            const float* row = local.M + r * 4;
+            __m128 v = _mm_mul_ps(_mm_set1_ps(row[0]), p0);
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(row[1]), p1));
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(row[2]), p2));
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(row[3]), p3));
+            _mm_store_ps(out.M + r * 4, v);
+        }
+    }
+}
+
+void TransformHierarchy::Reserve(std::uint32_t count)
+{
+    mParentOf.reserve(count);
+    mSlotOf.reserve(count);
+    mSlotNode.reserve(count);
+    mParentSlot.reserve(count);
+    mLocal.reserve(count);
+    mWorld.reserve(count);
+    mDirty.reserve(count);
+    mChanged.reserve(count);
+}
+
+void TransformHierarchy::Clear()
+{
+    mParentOf.clear();
+    mSlotOf.clear();
+    mFreeNodes.clear();
+    mSlotNode.clear();
+    mParentSlot.clear();
+    mLocal.clear();
+    mWorld.clear();
+    mDirty.clear();
+    mChanged.clear();
+    mLevelStart.clear();
+    mChangedNodes.clear();
+    mOrderDirty = false;
+    mDirtyMin = UINT32_MAX;
+    mDirtyMax = 0;
+}
+
+// ---------------------------------------------------------
+//  
+// ---------------------------------------------------------
+HierarchyNodeId TransformHierarchy::CreateNode(HierarchyNodeId parent)
+{
+    assert(parent == InvalidHierarchyNode || IsAlive(parent));
+
+    HierarchyNodeId node;
+    if (!mFreeNodes.empty())
+    {
+        node = mFreeNodes.back();
+        mFreeNodes.pop_back();
+    }
+    else
+    {
+        node = (HierarchyNodeId)mParentOf.size();
+        mParentOf.push_back(InvalidHierarchyNode);
+        mSlotOf.push_back(InvalidSlot);
+    }
+
+    // ϴ  ڿ ̰   Update()  
+    const std::uint32_t slot = GetNodeCount();
+    mParentOf[node] = parent;
+    mSlotOf[node] = slot;
+
+    mSlotNode.push_back(node);
+    mParentSlot.push_back(parent == InvalidHierarchyNode ? InvalidSlot : mSlotOf[parent]);
+    mLocal.push_back(Float4x4A::Identity());
+    mWorld.push_back(Float4x4A::Identity());
+    mDirty.push_back(0);
+    mChanged.push_back(0);
+
+    MarkDirty(slot);
+    mOrderDirty = true;
+
+    return node;
+}
+
+void TransformHierarchy::DestroyNode(HierarchyNodeId node)
+{
+    assert(IsAlive(node));
+
+    if (mOrderDirty)
+        RebuildOrder();
+
+    // 1. BFS  θ ׻ տ Ƿ    ڼ  ǥõ
+    const std::uint32_t count = GetNodeCount();
+    std::vector<std::uint8_t> removed(count, 0);
+    removed[mSlotOf[node]] = 1;
+
+    for (std::uint32_t s = mSlotOf[node] + 1; s < count; ++s)
+    {
+        std::uint32_t p = mParentSlot[s];
+        if (p != InvalidSlot && removed[p])
+            removed[s] = 1;
+    }
+
+    // 2.  Ը   (  )
+    //     Update()  SetLocal / GetWorld / SetParent  Ƿ  ȣ θ  ٷ ħ
+    //    (θ ׻ ̶ θ   ̹  )
+    std::vector<std::uint32_t> newSlot(count, InvalidSlot);
+    std::uint32_t write = 0;
+    mDirtyMin = UINT32_MAX;
+    mDirtyMax = 0;
+    for (std::uint32_t s = 0; s < count; ++s)
+    {
+        const HierarchyNodeId n = mSlotNode[s];
+        if (removed[s])
+        {
+            mParentOf[n] = InvalidHierarchyNode;
+            mSlotOf[n] = InvalidSlot;
+            mFreeNodes.push_back(n);
+            continue;
+        }
+
+        const std::uint32_t p = mParentSlot[s];
+        newSlot[s] = write;
+        mSlotOf[n] = write;
+        mSlotNode[write] = n;
+        mParentSlot[write] = (p == InvalidSlot) ? InvalidSlot : newSlot[p];
+        mLocal[write] = mLocal[s];
+        mWorld[write] = mWorld[s];
+        mDirty[write] = mDirty[s];
+        if (mDirty[write])
+        {
+            mDirtyMin = std::min(mDirtyMin, write);
+            mDirtyMax = std::max(mDirtyMax, write);
+        }
+        ++write;
+    }
+
+    mSlotNode.resize(write);
+    mParentSlot.resize(write);
+    mLocal.resize(write);
+    mWorld.resize(write);
+    mDirty.resize(write);
+    mChanged.resize(write);
+
+    //   Ŀ ٽ 
+    mOrderDirty = true;
+}
+
+void TransformHierarchy::SetParent(HierarchyNodeId node, HierarchyNodeId parent)
+{
+    assert(IsAlive(node));
+    assert(parent == InvalidHierarchyNode || IsAlive(parent));
+
+    // ڱ ڼ   ȯ 
+    for (HierarchyNodeId p = parent; p != InvalidHierarchyNode; p = mParentOf[p])
+    {
+        assert(p != node);
+        if (p == node)
+            return;
+    }
+
+    mParentOf[node] = parent;
+    MarkDirty(mSlotOf[node]);
+    mOrderDirty = true;
+}
+
+bool TransformHierarchy::IsAlive(HierarchyNodeId node)const
+{
+    return node < mSlotOf.size() && mSlotOf[node] != InvalidSlot;
+}
+
+void TransformHierarchy::RebuildOrder()
+{
+    PROFILE_SCOPE("TransformHierarchy::RebuildOrder");
+
+    const std::uint32_t count = GetNodeCount();
+
+    // 1. 帶  (θ ü  ö󰡸鼭 ޸)
+    std::vector<std::uint32_t> depth(mParentOf.size(), InvalidSlot);
+    std::vector<HierarchyNodeId> chain;
+    std::uint32_t maxDepth = 0;
+
+    for (std::uint32_t s = 0; s < count; ++s)
+    {
+        HierarchyNodeId n = mSlotNode[s];
+        while (n != InvalidHierarchyNode && depth[n] == InvalidSlot)
+        {
+            chain.push_back(n);
+            n = mParentOf[n];
+        }
+
+        std::uint32_t d = (n == InvalidHierarchyNode) ? 0 : depth[n] + 1;
+        while (!chain.empty())
+        {
+            depth[chain.back()] = d++;
+            chain.pop_back();
+        }
+        maxDepth = std::max(maxDepth, depth[mSlotNode[s]]);
+    }
+
+    // 2.     (  ȿ   )
+    mLevelStart.assign(count > 0 ? maxDepth + 2 : 1, 0);
+    for (std::uint32_t s = 0; s < count; ++s)
+        mLevelStart[depth[mSlotNode[s]] + 1]++;
+    for (std::size_t l = 1; l < mLevelStart.size(); ++l)
+        mLevelStart[l] += mLevelStart[l - 1];
+
+    std::vector<std::uint32_t> cursor(mLevelStart.begin(), mLevelStart.end() - 1);
+    std::vector<HierarchyNodeId> slotNode(count);
+    std::vector<Float4x4A> local(count), world(count);
+    std::vector<std::uint8_t> dirty(count);
+
+    for (std::uint32_t s = 0; s < count; ++s)
+    {
+        std::uint32_t dst = cursor[depth[mSlotNode[s]]]++;
+        slotNode[dst] = mSlotNode[s];
+        local[dst] = mLocal[s];
+        world[dst] = mWorld[s];
+        dirty[dst] = mDirty[s];
+    }
+
+    mSlotNode.swap(slotNode);
+    mLocal.swap(local);
+    mWorld.swap(world);
+    mDirty.swap(dirty);
+
+    // 3.   ȣ θ  Ƽ  ٽ 
+    mDirtyMin = UINT32_MAX;
+    mDirtyMax = 0;
+    for (std::uint32_t s = 0; s < count; ++s)
+        mSlotOf[mSlotNode[s]] = s;
+
+    mParentSlot.resize(count);
+    for (std::uint32_t s = 0; s < count; ++s)
+    {
+        HierarchyNodeId parent = mParentOf[mSlotNode[s]];
+        mParentSlot[s] = (parent == InvalidHierarchyNode) ? InvalidSlot : mSlotOf[parent];
+
+        if (mDirty[s])
+        {
+            mDirtyMin = std::min(mDirtyMin, s);
+            mDirtyMax = std::max(mDirtyMax, s);
+        }
+    }
+
+    mChanged.assign(count, 0);
+    mOrderDirty = false;
+}
+
+// ---------------------------------------------------------
+//  
+// ---------------------------------------------------------
+void TransformHierarchy::MarkDirty(std::uint32_t slot)
+{
+    mDirty[slot] = 1;
+    mDirtyMin = std::min(mDirtyMin, slot);
+    mDirtyMax = std::max(mDirtyMax, slot);
+}
+
+void TransformHierarchy::SetLocal(HierarchyNodeId node, const float matrix[16])
+{
+    const std::uint32_t slot = mSlotOf[node];
+    memcpy(mLocal[slot].M, matrix, sizeof(float) * 16);
+    MarkDirty(slot);
+}
+
+void TransformHierarchy::SetLocalTRS(HierarchyNodeId node,
+    float px, float py, float pz,
+    float qx, float qy, float qz, float qw,
+    float sx, float sy, float sz)
+{
+    // Scale * Rotation(ʹϾ) * Translation
+    const float m[16] =
+    {
+        sx * (1.0f - 2.0f * (qy * qy + qz * qz)), sx * (2.0f * (qx * qy + qw * qz)), sx * (2.0f * (qx * qz - qw * qy)), 0.0f,
+        sy * (2.0f * (qx * qy - qw * qz)), sy * (1.0f - 2.0f * (qx * qx + qz * qz)), sy * (2.0f * (qy * qz + qw * qx)), 0.0f,
+        sz * (2.0f * (qx * qz + qw * qy)), sz * (2.0f * (qy * qz - qw * qx)), sz * (1.0f - 2.0f * (qx * qx + qy * qy)), 0.0f,
+        px, py, pz, 1.0f,
+    };
+    SetLocal(node, m);
+}
+
+// ---------------------------------------------------------
+// 
+// ---------------------------------------------------------
+void TransformHierarchy::Update()
+{
+    PROFILE_SCOPE("TransformHierarchy::Update");
+
+    if (mOrderDirty)
+        RebuildOrder();
+
+    mChangedNodes.clear();
+    if (mDirtyMin > mDirtyMax)
+        return;
+
+    // 1.   Ƽ   ִ  
+    const std::uint32_t levelCount = GetLevelCount();
+    std::uint32_t level = (std::uint32_t)(std::upper_bound(mLevelStart.begin(), mLevelStart.end(), mDirtyMin) - mLevelStart.begin()) - 1;
+
+    const std::uint32_t firstSlot = mLevelStart[level];
+    std::uint32_t lastSlot = firstSlot;
+    std::uint32_t changedInLevel = 0;
+
+    // 2.   
+    //    Ƽ   ٷ   ٲ     ʿ 
+    for (; level < levelCount; ++level)
+    {
+        const std::uint32_t begin = mLevelStart[level];
+        const std::uint32_t end = mLevelStart[level + 1];
+        if (begin > mDirtyMax && changedInLevel == 0)
+            break;
+
+        changedInLevel = PropagateLevel(begin, end);
+        lastSlot = end;
+    }
+
+    // 3. ٲ   ѱ ǥ 
+    for (std::uint32_t s = firstSlot; s < lastSlot; ++s)
+    {
+        if (mChanged[s])
+        {
+            mChanged[s] = 0;
+            mChangedNodes.push_back(mSlotNode[s]);
+        }
+    }
+
+    mDirtyMin = UINT32_MAX;
+    mDirtyMax = 0;
+}
+
+std::uint32_t TransformHierarchy::PropagateLevel(std::uint32_t begin, std::uint32_t end)
+{
+    if (end - begin < ParallelThreshold)
+        return PropagateRange(begin, end);
+
+    std::atomic<std::uint32_t> changed{ 0 };
+    JobSystem::GetInstance()->ParallelFor(end - begin, ParallelGrain,
+        [&](std::uint32_t b, std::uint32_t e)
+        {
+            changed.fetch_add(PropagateRange(begin + b, begin + e), std::memory_order_relaxed);
+        });
+    return changed.load(std::memory_order_relaxed);
+}
+
+std::uint32_t TransformHierarchy::PropagateRange(std::uint32_t begin, std::uint32_t end)
+{
+    std::uint32_t changed = 0;
+
+    for (std::uint32_t s = begin; s < end; ++s)
+    {
+        const std::uint32_t p = mParentSlot[s];
+        const bool parentChanged = (p != InvalidSlot) && mChanged[p];
+        if (!mDirty[s] && !parentChanged)
+            continue;
+
+        if (p == InvalidSlot)
+            mWorld[s] = mLocal[s];
+        else
+            MultiplyAffine(mLocal[s], mWorld[p], mWorld[s]);
+
+        mDirty[s] = 0;
+        mChanged[s] = 1;
+        ++changed;
+    }
+
+    return changed;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+// θ/ڽ Ʈ  ( -> ĳ, ī޶  )
+// -  ʺ 켱(BFS)  ź 迭 , θ  ȣ Ŵ
+//   ->   迭  ̰ θ ׻    
+// - Update()   World = Local * ParentWorld  
+//    ȿ  ̶ ũ JobSystem   ,   SSE
+// - Ƽ   ڼո ٽ  (Ƽ    ǳʶ)
+// -  ߰/θ    Update()   ٽ 
+//  DirectXMath   켱 /   Ծ
+// ==========================================================
+
+using HierarchyNodeId = std::uint32_t;
+constexpr HierarchyNodeId InvalidHierarchyNode = 0xFFFFFFFFu;
+
+struct alignas(16) Float4x4A
+{
+    float M[16];
+
+    static Float4x4A Identity()
+    {
+        return Float4x4A{ { 1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 0.0f, 1.0f } };
+    }
+};
+
+class TransformHierarchy
+{
+public:
+    void Reserve(std::uint32_t count);
+    void Clear();
+
+    HierarchyNodeId CreateNode(HierarchyNodeId parent = InvalidHierarchyNode);
+    void DestroyNode(HierarchyNodeId node); // ڼձ  
+    void SetParent(HierarchyNodeId node, HierarchyNodeId parent);
+    bool IsAlive(HierarchyNodeId node)const;
+
+    void SetLocal(HierarchyNodeId node, const float matrix[16]);
+    void SetLocalTRS(HierarchyNodeId node,
+        float px, float py, float pz,
+        float qx, float qy, float qz, float qw,
+        float sx, float sy, float sz);
+
+    HierarchyNodeId GetParent(HierarchyNodeId node)const { return mParentOf[node]; }
+    const float* GetLocal(HierarchyNodeId node)const { return mLocal[mSlotOf[node]].M; }
+    const float* GetWorld(HierarchyNodeId node)const { return mWorld[mSlotOf[node]].M; }
+
+    //  (ʿϸ) + Ƽ 
+    void Update();
+
+    //  Update()    ٲ 
+    const std::vector<HierarchyNodeId>& GetChanged()const { return mChangedNodes; }
+
+    std::uint32_t GetNodeCount()const { return (std::uint32_t)mSlotNode.size(); }
+    std::uint32_t GetLevelCount()const { return mLevelStart.empty() ? 0 : (std::uint32_t)mLevelStart.size() - 1; }
+
+private:
+    void MarkDirty(std::uint32_t slot);
+    void RebuildOrder();
+    std::uint32_t PropagateLevel(std::uint32_t begin, std::uint32_t end);
+    std::uint32_t PropagateRange(std::uint32_t begin, std::uint32_t end);
+
+private:
+    //  ȣ  ( ڵ)
+    std::vector<HierarchyNodeId> mParentOf;
+    std::vector<std::uint32_t> mSlotOf;
+    std::vector<HierarchyNodeId> mFreeNodes;
+
+    //   (BFS )
+    std::vector<HierarchyNodeId> mSlotNode;
+    std::vector<std::uint32_t> mParentSlot;
+    std::vector<Float4x4A> mLocal;
+    std::vector<Float4x4A> mWorld;
+    std::vector<std::uint8_t> mDirty;   // ڱ  ٲ
+    std::vector<std::uint8_t> mChanged; // ̹ Update  尡 ٲ (Update ۿ ׻ 0)
+
+    std::vector<std::uint32_t> mLevelStart; //  L = [mLevelStart[L], mLevelStart[L + 1])
+    bool mOrderDirty = false;
+
+    std::uint32_t mDirtyMin = UINT32_MAX; // Ƽ  
+    std::uint32_t mDirtyMax = 0;
+
+    std::vector<HierarchyNodeId> mChangedNodes;
+};
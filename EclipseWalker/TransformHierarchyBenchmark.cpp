@@ -0,0 +1,228 @@
+#include "TransformHierarchyBenchmark.h"
+#include "TransformHierarchy.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float MaxWorldError = 1e-3f;
+    constexpr std::uint32_t DestroyedSubtrees = 64;
+
+    // : θ 带  ()   World = Local * ParentWorld  double 
+    const double* ReferenceWorld(const TransformHierarchy& hierarchy, HierarchyNodeId node,
+        std::vector<double>& worlds, std::vector<std::uint8_t>& done)
+    {
+        double* world = &worlds[node * 16];
+        if (done[node])
+            return world;
+
+        const float* local = hierarchy.GetLocal(node);
+        const HierarchyNodeId parent = hierarchy.GetParent(node);
+        if (parent == InvalidHierarchyNode)
+        {
+            for (int i = 0; i < 16; ++i)
+                world[i] = local[i];
+        }
+        else
+        {
+            const double* parentWorld = ReferenceWorld(hierarchy, parent, worlds, done);
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c)
+                    world[r * 4 + c] = local[r * 4 + 0] * parentWorld[0 * 4 + c] + local[r * 4 + 1] * parentWorld[1 * 4 + c] +
+                        local[r * 4 + 2] * parentWorld[2 * 4 + c] + local[r * 4 + 3] * parentWorld[3 * 4 + c];
+        }
+
+        done[node] = 1;
+        return world;
+    }
+
+    //  ٸ   (maxError  )
+    std::uint32_t CompareWorlds(const TransformHierarchy& hierarchy, const std::vector<HierarchyNodeId>& nodes, float& maxError)
+    {
+        HierarchyNodeId maxId = 0;
+        for (HierarchyNodeId node : nodes)
+            maxId = std::max(maxId, node);
+
+        std::vector<double> worlds((std::size_t)(maxId + 1) * 16);
+        std::vector<std::uint8_t> done(maxId + 1, 0);
+
+        std::uint32_t mismatches = 0;
+        for (HierarchyNodeId node : nodes)
+        {
+            const double* expected = ReferenceWorld(hierarchy, node, worlds, done);
+            const float* world = hierarchy.GetWorld(node);
+
+            float error = 0.0f;
+            for (int i = 0; i < 16; ++i)
+                error = std::max(error, (float)std::fabs(world[i] - expected[i]));
+
+            maxError = std::max(maxError, error);
+            if (!(error <= MaxWorldError))
+                ++mismatches;
+        }
+        return mismatches;
+    }
+}
+
+namespace TransformHierarchyBenchmark
+{
+    TransformHierarchyBenchmarkResult Run(std::uint32_t nodeCount, std::uint32_t seed)
+    {
+        TransformHierarchyBenchmarkResult result;
+        result.NodeCount = nodeCount;
+
+        //  ũ Update   ý  
+        JobSystem::GetInstance()->Initialize();
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> angle(-3.14159f, 3.14159f);
+
+        const std::uint32_t rootCount = std::max(1u, nodeCount / 100);
+
+        TransformHierarchy hierarchy;
+        hierarchy.Reserve(nodeCount);
+        std::vector<HierarchyNodeId> nodes;
+        std::vector<HierarchyNodeId> roots;
+        nodes.reserve(nodeCount);
+
+        // 1. Ʈ 1% +  ռ    ϳ θ (  Ʈ)
+        Clock::time_point t0 = Clock::now();
+        for (std::uint32_t i = 0; i < nodeCount; ++i)
+        {
+            HierarchyNodeId parent = InvalidHierarchyNode;
+            if (i >= rootCount)
+                parent = nodes[std::uniform_int_distribution<std::uint32_t>(0, i - 1)(rng)];
+
+            HierarchyNodeId node = hierarchy.CreateNode(parent);
+            float a = angle(rng);
+            hierarchy.SetLocalTRS(node, offset(rng), offset(rng), offset(rng),
+                0.0f, sinf(0.5f * a), 0.0f, cosf(0.5f * a), 1.0f, 1.0f, 1.0f);
+
+            nodes.push_back(node);
+            if (parent == InvalidHierarchyNode)
+                roots.push_back(node);
+        }
+        hierarchy.Update();
+        Clock::time_point t1 = Clock::now();
+        result.BuildMs = ElapsedMs(t0, t1);
+        result.LevelCount = hierarchy.GetLevelCount();
+        result.WorldMismatches += CompareWorlds(hierarchy, nodes, result.MaxWorldError);
+
+        // 2. Ʈ   ->   ٽ 
+        for (HierarchyNodeId root : roots)
+            hierarchy.SetLocalTRS(root, offset(rng), 0.0f, offset(rng), 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f);
+        t0 = Clock::now();
+        hierarchy.Update();
+        t1 = Clock::now();
+        result.FullUpdateMs = ElapsedMs(t0, t1);
+        result.WorldMismatches += CompareWorlds(hierarchy, nodes, result.MaxWorldError);
+
+        // 3. ƹ 峪 1% ( ̵  ٲ㼭 ڼձ   ޶)
+        for (std::uint32_t i = 0; i < nodeCount / 100; ++i)
+        {
+            HierarchyNodeId node = nodes[std::uniform_int_distribution<std::uint32_t>(0, nodeCount - 1)(rng)];
+            float local[16];
+            std::copy(hierarchy.GetLocal(node), hierarchy.GetLocal(node) + 16, local);
+            local[12] += offset(rng);
+            local[14] += offset(rng);
+            hierarchy.SetLocal(node, local);
+        }
+        t0 = Clock::now();
+        hierarchy.Update();
+        t1 = Clock::now();
+        result.PartialUpdateMs = ElapsedMs(t0, t1);
+        result.PartialChanged = (std::uint32_t)hierarchy.GetChanged().size();
+        result.WorldMismatches += CompareWorlds(hierarchy, nodes, result.MaxWorldError);
+
+        // 4. Ƽ 
+        t0 = Clock::now();
+        hierarchy.Update();
+        t1 = Clock::now();
+        result.IdleUpdateMs = ElapsedMs(t0, t1);
+
+        // 5. Ʈ    -> Update  ٷ SetLocal / SetParent (  ״  )
+        for (std::uint32_t i = 0; i < DestroyedSubtrees; ++i)
+        {
+            HierarchyNodeId node = nodes[std::uniform_int_distribution<std::uint32_t>(0, nodeCount - 1)(rng)];
+            if (hierarchy.IsAlive(node))
+                hierarchy.DestroyNode(node);
+        }
+
+        std::vector<HierarchyNodeId> survivors;
+        for (HierarchyNodeId node : nodes)
+        {
+            if (hierarchy.IsAlive(node))
+                survivors.push_back(node);
+        }
+        std::vector<HierarchyNodeId> liveRoots;
+        for (HierarchyNodeId root : roots)
+        {
+            if (hierarchy.IsAlive(root))
+                liveRoots.push_back(root);
+        }
+
+        //     ΰ Update ڿ ״  ִ Ȯ ( Կ  )
+        std::vector<std::pair<HierarchyNodeId, Float4x4A>> expectedLocals;
+        for (std::size_t i = 0; i < survivors.size(); i += 50)
+        {
+            Float4x4A local;
+            std::copy(hierarchy.GetLocal(survivors[i]), hierarchy.GetLocal(survivors[i]) + 16, local.M);
+            local.M[12] += offset(rng);
+            local.M[13] += offset(rng);
+            hierarchy.SetLocal(survivors[i], local.M);
+            expectedLocals.emplace_back(survivors[i], local);
+
+            //  ٸ Ʈ  (Ʈ  ڼյ ƴϹǷ ȯ )
+            if (i % 500 == 0 && !liveRoots.empty())
+            {
+                HierarchyNodeId root = liveRoots[std::uniform_int_distribution<std::size_t>(0, liveRoots.size() - 1)(rng)];
+                if (root != survivors[i])
+                    hierarchy.SetParent(survivors[i], root);
+            }
+        }
+        hierarchy.Update();
+
+        for (const auto& expected : expectedLocals)
+        {
+            if (!std::equal(expected.second.M, expected.second.M + 16, hierarchy.GetLocal(expected.first)))
+                ++result.LostLocals;
+        }
+        result.SurvivingNodes = (std::uint32_t)survivors.size();
+        result.WorldMismatches += CompareWorlds(hierarchy, survivors, result.MaxWorldError);
+
+        result.Valid = result.WorldMismatches == 0 && result.LostLocals == 0;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        TransformHierarchyBenchmarkResult r = Run(100000);
+
+        std::string report = "[TransformHierarchy]\n";
+        report += "    nodes levels  build(ms)  full(ms)  1%dirty(ms)  changed  idle(ms)  after-destroy  lost  err(mm)  valid\n";
+
+        char line[192];
+        snprintf(line, sizeof(line), "%9u %6u %10.2f %9.3f %12.3f %8u %9.4f %14u %5u %8.4f  %s\n",
+            r.NodeCount, r.LevelCount, r.BuildMs, r.FullUpdateMs, r.PartialUpdateMs, r.PartialChanged,
+            r.IdleUpdateMs, r.SurvivingNodes, r.LostLocals, r.MaxWorldError * 1000.0f, r.Valid ? "yes" : "NO");
+        report += line;
+
+        if (allValid)
+            *allValid = r.Valid;
+        return report;
+    }
+}
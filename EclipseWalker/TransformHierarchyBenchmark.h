@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// TransformHierarchy    (߿)
+//  Ʈ(  ~ ln N)  Ƽ  Update() ð .
+// ܰ踶   θ *  ͷ   (double)  Ѵ.
+//  Ʈ  Update  ٷ SetLocal / SetParent    ʴ ȮѴ.
+// ==========================================================
+
+struct TransformHierarchyBenchmarkResult
+{
+    std::uint32_t NodeCount = 0;
+    std::uint32_t LevelCount = 0;
+
+    double BuildMs = 0.0;         //   + ù Update (  + ü )
+    double FullUpdateMs = 0.0;    // Ʈ  Ƽ -> ü 
+    double PartialUpdateMs = 0.0; //  1% Ƽ (ڼձ )
+    std::uint32_t PartialChanged = 0;
+    double IdleUpdateMs = 0.0;    // Ƽ 
+
+    std::uint32_t SurvivingNodes = 0; // Ʈ  
+    std::uint32_t LostLocals = 0;     //   SetLocal   Update ڿ  
+
+    float MaxWorldError = 0.0f;   //   (  ִ)
+    std::uint32_t WorldMismatches = 0;
+    bool Valid = false;
+};
+
+namespace TransformHierarchyBenchmark
+{
+    TransformHierarchyBenchmarkResult Run(std::uint32_t nodeCount, std::uint32_t seed = 1);
+
+    // 100k   ڿ 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
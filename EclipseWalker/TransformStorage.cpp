@@ -0,0 +1,344 @@
+#include "TransformStorage.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <immintrin.h>
+
+namespace
+{
+    // ̺  ٲ Ŀ    ŭ
+    constexpr std::uint32_t ParallelThreshold = 4096;
+    constexpr std::uint32_t ParallelGrain = 2048;
+
+    template<typename T>
+    void SwapRemove(std::vector<T>& v, std::uint32_t index)
+    {
+        v[index] = v.back();
+        v.pop_back();
+    }
+
+    inline __m128 Abs(__m128 v)
+    {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+    }
+}
+
+void TransformStorage::Reserve(std::uint32_t count)
+{
+    mSparse.reserve(count);
+    mEntities.reserve(count);
+    for (std::vector<float>* v : { &mPosX, &mPosY, &mPosZ, &mRotX, &mRotY, &mRotZ, &mRotW,
+        &mScaleX, &mScaleY, &mScaleZ, &mLocalExtX, &mLocalExtY, &mLocalExtZ,
+        &mM00, &mM01, &mM02, &mM10, &mM11, &mM12, &mM20, &mM21, &mM22 })
+    {
+        v->reserve(count);
+    }
+    mMeshId.reserve(count);
+    mLod.reserve(count);
+    mWorldBounds.Reserve(count);
+    mDirty.reserve(count);
+    mDirtyList.reserve(count);
+}
+
+void TransformStorage::Clear()
+{
+    mSparse.clear();
+    mFreeIds.clear();
+    mEntities.clear();
+    for (std::vector<float>* v : { &mPosX, &mPosY, &mPosZ, &mRotX, &mRotY, &mRotZ, &mRotW,
+        &mScaleX, &mScaleY, &mScaleZ, &mLocalExtX, &mLocalExtY, &mLocalExtZ,
+        &mM00, &mM01, &mM02, &mM10, &mM11, &mM12, &mM20, &mM21, &mM22 })
+    {
+        v->clear();
+    }
+    mMeshId.clear();
+    mLod.clear();
+    mWorldBounds.Clear();
+    mDirty.clear();
+    mDirtyList.clear();
+    mChanged.clear();
+}
+
+// ---------------------------------------------------------
+//  / 
+// ---------------------------------------------------------
+EntityId TransformStorage::Create(float x, float y, float z, std::uint32_t meshId)
+{
+    EntityId entity;
+    if (!mFreeIds.empty())
+    {
+        entity = mFreeIds.back();
+        mFreeIds.pop_back();
+    }
+    else
+    {
+        entity = (EntityId)mSparse.size();
+        mSparse.push_back(InvalidEntity);
+    }
+
+    const std::uint32_t index = (std::uint32_t)mEntities.size();
+    mSparse[entity] = index;
+    mEntities.push_back(entity);
+
+    mPosX.push_back(x); mPosY.push_back(y); mPosZ.push_back(z);
+    mRotX.push_back(0.0f); mRotY.push_back(0.0f); mRotZ.push_back(0.0f); mRotW.push_back(1.0f);
+    mScaleX.push_back(1.0f); mScaleY.push_back(1.0f); mScaleZ.push_back(1.0f);
+    mLocalExtX.push_back(0.0f); mLocalExtY.push_back(0.0f); mLocalExtZ.push_back(0.0f);
+    mMeshId.push_back(meshId);
+    mLod.push_back(0);
+
+    mM00.push_back(1.0f); mM01.push_back(0.0f); mM02.push_back(0.0f);
+    mM10.push_back(0.0f); mM11.push_back(1.0f); mM12.push_back(0.0f);
+    mM20.push_back(0.0f); mM21.push_back(0.0f); mM22.push_back(1.0f);
+    mWorldBounds.Add(x, y, z, 0.0f, 0.0f, 0.0f);
+
+    mDirty.push_back(0);
+    MarkDirty(index);
+
+    return entity;
+}
+
+void TransformStorage::Destroy(EntityId entity)
+{
+    assert(IsAlive(entity));
+
+    const std::uint32_t index = mSparse[entity];
+    const std::uint32_t last = GetCount() - 1;
+
+    //  Ҹ ڸ ű
+    mSparse[mEntities[last]] = index;
+    mSparse[entity] = InvalidEntity;
+    mFreeIds.push_back(entity);
+
+    SwapRemove(mEntities, index);
+    for (std::vector<float>* v : { &mPosX, &mPosY, &mPosZ, &mRotX, &mRotY, &mRotZ, &mRotW,
+        &mScaleX, &mScaleY, &mScaleZ, &mLocalExtX, &mLocalExtY, &mLocalExtZ,
+        &mM00, &mM01, &mM02, &mM10, &mM11, &mM12, &mM20, &mM21, &mM22,
+        &mWorldBounds.CenterX, &mWorldBounds.CenterY, &mWorldBounds.CenterZ,
+        &mWorldBounds.ExtentX, &mWorldBounds.ExtentY, &mWorldBounds.ExtentZ })
+    {
+        SwapRemove(*v, index);
+    }
+    SwapRemove(mMeshId, index);
+    SwapRemove(mLod, index);
+    SwapRemove(mDirty, index);
+
+    // Ű Ҵ  ε ٲǷ (   ) ٽ  
+    // ̹ Ƽ  ǥô  ڸ (last)  ̶ Ͽ index   -> ǥÿ  
+    // (ߺ UpdateWorld  ɷ)
+    if (index != last)
+    {
+        mDirty[index] = 1;
+        mDirtyList.push_back(index);
+    }
+}
+
+bool TransformStorage::IsAlive(EntityId entity)const
+{
+    return entity < mSparse.size() && mSparse[entity] != InvalidEntity;
+}
+
+// ---------------------------------------------------------
+// Ʈ 
+// ---------------------------------------------------------
+void TransformStorage::MarkDirty(std::uint32_t index)
+{
+    if (mDirty[index] == 0)
+    {
+        mDirty[index] = 1;
+        mDirtyList.push_back(index);
+    }
+}
+
+void TransformStorage::SetPosition(EntityId entity, float x, float y, float z)
+{
+    const std::uint32_t i = mSparse[entity];
+    mPosX[i] = x; mPosY[i] = y; mPosZ[i] = z;
+    MarkDirty(i);
+}
+
+void TransformStorage::Translate(EntityId entity, float dx, float dy, float dz)
+{
+    const std::uint32_t i = mSparse[entity];
+    mPosX[i] += dx; mPosY[i] += dy; mPosZ[i] += dz;
+    MarkDirty(i);
+}
+
+void TransformStorage::SetRotation(EntityId entity, float qx, float qy, float qz, float qw)
+{
+    const std::uint32_t i = mSparse[entity];
+    if (mRotX[i] == qx && mRotY[i] == qy && mRotZ[i] == qz && mRotW[i] == qw)
+        return;
+
+    mRotX[i] = qx; mRotY[i] = qy; mRotZ[i] = qz; mRotW[i] = qw;
+    MarkDirty(i);
+}
+
+void TransformStorage::SetRotationY(EntityId entity, float angle)
+{
+    SetRotation(entity, 0.0f, sinf(0.5f * angle), 0.0f, cosf(0.5f * angle));
+}
+
+void TransformStorage::SetScale(EntityId entity, float sx, float sy, float sz)
+{
+    const std::uint32_t i = mSparse[entity];
+    mScaleX[i] = sx; mScaleY[i] = sy; mScaleZ[i] = sz;
+    MarkDirty(i);
+}
+
+void TransformStorage::SetLocalExtent(EntityId entity, float ex, float ey, float ez)
+{
+    const std::uint32_t i = mSparse[entity];
+    mLocalExtX[i] = ex; mLocalExtY[i] = ey; mLocalExtZ[i] = ez;
+    MarkDirty(i);
+}
+
+void TransformStorage::GetPosition(EntityId entity, float& x, float& y, float& z)const
+{
+    const std::uint32_t i = mSparse[entity];
+    x = mPosX[i]; y = mPosY[i]; z = mPosZ[i];
+}
+
+void TransformStorage::GetWorldMatrix(std::uint32_t index, float out[16])const
+{
+    const std::uint32_t i = index;
+    out[0] = mM00[i];  out[1] = mM01[i];  out[2] = mM02[i];  out[3] = 0.0f;
+    out[4] = mM10[i];  out[5] = mM11[i];  out[6] = mM12[i];  out[7] = 0.0f;
+    out[8] = mM20[i];  out[9] = mM21[i];  out[10] = mM22[i]; out[11] = 0.0f;
+    out[12] = mPosX[i]; out[13] = mPosY[i]; out[14] = mPosZ[i]; out[15] = 1.0f;
+}
+
+// ---------------------------------------------------------
+//   
+// ---------------------------------------------------------
+void TransformStorage::UpdateWorld()
+{
+    mChanged.clear();
+    if (mDirtyList.empty())
+        return;
+
+    PROFILE_SCOPE("TransformStorage::UpdateWorld");
+
+    const std::uint32_t count = GetCount();
+
+    // 1. 4   鼭 Ƽ ϳ ִ  SIMD 
+    //    ( Ҹ  ص  Ƿ ŷ  )
+    if (mDirtyList.size() >= ParallelThreshold)
+    {
+        JobSystem::GetInstance()->ParallelFor(count, ParallelGrain,
+            [this](std::uint32_t begin, std::uint32_t end) { UpdateRange(begin, end); });
+    }
+    else
+    {
+        UpdateRange(0, count);
+    }
+
+    // 2. ٲ  Ѱְ Ƽ 
+    //    ( з ε ߺ ⼭ ɷ)
+    for (std::uint32_t index : mDirtyList)
+    {
+        if (index < count && mDirty[index] != 0)
+        {
+            mDirty[index] = 0;
+            mChanged.push_back(index);
+        }
+    }
+    mDirtyList.clear();
+}
+
+void TransformStorage::UpdateRange(std::uint32_t begin, std::uint32_t end)
+{
+    // ParallelFor  谡 4  ƴ  Ƿ յڴ ϳ
+    std::uint32_t i = begin;
+    for (; i < end && (i & 3) != 0; ++i)
+    {
+        if (mDirty[i] != 0)
+            UpdateOne(i);
+    }
+
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+
+    for (; i + 4 <= end; i += 4)
+    {
+        std::uint32_t dirtyBits;
+        memcpy(&dirtyBits, &mDirty[i], sizeof(dirtyBits));
+        if (dirtyBits == 0)
+            continue;
+
+        // ʹϾ -> ȸ  (XMMatrixRotationQuaternion   ġ)
+        __m128 qx = _mm_loadu_ps(&mRotX[i]), qy = _mm_loadu_ps(&mRotY[i]);
+        __m128 qz = _mm_loadu_ps(&mRotZ[i]), qw = _mm_loadu_ps(&mRotW[i]);
+
+        __m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+        __m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+        __m128 wx = _mm_mul_ps(qw, qx), wy = _mm_mul_ps(qw, qy), wz = _mm_mul_ps(qw, qz);
+
+        __m128 sx = _mm_loadu_ps(&mScaleX[i]), sy = _mm_loadu_ps(&mScaleY[i]), sz = _mm_loadu_ps(&mScaleZ[i]);
+
+        //  i   i   (Scale * Rotation)
+        __m128 m00 = _mm_mul_ps(sx, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))));
+        __m128 m01 = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_add_ps(xy, wz)));
+        __m128 m02 = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_sub_ps(xz, wy)));
+
+        __m128 m10 = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_sub_ps(xy, wz)));
+        __m128 m11 = _mm_mul_ps(sy, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))));
+        __m128 m12 = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_add_ps(yz, wx)));
+
+        __m128 m20 = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_add_ps(xz, wy)));
+        __m128 m21 = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_sub_ps(yz, wx)));
+        __m128 m22 = _mm_mul_ps(sz, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))));
+
+        _mm_storeu_ps(&mM00[i], m00); _mm_storeu_ps(&mM01[i], m01); _mm_storeu_ps(&mM02[i], m02);
+        _mm_storeu_ps(&mM10[i], m10); _mm_storeu_ps(&mM11[i], m11); _mm_storeu_ps(&mM12[i], m12);
+        _mm_storeu_ps(&mM20[i], m20); _mm_storeu_ps(&mM21[i], m21); _mm_storeu_ps(&mM22[i], m22);
+
+        //  AABB: ߽ = ̵,  = |M|^T *  
+        __m128 ex = _mm_loadu_ps(&mLocalExtX[i]), ey = _mm_loadu_ps(&mLocalExtY[i]), ez = _mm_loadu_ps(&mLocalExtZ[i]);
+
+        __m128 wex = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Abs(m00), ex), _mm_mul_ps(Abs(m10), ey)), _mm_mul_ps(Abs(m20), ez));
+        __m128 wey = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Abs(m01), ex), _mm_mul_ps(Abs(m11), ey)), _mm_mul_ps(Abs(m21), ez));
+        __m128 wez = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Abs(m02), ex), _mm_mul_ps(Abs(m12), ey)), _mm_mul_ps(Abs(m22), ez));
+
+        _mm_storeu_ps(&mWorldBounds.CenterX[i], _mm_loadu_ps(&mPosX[i]));
+        _mm_storeu_ps(&mWorldBounds.CenterY[i], _mm_loadu_ps(&mPosY[i]));
+        _mm_storeu_ps(&mWorldBounds.CenterZ[i], _mm_loadu_ps(&mPosZ[i]));
+        _mm_storeu_ps(&mWorldBounds.ExtentX[i], wex);
+        _mm_storeu_ps(&mWorldBounds.ExtentY[i], wey);
+        _mm_storeu_ps(&mWorldBounds.ExtentZ[i], wez);
+    }
+
+    for (; i < end; ++i)
+    {
+        if (mDirty[i] != 0)
+            UpdateOne(i);
+    }
+}
+
+void TransformStorage::UpdateOne(std::uint32_t i)
+{
+    const float qx = mRotX[i], qy = mRotY[i], qz = mRotZ[i], qw = mRotW[i];
+    const float sx = mScaleX[i], sy = mScaleY[i], sz = mScaleZ[i];
+
+    const float m00 = sx * (1.0f - 2.0f * (qy * qy + qz * qz));
+    const float m01 = sx * (2.0f * (qx * qy + qw * qz));
+    const float m02 = sx * (2.0f * (qx * qz - qw * qy));
+    const float m10 = sy * (2.0f * (qx * qy - qw * qz));
+    const float m11 = sy * (1.0f - 2.0f * (qx * qx + qz * qz));
+    const float m12 = sy * (2.0f * (qy * qz + qw * qx));
+    const float m20 = sz * (2.0f * (qx * qz + qw * qy));
+    const float m21 = sz * (2.0f * (qy * qz - qw * qx));
+    const float m22 = sz * (1.0f - 2.0f * (qx * qx + qy * qy));
+
+    mM00[i] = m00; mM01[i] = m01; mM02[i] = m02;
+    mM10[i] = m10; mM11[i] = m11; mM12[i] = m12;
+    mM20[i] = m20; mM21[i] = m21; mM22[i] = m22;
+
+    const float ex = mLocalExtX[i], ey = mLocalExtY[i], ez = mLocalExtZ[i];
+    mWorldBounds.Set(i, mPosX[i], mPosY[i], mPosZ[i],
+        std::fabs(m00) * ex + std::fabs(m10) * ey + std::fabs(m20) * ez,
+        std::fabs(m01) * ex + std::fabs(m11) * ey + std::fabs(m21) * ez,
+        std::fabs(m02) * ex + std::fabs(m12) * ey + std::fabs(m22) * ez);
+}
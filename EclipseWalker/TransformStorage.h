@@ -0,0 +1,92 @@
+#pragma once
+#include "FrustumCulling.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// ==========================================================
+// ƼƼ Ʈ  (sparse set + SoA)
+// - EntityId ->  ε (sparse),  迭 Ʈ  (SoA)
+//   ġ / ȸ(ʹϾ) /  /  AABB  / ޽ ȣ / LOD /   /  AABB
+// - Set*()  Ƽ ǥø ϰ, UpdateWorld()  Ƽ ͸ 4 SSE 
+//   (    Ʈ ٽ Ƽ  Ƿ  )
+// -   Ҹ ڸ ű ( ε ٲ  ڸ ٽ Ƽ)
+//  DirectXMath    Ծ: World = Scale * Rotation * Translation
+// ==========================================================
+
+using EntityId = std::uint32_t;
+constexpr EntityId InvalidEntity = 0xFFFFFFFFu;
+
+class TransformStorage
+{
+public:
+    void Reserve(std::uint32_t count);
+    void Clear();
+
+    EntityId Create(float x, float y, float z, std::uint32_t meshId);
+    void Destroy(EntityId entity);
+    bool IsAlive(EntityId entity)const;
+
+    //  迭  (0 ~ GetCount()-1). /ø   ε 
+    std::uint32_t GetCount()const { return (std::uint32_t)mEntities.size(); }
+    std::uint32_t GetIndex(EntityId entity)const { return mSparse[entity]; }
+    EntityId GetEntity(std::uint32_t index)const { return mEntities[index]; }
+
+    void SetPosition(EntityId entity, float x, float y, float z);
+    void Translate(EntityId entity, float dx, float dy, float dz);
+    void SetRotation(EntityId entity, float qx, float qy, float qz, float qw);
+    void SetRotationY(EntityId entity, float angle);
+    void SetScale(EntityId entity, float sx, float sy, float sz);
+    void SetLocalExtent(EntityId entity, float ex, float ey, float ez); //  ߽  AABB
+    void SetMeshId(EntityId entity, std::uint32_t meshId) { mMeshId[mSparse[entity]] = meshId; }
+
+    void GetPosition(EntityId entity, float& x, float& y, float& z)const;
+    std::uint32_t GetMeshId(std::uint32_t index)const { return mMeshId[index]; }
+    void GetLocalExtent(std::uint32_t index, float& ex, float& ey, float& ez)const { ex = mLocalExtX[index]; ey = mLocalExtY[index]; ez = mLocalExtZ[index]; }
+    float GetMaxScale(std::uint32_t index)const { return std::max({ std::fabs(mScaleX[index]), std::fabs(mScaleY[index]), std::fabs(mScaleZ[index]) }); }
+
+    //  ׸ LOD (LodSelection  ,   ׸ý )
+    std::uint32_t GetLod(std::uint32_t index)const { return mLod[index]; }
+    void SetLod(std::uint32_t index, std::uint32_t lod) { mLod[index] = (std::uint8_t)lod; }
+
+    // Ƽ ͵   /  AABB  ٽ 
+    //   JobSystem    ó
+    void UpdateWorld();
+
+    //  UpdateWorld()  ٲ  ε (  ſ)
+    const std::vector<std::uint32_t>& GetChanged()const { return mChanged; }
+
+    //  켱 4x4 (XMFLOAT4X4   ġ)
+    void GetWorldMatrix(std::uint32_t index, float out[16])const;
+    const AabbSoA& GetWorldBounds()const { return mWorldBounds; }
+
+private:
+    void MarkDirty(std::uint32_t index);
+    void UpdateRange(std::uint32_t begin, std::uint32_t end);
+    void UpdateOne(std::uint32_t index);
+
+private:
+    // sparse: EntityId ->  ε
+    std::vector<std::uint32_t> mSparse;
+    std::vector<EntityId> mFreeIds;
+
+    //  迭 (  )
+    std::vector<EntityId> mEntities;
+    std::vector<float> mPosX, mPosY, mPosZ;
+    std::vector<float> mRotX, mRotY, mRotZ, mRotW;
+    std::vector<float> mScaleX, mScaleY, mScaleZ;
+    std::vector<float> mLocalExtX, mLocalExtY, mLocalExtZ;
+    std::vector<std::uint32_t> mMeshId;
+    std::vector<std::uint8_t> mLod;
+
+    //   ȸ* 3x3 κ (̵ mPos ״)
+    std::vector<float> mM00, mM01, mM02;
+    std::vector<float> mM10, mM11, mM12;
+    std::vector<float> mM20, mM21, mM22;
+    AabbSoA mWorldBounds;
+
+    std::vector<std::uint8_t> mDirty;
+    std::vector<std::uint32_t> mDirtyList;
+    std::vector<std::uint32_t> mChanged;
+};
@@ -0,0 +1,248 @@
+#include "TransformStorageBenchmark.h"
+#include "TransformStorage.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr float MaxError = 1e-4f;
+
+    struct Shadow
+    {
+        bool Alive = false;
+        float Pos[3] = {};
+        float Rot[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+        float Scale[3] = { 1.0f, 1.0f, 1.0f };
+        float Ext[3] = {};
+    };
+
+    // : Scale * Rotation (XMMatrixRotationQuaternion ġ), ̵ ״
+    bool MatchesShadow(const TransformStorage& storage, std::uint32_t index, const Shadow& s)
+    {
+        const float qx = s.Rot[0], qy = s.Rot[1], qz = s.Rot[2], qw = s.Rot[3];
+        const float m[3][3] =
+        {
+            { s.Scale[0] * (1.0f - 2.0f * (qy * qy + qz * qz)), s.Scale[0] * 2.0f * (qx * qy + qw * qz), s.Scale[0] * 2.0f * (qx * qz - qw * qy) },
+            { s.Scale[1] * 2.0f * (qx * qy - qw * qz), s.Scale[1] * (1.0f - 2.0f * (qx * qx + qz * qz)), s.Scale[1] * 2.0f * (qy * qz + qw * qx) },
+            { s.Scale[2] * 2.0f * (qx * qz + qw * qy), s.Scale[2] * 2.0f * (qy * qz - qw * qx), s.Scale[2] * (1.0f - 2.0f * (qx * qx + qy * qy)) },
+        };
+
+        float world[16];
+        storage.GetWorldMatrix(index, world);
+
+        float error = 0.0f;
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 3; ++c)
+                error = std::max(error, std::fabs(world[r * 4 + c] - m[r][c]));
+            error = std::max(error, std::fabs(world[12 + r] - s.Pos[r]));
+        }
+
+        const AabbSoA& bounds = storage.GetWorldBounds();
+        const float center[3] = { bounds.CenterX[index], bounds.CenterY[index], bounds.CenterZ[index] };
+        const float extent[3] = { bounds.ExtentX[index], bounds.ExtentY[index], bounds.ExtentZ[index] };
+        for (int c = 0; c < 3; ++c)
+        {
+            const float expected = std::fabs(m[0][c]) * s.Ext[0] + std::fabs(m[1][c]) * s.Ext[1] + std::fabs(m[2][c]) * s.Ext[2];
+            error = std::max(error, std::fabs(center[c] - s.Pos[c]));
+            error = std::max(error, std::fabs(extent[c] - expected));
+        }
+        return error <= MaxError;
+    }
+
+    //  ƼƼ Ƽ  ä  ƼƼ  -> Ű ƼƼ ̹ /    ŵž 
+    bool CheckDestroyWhileLastDirty()
+    {
+        TransformStorage storage;
+        const EntityId first = storage.Create(0.0f, 0.0f, 0.0f, 0);
+        storage.Create(1.0f, 0.0f, 0.0f, 0);
+        const EntityId last = storage.Create(2.0f, 0.0f, 0.0f, 0);
+        storage.UpdateWorld();
+
+        storage.SetPosition(last, 5.0f, 0.0f, 0.0f);
+        storage.Destroy(first);
+        storage.UpdateWorld();
+
+        const std::uint32_t index = storage.GetIndex(last);
+        const std::vector<std::uint32_t>& changed = storage.GetChanged();
+        bool valid = index == 0 && std::find(changed.begin(), changed.end(), index) != changed.end();
+
+        float world[16];
+        storage.GetWorldMatrix(index, world);
+        valid &= world[12] == 5.0f;
+
+        //  ӿ ٽ ̸  ŵž  (Ƽ ǥð   ⼭ )
+        storage.SetPosition(last, 7.0f, 0.0f, 0.0f);
+        storage.UpdateWorld();
+        storage.GetWorldMatrix(index, world);
+        valid &= storage.GetChanged().size() == 1 && storage.GetChanged()[0] == index && world[12] == 7.0f;
+        return valid;
+    }
+}
+
+namespace TransformStorageBenchmark
+{
+    TransformStorageBenchmarkResult Run(std::uint32_t entities, std::uint32_t frames, std::uint32_t seed)
+    {
+        TransformStorageBenchmarkResult result;
+        result.Entities = entities;
+        result.Frames = frames;
+
+        //  ٲ UpdateWorld   ý 
+        JobSystem::GetInstance()->Initialize();
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> extent(0.1f, 4.0f);
+        std::uniform_int_distribution<std::uint32_t> percent(0, 99);
+
+        TransformStorage storage;
+        storage.Reserve(entities);
+        std::vector<Shadow> shadows;
+
+        auto create = [&]()
+        {
+            Shadow s;
+            s.Alive = true;
+            for (float& p : s.Pos)
+                p = position(rng);
+            for (float& e : s.Ext)
+                e = extent(rng);
+
+            const EntityId entity = storage.Create(s.Pos[0], s.Pos[1], s.Pos[2], 0);
+            storage.SetLocalExtent(entity, s.Ext[0], s.Ext[1], s.Ext[2]);
+            if (entity >= shadows.size())
+                shadows.resize(entity + 1);
+            shadows[entity] = s;
+        };
+
+        for (std::uint32_t i = 0; i < entities; ++i)
+            create();
+        storage.UpdateWorld();
+
+        std::vector<std::uint32_t> movedIndex;        //    ε (Ű )
+        std::vector<std::uint8_t> touched;
+        std::vector<std::uint8_t> reported;
+        double updateMs = 0.0;
+
+        for (std::uint32_t frame = 0; frame < frames; ++frame)
+        {
+            touched.assign(shadows.size() + entities, 0);
+
+            // 1. : κ  ,   ̻ ( )
+            const std::uint32_t moveRatio = frame % 10 == 0 ? 60 : 2;
+            for (std::uint32_t i = 0; i < storage.GetCount(); ++i)
+            {
+                if (percent(rng) >= moveRatio)
+                    continue;
+
+                const EntityId entity = storage.GetEntity(i);
+                Shadow& s = shadows[entity];
+                switch (percent(rng) % 3)
+                {
+                case 0:
+                    for (float& p : s.Pos)
+                        p = position(rng);
+                    storage.SetPosition(entity, s.Pos[0], s.Pos[1], s.Pos[2]);
+                    break;
+                case 1:
+                {
+                    float q[4] = { unit(rng), unit(rng), unit(rng), unit(rng) };
+                    const float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+                    for (int c = 0; c < 4; ++c)
+                        s.Rot[c] = length > 0.0f ? q[c] / length : (c == 3 ? 1.0f : 0.0f);
+                    storage.SetRotation(entity, s.Rot[0], s.Rot[1], s.Rot[2], s.Rot[3]);
+                    break;
+                }
+                default:
+                    for (float& c : s.Scale)
+                        c = 0.5f + 0.5f * (unit(rng) + 1.0f);
+                    storage.SetScale(entity, s.Scale[0], s.Scale[1], s.Scale[2]);
+                    break;
+                }
+                touched[entity] = 1;
+                ++result.Moved;
+            }
+
+            // 2.  /   ( 0.5%, Ƽ  ƼƼ Ű 찡  )
+            movedIndex.assign(shadows.size(), InvalidEntity);
+            for (std::uint32_t i = 0; i < storage.GetCount(); ++i)
+                movedIndex[storage.GetEntity(i)] = i;
+
+            const std::uint32_t churn = std::max(1u, storage.GetCount() / 200);
+            for (std::uint32_t c = 0; c < churn && storage.GetCount() > 1; ++c)
+            {
+                const EntityId entity = storage.GetEntity(std::uniform_int_distribution<std::uint32_t>(0, storage.GetCount() - 1)(rng));
+                storage.Destroy(entity);
+                shadows[entity].Alive = false;
+                ++result.Destroyed;
+            }
+            for (std::uint32_t c = 0; c < churn; ++c)
+                create();
+
+            // 3. 
+            Clock::time_point t0 = Clock::now();
+            storage.UpdateWorld();
+            updateMs += ElapsedMs(t0, Clock::now());
+
+            // 4.  ƼƼ , ٲ  / Ű  /    GetChanged  ־ 
+            reported.assign(storage.GetCount(), 0);
+            for (std::uint32_t index : storage.GetChanged())
+                reported[index] = 1;
+
+            for (std::uint32_t i = 0; i < storage.GetCount(); ++i)
+            {
+                const EntityId entity = storage.GetEntity(i);
+                if (!MatchesShadow(storage, i, shadows[entity]))
+                    ++result.WorldMismatches;
+
+                const bool isNew = entity >= movedIndex.size() || movedIndex[entity] == InvalidEntity;
+                const bool mustReport = touched[entity] != 0 || isNew || movedIndex[entity] != i;
+                if (mustReport && reported[i] == 0)
+                    ++result.MissingChanged;
+            }
+        }
+
+        result.UpdateMs = frames > 0 ? updateMs / frames : 0.0;
+        result.DestroyDirtyLast = CheckDestroyWhileLastDirty();
+        result.Valid = result.WorldMismatches == 0 && result.MissingChanged == 0 && result.DestroyDirtyLast;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[TransformStorageBenchmark]\n";
+        report += "  entities  frames   moved  destroyed  update(ms)  mismatches  missing  destroy-dirty  valid\n";
+
+        bool valid = true;
+        for (std::uint32_t count : { 10000u, 100000u })
+        {
+            TransformStorageBenchmarkResult r = Run(count, 60);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%10u %7u %7llu %10llu %11.3f %11llu %8llu %14s  %s\n",
+                r.Entities, r.Frames, (unsigned long long)r.Moved, (unsigned long long)r.Destroyed, r.UpdateMs,
+                (unsigned long long)r.WorldMismatches, (unsigned long long)r.MissingChanged,
+                r.DestroyDirtyLast ? "yes" : "NO", r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// Ʈ  Ȯ /  (߿, 帮)
+// ƼƼ entities  ΰ Ӹ Ϻθ ̰ /  /    UpdateWorld()
+//  Ȯ (ƼƼ ġ / ȸ /  /     ִ ׸ 𵨰 ):
+//   1.    ƼƼ   /  AABB = ׸  Į  
+//   2. ̹ ӿ ٲų  ε Ű ƼƼ  GetChanged()  
+//   3.  ƼƼ Ƽ ä ٸ ƼƼ   (Ű ƼƼ  ӿ ŵǴ)
+// ==========================================================
+
+struct TransformStorageBenchmarkResult
+{
+    std::uint32_t Entities = 0;
+    std::uint32_t Frames = 0;
+
+    std::uint64_t Moved = 0;            // Ӹ   
+    std::uint64_t Destroyed = 0;
+    double UpdateMs = 0.0;              // UpdateWorld   ()
+
+    std::uint64_t WorldMismatches = 0;  // ׸ 𵨰 ٸ ƼƼ ( )
+    std::uint64_t MissingChanged = 0;   // ٲµ GetChanged   ƼƼ ( )
+    bool DestroyDirtyLast = false;      // 3  
+    bool Valid = false;
+};
+
+namespace TransformStorageBenchmark
+{
+    TransformStorageBenchmarkResult Run(std::uint32_t entities, std::uint32_t frames, std::uint32_t seed = 31);
+
+    // 1  / 10  ƼƼ x 60 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
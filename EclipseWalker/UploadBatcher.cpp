@@ -0,0 +1,149 @@
+#include "UploadBatcher.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+UploadBatcher::UploadBatcher(UploadBackend* backend, std::uint8_t* stagingMemory, std::uint64_t capacity, std::uint64_t maxBatchBytes)
+    : mBackend(backend), mStaging(stagingMemory), mMaxBatchBytes(maxBatchBytes)
+{
+    assert(backend != nullptr && stagingMemory != nullptr);
+    assert(capacity % TextureAlignment == 0);
+
+    mRing.Reset(capacity);
+}
+
+std::uint64_t UploadBatcher::AllocateStaging(std::uint64_t size, std::uint64_t alignment)
+{
+    std::uint64_t offset = mRing.Allocate(size, alignment);
+
+    while (offset == UploadRingAllocator::InvalidOffset)
+    {
+        // 1.    ġ     
+        if (!mPending.empty())
+            Flush();
+
+        // 2.   ġ   ٷȴٰ ȯ
+        const UploadTicket oldest = mRing.GetOldestFence();
+        if (oldest == 0)
+            throw std::length_error("UploadBatcher: upload larger than staging ring");
+
+        WaitForTicket(oldest);
+        offset = mRing.Allocate(size, alignment);
+    }
+
+    return offset;
+}
+
+void UploadBatcher::AddCommand(const UploadCopyCommand& command)
+{
+    mPending.push_back(command);
+    mPendingBytes += command.Size;
+}
+
+UploadTicket UploadBatcher::UploadBuffer(void* dst, std::uint64_t dstOffset, const void* data, std::uint64_t size)
+{
+    if (size == 0)
+        return 0;
+
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(data);
+    const std::uint64_t chunkSize = mRing.GetCapacity() / 4;
+
+    // ū ۴  ( ʿϸ  ġ  ٸ)
+    for (std::uint64_t done = 0; done < size;)
+    {
+        const std::uint64_t bytes = std::min(chunkSize, size - done);
+        const std::uint64_t offset = AllocateStaging(bytes, BufferAlignment);
+        memcpy(mStaging + offset, src + done, (size_t)bytes);
+
+        UploadCopyCommand command;
+        command.Kind = UploadCopyCommand::Type::Buffer;
+        command.Dst = dst;
+        command.DstOffset = dstOffset + done;
+        command.SrcOffset = offset;
+        command.Size = bytes;
+        AddCommand(command);
+
+        done += bytes;
+        if (mPendingBytes >= mMaxBatchBytes && done < size)
+            Flush();
+    }
+
+    //  ε    ġ Ƽ
+    const UploadTicket ticket = mNextTicket;
+    if (mPendingBytes >= mMaxBatchBytes)
+        Flush();
+    return ticket;
+}
+
+UploadTicket UploadBatcher::UploadTexture(void* dst, std::uint32_t subresource, const UploadTextureFootprint& footprint,
+    const void* data, std::uint64_t srcRowPitch, std::uint64_t srcSlicePitch)
+{
+    assert(footprint.RowBytes <= footprint.RowPitch && footprint.RowBytes <= srcRowPitch);
+
+    const std::uint64_t sliceBytes = (std::uint64_t)footprint.RowPitch * footprint.RowCount;
+    const std::uint64_t size = sliceBytes * footprint.Depth;
+    const std::uint64_t offset = AllocateStaging(size, TextureAlignment);
+
+    //   ٸǷ  ྿ 
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(data);
+    for (std::uint32_t z = 0; z < footprint.Depth; ++z)
+    {
+        std::uint8_t* dstSlice = mStaging + offset + z * sliceBytes;
+        const std::uint8_t* srcSlice = src + z * srcSlicePitch;
+        for (std::uint32_t row = 0; row < footprint.RowCount; ++row)
+            memcpy(dstSlice + (std::uint64_t)row * footprint.RowPitch, srcSlice + row * srcRowPitch, (size_t)footprint.RowBytes);
+    }
+
+    UploadCopyCommand command;
+    command.Kind = UploadCopyCommand::Type::Texture;
+    command.Dst = dst;
+    command.Subresource = subresource;
+    command.SrcOffset = offset;
+    command.Size = size;
+    command.Footprint = footprint;
+    AddCommand(command);
+
+    const UploadTicket ticket = mNextTicket;
+    if (mPendingBytes >= mMaxBatchBytes)
+        Flush();
+    return ticket;
+}
+
+UploadTicket UploadBatcher::Flush()
+{
+    if (mPending.empty())
+        return mNextTicket - 1;
+
+    const UploadTicket ticket = mNextTicket++;
+    mBackend->SubmitUploads(mPending.data(), mPending.size(), ticket);
+
+    //  ġ  ¡  ticket   ȯ
+    mRing.FinishFrame(ticket);
+
+    mPending.clear();
+    mPendingBytes = 0;
+    return ticket;
+}
+
+void UploadBatcher::Retire()
+{
+    mCompletedTicket = std::max(mCompletedTicket, mBackend->GetCompletedTicket());
+    mRing.Retire(mCompletedTicket);
+}
+
+void UploadBatcher::WaitForTicket(UploadTicket ticket)
+{
+    //    ġ ٸ   
+    if (ticket >= mNextTicket)
+        Flush();
+
+    if (!IsComplete(ticket))
+    {
+        Retire();
+        if (!IsComplete(ticket))
+            mBackend->WaitForTicket(ticket);
+    }
+
+    Retire();
+}
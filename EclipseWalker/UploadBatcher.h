@@ -0,0 +1,100 @@
+#pragma once
+#include "UploadRingAllocator.h"
+#include <vector>
+
+// ==========================================================
+// ε ġ ó (GPU  ϴ κ)
+// - /ؽó   ¡  ϰ   Ƶ
+// - Flush()ϸ     鿣 ѱ (D3D  ť )
+// - ε帶 Ƽ(=  ť 潺 ) .  Ƽ  ҽ   
+// -       ġ     ġ ٸ
+// ū ۴  1/4 ũ   ø
+// ==========================================================
+
+// 0 ̸ "̹   "
+using UploadTicket = std::uint64_t;
+
+//   ؽó ġ  (D3D12_SUBRESOURCE_FOOTPRINT +  )
+struct UploadTextureFootprint
+{
+    std::uint32_t Format = 0;
+    std::uint32_t Width = 0;
+    std::uint32_t Height = 0;
+    std::uint32_t Depth = 1;
+    std::uint32_t RowPitch = 0;  // ¡    (ĵ)
+    std::uint32_t RowCount = 0;  //      ( ̸  )
+    std::uint64_t RowBytes = 0;  //     ũ
+};
+
+struct UploadCopyCommand
+{
+    enum class Type : std::uint8_t { Buffer, Texture };
+
+    Type Kind = Type::Buffer;
+    void* Dst = nullptr;          // 鿣尡 ؼ (D3D  ID3D12Resource*)
+    std::uint64_t DstOffset = 0;  // 
+    std::uint32_t Subresource = 0; // ؽó
+    std::uint64_t SrcOffset = 0;  // ¡   ġ
+    std::uint64_t Size = 0;
+    UploadTextureFootprint Footprint;
+};
+
+class UploadBackend
+{
+public:
+    virtual ~UploadBackend() = default;
+
+    //  ϰ   ticket  ȣؾ 
+    virtual void SubmitUploads(const UploadCopyCommand* commands, std::size_t count, UploadTicket ticket) = 0;
+    virtual UploadTicket GetCompletedTicket() = 0;
+    virtual void WaitForTicket(UploadTicket ticket) = 0;
+};
+
+class UploadBatcher
+{
+public:
+    static constexpr std::uint64_t BufferAlignment = 16;
+    static constexpr std::uint64_t TextureAlignment = 512;  // D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+
+    // stagingMemory  capacity Ʈ (TextureAlignment ). ġ maxBatchBytes   ڵ Flush
+    UploadBatcher(UploadBackend* backend, std::uint8_t* stagingMemory, std::uint64_t capacity, std::uint64_t maxBatchBytes);
+    UploadBatcher(const UploadBatcher& rhs) = delete;
+    UploadBatcher& operator=(const UploadBatcher& rhs) = delete;
+
+    UploadTicket UploadBuffer(void* dst, std::uint64_t dstOffset, const void* data, std::uint64_t size);
+
+    // srcRowPitch / srcSlicePitch     
+    UploadTicket UploadTexture(void* dst, std::uint32_t subresource, const UploadTextureFootprint& footprint,
+        const void* data, std::uint64_t srcRowPitch, std::uint64_t srcSlicePitch);
+
+    //   . ȯ ݱ û ε尡   Ƽ
+    UploadTicket Flush();
+
+    //  ġ ¡  ȯ (  ȣ)
+    void Retire();
+
+    bool IsComplete(UploadTicket ticket)const { return ticket <= mCompletedTicket; }
+    void WaitForTicket(UploadTicket ticket);
+    void WaitIdle() { WaitForTicket(Flush()); }
+
+    std::uint64_t GetPendingBytes()const { return mPendingBytes; }
+    std::uint64_t GetStagingUsedBytes()const { return mRing.GetUsedBytes(); }
+    std::uint64_t GetSubmittedBatchCount()const { return mNextTicket - 1; }
+
+private:
+    std::uint64_t AllocateStaging(std::uint64_t size, std::uint64_t alignment);
+    void AddCommand(const UploadCopyCommand& command);
+
+private:
+    UploadBackend* mBackend = nullptr;
+    std::uint8_t* mStaging = nullptr;
+    std::uint64_t mMaxBatchBytes = 0;
+
+    UploadRingAllocator mRing;
+
+    std::vector<UploadCopyCommand> mPending;
+    std::uint64_t mPendingBytes = 0;
+
+    UploadTicket mNextTicket = 1;      //   ġ  Ƽ
+    UploadTicket mCompletedTicket = 0;
+};
@@ -0,0 +1,231 @@
+#include "UploadBatcherBenchmark.h"
+#include "DelayedUploadBackend.h"
+#include "UploadBatcher.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr std::uint32_t TexelBytes = 4;     // RGBA8
+    constexpr std::uint32_t TextureFormat = 28; // DXGI_FORMAT_R8G8B8A8_UNORM
+    constexpr std::uint32_t RowPitchAlignment = 256;
+
+    // ε帶 ٸ Ʈ  (   ʰ ٽ  )
+    inline std::uint8_t Pattern(std::uint64_t upload, std::uint64_t i)
+    {
+        std::uint64_t x = (upload + 1) * 0x9E3779B97F4A7C15ull + i * 0xBF58476D1CE4E5B9ull;
+        x ^= x >> 29;
+        return (std::uint8_t)(x ^ (x >> 32));
+    }
+
+    struct PendingUpload
+    {
+        UploadTicket Ticket = 0;
+        std::uint64_t Id = 0;
+        std::vector<std::uint8_t> Dst; //  ( Ǵ   ؽó)
+    };
+}
+
+namespace UploadBatcherBenchmark
+{
+    UploadBatcherBenchmarkResult Run(std::uint64_t stagingBytes, std::uint64_t maxBatchBytes, std::uint32_t completionDelay,
+        std::uint32_t frames, std::uint32_t seed)
+    {
+        UploadBatcherBenchmarkResult result;
+        result.StagingBytes = stagingBytes;
+        result.MaxBatchBytes = maxBatchBytes;
+        result.CompletionDelay = completionDelay;
+        result.Frames = frames;
+
+        std::vector<std::uint8_t> staging(stagingBytes);
+        DelayedUploadBackend backend(staging.data(), completionDelay);
+        UploadBatcher batcher(&backend, staging.data(), stagingBytes, maxBatchBytes);
+
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<std::uint32_t> percent(0, 99);
+
+        std::vector<std::unique_ptr<PendingUpload>> pending;
+        std::vector<std::uint8_t> source;
+        std::uint64_t stagedBytes = 0;
+        std::uint64_t largestCommand = 0;
+        UploadTicket lastTicket = 0;
+        double cpuMs = 0.0;
+
+        // Ϸ ε带  ϰ Ͽ 
+        auto verifyCompleted = [&]()
+        {
+            for (std::size_t i = 0; i < pending.size();)
+            {
+                PendingUpload& upload = *pending[i];
+                if (!batcher.IsComplete(upload.Ticket))
+                {
+                    ++i;
+                    continue;
+                }
+
+                for (std::uint64_t b = 0; b < upload.Dst.size(); ++b)
+                {
+                    if (upload.Dst[b] != Pattern(upload.Id, b))
+                    {
+                        ++result.DataMismatches;
+                        break;
+                    }
+                }
+
+                pending[i] = std::move(pending.back());
+                pending.pop_back();
+            }
+        };
+
+        for (std::uint32_t frame = 0; frame < frames; ++frame)
+        {
+            const std::uint32_t uploads = std::uniform_int_distribution<std::uint32_t>(1, 16)(rng);
+            for (std::uint32_t u = 0; u < uploads; ++u)
+            {
+                auto upload = std::make_unique<PendingUpload>();
+                upload->Id = result.Uploads++;
+
+                UploadTicket ticket = 0;
+                const std::uint32_t kind = percent(rng);
+                if (kind < 60)
+                {
+                    // 1. : κ ۰,   Ŀ  
+                    std::uint64_t size = std::uniform_int_distribution<std::uint64_t>(16, 64 * 1024)(rng);
+                    if (kind < 1)
+                        size = std::uniform_int_distribution<std::uint64_t>(stagingBytes / 2, stagingBytes * 3 / 2)(rng);
+
+                    source.resize((size_t)size);
+                    for (std::uint64_t b = 0; b < size; ++b)
+                        source[b] = Pattern(upload->Id, b);
+                    upload->Dst.assign((size_t)size, 0);
+
+                    Clock::time_point t0 = Clock::now();
+                    ticket = batcher.UploadBuffer(upload->Dst.data(), 0, source.data(), size);
+                    cpuMs += ElapsedMs(t0, Clock::now());
+
+                    stagedBytes += size;
+                    largestCommand = std::max(largestCommand, std::min(size, stagingBytes / 4));
+                }
+                else
+                {
+                    // 2. ؽó:   ݿ , ¡   256  ( 1/4 )
+                    UploadTextureFootprint footprint;
+                    footprint.Format = TextureFormat;
+                    footprint.Depth = percent(rng) < 10 ? 4 : 1;
+                    do
+                    {
+                        footprint.Width = 1u << std::uniform_int_distribution<std::uint32_t>(2, 9)(rng);
+                        footprint.Height = 1u << std::uniform_int_distribution<std::uint32_t>(2, 9)(rng);
+                        footprint.RowBytes = (std::uint64_t)footprint.Width * TexelBytes;
+                        footprint.RowPitch = (std::uint32_t)((footprint.RowBytes + RowPitchAlignment - 1) & ~(std::uint64_t)(RowPitchAlignment - 1));
+                        footprint.RowCount = footprint.Height;
+                    } while ((std::uint64_t)footprint.RowPitch * footprint.RowCount * footprint.Depth > stagingBytes / 4);
+
+                    const std::uint64_t srcRowPitch = footprint.RowBytes + std::uniform_int_distribution<std::uint32_t>(0, 3)(rng) * 16;
+                    const std::uint64_t srcSlicePitch = srcRowPitch * footprint.RowCount;
+                    const std::uint64_t dstSlice = footprint.RowBytes * footprint.RowCount;
+
+                    source.assign((size_t)(srcSlicePitch * footprint.Depth), 0xCD); //   Ÿ  
+                    for (std::uint32_t z = 0; z < footprint.Depth; ++z)
+                        for (std::uint32_t row = 0; row < footprint.RowCount; ++row)
+                            for (std::uint64_t b = 0; b < footprint.RowBytes; ++b)
+                                source[z * srcSlicePitch + row * srcRowPitch + b] = Pattern(upload->Id, z * dstSlice + row * footprint.RowBytes + b);
+                    upload->Dst.assign((size_t)(dstSlice * footprint.Depth), 0);
+
+                    Clock::time_point t0 = Clock::now();
+                    ticket = batcher.UploadTexture(upload->Dst.data(), 0, footprint, source.data(), srcRowPitch, srcSlicePitch);
+                    cpuMs += ElapsedMs(t0, Clock::now());
+
+                    const std::uint64_t size = (std::uint64_t)footprint.RowPitch * footprint.RowCount * footprint.Depth;
+                    stagedBytes += size;
+                    largestCommand = std::max(largestCommand, size);
+                }
+
+                // Ƽ  ʰ,    ġ   
+                if (ticket == 0 || ticket < lastTicket || ticket > batcher.GetSubmittedBatchCount() + 1)
+                    ++result.Errors;
+                lastTicket = ticket;
+
+                upload->Ticket = ticket;
+                pending.push_back(std::move(upload));
+            }
+
+            // 3.  : ,  ť  ĭ ,  ¡ ȯ
+            Clock::time_point t0 = Clock::now();
+            batcher.Flush();
+            cpuMs += ElapsedMs(t0, Clock::now());
+
+            backend.Tick();
+
+            t0 = Clock::now();
+            batcher.Retire();
+            cpuMs += ElapsedMs(t0, Clock::now());
+
+            if (batcher.GetStagingUsedBytes() > stagingBytes)
+                ++result.Errors;
+            verifyCompleted();
+        }
+
+        // 4.  ٸ  Ϸ, ¡  
+        batcher.WaitIdle();
+        verifyCompleted();
+        if (!pending.empty() || batcher.GetStagingUsedBytes() != 0 ||
+            backend.GetCompletedTicket() != batcher.GetSubmittedBatchCount())
+        {
+            ++result.Errors;
+        }
+
+        if (backend.GetOrderErrors() != 0 || backend.GetLargestBatchBytes() > maxBatchBytes + largestCommand)
+            ++result.Errors;
+
+        result.Batches = backend.GetSubmittedBatches();
+        result.CommandsPerBatch = result.Batches > 0 ? (double)backend.GetSubmittedCommands() / (double)result.Batches : 0.0;
+        result.Waits = backend.GetWaitCount();
+        result.StagingLaps = (double)stagedBytes / (double)stagingBytes;
+        result.MBPerFrame = frames > 0 ? (double)stagedBytes / (1024.0 * 1024.0) / frames : 0.0;
+        result.CpuMsPerFrame = frames > 0 ? cpuMs / frames : 0.0;
+
+        result.Valid = result.DataMismatches == 0 && result.Errors == 0 && result.StagingLaps > 1.0;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[UploadBatcherBenchmark]\n";
+        report += "  staging(KB)  batch(KB)  delay  uploads  batches  cmds/batch  waits  laps  MB/frame  ms/frame  valid\n";
+
+        const struct { std::uint64_t Staging, Batch; std::uint32_t Delay; } cases[] =
+        {
+            { 1ull << 20, 256ull << 10, 4 }, { 4ull << 20, 1ull << 20, 2 }, { 32ull << 20, 4ull << 20, 3 },
+        };
+
+        bool valid = true;
+        for (const auto& c : cases)
+        {
+            UploadBatcherBenchmarkResult r = Run(c.Staging, c.Batch, c.Delay, 300);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%13llu %10llu %6u %8llu %8llu %11.1f %6llu %5.0f %9.2f %9.3f  %s\n",
+                (unsigned long long)(r.StagingBytes >> 10), (unsigned long long)(r.MaxBatchBytes >> 10), r.CompletionDelay,
+                (unsigned long long)r.Uploads, (unsigned long long)r.Batches, r.CommandsPerBatch, (unsigned long long)r.Waits,
+                r.StagingLaps, r.MBPerFrame, r.CpuMsPerFrame, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ε ġ ó Ȯ /  (߿, 帮, GPU )
+// UploadBatcher  DelayedUploadBackend (  delay  ڿ  Ϸ)   frames  
+// Ӹ  (16 B ~ 64 KB,   ū )  ؽó (  ٸ )   ø
+//  Ȯ:
+//   1. ġ: Ƽ 1  ø ǰ, ġ ũ <= maxBatchBytes +  ϳ
+//   2. Ƽ: IsComplete(ticket)  Ǹ  Ͱ  Ʈ   (   ٰ  )
+//   3. ¡ :    Ƶ        ( 񱳷 巯)
+//   4. WaitIdle ڿ ¡ 뷮 0,  Ƽ Ϸ
+// ==========================================================
+
+struct UploadBatcherBenchmarkResult
+{
+    std::uint64_t StagingBytes = 0;
+    std::uint64_t MaxBatchBytes = 0;
+    std::uint32_t CompletionDelay = 0;  // 
+    std::uint32_t Frames = 0;
+
+    std::uint64_t Uploads = 0;
+    std::uint64_t Batches = 0;
+    double CommandsPerBatch = 0.0;
+    std::uint64_t Waits = 0;            //    ϷḦ ٸ Ƚ
+    double StagingLaps = 0.0;           // ¡   / 뷮 (  )
+
+    double MBPerFrame = 0.0;
+    double CpuMsPerFrame = 0.0;         // UploadBuffer / UploadTexture / Flush / Retire (¡ memcpy )
+
+    std::uint64_t DataMismatches = 0;   // Ϸ Ƽε   ٸ ε
+    std::uint64_t Errors = 0;           // Ƽ , ġ ũ,  
+    bool Valid = false;
+};
+
+namespace UploadBatcherBenchmark
+{
+    UploadBatcherBenchmarkResult Run(std::uint64_t stagingBytes, std::uint64_t maxBatchBytes, std::uint32_t completionDelay,
+        std::uint32_t frames, std::uint32_t seed = 35);
+
+    // (1 MB, 256 KB, 4 ) / (4 MB, 1 MB, 2) / (32 MB, 4 MB, 3: UploadManager ⺻) x 300 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -11,11 +11,14 @@ public:
         mElementByteSize = sizeof(T);
 
         if (isConstantBuffer)
-            mElementByteSize = CalcConstantBufferByteSize(sizeof(T));
+            mElementByteSize = d3dUtil::CalcConstantBufferByteSize(sizeof(T));
+
+        auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+        auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer((UINT64)mElementByteSize * elementCount);
         ThrowIfFailed(device->CreateCommittedResource(
-            &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
+            &heapProps,
             D3D12_HEAP_FLAG_NONE,
-            &CD3DX12_RESOURCE_DESC::Buffer(mElementByteSize * elementCount),
+            &bufferDesc,
             D3D12_RESOURCE_STATE_GENERIC_READ,
             nullptr,
             IID_PPV_ARGS(&mUploadBuffer)));
@@ -46,11 +49,6 @@ public:
     }
 
 private:
-    UINT CalcConstantBufferByteSize(UINT byteSize)
-    {
-        return (byteSize + 255) & ~255;
-    }
-
     ComPtr<ID3D12Resource> mUploadBuffer;
     BYTE* mMappedData = nullptr;
 
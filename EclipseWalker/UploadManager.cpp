@@ -0,0 +1,194 @@
+#include "UploadManager.h"
+
+// ---------------------------------------------------------
+//  ť 鿣
+// ---------------------------------------------------------
+CopyQueueUploadBackend::CopyQueueUploadBackend(ID3D12Device* device, ID3D12Resource* stagingBuffer)
+    : mDevice(device), mStagingBuffer(stagingBuffer)
+{
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+    queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+    ThrowIfFailed(mDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&mQueue)));
+
+    ThrowIfFailed(mDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&mFence)));
+
+    mFenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (mFenceEvent == nullptr)
+    {
+        ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
+    }
+
+    //  Ʈ ù   Ҵڿ Բ Reset
+    ID3D12CommandAllocator* allocator = AcquireAllocator();
+    ThrowIfFailed(mDevice->CreateCommandList(
+        0,
+        D3D12_COMMAND_LIST_TYPE_COPY,
+        allocator,
+        nullptr,
+        IID_PPV_ARGS(&mCommandList)));
+    mCommandList->Close();
+}
+
+CopyQueueUploadBackend::~CopyQueueUploadBackend()
+{
+    if (mFenceEvent != nullptr)
+        CloseHandle(mFenceEvent);
+}
+
+ID3D12CommandAllocator* CopyQueueUploadBackend::AcquireAllocator()
+{
+    //   Ҵڰ  , ƴϸ  
+    if (!mAllocators.empty() && mAllocators.front().Ticket <= mFence->GetCompletedValue())
+    {
+        PooledAllocator pooled = std::move(mAllocators.front());
+        mAllocators.pop_front();
+        ThrowIfFailed(pooled.Allocator->Reset());
+        mAllocators.push_back(std::move(pooled));
+    }
+    else
+    {
+        PooledAllocator pooled;
+        ThrowIfFailed(mDevice->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_COPY,
+            IID_PPV_ARGS(&pooled.Allocator)));
+        mAllocators.push_back(std::move(pooled));
+    }
+
+    return mAllocators.back().Allocator.Get();
+}
+
+void CopyQueueUploadBackend::SubmitUploads(const UploadCopyCommand* commands, std::size_t count, UploadTicket ticket)
+{
+    // 1.  
+    ID3D12CommandAllocator* allocator = AcquireAllocator();
+    mAllocators.back().Ticket = ticket;
+    ThrowIfFailed(mCommandList->Reset(allocator, nullptr));
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const UploadCopyCommand& command = commands[i];
+        ID3D12Resource* dst = static_cast<ID3D12Resource*>(command.Dst);
+
+        if (command.Kind == UploadCopyCommand::Type::Buffer)
+        {
+            mCommandList->CopyBufferRegion(dst, command.DstOffset, mStagingBuffer, command.SrcOffset, command.Size);
+        }
+        else
+        {
+            D3D12_PLACED_SUBRESOURCE_FOOTPRINT layout = {};
+            layout.Offset = command.SrcOffset;
+            layout.Footprint.Format = (DXGI_FORMAT)command.Footprint.Format;
+            layout.Footprint.Width = command.Footprint.Width;
+            layout.Footprint.Height = command.Footprint.Height;
+            layout.Footprint.Depth = command.Footprint.Depth;
+            layout.Footprint.RowPitch = command.Footprint.RowPitch;
+
+            CD3DX12_TEXTURE_COPY_LOCATION dstLocation(dst, command.Subresource);
+            CD3DX12_TEXTURE_COPY_LOCATION srcLocation(mStagingBuffer, layout);
+            mCommandList->CopyTextureRegion(&dstLocation, 0, 0, 0, &srcLocation, nullptr);
+        }
+    }
+
+    ThrowIfFailed(mCommandList->Close());
+
+    // 2.  ť ϰ Ƽ  ȣ
+    ID3D12CommandList* cmdsLists[] = { mCommandList.Get() };
+    mQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
+    ThrowIfFailed(mQueue->Signal(mFence.Get(), ticket));
+}
+
+void CopyQueueUploadBackend::WaitForTicket(UploadTicket ticket)
+{
+    if (mFence->GetCompletedValue() >= ticket)
+        return;
+
+    ThrowIfFailed(mFence->SetEventOnCompletion(ticket, mFenceEvent));
+    WaitForSingleObject(mFenceEvent, INFINITE);
+}
+
+// ---------------------------------------------------------
+// ε 
+// ---------------------------------------------------------
+UploadManager::UploadManager(ID3D12Device* device, UINT64 stagingCapacity, UINT64 maxBatchBytes)
+    : mDevice(device)
+{
+    //  Ƶ ؽó (512) ǵ
+    stagingCapacity = (stagingCapacity + UploadBatcher::TextureAlignment - 1) & ~(UploadBatcher::TextureAlignment - 1);
+
+    auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+    auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(stagingCapacity);
+
+    ThrowIfFailed(mDevice->CreateCommittedResource(
+        &heapProps,
+        D3D12_HEAP_FLAG_NONE,
+        &bufferDesc,
+        D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr,
+        IID_PPV_ARGS(&mStagingBuffer)));
+
+    ThrowIfFailed(mStagingBuffer->Map(0, nullptr, reinterpret_cast<void**>(&mMappedData)));
+
+    mBackend = std::make_unique<CopyQueueUploadBackend>(mDevice, mStagingBuffer.Get());
+    mBatcher = std::make_unique<UploadBatcher>(mBackend.get(), mMappedData, stagingCapacity, maxBatchBytes);
+}
+
+UploadManager::~UploadManager()
+{
+    //  ť ¡ д   
+    if (mBatcher != nullptr)
+        mBatcher->WaitIdle();
+
+    if (mStagingBuffer != nullptr)
+        mStagingBuffer->Unmap(0, nullptr);
+
+    mMappedData = nullptr;
+}
+
+UploadTicket UploadManager::UploadBuffer(ID3D12Resource* dst, UINT64 dstOffset, const void* data, UINT64 byteSize)
+{
+    return mBatcher->UploadBuffer(dst, dstOffset, data, byteSize);
+}
+
+UploadTicket UploadManager::UploadTexture(ID3D12Resource* dst, UINT firstSubresource, UINT numSubresources,
+    const D3D12_SUBRESOURCE_DATA* srcData)
+{
+    const D3D12_RESOURCE_DESC desc = dst->GetDesc();
+    UploadTicket ticket = 0;
+
+    // 긮ҽ   ġ(  256 ) ޾Ƽ  
+    for (UINT i = 0; i < numSubresources; ++i)
+    {
+        D3D12_PLACED_SUBRESOURCE_FOOTPRINT layout;
+        UINT numRows = 0;
+        UINT64 rowSizeInBytes = 0;
+        mDevice->GetCopyableFootprints(&desc, firstSubresource + i, 1, 0, &layout, &numRows, &rowSizeInBytes, nullptr);
+
+        UploadTextureFootprint footprint;
+        footprint.Format = (std::uint32_t)layout.Footprint.Format;
+        footprint.Width = layout.Footprint.Width;
+        footprint.Height = layout.Footprint.Height;
+        footprint.Depth = layout.Footprint.Depth;
+        footprint.RowPitch = layout.Footprint.RowPitch;
+        footprint.RowCount = numRows;
+        footprint.RowBytes = rowSizeInBytes;
+
+        ticket = mBatcher->UploadTexture(dst, firstSubresource + i, footprint,
+            srcData[i].pData, (std::uint64_t)srcData[i].RowPitch, (std::uint64_t)srcData[i].SlicePitch);
+    }
+
+    return ticket;
+}
+
+void UploadManager::Update()
+{
+    mBatcher->Flush();
+    mBatcher->Retire();
+}
+
+void UploadManager::QueueWait(ID3D12CommandQueue* queue, UploadTicket ticket)
+{
+    //    ġ   ( ׷ ׷Ƚ ť  ٸ)
+    mBatcher->Flush();
+    ThrowIfFailed(queue->Wait(mBackend->GetFence(), ticket));
+}
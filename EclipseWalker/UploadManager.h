@@ -0,0 +1,93 @@
+#pragma once
+#include "d3dUtil.h"
+#include "UploadBatcher.h"
+#include "GpuMemoryAllocator.h"
+#include <deque>
+#include <memory>
+
+// ==========================================================
+// 񵿱 ε  (  ť)
+// - /ؽó ε带 UploadBatcher    ť   
+// - ȯ Ƽ( ť 潺 ) IsComplete() Ȯ  ׸⿡ 
+//   -> ʱȭ/ ε ߿  尡 ٸ 
+// - ¡   ε ε  ϳ, ġ    
+//  ҽ COMMON ·    ( ť COPY_DEST  °,  COMMON  )
+// ==========================================================
+
+// UploadBatcher    D3D12  ť /
+class CopyQueueUploadBackend : public UploadBackend
+{
+public:
+    CopyQueueUploadBackend(ID3D12Device* device, ID3D12Resource* stagingBuffer);
+    CopyQueueUploadBackend(const CopyQueueUploadBackend& rhs) = delete;
+    CopyQueueUploadBackend& operator=(const CopyQueueUploadBackend& rhs) = delete;
+    ~CopyQueueUploadBackend();
+
+    void SubmitUploads(const UploadCopyCommand* commands, std::size_t count, UploadTicket ticket) override;
+    UploadTicket GetCompletedTicket() override { return mFence->GetCompletedValue(); }
+    void WaitForTicket(UploadTicket ticket) override;
+
+    ID3D12CommandQueue* GetQueue()const { return mQueue.Get(); }
+    ID3D12Fence* GetFence()const { return mFence.Get(); }
+
+private:
+    struct PooledAllocator
+    {
+        ComPtr<ID3D12CommandAllocator> Allocator;
+        UploadTicket Ticket = 0; //  Ƽ  Reset 
+    };
+
+    ID3D12CommandAllocator* AcquireAllocator();
+
+private:
+    ID3D12Device* mDevice = nullptr;
+    ID3D12Resource* mStagingBuffer = nullptr;
+
+    ComPtr<ID3D12CommandQueue> mQueue;
+    ComPtr<ID3D12GraphicsCommandList> mCommandList;
+    ComPtr<ID3D12Fence> mFence;
+    HANDLE mFenceEvent = nullptr;
+
+    std::deque<PooledAllocator> mAllocators; //   (  )
+};
+
+class UploadManager
+{
+public:
+    UploadManager(ID3D12Device* device, UINT64 stagingCapacity = 32ull << 20, UINT64 maxBatchBytes = 4ull << 20);
+    UploadManager(const UploadManager& rhs) = delete;
+    UploadManager& operator=(const UploadManager& rhs) = delete;
+    ~UploadManager();
+
+    UploadTicket UploadBuffer(ID3D12Resource* dst, UINT64 dstOffset, const void* data, UINT64 byteSize);
+    UploadTicket UploadBuffer(const GpuBufferAllocation& dst, const void* data, UINT64 byteSize)
+    {
+        return UploadBuffer(dst.Resource, dst.Offset, data, byteSize);
+    }
+
+    // srcData  긮ҽ ϳ (pData / RowPitch / SlicePitch)
+    UploadTicket UploadTexture(ID3D12Resource* dst, UINT firstSubresource, UINT numSubresources,
+        const D3D12_SUBRESOURCE_DATA* srcData);
+
+    //  :  ε  +  ġ ¡ ȯ
+    void Update();
+    UploadTicket Flush() { return mBatcher->Flush(); }
+
+    bool IsComplete(UploadTicket ticket)const { return mBatcher->IsComplete(ticket); }
+    void WaitForTicket(UploadTicket ticket) { mBatcher->WaitForTicket(ticket); }
+    void WaitIdle() { mBatcher->WaitIdle(); }
+
+    // ̹ ӿ    : CPU  ׷Ƚ ť GPU  ٸ
+    void QueueWait(ID3D12CommandQueue* queue, UploadTicket ticket);
+
+    const UploadBatcher& GetBatcher()const { return *mBatcher; }
+
+private:
+    ID3D12Device* mDevice = nullptr;
+
+    ComPtr<ID3D12Resource> mStagingBuffer;
+    BYTE* mMappedData = nullptr;
+
+    std::unique_ptr<CopyQueueUploadBackend> mBackend;
+    std::unique_ptr<UploadBatcher> mBatcher;
+};
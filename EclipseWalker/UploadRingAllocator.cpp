@@ -0,0 +1,62 @@
+#include "UploadRingAllocator.h"
+#include <cassert>
+
+void UploadRingAllocator::Reset(std::uint64_t capacity)
+{
+    mCapacity = capacity;
+    mHead = 0;
+    mTail = 0;
+    mFrames.clear();
+}
+
+std::uint64_t UploadRingAllocator::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+    assert(mCapacity % alignment == 0);
+
+    if (size == 0 || size > mCapacity)
+        return InvalidOffset;
+
+    // 0.     ó ǳʶ ( ׷ ū û   ɷ  )
+    if (mHead == mTail && mHead % mCapacity != 0)
+    {
+        mHead = (mHead / mCapacity + 1) * mCapacity;
+        mTail = mHead;
+    }
+
+    // 1.  ġ 
+    const std::uint64_t pos = mHead % mCapacity;
+    std::uint64_t offset = (pos + alignment - 1) & ~(alignment - 1);
+    std::uint64_t padding = offset - pos;
+
+    // 2.       0 (     )
+    if (offset + size > mCapacity)
+    {
+        padding = mCapacity - pos;
+        offset = 0;
+    }
+
+    // 3.  ȯ     
+    if (mHead + padding + size - mTail > mCapacity)
+        return InvalidOffset;
+
+    mHead += padding + size;
+    return offset;
+}
+
+void UploadRingAllocator::FinishFrame(std::uint64_t fenceValue)
+{
+    assert(mFrames.empty() || mFrames.back().Fence < fenceValue);
+    mFrames.push_back(FrameMark{ fenceValue, mHead });
+}
+
+void UploadRingAllocator::Retire(std::uint64_t completedFenceValue)
+{
+    while (!mFrames.empty() && mFrames.front().Fence <= completedFenceValue)
+    {
+        //   ǳʶپ End  tail     (tail  ڷ  )
+        if (mFrames.front().End > mTail)
+            mTail = mFrames.front().End;
+        mFrames.pop_front();
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+
+// ==========================================================
+// ε    Ҵ ( 길 , GPU  )
+// - Allocate() head  б⸸  (bump).       0
+// -   FinishFrame(潺 )     ġ 
+// - GPU 潺 ϸ Retire(Ϸ 潺 )  ӱ ° ȯ
+// head / tail   ϴ  ġ,   = ġ % 뷮
+// ==========================================================
+
+class UploadRingAllocator
+{
+public:
+    static constexpr std::uint64_t InvalidOffset = ~0ull;
+
+    // capacity  ū     ( 0 ư   )
+    explicit UploadRingAllocator(std::uint64_t capacity = 0) { Reset(capacity); }
+
+    void Reset(std::uint64_t capacity);
+
+    //   InvalidOffset (   ٸ  Retire ϰ ٽ õ)
+    std::uint64_t Allocate(std::uint64_t size, std::uint64_t alignment);
+
+    // ݱ Ҵ ͵ fenceValue  
+    void FinishFrame(std::uint64_t fenceValue);
+
+    // completedFenceValue  ӵ ȯ
+    void Retire(std::uint64_t completedFenceValue);
+
+    //  GPU    ִ    潺 ( 0)
+    std::uint64_t GetOldestFence()const { return mFrames.empty() ? 0 : mFrames.front().Fence; }
+
+    std::uint64_t GetCapacity()const { return mCapacity; }
+    std::uint64_t GetUsedBytes()const { return mHead - mTail; }
+    std::uint32_t GetFramesInFlight()const { return (std::uint32_t)mFrames.size(); }
+
+private:
+    struct FrameMark
+    {
+        std::uint64_t Fence;
+        std::uint64_t End; //     head
+    };
+
+    std::uint64_t mCapacity = 0;
+    std::uint64_t mHead = 0;
+    std::uint64_t mTail = 0;
+    std::deque<FrameMark> mFrames;
+};
@@ -0,0 +1,258 @@
+#include "UploadRingBenchmark.h"
+#include "UploadRingAllocator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    constexpr std::uint64_t Alignments[] = { 4, 16, 256, 512, 65536 };
+    constexpr std::uint32_t MaxGpuLag = 3;
+
+    struct LiveRange
+    {
+        std::uint64_t Offset;
+        std::uint64_t Size;
+        std::uint64_t Fence; // 0 =  FinishFrame  (̹ )
+    };
+
+    //  ̸ Ȯ /       û 潺  Ѱ 
+    class RequestStream
+    {
+    public:
+        RequestStream(std::uint64_t capacity, std::uint32_t seed)
+            : mRng(seed), mFrameBudget(capacity / 2) {}
+
+        std::uint32_t GpuLag() { return std::uniform_int_distribution<std::uint32_t>(0, MaxGpuLag)(mRng); }
+
+        std::uint32_t AllocationsThisFrame()
+        {
+            mFrameBytes = 0;
+            return std::uniform_int_distribution<std::uint32_t>(1, 24)(mRng);
+        }
+
+        // κ ۰ ( )  ŭ (ؽó )
+        //      뷮   ʰ  ( ٸ ݵ )
+        void NextRequest(std::uint64_t& size, std::uint64_t& alignment)
+        {
+            const bool large = std::uniform_int_distribution<std::uint32_t>(0, 15)(mRng) == 0;
+            size = std::uniform_int_distribution<std::uint64_t>(1, large ? 64 * 1024 : 2048)(mRng);
+            alignment = Alignments[std::uniform_int_distribution<std::uint32_t>(0, large ? 4 : 3)(mRng)];
+
+            const std::uint64_t left = mFrameBudget - std::min(mFrameBudget, mFrameBytes);
+            if (size + alignment > left)
+            {
+                alignment = Alignments[0];
+                size = std::max<std::uint64_t>(left, 2 * alignment) - alignment;
+            }
+            mFrameBytes += size + alignment;
+        }
+
+    private:
+        std::mt19937 mRng;
+        std::uint64_t mFrameBudget;
+        std::uint64_t mFrameBytes = 0;
+    };
+
+    bool Overlaps(const LiveRange& a, std::uint64_t offset, std::uint64_t size)
+    {
+        return offset < a.Offset + a.Size && a.Offset < offset + size;
+    }
+}
+
+namespace UploadRingBenchmark
+{
+    UploadRingBenchmarkResult Run(std::uint64_t capacity, std::uint32_t frames, std::uint32_t seed)
+    {
+        UploadRingBenchmarkResult result;
+        result.Capacity = capacity;
+        result.Frames = frames;
+
+        // 1. Ȯ: Ҵ   ִ  ϰ  潺    
+        {
+            UploadRingAllocator ring(capacity);
+            RequestStream stream(capacity, seed);
+
+            std::vector<LiveRange> live;
+            std::vector<std::uint64_t> inFlight; // FinishFrame  潺 ( )
+            std::uint64_t completed = 0;
+            std::uint64_t lastEnd = 0;
+            double usedSum = 0.0;
+
+            auto retire = [&](std::uint64_t fence)
+            {
+                completed = std::max(completed, fence);
+                ring.Retire(completed);
+
+                live.erase(std::remove_if(live.begin(), live.end(),
+                    [&](const LiveRange& r) { return r.Fence != 0 && r.Fence <= completed; }), live.end());
+                inFlight.erase(std::remove_if(inFlight.begin(), inFlight.end(),
+                    [&](std::uint64_t f) { return f <= completed; }), inFlight.end());
+
+                if (ring.GetFramesInFlight() != inFlight.size() ||
+                    ring.GetOldestFence() != (inFlight.empty() ? 0 : inFlight.front()))
+                {
+                    ++result.Errors;
+                }
+            };
+
+            for (std::uint32_t frame = 0; frame < frames; ++frame)
+            {
+                const std::uint64_t fence = frame + 1;
+
+                // 1-1. GPU   潺 0 ~ 3  ʰ 
+                const std::uint32_t lag = stream.GpuLag();
+                if (fence > lag + 1)
+                    retire(fence - lag - 1);
+
+                // 1-2. ̹  Ҵ
+                const std::uint32_t count = stream.AllocationsThisFrame();
+                for (std::uint32_t i = 0; i < count; ++i)
+                {
+                    std::uint64_t size, alignment;
+                    stream.NextRequest(size, alignment);
+
+                    std::uint64_t offset = ring.Allocate(size, alignment);
+                    while (offset == UploadRingAllocator::InvalidOffset && !inFlight.empty())
+                    {
+                        ++result.Stalls;
+                        retire(inFlight.front());
+                        offset = ring.Allocate(size, alignment);
+                    }
+
+                    // ̹  δ 뷮 ݵ  ǹǷ  ٸ ڿ ݵ  
+                    if (offset == UploadRingAllocator::InvalidOffset)
+                    {
+                        ++result.Errors;
+                        continue;
+                    }
+
+                    if (offset % alignment != 0 || offset + size > capacity)
+                        ++result.Errors;
+                    for (const LiveRange& r : live)
+                    {
+                        if (Overlaps(r, offset, size))
+                            ++result.Errors;
+                    }
+
+                    if (offset < lastEnd)
+                        ++result.Wraps;
+                    lastEnd = offset + size;
+
+                    live.push_back(LiveRange{ offset, size, 0 });
+                    ++result.Allocations;
+                }
+
+                // 1-3.  
+                ring.FinishFrame(fence);
+                for (LiveRange& r : live)
+                {
+                    if (r.Fence == 0)
+                        r.Fence = fence;
+                }
+                inFlight.push_back(fence);
+
+                std::uint64_t liveBytes = 0;
+                for (const LiveRange& r : live)
+                    liveBytes += r.Size;
+                if (ring.GetUsedBytes() < liveBytes || ring.GetUsedBytes() > capacity)
+                    ++result.Errors;
+                usedSum += (double)ring.GetUsedBytes() / (double)capacity;
+            }
+
+            // 1-4. GPU     ȯ
+            retire(frames);
+            if (ring.GetUsedBytes() != 0 || ring.GetFramesInFlight() != 0 || !live.empty())
+                ++result.Errors;
+
+            result.AverageUsed = frames > 0 ? usedSum / frames : 0.0;
+        }
+
+        // 2. :  û  Ȯ  (Allocate / FinishFrame / Retire )
+        {
+            UploadRingAllocator ring(capacity);
+            RequestStream stream(capacity, seed);
+
+            std::vector<std::uint64_t> sizes, alignments;
+            std::vector<std::uint32_t> counts, lags;
+            counts.reserve(frames);
+            lags.reserve(frames);
+            for (std::uint32_t frame = 0; frame < frames; ++frame)
+            {
+                lags.push_back(stream.GpuLag());
+                counts.push_back(stream.AllocationsThisFrame());
+                for (std::uint32_t i = 0; i < counts.back(); ++i)
+                {
+                    std::uint64_t size, alignment;
+                    stream.NextRequest(size, alignment);
+                    sizes.push_back(size);
+                    alignments.push_back(alignment);
+                }
+            }
+
+            std::uint64_t sink = 0;
+            std::size_t next = 0;
+            Clock::time_point t0 = Clock::now();
+            for (std::uint32_t frame = 0; frame < frames; ++frame)
+            {
+                const std::uint64_t fence = frame + 1;
+                if (fence > lags[frame] + 1)
+                    ring.Retire(fence - lags[frame] - 1);
+
+                for (std::uint32_t i = 0; i < counts[frame]; ++i, ++next)
+                {
+                    std::uint64_t offset = ring.Allocate(sizes[next], alignments[next]);
+                    while (offset == UploadRingAllocator::InvalidOffset && ring.GetFramesInFlight() > 0)
+                    {
+                        ring.Retire(ring.GetOldestFence());
+                        offset = ring.Allocate(sizes[next], alignments[next]);
+                    }
+                    sink += offset;
+                }
+                ring.FinishFrame(fence);
+            }
+            Clock::time_point t1 = Clock::now();
+
+            result.NsPerAllocation = next > 0 ? ElapsedMs(t0, t1) * 1e6 / (double)next : 0.0;
+            if (sink == 0)
+                ++result.Errors; // ȭ   ʰ
+        }
+
+        result.Valid = result.Errors == 0 && result.Wraps > 0;
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[UploadRingBenchmark]\n";
+        report += "  capacity(KB)  frames  allocs  wraps  stalls  used(%)  ns/alloc  valid\n";
+
+        //   GPU   ٸ
+        bool valid = true;
+        for (std::uint64_t capacity : { 256ull << 10, 1ull << 20, 4ull << 20 })
+        {
+            UploadRingBenchmarkResult r = Run(capacity, 20000);
+            valid = valid && r.Valid;
+
+            char line[192];
+            snprintf(line, sizeof(line), "%14llu %7u %7llu %6llu %7llu %8.1f %9.1f  %s\n",
+                (unsigned long long)(r.Capacity >> 10), r.Frames, (unsigned long long)r.Allocations,
+                (unsigned long long)r.Wraps, (unsigned long long)r.Stalls, r.AverageUsed * 100.0,
+                r.NsPerAllocation, r.Valid ? "yes" : "NO");
+            report += line;
+        }
+
+        if (allValid)
+            *allValid = valid;
+        return report;
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+// ε  Ҵ Ȯ /  (߿, 帮, GPU )
+// frames   Ӹ ũ /   Ҵ ϰ, GPU Ϸ 潺 0 ~ 3  ʰ 
+//      ٸ  ġ Retire   ٽ õ (stall)
+//  Ȯ ( ִ    ִ ׸ 𵨰 ):
+//   1.  , 뷮 ,  ȯ    ġ 
+//   2. Retire  Ϸ 潺 Ӹ ȯ, GetOldestFence / GetFramesInFlight  𵨰 
+//   3.  0  ư 찡  ,  ȯϸ 뷮 0
+// ==========================================================
+
+struct UploadRingBenchmarkResult
+{
+    std::uint64_t Capacity = 0;
+    std::uint32_t Frames = 0;
+
+    std::uint64_t Allocations = 0;
+    std::uint64_t Wraps = 0;            //  0  ư Ƚ
+    std::uint64_t Stalls = 0;           //   GPU  ٸ Ƚ
+    double AverageUsed = 0.0;           //   뷮 / 뷮
+    double NsPerAllocation = 0.0;       // Ȯ    ٽ  
+
+    std::uint64_t Errors = 0;           // 𵨰 ٸ  (ħ, , 潺 )
+    bool Valid = false;
+};
+
+namespace UploadRingBenchmark
+{
+    UploadRingBenchmarkResult Run(std::uint64_t capacity, std::uint32_t frames, std::uint32_t seed = 33);
+
+    // 256 KB / 1 MB / 4 MB x 20000 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
@@ -0,0 +1,290 @@
+#include "VertexCompression.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    //   ġ (VertexTypes  )
+    struct SourcePosColor
+    {
+        float Pos[3];
+        float Color[4];
+    };
+    static_assert(sizeof(SourcePosColor) == 28, "SourcePosColor must match VertexPosColor");
+
+    struct SourcePosNormalTex
+    {
+        float Pos[3];
+        float Normal[3];
+        float TexC[2];
+    };
+    static_assert(sizeof(SourcePosNormalTex) == 32, "SourcePosNormalTex must match VertexPosNormalTex");
+
+    struct PackedPosColor
+    {
+        std::uint16_t Pos[4];
+        std::uint32_t Color;
+    };
+    static_assert(sizeof(PackedPosColor) == 12, "PackedPosColor must match VertexPackedPosColor");
+
+    struct PackedPosNormalTex
+    {
+        std::uint16_t Pos[4];
+        std::int16_t Normal[2];
+        std::uint16_t TexC[2];
+    };
+    static_assert(sizeof(PackedPosNormalTex) == 16, "PackedPosNormalTex must match VertexPackedPosNormalTex");
+
+    std::uint8_t ToUnorm8(float value)
+    {
+        return (std::uint8_t)std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+    }
+
+    std::int16_t ToSnorm16(float value)
+    {
+        return (std::int16_t)std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f);
+    }
+
+    // D3D SNORM Ģ: -32768  -1
+    float FromSnorm16(std::int16_t value)
+    {
+        return std::max((float)value / 32767.0f, -1.0f);
+    }
+
+    float SignNotZero(float value)
+    {
+        return value >= 0.0f ? 1.0f : -1.0f;
+    }
+}
+
+PositionQuantization PositionQuantization::FromBounds(const float boundsMin[3], const float boundsMax[3])
+{
+    PositionQuantization quantization;
+    for (int a = 0; a < 3; ++a)
+    {
+        quantization.Bias[a] = boundsMin[a];
+        quantization.Scale[a] = std::max(boundsMax[a] - boundsMin[a], 0.0f);
+    }
+    return quantization;
+}
+
+void PositionQuantization::Encode(const float position[3], std::uint16_t out[4])const
+{
+    for (int a = 0; a < 3; ++a)
+    {
+        // β 0    Bias
+        const float t = Scale[a] > 0.0f ? (position[a] - Bias[a]) / Scale[a] : 0.0f;
+        out[a] = (std::uint16_t)std::lround(std::clamp(t, 0.0f, 1.0f) * 65535.0f);
+    }
+    out[3] = 0;
+}
+
+void PositionQuantization::Decode(const std::uint16_t packed[4], float out[3])const
+{
+    for (int a = 0; a < 3; ++a)
+        out[a] = Bias[a] + (float)packed[a] / 65535.0f * Scale[a];
+}
+
+namespace VertexCompression
+{
+    std::uint16_t FloatToHalf(float value)
+    {
+        std::uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        const std::uint32_t sign = (bits >> 16) & 0x8000u;
+        std::uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+        // 1. Inf / NaN (NaN   NaN )
+        if (magnitude >= 0x7F800000u)
+            return (std::uint16_t)(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x200u : 0u));
+
+        // 2. 65520 ̻ ݿøϸ Inf
+        if (magnitude >= 0x477FF000u)
+            return (std::uint16_t)(sign | 0x7C00u);
+
+        // 3. 2^-14 ̸  : 2^-24  ݿø (⺻ ݿø  =  ¦)
+        if (magnitude < 0x38800000u)
+        {
+            float absValue;
+            memcpy(&absValue, &magnitude, sizeof(absValue));
+            return (std::uint16_t)(sign | (std::uint32_t)std::nearbyint(absValue * 16777216.0f));
+        }
+
+        // 4.  :   127 -> 15,  13 Ʈ  ¦ ݿø
+        const std::uint32_t mantissaOdd = (magnitude >> 13) & 1u;
+        magnitude += 0xC8000000u + 0x0FFFu + mantissaOdd;
+        return (std::uint16_t)(sign | (magnitude >> 13));
+    }
+
+    float HalfToFloat(std::uint16_t value)
+    {
+        const std::uint32_t sign = (std::uint32_t)(value & 0x8000u) << 16;
+        const std::uint32_t exponent = (value >> 10) & 0x1Fu;
+        const std::uint32_t mantissa = value & 0x3FFu;
+
+        std::uint32_t bits;
+        if (exponent == 0)
+        {
+            // 0 /  
+            const float magnitude = (float)mantissa * (1.0f / 16777216.0f);
+            return sign != 0 ? -magnitude : magnitude;
+        }
+        else if (exponent == 31)
+        {
+            bits = sign | 0x7F800000u | (mantissa << 13);
+        }
+        else
+        {
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        }
+
+        float result;
+        memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    std::uint32_t PackColor(const float rgba[4])
+    {
+        return (std::uint32_t)ToUnorm8(rgba[0]) |
+            ((std::uint32_t)ToUnorm8(rgba[1]) << 8) |
+            ((std::uint32_t)ToUnorm8(rgba[2]) << 16) |
+            ((std::uint32_t)ToUnorm8(rgba[3]) << 24);
+    }
+
+    void UnpackColor(std::uint32_t packed, float rgba[4])
+    {
+        for (int c = 0; c < 4; ++c)
+            rgba[c] = (float)((packed >> (c * 8)) & 0xFFu) / 255.0f;
+    }
+
+    void EncodeOctahedral(const float normal[3], std::int16_t out[2])
+    {
+        // 1. ȸü(|x|+|y|+|z| = 1) 
+        const float l1 = std::fabs(normal[0]) + std::fabs(normal[1]) + std::fabs(normal[2]);
+        if (l1 <= 0.0f)
+        {
+            out[0] = out[1] = 0; // (0, 0, 1)  ڵ
+            return;
+        }
+
+        float x = normal[0] / l1;
+        float y = normal[1] / l1;
+
+        // 2. Ʒ ݱ 밢 ٱ 
+        if (normal[2] < 0.0f)
+        {
+            const float foldedX = (1.0f - std::fabs(y)) * SignNotZero(x);
+            const float foldedY = (1.0f - std::fabs(x)) * SignNotZero(y);
+            x = foldedX;
+            y = foldedY;
+        }
+
+        out[0] = ToSnorm16(x);
+        out[1] = ToSnorm16(y);
+    }
+
+    void DecodeOctahedral(const std::int16_t packed[2], float out[3])
+    {
+        float x = FromSnorm16(packed[0]);
+        float y = FromSnorm16(packed[1]);
+        const float z = 1.0f - std::fabs(x) - std::fabs(y);
+
+        //  Ʒ ݱ 
+        const float t = std::max(-z, 0.0f);
+        x += x >= 0.0f ? -t : t;
+        y += y >= 0.0f ? -t : t;
+
+        const float invLength = 1.0f / std::sqrt(x * x + y * y + z * z);
+        out[0] = x * invLength;
+        out[1] = y * invLength;
+        out[2] = z * invLength;
+    }
+
+    MeshFormat::VertexFormat GetPackedFormat(MeshFormat::VertexFormat format)
+    {
+        switch (format)
+        {
+        case MeshFormat::VertexFormat::PosColor:     return MeshFormat::VertexFormat::PackedPosColor;
+        case MeshFormat::VertexFormat::PosNormalTex: return MeshFormat::VertexFormat::PackedPosNormalTex;
+        default:                                     return format;
+        }
+    }
+
+    bool CompressVertices(MeshCookSource& source)
+    {
+        using MeshFormat::VertexFormat;
+
+        const VertexFormat packedFormat = GetPackedFormat(source.VertexLayout);
+        if (packedFormat == source.VertexLayout)
+            return MeshFormat::IsPacked(source.VertexLayout);
+
+        const std::uint32_t vertexCount = source.GetVertexCount();
+        const std::uint32_t srcStride = MeshFormat::GetVertexStride(source.VertexLayout);
+
+        // 1. ȭ  = ġ AABB ( ü   Pos)
+        for (int a = 0; a < 3; ++a)
+        {
+            source.QuantizeMin[a] = vertexCount > 0 ? INFINITY : 0.0f;
+            source.QuantizeMax[a] = vertexCount > 0 ? -INFINITY : 0.0f;
+        }
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+        {
+            const float* p = reinterpret_cast<const float*>(source.Vertices.data() + (std::size_t)v * srcStride);
+            for (int a = 0; a < 3; ++a)
+            {
+                source.QuantizeMin[a] = std::min(source.QuantizeMin[a], p[a]);
+                source.QuantizeMax[a] = std::max(source.QuantizeMax[a], p[a]);
+            }
+        }
+        const PositionQuantization quantization = PositionQuantization::FromBounds(source.QuantizeMin, source.QuantizeMax);
+
+        // 2. ڵ
+        std::vector<std::uint8_t> packed((std::size_t)vertexCount * MeshFormat::GetVertexStride(packedFormat));
+
+        if (source.VertexLayout == VertexFormat::PosColor)
+        {
+            const SourcePosColor* src = reinterpret_cast<const SourcePosColor*>(source.Vertices.data());
+            PackedPosColor* dst = reinterpret_cast<PackedPosColor*>(packed.data());
+            for (std::uint32_t v = 0; v < vertexCount; ++v)
+            {
+                quantization.Encode(src[v].Pos, dst[v].Pos);
+                dst[v].Color = PackColor(src[v].Color);
+            }
+        }
+        else
+        {
+            const SourcePosNormalTex* src = reinterpret_cast<const SourcePosNormalTex*>(source.Vertices.data());
+            PackedPosNormalTex* dst = reinterpret_cast<PackedPosNormalTex*>(packed.data());
+            for (std::uint32_t v = 0; v < vertexCount; ++v)
+            {
+                quantization.Encode(src[v].Pos, dst[v].Pos);
+                EncodeOctahedral(src[v].Normal, dst[v].Normal);
+                dst[v].TexC[0] = FloatToHalf(src[v].TexC[0]);
+                dst[v].TexC[1] = FloatToHalf(src[v].TexC[1]);
+            }
+        }
+
+        source.VertexLayout = packedFormat;
+        source.Vertices = std::move(packed);
+        return true;
+    }
+
+    void DecodePosition(const MeshCookSource& source, std::uint32_t vertex, float out[3])
+    {
+        const std::uint8_t* p = source.Vertices.data() + (std::size_t)vertex * MeshFormat::GetVertexStride(source.VertexLayout);
+
+        if (MeshFormat::IsPacked(source.VertexLayout))
+        {
+            //       UNORM16x4 ġ
+            std::uint16_t q[4];
+            memcpy(q, p, sizeof(q));
+            PositionQuantization::FromBounds(source.QuantizeMin, source.QuantizeMax).Decode(q, out);
+        }
+        else
+        {
+            memcpy(out, p, sizeof(float) * 3);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "MeshCooker.h"
+
+// ==========================================================
+//   (ŷ ܰ ڵ + /ġũ ڵ)
+// - ġ: ޽ AABB  UNORM16 ( <=  / 131070)
+// - : ȸü ڵ SNORM16x2 ( 0.05 ̸)
+// - UV: half (ݿø   ¦)
+// - : RGBA8 UNORM
+// PosColor 28 -> 12 Ʈ, PosNormalTex 32 -> 16 Ʈ
+// GPU  ڵ Է ġ (UNORM/SNORM/FLOAT16) ְ
+// ġ ȭ(Scale, Bias)  Ŀ ļ 
+// ==========================================================
+
+// decoded = Bias + unorm * Scale (unorm = q / 65535)
+struct PositionQuantization
+{
+    float Bias[3] = { 0.0f, 0.0f, 0.0f };
+    float Scale[3] = { 1.0f, 1.0f, 1.0f };
+
+    static PositionQuantization FromBounds(const float boundsMin[3], const float boundsMax[3]);
+
+    void Encode(const float position[3], std::uint16_t out[4])const;
+    void Decode(const std::uint16_t packed[4], float out[3])const;
+};
+
+namespace VertexCompression
+{
+    std::uint16_t FloatToHalf(float value);
+    float HalfToFloat(std::uint16_t value);
+
+    std::uint32_t PackColor(const float rgba[4]);
+    void UnpackColor(std::uint32_t packed, float rgba[4]);
+
+    // normal  ̰ 0  ƴϸ ȭ   ־ 
+    void EncodeOctahedral(const float normal[3], std::int16_t out[2]);
+    void DecodeOctahedral(const std::int16_t packed[2], float out[3]);
+
+    //   -> ϴ   (̹   ״)
+    MeshFormat::VertexFormat GetPackedFormat(MeshFormat::VertexFormat format);
+
+    // source     ٲٰ ȭ  source.QuantizeMin/Max  
+    //    ̸ false (source  ״)
+    bool CompressVertices(MeshCookSource& source);
+
+    //  ġ float  ( ̸ QuantizeMin/Max  ȭ)
+    void DecodePosition(const MeshCookSource& source, std::uint32_t vertex, float out[3]);
+}
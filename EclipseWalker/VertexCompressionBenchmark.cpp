@@ -0,0 +1,171 @@
+#include "VertexCompressionBenchmark.h"
+#include "VertexCompression.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedMs(Clock::time_point begin, Clock::time_point end)
+    {
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+
+    struct PosNormalTex
+    {
+        float Pos[3];
+        float Normal[3];
+        float TexC[2];
+    };
+
+    struct PosColor
+    {
+        float Pos[3];
+        float Color[4];
+    };
+
+    template <typename T>
+    MeshCookSource MakeSource(MeshFormat::VertexFormat layout, const std::vector<T>& vertices)
+    {
+        MeshCookSource source;
+        source.VertexLayout = layout;
+        source.Vertices.resize(vertices.size() * sizeof(T));
+        memcpy(source.Vertices.data(), vertices.data(), source.Vertices.size());
+        return source;
+    }
+}
+
+namespace VertexCompressionBenchmark
+{
+    VertexCompressionBenchmarkResult Run(std::uint32_t vertexCount)
+    {
+        VertexCompressionBenchmarkResult result;
+        result.VertexCount = vertexCount;
+
+        // 1.   (ġ   100 ¥  ,     յ)
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> texCoord(0.0f, 4.0f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::normal_distribution<float> gaussian(0.0f, 1.0f);
+
+        std::vector<PosNormalTex> lit(vertexCount);
+        std::vector<PosColor> colored(vertexCount);
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+        {
+            float n[3] = { gaussian(rng), gaussian(rng), gaussian(rng) };
+            const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) + 1e-20f;
+
+            for (int a = 0; a < 3; ++a)
+            {
+                lit[v].Pos[a] = colored[v].Pos[a] = position(rng);
+                lit[v].Normal[a] = n[a] / length;
+            }
+            lit[v].TexC[0] = texCoord(rng);
+            lit[v].TexC[1] = texCoord(rng);
+            for (int c = 0; c < 4; ++c)
+                colored[v].Color[c] = unit(rng);
+        }
+
+        // 2. ڵ
+        MeshCookSource litSource = MakeSource(MeshFormat::VertexFormat::PosNormalTex, lit);
+        MeshCookSource colorSource = MakeSource(MeshFormat::VertexFormat::PosColor, colored);
+
+        auto t0 = Clock::now();
+        VertexCompression::CompressVertices(litSource);
+        auto t1 = Clock::now();
+        VertexCompression::CompressVertices(colorSource);
+        result.EncodeMs = ElapsedMs(t0, t1);
+
+        result.PosNormalTexBytes = MeshFormat::GetVertexStride(MeshFormat::VertexFormat::PosNormalTex);
+        result.PackedPosNormalTexBytes = MeshFormat::GetVertexStride(litSource.VertexLayout);
+        result.PosColorBytes = MeshFormat::GetVertexStride(MeshFormat::VertexFormat::PosColor);
+        result.PackedPosColorBytes = MeshFormat::GetVertexStride(colorSource.VertexLayout);
+
+        // 3. ڵ (CPU   , GPU  Է Ⱑ  Ģ ǯ)
+        const PositionQuantization quantization = PositionQuantization::FromBounds(litSource.QuantizeMin, litSource.QuantizeMax);
+
+        std::vector<PosNormalTex> decoded(vertexCount);
+        const std::uint8_t* packed = litSource.Vertices.data();
+        const std::uint32_t packedStride = result.PackedPosNormalTexBytes;
+
+        t0 = Clock::now();
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+        {
+            const std::uint8_t* p = packed + (std::size_t)v * packedStride;
+            std::uint16_t q[4];
+            std::int16_t normal[2];
+            std::uint16_t texC[2];
+            memcpy(q, p, sizeof(q));
+            memcpy(normal, p + 8, sizeof(normal));
+            memcpy(texC, p + 12, sizeof(texC));
+
+            quantization.Decode(q, decoded[v].Pos);
+            VertexCompression::DecodeOctahedral(normal, decoded[v].Normal);
+            decoded[v].TexC[0] = VertexCompression::HalfToFloat(texC[0]);
+            decoded[v].TexC[1] = VertexCompression::HalfToFloat(texC[1]);
+        }
+        t1 = Clock::now();
+        result.DecodeMs = ElapsedMs(t0, t1);
+
+        // 4. 
+        const float extent = std::max({ quantization.Scale[0], quantization.Scale[1], quantization.Scale[2], 1e-20f });
+        for (std::uint32_t v = 0; v < vertexCount; ++v)
+        {
+            float dot = 0.0f;
+            for (int a = 0; a < 3; ++a)
+            {
+                result.MaxPositionError = std::max(result.MaxPositionError, std::fabs(decoded[v].Pos[a] - lit[v].Pos[a]) / extent);
+                dot += decoded[v].Normal[a] * lit[v].Normal[a];
+            }
+            const float angle = std::acos(std::clamp(dot, -1.0f, 1.0f)) * 57.2957795f;
+            result.MaxNormalErrorDeg = std::max(result.MaxNormalErrorDeg, angle);
+
+            for (int t = 0; t < 2; ++t)
+                result.MaxTexCoordError = std::max(result.MaxTexCoordError, std::fabs(decoded[v].TexC[t] - lit[v].TexC[t]));
+
+            std::uint32_t color;
+            memcpy(&color, colorSource.Vertices.data() + (std::size_t)v * result.PackedPosColorBytes + 8, sizeof(color));
+            float rgba[4];
+            VertexCompression::UnpackColor(color, rgba);
+            for (int c = 0; c < 4; ++c)
+                result.MaxColorError = std::max(result.MaxColorError, std::fabs(rgba[c] - colored[v].Color[c]));
+        }
+
+        return result;
+    }
+
+    std::string RunDefaultSuite(bool* allValid)
+    {
+        std::string report = "[VertexCompressionBenchmark]\n";
+        report += "     verts  PNT(B)  PC(B)  enc(ms) dec(ms)  enc(Mv/s) dec(Mv/s)  pos(rel)   nrm(deg)  uv       color\n";
+
+        const std::uint32_t counts[] = { 65536, 1u << 20 };
+        for (std::uint32_t count : counts)
+        {
+            VertexCompressionBenchmarkResult r = Run(count);
+
+            char line[224];
+            snprintf(line, sizeof(line), "%10u %3u->%-3u %2u->%-2u %8.2f %7.2f %10.1f %9.1f  %.2e  %.5f  %.2e %.4f\n",
+                r.VertexCount,
+                r.PosNormalTexBytes, r.PackedPosNormalTexBytes,
+                r.PosColorBytes, r.PackedPosColorBytes,
+                r.EncodeMs, r.DecodeMs,
+                r.EncodeMs > 0.0 ? r.VertexCount / (r.EncodeMs * 1000.0) : 0.0,
+                r.DecodeMs > 0.0 ? r.VertexCount / (r.DecodeMs * 1000.0) : 0.0,
+                r.MaxPositionError, r.MaxNormalErrorDeg, r.MaxTexCoordError, r.MaxColorError);
+            report += line;
+        }
+
+        // ð  ǥ Ʋ  ִ  
+        if (allValid)
+            *allValid = true;
+        return report;
+    }
+}
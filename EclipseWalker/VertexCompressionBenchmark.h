@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ==========================================================
+//   Ȯ/ӵ  (߿, CPU )
+//  PosNormalTex / PosColor  ߴٰ ٽ Ǯ
+// ִ  ڵ/ڵ ó 
+// ==========================================================
+
+struct VertexCompressionBenchmarkResult
+{
+    std::uint32_t VertexCount = 0;
+
+    std::uint32_t PosNormalTexBytes = 0; //  ϳ ( -> )
+    std::uint32_t PackedPosNormalTexBytes = 0;
+    std::uint32_t PosColorBytes = 0;
+    std::uint32_t PackedPosColorBytes = 0;
+
+    double EncodeMs = 0.0; // PosNormalTex ü
+    double DecodeMs = 0.0;
+
+    float MaxPositionError = 0.0f;  // ޽   
+    float MaxNormalErrorDeg = 0.0f;
+    float MaxTexCoordError = 0.0f;  // UV  ([0, 4] )
+    float MaxColorError = 0.0f;     // [0, 1] 
+};
+
+namespace VertexCompressionBenchmark
+{
+    VertexCompressionBenchmarkResult Run(std::uint32_t vertexCount);
+
+    // 64k / 1M 
+    // allValid     ߴ  ( --bench-*   ڵ)
+    std::string RunDefaultSuite(bool* allValid = nullptr);
+}
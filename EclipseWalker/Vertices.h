@@ -1,5 +1,6 @@
 #pragma once
 #include <DirectXMath.h>
+#include <cstdint>
 
 using namespace DirectX;
 
@@ -12,11 +13,10 @@ namespace VertexTypes
         XMFLOAT4 Color;
     };
 
-    // 2. ؽó   ִ  (߿  )
+    // 2. ؽó   (  - Ʈ, ī̹ڽ)
     struct VertexPosTex
     {
         XMFLOAT3 Pos;
-        XMFLOAT3 Normal;
         XMFLOAT2 TexC;
     };
 
@@ -27,4 +27,20 @@ namespace VertexTypes
         XMFLOAT3 Normal;
         XMFLOAT2 TexC;
     };
-}
\ No newline at end of file
+
+    // 4.   (ŷ ޽, VertexCompression.h  ڵ)
+    // ġ ޽   UNORM16 (ȭ   տ ), Pos[3]  ä
+    struct VertexPackedPosColor
+    {
+        std::uint16_t Pos[4];
+        std::uint32_t Color; // RGBA8 (R   Ʈ)
+    };
+
+    //  ȸü ڵ SNORM16x2 (̴ z = 1 - |x| - |y|  ǵ), UV  half
+    struct VertexPackedPosNormalTex
+    {
+        std::uint16_t Pos[4];
+        std::int16_t Normal[2];
+        std::uint16_t TexC[2];
+    };
+}
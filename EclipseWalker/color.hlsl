@@ -1,6 +1,18 @@
-cbuffer cbPerObject : register(b0)
+//  ť   ä νϽ  (ġ ϳ =  )
+struct InstanceData
 {
-    float4x4 gWorldViewProj; 
+    float4x4 World;
+};
+StructuredBuffer<InstanceData> gInstances : register(t0);
+
+cbuffer cbPerDraw : register(b0)
+{
+    uint gInstanceBase; // ġ ù νϽ ȣ (SV_InstanceID  0  )
+};
+
+cbuffer cbPass : register(b1)
+{
+    float4x4 gViewProj;
 };
 
 struct VertexIn
@@ -18,11 +30,13 @@ struct VertexOut
 // ---------------------------------------------------------
 // ؽ ̴ (Vertex Shader)
 // ---------------------------------------------------------
-VertexOut VS(VertexIn vin)
+VertexOut VS(VertexIn vin, uint instanceID : SV_InstanceID)
 {
     VertexOut vout;
 
-    vout.PosH = mul(float4(vin.PosL, 1.0f), gWorldViewProj);
+    float4x4 world = gInstances[gInstanceBase + instanceID].World;
+    float4 posW = mul(float4(vin.PosL, 1.0f), world);
+    vout.PosH = mul(posW, gViewProj);
 
     vout.Color = vin.Color;
 
@@ -1,4 +1,8 @@
 #pragma once
+// windows.h  min/max ũΰ std::min / std::max  ߸ ʰ
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
 #include <windows.h>
 #include <wrl.h>
 #include <dxgi1_4.h>
@@ -69,61 +73,4 @@ public:
         const D3D_SHADER_MACRO* defines,
         const std::string& entrypoint,
         const std::string& target);
-
-    // ⺻    
-    static ComPtr<ID3D12Resource> CreateDefaultBuffer(
-        ID3D12Device* device,
-        ID3D12GraphicsCommandList* cmdList,
-        const void* initData,
-        UINT64 byteSize,
-        ComPtr<ID3D12Resource>& uploadBuffer)
-    {
-        ComPtr<ID3D12Resource> defaultBuffer;
-
-        // ӽ ü   (L-value )
-        auto heapPropsDefault = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
-        auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(byteSize);
-
-        // 1.  GPU    (Default Heap) 
-        ThrowIfFailed(device->CreateCommittedResource(
-            &heapPropsDefault, 
-            D3D12_HEAP_FLAG_NONE,
-            &bufferDesc,       
-            D3D12_RESOURCE_STATE_COMMON,
-            nullptr,
-            IID_PPV_ARGS(defaultBuffer.GetAddressOf())));
-
-        auto heapPropsUpload = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-        // 2. CPU -> GPU  ӽ  (Upload Heap) 
-        ThrowIfFailed(device->CreateCommittedResource(
-            &heapPropsUpload,
-            D3D12_HEAP_FLAG_NONE,
-            &bufferDesc,     
-            D3D12_RESOURCE_STATE_GENERIC_READ,
-            nullptr,
-            IID_PPV_ARGS(uploadBuffer.GetAddressOf())));
-
-        // 3.   غ
-        D3D12_SUBRESOURCE_DATA subResourceData = {};
-        subResourceData.pData = initData;
-        subResourceData.RowPitch = byteSize;
-        subResourceData.SlicePitch = subResourceData.RowPitch;
-
-        // ҽ 踮  
-        auto barrier1 = CD3DX12_RESOURCE_BARRIER::Transition(defaultBuffer.Get(),
-            D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST);
-
-        // 4.    
-        cmdList->ResourceBarrier(1, &barrier1); 
-
-        UpdateSubresources<1>(cmdList, defaultBuffer.Get(), uploadBuffer.Get(), 0, 0, 1, &subResourceData);
-
-        //  ° 踮  
-        auto barrier2 = CD3DX12_RESOURCE_BARRIER::Transition(defaultBuffer.Get(),
-            D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_GENERIC_READ);
-
-        cmdList->ResourceBarrier(1, &barrier2); 
-
-        return defaultBuffer;
-    }
 };
\ No newline at end of file
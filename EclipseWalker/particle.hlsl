@@ -0,0 +1,53 @@
+// CPU ƼŬ  (ParticleSystem::WriteVertices  ε   ״)
+// ƼŬ ϳ = νϽ ϳ,  4  SV_VertexID  𼭸  ī޶  ħ
+struct ParticleVertex
+{
+    float3 Position;
+    float Size;     //  ũ
+    uint Color;     // RGBA8 (R   Ʈ)
+};
+StructuredBuffer<ParticleVertex> gParticles : register(t0);
+
+cbuffer cbPass : register(b1)
+{
+    float4x4 gViewProj;
+    float4 gCameraRight;
+    float4 gCameraUp;
+};
+
+struct VertexOut
+{
+    float4 PosH   : SV_POSITION;
+    float2 Corner : TEXCOORD;
+    float4 Color  : COLOR;
+};
+
+// ---------------------------------------------------------
+// ؽ ̴ (Vertex Shader)
+// ---------------------------------------------------------
+VertexOut VS(uint vertexID : SV_VertexID, uint instanceID : SV_InstanceID)
+{
+    VertexOut vout;
+
+    ParticleVertex p = gParticles[instanceID];
+
+    // 0 (-1, -1), 1 (1, -1), 2 (-1, 1), 3 (1, 1)
+    float2 corner = float2((vertexID & 1) ? 1.0f : -1.0f, (vertexID & 2) ? 1.0f : -1.0f);
+    float3 posW = p.Position + (corner.x * gCameraRight.xyz + corner.y * gCameraUp.xyz) * p.Size;
+    vout.PosH = mul(float4(posW, 1.0f), gViewProj);
+    vout.Corner = corner;
+
+    vout.Color = float4(p.Color & 0xFF, (p.Color >> 8) & 0xFF, (p.Color >> 16) & 0xFF, p.Color >> 24) / 255.0f;
+
+    return vout;
+}
+
+// ---------------------------------------------------------
+// ȼ ̴ (Pixel Shader)
+// ---------------------------------------------------------
+float4 PS(VertexOut pin) : SV_Target
+{
+    //  ڸ ε巴  
+    float fade = saturate(1.0f - dot(pin.Corner, pin.Corner));
+    return float4(pin.Color.rgb, pin.Color.a * fade * fade);
+}